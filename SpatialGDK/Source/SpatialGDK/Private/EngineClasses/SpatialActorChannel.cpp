@@ -206,6 +206,7 @@ void USpatialActorChannel::Init(UNetConnection* InConnection, int32 ChannelIndex
 	bCreatingNewEntity = false;
 	EntityId = SpatialConstants::INVALID_ENTITY_ID;
 	bInterestDirty = false;
+	LastSentInterest.Reset();
 	bNetOwned = false;
 	bIsAuthClient = false;
 	bIsAuthServer = false;
@@ -597,6 +598,7 @@ int64 USpatialActorChannel::ReplicateActor()
 	}
 
 	ReplicationBytesWritten = 0;
+	const int32 NumDeferredUpdates = Sender->GetNumDeferredComponentUpdates();
 
 	// If any properties have changed, send a component update.
 	if (bCreatingNewEntity || RepChanged.Num() > 0 || HandoverChangeState.Num() > 0)
@@ -721,7 +723,8 @@ int64 USpatialActorChannel::ReplicateActor()
 
 	bForceCompareProperties = false;		// Only do this once per frame when set
 
-	if (ReplicationBytesWritten > 0)
+	// Bytes for deferred component updates are counted by the net driver when they are flushed.
+	if (ReplicationBytesWritten > 0 || Sender->GetNumDeferredComponentUpdates() > NumDeferredUpdates)
 	{
 		INC_DWORD_STAT_BY(STAT_NumReplicatedActors, 1);
 	}
@@ -973,21 +976,8 @@ FHandoverChangeState USpatialActorChannel::GetHandoverChangeList(TArray<uint8>&
 
 	const FClassInfo& ClassInfo = NetDriver->ClassInfoManager->GetOrCreateClassInfoByClass(Object->GetClass());
 
-	uint32 ShadowDataOffset = 0;
-	for (const FHandoverPropertyInfo& PropertyInfo : ClassInfo.HandoverProperties)
-	{
-		ShadowDataOffset = Align(ShadowDataOffset, PropertyInfo.Property->GetMinAlignment());
-
-		const uint8* Data = (uint8*)Object + PropertyInfo.Offset;
-		uint8* StoredData = ShadowData.GetData() + ShadowDataOffset;
-		// Compare and assign.
-		if (bCreatingNewEntity || !PropertyInfo.Property->Identical(StoredData, Data))
-		{
-			HandoverChanged.Add(PropertyInfo.Handle);
-			PropertyInfo.Property->CopySingleValue(StoredData, Data);
-		}
-		ShadowDataOffset += PropertyInfo.Property->ElementSize;
-	}
+	// Compare and assign.
+	ClassInfo.HandoverLayout.GetChanges(ClassInfo.HandoverProperties, ShadowData.GetData(), reinterpret_cast<const uint8*>(Object), bCreatingNewEntity, HandoverChanged);
 
 	return HandoverChanged;
 }
@@ -1142,10 +1132,48 @@ void USpatialActorChannel::UpdateSpatialPosition()
 {
 	SCOPE_CYCLE_COUNTER(STAT_SpatialActorChannelUpdateSpatialPosition);
 
+	if (!PrepareSpatialPositionUpdate())
+	{
+		return;
+	}
+
+	SendPositionUpdate(Actor, EntityId, LastPositionSinceUpdate);
+
+	if (APlayerController* PlayerController = Cast<APlayerController>(Actor))
+	{
+		if (APawn* Pawn = PlayerController->GetPawn())
+		{
+			SendPositionUpdate(Pawn, NetDriver->PackageMap->GetEntityIdFromObject(Pawn), LastPositionSinceUpdate);
+		}
+	}
+}
+
+void USpatialActorChannel::GatherPositionUpdates(TArray<TPair<Worker_EntityId, FVector>>& OutPositionUpdates)
+{
+	SCOPE_CYCLE_COUNTER(STAT_SpatialActorChannelUpdateSpatialPosition);
+
+	if (!PrepareSpatialPositionUpdate())
+	{
+		return;
+	}
+
+	USpatialPackageMapClient* PackageMap = NetDriver->PackageMap;
+	PositionHierarchy.Update(*Actor, [PackageMap](const AActor* HierarchyActor) { return PackageMap->GetEntityIdFromObject(HierarchyActor); }, *NetDriver->StaticComponentView);
+	for (const SpatialGDK::FPositionHierarchy::FEntity& Entity : PositionHierarchy.GetEntities())
+	{
+		if (Entity.bAuthoritative)
+		{
+			OutPositionUpdates.Emplace(Entity.EntityId, LastPositionSinceUpdate);
+		}
+	}
+}
+
+bool USpatialActorChannel::PrepareSpatialPositionUpdate()
+{
 	// Additional check to validate Actor is still present
 	if (Actor == nullptr || Actor->IsPendingKill())
 	{
-		return;
+		return false;
 	}
 
 	// When we update an Actor's position, we want to update the position of all the children of this Actor.
@@ -1160,7 +1188,7 @@ void USpatialActorChannel::UpdateSpatialPosition()
 		// position updated as this code will never be run for the parent.
 		if (!(Actor->GetNetConnection() == nullptr && ActorOwner != nullptr && !ActorOwner->GetIsReplicated()))
 		{
-			return;
+			return false;
 		}
 	}
 
@@ -1169,21 +1197,13 @@ void USpatialActorChannel::UpdateSpatialPosition()
 	FVector ActorSpatialPosition = SpatialGDK::GetActorSpatialPosition(Actor);
 	if (FVector::DistSquared(ActorSpatialPosition, LastPositionSinceUpdate) < SpatialPositionThresholdSquared)
 	{
-		return;
+		return false;
 	}
 
 	LastPositionSinceUpdate = ActorSpatialPosition;
 	TimeWhenPositionLastUpdated = NetDriver->GetElapsedTime();
 
-	SendPositionUpdate(Actor, EntityId, LastPositionSinceUpdate);
-
-	if (APlayerController* PlayerController = Cast<APlayerController>(Actor))
-	{
-		if (APawn* Pawn = PlayerController->GetPawn())
-		{
-			SendPositionUpdate(Pawn, NetDriver->PackageMap->GetEntityIdFromObject(Pawn), LastPositionSinceUpdate);
-		}
-	}
+	return true;
 }
 
 void USpatialActorChannel::SendPositionUpdate(AActor* InActor, Worker_EntityId InEntityId, const FVector& NewPosition)
@@ -6,6 +6,7 @@
 
 #include "EngineClasses/SpatialPackageMapClient.h"
 #include "SpatialConstants.h"
+#include "Utils/ObjectRefPathTable.h"
 
 DEFINE_LOG_CATEGORY(LogSpatialNetBitReader);
 
@@ -25,10 +26,35 @@ void FSpatialNetBitReader::DeserializeObjectRef(FUnrealObjectRef& ObjectRef)
 	SerializeBits(&HasPath, 1);
 	if (HasPath)
 	{
-		FString Path;
-		*this << Path;
-
-		ObjectRef.Path = Path;
+		// Writers only write the interned bit when interning is enabled, which must be the same on every worker.
+		const SpatialGDK::FObjectRefPathTable& PathTable = SpatialGDK::FObjectRefPathTable::Get();
+		uint8 IsInterned = 0;
+		if (PathTable.ShouldInternWrittenPaths())
+		{
+			SerializeBits(&IsInterned, 1);
+		}
+		if (IsInterned)
+		{
+			uint32 PathId;
+			SerializeIntPacked(PathId);
+
+			if (PathTable.IsValidPathId(PathId))
+			{
+				ObjectRef.Path = PathTable.GetPath(PathId);
+			}
+			else
+			{
+				UE_LOG(LogSpatialNetBitReader, Error, TEXT("Read object ref with interned path %u, but only %u paths are interned. Check that all workers use the same schema."), PathId, PathTable.Num());
+				SetError();
+			}
+		}
+		else
+		{
+			FString Path;
+			*this << Path;
+
+			ObjectRef.Path = Path;
+		}
 	}
 
 	uint8 HasOuter;
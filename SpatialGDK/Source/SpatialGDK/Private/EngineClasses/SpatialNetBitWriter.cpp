@@ -9,6 +9,7 @@
 #include "Schema/UnrealObjectRef.h"
 #include "SpatialConstants.h"
 #include "Utils/EntityPool.h"
+#include "Utils/ObjectRefPathTable.h"
 
 DEFINE_LOG_CATEGORY(LogSpatialNetSerialize);
 
@@ -26,7 +27,24 @@ void FSpatialNetBitWriter::SerializeObjectRef(FUnrealObjectRef& ObjectRef)
 	SerializeBits(&HasPath, 1);
 	if (HasPath)
 	{
-		*this << ObjectRef.Path.GetValue();
+		// The interned bit is only written when interning is enabled, so payloads keep their format when it isn't.
+		const SpatialGDK::FObjectRefPathTable& PathTable = SpatialGDK::FObjectRefPathTable::Get();
+		uint32 PathId = SpatialGDK::FObjectRefPathTable::InvalidPathId;
+		uint8 IsInterned = 0;
+		if (PathTable.ShouldInternWrittenPaths())
+		{
+			PathId = PathTable.FindPathId(ObjectRef.Path.GetValue());
+			IsInterned = PathId != SpatialGDK::FObjectRefPathTable::InvalidPathId;
+			SerializeBits(&IsInterned, 1);
+		}
+		if (IsInterned)
+		{
+			SerializeIntPacked(PathId);
+		}
+		else
+		{
+			*this << ObjectRef.Path.GetValue();
+		}
 	}
 
 	uint8 HasOuter = ObjectRef.Outer.IsSet();
@@ -55,3 +73,20 @@ FArchive& FSpatialNetBitWriter::operator<<(FWeakObjectPtr& Value)
 
 	return *this;
 }
+
+TArray<uint8> FSpatialNetBitWriter::MoveBytes()
+{
+	const int64 NumBytes = GetNumBytes();
+
+	// FBitWriter only exposes its buffer as const, but the buffer is owned by this writer and not used again.
+	TArray<uint8> Bytes = MoveTemp(const_cast<TArray<uint8>&>(*GetBuffer()));
+	Bytes.SetNum(NumBytes, /* bAllowShrinking */ false);
+
+	// The writer grows its buffer ahead of what is written, and the bytes are often kept, so large slack is given back.
+	if (Bytes.GetSlack() > NumBytes / 4)
+	{
+		Bytes.Shrink();
+	}
+
+	return Bytes;
+}
@@ -10,6 +10,7 @@
 #include "EngineGlobals.h"
 #include "GameFramework/GameModeBase.h"
 #include "GameFramework/GameNetworkManager.h"
+#include "GameFramework/Pawn.h"
 #include "Misc/MessageDialog.h"
 #include "Net/DataReplication.h"
 #include "Net/RepLayout.h"
@@ -88,6 +89,7 @@ USpatialNetDriver::USpatialNetDriver(const FObjectInitializer& ObjectInitializer
 	, SessionId(0)
 	, NextRPCIndex(0)
 	, TimeWhenPositionLastUpdated(0.f)
+	, TimeWhenWorkerLoadLastReported(0.f)
 {
 	// Due to changes in 4.23, we now use an outdated flow in ComponentReader::ApplySchemaObject
 	// Native Unreal now iterates over all commands on clients, and no longer has access to a BaseHandleToCmdIndex
@@ -408,6 +410,11 @@ void USpatialNetDriver::CreateAndInitializeCoreClasses()
 	PlayerSpawner->OnPlayerSpawnFailed.BindUObject(GameInstance, &USpatialGameInstance::HandleOnPlayerSpawnFailed);
 	SpatialMetrics->Init(Connection, NetServerMaxTickRate, IsServer());
 	SpatialMetrics->ControllerRefProvider.BindUObject(this, &USpatialNetDriver::GetCurrentPlayerControllerRef);
+	if (RPCService.IsValid())
+	{
+		SpatialMetrics->SetRPCOverflowStats(&RPCService->GetOverflowStats());
+	}
+	SpatialMetrics->SetQueuedRPCStats(&Sender->GetRPCContainer().GetStats(), &Receiver->GetRPCContainer().GetStats());
 
 	// PackageMap value has been set earlier in USpatialNetConnection::InitBase
 	// Making sure the value is the same
@@ -461,6 +468,7 @@ void USpatialNetDriver::CreateAndInitializeLoadBalancingClasses()
 	LoadBalanceStrategy->SetVirtualWorkerIds(1, LoadBalanceStrategy->GetMinimumRequiredWorkers());
 
 	VirtualWorkerTranslator = MakeUnique<SpatialVirtualWorkerTranslator>(LoadBalanceStrategy, Connection->GetWorkerId());
+	VirtualWorkerTranslator->LoadBalancingRegionsChanged.BindUObject(this, &USpatialNetDriver::OnLoadBalancingRegionsChanged);
 
 	LoadBalanceEnforcer = MakeUnique<SpatialLoadBalanceEnforcer>(Connection->GetWorkerId(), StaticComponentView, VirtualWorkerTranslator.Get());
 
@@ -911,6 +919,8 @@ void USpatialNetDriver::NotifyActorDestroyed(AActor* ThisActor, bool IsSeamlessT
 	// Remove the actor from the property tracker map
 	RepChangedPropertyTrackerMap.Remove(ThisActor);
 
+	ActorPriorityTable.RemoveRow(ThisActor);
+
 	const bool bIsServer = ServerConnection == nullptr;
 	if (bIsServer)
 	{
@@ -1080,6 +1090,52 @@ static FORCEINLINE_DEBUGGABLE bool IsActorRelevantToConnection(const AActor* Act
 	return false;
 }
 
+// Returns true if the actor can only be relevant by being within its net cull distance of a viewer.
+// Matches the checks AActor::IsNetRelevantFor makes before the distance check, so must only be used for classes that don't override it.
+static FORCEINLINE_DEBUGGABLE bool IsActorRelevancyDistanceOnly(const AActor* Actor, const TArray<FNetViewer>& ConnectionViewers)
+{
+	if (Actor->bAlwaysRelevant || Actor->bOnlyRelevantToOwner || Actor->bNetUseOwnerRelevancy
+		|| Actor->GetOwner() != nullptr || Actor->GetInstigator() != nullptr)
+	{
+		return false;
+	}
+
+	const USceneComponent* RootComponent = Actor->GetRootComponent();
+	if (RootComponent != nullptr && RootComponent->GetAttachParent() != nullptr)
+	{
+		return false;
+	}
+
+	for (const FNetViewer& Viewer : ConnectionViewers)
+	{
+		if (Actor == Viewer.ViewTarget || Actor == Viewer.InViewer)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+// Queries the spatial index for the entities within EntitySpatialIndexMaxRelevancyQueryDistance, plus a margin, of any viewer.
+// The results are read back with FEntitySpatialIndex::IsOutsideLastQuery.
+static void QueryEntitiesNearViewers(const SpatialGDK::FEntitySpatialIndex& SpatialIndex, const TArray<FNetViewer>& ConnectionViewers, TArray<Worker_EntityId>& OutEntityIds)
+{
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+
+	// Unreal units are centimeters and SpatialOS units are meters.
+	const double Radius = (SpatialGDKSettings->EntitySpatialIndexMaxRelevancyQueryDistance + SpatialGDKSettings->EntitySpatialIndexRelevancyMargin) * 0.01;
+
+	TArray<SpatialGDK::SphereConstraint, TInlineAllocator<4>> Spheres;
+	for (const FNetViewer& Viewer : ConnectionViewers)
+	{
+		Spheres.Add(SpatialGDK::SphereConstraint{ SpatialGDK::Coordinates::FromFVector(Viewer.ViewLocation), Radius });
+	}
+
+	OutEntityIds.Reset();
+	SpatialIndex.QuerySpheres(Spheres, OutEntityIds);
+}
+
 // Returns true if this actor is considered dormant (and all properties caught up) to the current connection
 static FORCEINLINE_DEBUGGABLE bool IsActorDormant(FNetworkObjectInfo* ActorInfo, UNetConnection* Connection)
 {
@@ -1181,6 +1237,32 @@ struct FCompareActorPriorityAndMigration
 	const FSpatialLoadBalancingHandler& MigrationHandler;
 };
 
+bool USpatialNetDriver::IsClassRelevancyDistanceOnly(UClass* Class)
+{
+	if (const bool* bDistanceOnly = DistanceOnlyRelevancyClasses.Find(Class))
+	{
+		return *bDistanceOnly;
+	}
+
+	// APawn::IsNetRelevantFor also checks the pawn's controller and instigator, so pawns are never distance only.
+	bool bDistanceOnly = false;
+	if (!Class->IsChildOf(APawn::StaticClass()))
+	{
+		for (const TSoftClassPtr<AActor>& DistanceOnlyClass : GetDefault<USpatialGDKSettings>()->DistanceOnlyRelevancyActorClasses)
+		{
+			const UClass* LoadedClass = DistanceOnlyClass.Get();
+			if (LoadedClass != nullptr && Class->IsChildOf(LoadedClass))
+			{
+				bDistanceOnly = true;
+				break;
+			}
+		}
+	}
+
+	DistanceOnlyRelevancyClasses.Add(Class, bDistanceOnly);
+	return bDistanceOnly;
+}
+
 int32 USpatialNetDriver::ServerReplicateActors_PrioritizeActors(UNetConnection* InConnection, const TArray<FNetViewer>& ConnectionViewers, FSpatialLoadBalancingHandler& MigrationHandler, const TArray<FNetworkObjectInfo*> ConsiderList, const bool bCPUSaturated, FActorPriority*& OutPriorityList, FActorPriority**& OutPriorityActors)
 {
 	// Since this function signature is copied from NetworkDriver.cpp, I don't want to change the signature. But we expect
@@ -1215,6 +1297,22 @@ int32 USpatialNetDriver::ServerReplicateActors_PrioritizeActors(UNetConnection*
 
 		const bool bNetRelevancyEnabled = GetDefault<USpatialGDKSettings>()->bUseIsActorRelevantForConnection;
 
+		// The priority table doesn't implement the low bandwidth priority adjustments, so those are left to the engine.
+		const bool bUsePriorityTable = GetDefault<USpatialGDKSettings>()->bUseActorPriorityTable && !bLowNetBandwidth;
+		PriorityTableRows.Reset();
+		PriorityTableListIndices.Reset();
+
+		// With the spatial index, opted-in actors that are far from every viewer can be skipped without checking their relevancy.
+		const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+		const SpatialGDK::FEntitySpatialIndex* SpatialIndex = bNetRelevancyEnabled && SpatialGDKSettings->DistanceOnlyRelevancyActorClasses.Num() > 0
+			? StaticComponentView->GetSpatialIndex() : nullptr;
+		if (SpatialIndex != nullptr)
+		{
+			QueryEntitiesNearViewers(*SpatialIndex, ConnectionViewers, EntitiesNearViewers);
+		}
+		// The query covers every viewer up to the margin beyond these net cull distances.
+		const float MaxSkippableNetCullDistanceSquared = FMath::Square(SpatialGDKSettings->EntitySpatialIndexMaxRelevancyQueryDistance);
+
 		for (FNetworkObjectInfo* ActorInfo : ConsiderList)
 		{
 			AActor* Actor = ActorInfo->Actor;
@@ -1238,6 +1336,16 @@ int32 USpatialNetDriver::ServerReplicateActors_PrioritizeActors(UNetConnection*
 
 			UE_LOG(LogSpatialOSNetDriver, Verbose, TEXT("Actor %s will be replicated on the catch-all connection"), *Actor->GetName());
 
+			// Opted-in actors the query didn't find are further than their net cull distance from every viewer, and those it did find
+			// are checked normally. Entities missing from the index have just been created and their position hasn't been received yet,
+			// so IsOutsideLastQuery leaves them to be checked normally too.
+			if (SpatialIndex != nullptr && Channel != nullptr && Actor->NetCullDistanceSquared <= MaxSkippableNetCullDistanceSquared
+				&& IsActorRelevancyDistanceOnly(Actor, ConnectionViewers) && IsClassRelevancyDistanceOnly(Actor->GetClass())
+				&& SpatialIndex->IsOutsideLastQuery(Cast<USpatialActorChannel>(Channel)->GetEntityId()))
+			{
+				continue;
+			}
+
 			// Check actor relevancy if Net Relevancy is enabled in the GDK settings
 			if (bNetRelevancyEnabled && !IsActorRelevantToConnection(Actor, Channel, ConnectionViewers))
 			{
@@ -1253,7 +1361,25 @@ int32 USpatialNetDriver::ServerReplicateActors_PrioritizeActors(UNetConnection*
 
 				Actor->NetTag = NetTag;
 
-				OutPriorityList[FinalSortedCount] = FActorPriority(PriorityConnection, Channel, ActorInfo, ConnectionViewers, bLowNetBandwidth);
+				const int32 PriorityTableRow = bUsePriorityTable ? ActorPriorityTable.FindOrAddRow(Actor) : INDEX_NONE;
+				if (PriorityTableRow != INDEX_NONE)
+				{
+					ActorPriorityTable.UpdateRow(PriorityTableRow, Actor, Channel);
+				}
+
+				if (PriorityTableRow != INDEX_NONE && !(ActorPriorityTable.GetFlags(PriorityTableRow) & SpatialGDK::FActorPriorityTable::UsesOwnerPriority))
+				{
+					// The priority is filled in once all relevant actors have been found.
+					OutPriorityList[FinalSortedCount] = FActorPriority();
+					OutPriorityList[FinalSortedCount].ActorInfo = ActorInfo;
+					OutPriorityList[FinalSortedCount].Channel = Channel;
+					PriorityTableRows.Add(PriorityTableRow);
+					PriorityTableListIndices.Add(FinalSortedCount);
+				}
+				else
+				{
+					OutPriorityList[FinalSortedCount] = FActorPriority(PriorityConnection, Channel, ActorInfo, ConnectionViewers, bLowNetBandwidth);
+				}
 				OutPriorityActors[FinalSortedCount] = OutPriorityList + FinalSortedCount;
 
 				FinalSortedCount++;
@@ -1265,6 +1391,15 @@ int32 USpatialNetDriver::ServerReplicateActors_PrioritizeActors(UNetConnection*
 			}
 		}
 
+		if (PriorityTableRows.Num() > 0)
+		{
+			ActorPriorityTable.ComputePriorities(PriorityTableRows, ConnectionViewers, GetElapsedTime(), SpawnPrioritySeconds, PriorityTablePriorities);
+			for (int32 i = 0; i < PriorityTableRows.Num(); ++i)
+			{
+				OutPriorityList[PriorityTableListIndices[i]].Priority = PriorityTablePriorities[i];
+			}
+		}
+
 		// Add in deleted actors
 		for (auto It = InConnection->GetDestroyedStartupOrDormantActorGUIDs().CreateIterator(); It; ++It)
 		{
@@ -1440,7 +1575,9 @@ void USpatialNetDriver::ServerReplicateActors_ProcessPrioritizedActors(UNetConne
 							LastRelevantActors.Add(Actor);
 						}
 
-						if (Channel->ReplicateActor())
+						// Deferred component updates are only serialized when flushed, so an actor whose changes were all deferred reports no bits written.
+						const int32 NumDeferredUpdates = Sender->GetNumDeferredComponentUpdates();
+						if (Channel->ReplicateActor() > 0 || Sender->GetNumDeferredComponentUpdates() > NumDeferredUpdates)
 						{
 							ActorUpdatesThisConnectionSent++;
 							if (DebugRelevantActors)
@@ -1634,9 +1771,22 @@ int32 USpatialNetDriver::ServerReplicateActors(float DeltaSeconds)
 	// Get a sorted list of actors for this connection
 	const int32 FinalSortedCount = ServerReplicateActors_PrioritizeActors(SpatialConnection, ConnectionViewers, MigrationHandler, ConsiderList, bCPUSaturated, PriorityList, PriorityActors);
 
+	// Changelists are built on the game thread while processing the actors. With parallel serialization enabled,
+	// eligible changelists are serialized on the task graph afterwards and sent in the order they were processed.
+	const bool bParallelSerialization = GetDefault<USpatialGDKSettings>()->bEnableParallelComponentSerialization;
+	if (bParallelSerialization)
+	{
+		Sender->BeginDeferringComponentUpdates();
+	}
+
 	// Process the sorted list of actors for this connection
 	ServerReplicateActors_ProcessPrioritizedActors(SpatialConnection, ConnectionViewers, MigrationHandler, PriorityActors, FinalSortedCount, Updated);
 
+	if (bParallelSerialization)
+	{
+		INC_DWORD_STAT_BY(STAT_NumReplicatedActorBytes, Sender->FlushDeferredComponentUpdates());
+	}
+
 	if (bIsMultiWorkerEnabled)
 	{
 		// Once an up to date version of the actors have been sent, do the actual migration.
@@ -1693,7 +1843,12 @@ void USpatialNetDriver::TickDispatch(float DeltaTime)
 			SCOPE_CYCLE_COUNTER(STAT_SpatialProcessOps);
 			for (const OpList& Ops : OpLists)
 			{
+				const double DispatchStartTime = FPlatformTime::Seconds();
 				Dispatcher->ProcessOps(Ops);
+				if (SpatialMetrics != nullptr && SpatialGDKSettings->bEnableMetrics)
+				{
+					SpatialMetrics->RecordOpDispatch(Ops.Count, FPlatformTime::Seconds() - DispatchStartTime);
+				}
 			}
 		}
 
@@ -1710,6 +1865,20 @@ void USpatialNetDriver::TickDispatch(float DeltaTime)
 				Sender->SetAclWriteAuthority(AclAssignmentRequest);
 			}
 		}
+
+		if (LoadBalanceStrategy != nullptr && LoadBalanceStrategy->IsDynamic())
+		{
+			if (IsServer() && (GetElapsedTime() - TimeWhenWorkerLoadLastReported) >= SpatialGDKSettings->MetricsReportRate)
+			{
+				TimeWhenWorkerLoadLastReported = GetElapsedTime();
+				ReportWorkerLoad();
+			}
+
+			if (VirtualWorkerTranslationManager.IsValid())
+			{
+				VirtualWorkerTranslationManager->Tick(GetElapsedTime());
+			}
+		}
 	}
 }
 
@@ -1835,7 +2004,12 @@ void USpatialNetDriver::TickFlush(float DeltaTime)
 		// Update all clients.
 #if WITH_SERVER_CODE
 
+		const double ReplicateStartTime = FPlatformTime::Seconds();
 		int32 Updated = ServerReplicateActors(DeltaTime);
+		if (SpatialMetrics != nullptr && SpatialGDKSettings->bEnableMetrics)
+		{
+			SpatialMetrics->RecordActorReplication(Updated, FPlatformTime::Seconds() - ReplicateStartTime);
+		}
 
 		static int32 LastUpdateCount = 0;
 		// Only log the zero replicated actors once after replicating an actor
@@ -1871,6 +2045,11 @@ void USpatialNetDriver::TickFlush(float DeltaTime)
 
 	TimerManager.Tick(DeltaTime);
 
+	if (Connection != nullptr)
+	{
+		Connection->QueueCoalescedComponentUpdates();
+	}
+
 	if (SpatialGDKSettings->bRunSpatialWorkerConnectionOnGameThread || SpatialGDKSettings->bUseSpatialView)
 	{
 		if (Connection != nullptr)
@@ -2404,6 +2583,31 @@ void USpatialNetDriver::WipeWorld(const PostWorldWipeDelegate& LoadSnapshotAfter
 	SnapshotManager->WorldWipe(LoadSnapshotAfterWorldWipe);
 }
 
+void USpatialNetDriver::ReportWorkerLoad()
+{
+	uint32 AuthoritativeActorCount = 0;
+	for (const TSharedPtr<FNetworkObjectInfo>& ObjectInfo : GetNetworkObjectList().GetActiveObjects())
+	{
+		if (ObjectInfo->Actor != nullptr && ObjectInfo->Actor->HasAuthority())
+		{
+			AuthoritativeActorCount++;
+		}
+	}
+
+	const double WorkerLoad = SpatialMetrics != nullptr ? SpatialMetrics->GetWorkerLoad() : 0.0;
+	Sender->SendServerWorkerLoadUpdate(WorkerLoad, AuthoritativeActorCount);
+}
+
+void USpatialNetDriver::OnLoadBalancingRegionsChanged()
+{
+	// The worker's interest and position follow its load balancing region. Before the worker is ready
+	// to start, they are set from the current regions once it is.
+	if (bIsReadyToStart && Sender != nullptr)
+	{
+		Sender->UpdateServerWorkerEntityInterestAndPosition();
+	}
+}
+
 void USpatialNetDriver::DelayedRetireEntity(Worker_EntityId EntityId, float Delay, bool bIsNetStartupActor)
 {
 	FTimerHandle RetryTimer;
@@ -2674,6 +2878,6 @@ FUnrealObjectRef USpatialNetDriver::GetCurrentPlayerControllerRef()
 // for the TranslationManager, otherwise the manager will never be instantiated.
 void USpatialNetDriver::InitializeVirtualWorkerTranslationManager()
 {
-	VirtualWorkerTranslationManager = MakeUnique<SpatialVirtualWorkerTranslationManager>(Receiver, Connection, VirtualWorkerTranslator.Get());
+	VirtualWorkerTranslationManager = MakeUnique<SpatialVirtualWorkerTranslationManager>(Receiver, Connection, VirtualWorkerTranslator.Get(), LoadBalanceStrategy);
 	VirtualWorkerTranslationManager->SetNumberOfVirtualWorkers(LoadBalanceStrategy->GetMinimumRequiredWorkers());
 }
@@ -10,6 +10,7 @@
 #include "Interop/SpatialSender.h"
 #include "Schema/UnrealObjectRef.h"
 #include "SpatialConstants.h"
+#include "Utils/ObjectRefPathTable.h"
 #include "Utils/SchemaOption.h"
 
 #include "EngineUtils.h"
@@ -687,13 +688,26 @@ FNetworkGUID FSpatialNetGUIDCache::GetNetGUIDFromEntityId(Worker_EntityId Entity
 
 FNetworkGUID FSpatialNetGUIDCache::RegisterNetGUIDFromPathForStaticObject(const FString& PathName, const FNetworkGUID& OuterGUID, bool bNoLoadOnClient)
 {
-	// Put the PIE prefix back (if applicable) so that the correct object can be found.
-	FString TempPath = PathName;
-	GEngine->NetworkRemapPath(Driver, TempPath, true);
-
 	// This function should only be called for stably named object references, not dynamic ones.
 	FNetGuidCacheObject CacheObject;
-	CacheObject.PathName = FName(*TempPath);
+
+	// Interned paths only need remapping in PIE or duplicated level collections, so otherwise reuse the table's name for the path.
+	const SpatialGDK::FObjectRefPathTable& PathTable = SpatialGDK::FObjectRefPathTable::Get();
+	const UWorld* World = Driver->GetWorld();
+	const bool bNeedsRemapping = World == nullptr || World->IsPlayInEditor() || Driver->GetDuplicateLevelID() != INDEX_NONE;
+	const uint32 PathId = bNeedsRemapping ? SpatialGDK::FObjectRefPathTable::InvalidPathId : PathTable.FindPathId(PathName);
+	if (PathId != SpatialGDK::FObjectRefPathTable::InvalidPathId)
+	{
+		CacheObject.PathName = PathTable.GetPathName(PathId);
+	}
+	else
+	{
+		// Put the PIE prefix back (if applicable) so that the correct object can be found.
+		FString TempPath = PathName;
+		GEngine->NetworkRemapPath(Driver, TempPath, true);
+		CacheObject.PathName = FName(*TempPath);
+	}
+
 	CacheObject.OuterGUID = OuterGUID;
 	CacheObject.bNoLoad = bNoLoadOnClient;		// server decides whether the client should load objects (e.g. don't load levels)
 	CacheObject.bIgnoreWhenMissing = bNoLoadOnClient;
@@ -4,19 +4,44 @@
 #include "EngineClasses/SpatialVirtualWorkerTranslator.h"
 #include "Interop/Connection/SpatialWorkerConnection.h"
 #include "Interop/SpatialOSDispatcherInterface.h"
+#include "LoadBalancing/AbstractLBStrategy.h"
 #include "SpatialConstants.h"
 #include "Utils/SchemaUtils.h"
 
 DEFINE_LOG_CATEGORY(LogSpatialVirtualWorkerTranslationManager);
 
+namespace
+{
+// Creates a query for all the server worker entities.
+Worker_EntityQuery CreateServerWorkerEntityQuery()
+{
+	Worker_ComponentConstraint WorkerEntityComponentConstraint{};
+	WorkerEntityComponentConstraint.component_id = SpatialConstants::SERVER_WORKER_COMPONENT_ID;
+
+	Worker_Constraint WorkerEntityConstraint{};
+	WorkerEntityConstraint.constraint_type = WORKER_CONSTRAINT_TYPE_COMPONENT;
+	WorkerEntityConstraint.constraint.component_constraint = WorkerEntityComponentConstraint;
+
+	Worker_EntityQuery WorkerEntityQuery{};
+	WorkerEntityQuery.constraint = WorkerEntityConstraint;
+	WorkerEntityQuery.result_type = WORKER_RESULT_TYPE_SNAPSHOT;
+
+	return WorkerEntityQuery;
+}
+} // anonymous namespace
+
 SpatialVirtualWorkerTranslationManager::SpatialVirtualWorkerTranslationManager(
 	SpatialOSDispatcherInterface* InReceiver,
 	SpatialOSWorkerInterface* InConnection,
-	SpatialVirtualWorkerTranslator* InTranslator)
+	SpatialVirtualWorkerTranslator* InTranslator,
+	UAbstractLBStrategy* InLoadBalanceStrategy)
 	: Receiver(InReceiver)
 	, Connection(InConnection)
 	, Translator(InTranslator)
+	, LoadBalanceStrategy(InLoadBalanceStrategy)
 	, bWorkerEntityQueryInFlight(false)
+	, bWorkerLoadQueryInFlight(false)
+	, TimeOfLastWorkerLoadQuery(0.f)
 {}
 
 void SpatialVirtualWorkerTranslationManager::SetNumberOfVirtualWorkers(const uint32 NumVirtualWorkers)
@@ -31,6 +56,23 @@ void SpatialVirtualWorkerTranslationManager::SetNumberOfVirtualWorkers(const uin
 	}
 }
 
+void SpatialVirtualWorkerTranslationManager::Tick(float CurrentTime)
+{
+	// Regions are only rebalanced once every virtual worker has been assigned and the mapping published.
+	if (!LoadBalanceStrategy.IsValid() || !LoadBalanceStrategy->IsDynamic() || !UnassignedVirtualWorkers.IsEmpty())
+	{
+		return;
+	}
+
+	if (bWorkerLoadQueryInFlight || CurrentTime - TimeOfLastWorkerLoadQuery < LoadBalanceStrategy->GetRebalanceInterval())
+	{
+		return;
+	}
+
+	TimeOfLastWorkerLoadQuery = CurrentTime;
+	QueryForWorkerLoads();
+}
+
 void SpatialVirtualWorkerTranslationManager::AuthorityChanged(const Worker_AuthorityChangeOp& AuthOp)
 {
 	check(AuthOp.component_id == SpatialConstants::VIRTUAL_WORKER_TRANSLATION_COMPONENT_ID);
@@ -116,6 +158,11 @@ void SpatialVirtualWorkerTranslationManager::SendVirtualWorkerMappingUpdate() co
 
 	WriteMappingToSchema(UpdateObject);
 
+	if (LoadBalanceStrategy.IsValid() && LoadBalanceStrategy->IsDynamic())
+	{
+		LoadBalanceStrategy->WriteRegionsToSchema(UpdateObject);
+	}
+
 	// The Translator on the worker which hosts the manager won't get the component update notification,
 	// so send it across directly.
 	check(Translator != nullptr);
@@ -137,16 +184,7 @@ void SpatialVirtualWorkerTranslationManager::QueryForServerWorkerEntities()
 
 	// Create a query for all the server worker entities. This will be used
 	// to find physical workers which the virtual workers will map to.
-	Worker_ComponentConstraint WorkerEntityComponentConstraint{};
-	WorkerEntityComponentConstraint.component_id = SpatialConstants::SERVER_WORKER_COMPONENT_ID;
-
-	Worker_Constraint WorkerEntityConstraint{};
-	WorkerEntityConstraint.constraint_type = WORKER_CONSTRAINT_TYPE_COMPONENT;
-	WorkerEntityConstraint.constraint.component_constraint = WorkerEntityComponentConstraint;
-
-	Worker_EntityQuery WorkerEntityQuery{};
-	WorkerEntityQuery.constraint = WorkerEntityConstraint;
-	WorkerEntityQuery.result_type = WORKER_RESULT_TYPE_SNAPSHOT;
+	Worker_EntityQuery WorkerEntityQuery = CreateServerWorkerEntityQuery();
 
 	// Make the query.
 	check(Connection != nullptr);
@@ -189,6 +227,72 @@ void SpatialVirtualWorkerTranslationManager::ServerWorkerEntityQueryDelegate(con
 	}
 }
 
+void SpatialVirtualWorkerTranslationManager::QueryForWorkerLoads()
+{
+	UE_LOG(LogSpatialVirtualWorkerTranslationManager, Verbose, TEXT("Sending query for worker loads"));
+
+	Worker_EntityQuery WorkerEntityQuery = CreateServerWorkerEntityQuery();
+
+	check(Connection != nullptr);
+	Worker_RequestId RequestID = Connection->SendEntityQueryRequest(&WorkerEntityQuery);
+	bWorkerLoadQueryInFlight = true;
+
+	EntityQueryDelegate WorkerLoadQueryDelegate;
+	WorkerLoadQueryDelegate.BindRaw(this, &SpatialVirtualWorkerTranslationManager::WorkerLoadQueryDelegate);
+	check(Receiver != nullptr);
+	Receiver->AddEntityQueryDelegate(RequestID, WorkerLoadQueryDelegate);
+}
+
+// Collects the load each assigned server worker has reported on its ServerWorker component, and publishes
+// new regions if the load balancing strategy decides to rebalance.
+void SpatialVirtualWorkerTranslationManager::WorkerLoadQueryDelegate(const Worker_EntityQueryResponseOp& Op)
+{
+	bWorkerLoadQueryInFlight = false;
+
+	if (Op.status_code != WORKER_STATUS_CODE_SUCCESS)
+	{
+		UE_LOG(LogSpatialVirtualWorkerTranslationManager, Warning, TEXT("Could not query worker loads: %s, will retry at the next rebalance interval."), UTF8_TO_TCHAR(Op.message));
+		return;
+	}
+
+	if (!LoadBalanceStrategy.IsValid())
+	{
+		return;
+	}
+
+	TMap<VirtualWorkerId, FWorkerLoadReport> LoadReports;
+	for (uint32_t i = 0; i < Op.result_count; ++i)
+	{
+		const Worker_Entity& Entity = Op.results[i];
+		for (uint32_t j = 0; j < Entity.component_count; j++)
+		{
+			const Worker_ComponentData& Data = Entity.components[j];
+			if (Data.component_id != SpatialConstants::SERVER_WORKER_COMPONENT_ID)
+			{
+				continue;
+			}
+
+			const Schema_Object* ComponentObject = Schema_GetComponentDataFields(Data.schema_type);
+
+			// Workers which haven't been assigned a virtual worker or haven't reported their load yet are skipped.
+			const VirtualWorkerId* Id = PhysicalToVirtualWorkerMapping.Find(SpatialGDK::GetStringFromSchema(ComponentObject, SpatialConstants::SERVER_WORKER_NAME_ID));
+			if (Id == nullptr || Schema_GetDoubleCount(ComponentObject, SpatialConstants::SERVER_WORKER_LOAD_ID) == 0)
+			{
+				continue;
+			}
+
+			FWorkerLoadReport& Report = LoadReports.Add(*Id);
+			Report.Load = Schema_GetDouble(ComponentObject, SpatialConstants::SERVER_WORKER_LOAD_ID);
+			Report.AuthoritativeActorCount = Schema_GetUint32(ComponentObject, SpatialConstants::SERVER_WORKER_AUTHORITATIVE_ACTOR_COUNT_ID);
+		}
+	}
+
+	if (LoadBalanceStrategy->UpdateRegionsFromLoad(LoadReports))
+	{
+		SendVirtualWorkerMappingUpdate();
+	}
+}
+
 void SpatialVirtualWorkerTranslationManager::AssignWorker(const PhysicalWorkerName& Name, const Worker_EntityId& ServerWorkerEntityId)
 {
 	if (PhysicalToVirtualWorkerMapping.Contains(Name))
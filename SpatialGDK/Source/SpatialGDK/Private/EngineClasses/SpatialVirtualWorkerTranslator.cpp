@@ -46,6 +46,12 @@ void SpatialVirtualWorkerTranslator::ApplyVirtualWorkerManagerData(Schema_Object
 	{
 		UE_LOG(LogSpatialVirtualWorkerTranslator, Log, TEXT("Translator assignment: Virtual Worker %d to %s with server worker entity: %lld"), Entry.Key, *(Entry.Value.Key), Entry.Value.Value);
 	}
+
+	// Dynamic strategies publish their current regions alongside the mapping so that all workers agree on them.
+	if (LoadBalanceStrategy.IsValid() && LoadBalanceStrategy->IsDynamic() && LoadBalanceStrategy->ApplyRegionsFromSchema(ComponentObject))
+	{
+		LoadBalancingRegionsChanged.ExecuteIfBound();
+	}
 }
 
 // Check to see if this worker's physical worker name is in the mapping. If it isn't, it's possibly an old mapping.
@@ -0,0 +1,74 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Interop/Connection/ComponentUpdateCoalescer.h"
+
+namespace SpatialGDK
+{
+
+FComponentUpdateCoalescer::~FComponentUpdateCoalescer()
+{
+	Clear();
+}
+
+void FComponentUpdateCoalescer::AddUpdate(Worker_EntityId EntityId, const FWorkerComponentUpdate& Update)
+{
+	++NumAdded;
+
+	const FEntityComponentKey Key(EntityId, Update.component_id);
+	if (const int32* ExistingIndex = PendingIndices.Find(Key))
+	{
+		FWorkerComponentUpdate& Existing = PendingUpdates[*ExistingIndex].Update;
+
+#if TRACE_LIB_ACTIVE
+		// Merging would drop one of the two traces, so start a new pending update for this pair instead.
+		const bool bCanMerge = Existing.Trace == InvalidTraceKey || Update.Trace == InvalidTraceKey;
+#else
+		const bool bCanMerge = true;
+#endif
+
+		if (bCanMerge && Schema_MergeComponentUpdateIntoUpdate(Update.schema_type, Existing.schema_type) != 0)
+		{
+#if TRACE_LIB_ACTIVE
+			if (Existing.Trace == InvalidTraceKey)
+			{
+				Existing.Trace = Update.Trace;
+			}
+#endif
+			Schema_DestroyComponentUpdate(Update.schema_type);
+			return;
+		}
+	}
+
+	PendingIndices.Add(Key, PendingUpdates.Num());
+	PendingUpdates.Add(FPendingUpdate{ EntityId, Update });
+}
+
+void FComponentUpdateCoalescer::Clear()
+{
+	for (FPendingUpdate& Pending : PendingUpdates)
+	{
+		Schema_DestroyComponentUpdate(Pending.Update.schema_type);
+	}
+	PendingUpdates.Reset();
+	PendingIndices.Reset();
+}
+
+float FComponentUpdateCoalescer::GetMergeRatio() const
+{
+	if (NumAdded == 0)
+	{
+		return 0.0f;
+	}
+
+	// Every added update has either been merged, released, or is still pending.
+	const uint32 NumUnmerged = NumReleased + PendingUpdates.Num();
+	return 1.0f - static_cast<float>(NumUnmerged) / static_cast<float>(NumAdded);
+}
+
+void FComponentUpdateCoalescer::ResetCounters()
+{
+	NumAdded = 0;
+	NumReleased = 0;
+}
+
+} // namespace SpatialGDK
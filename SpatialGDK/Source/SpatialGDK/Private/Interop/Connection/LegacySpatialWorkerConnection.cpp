@@ -4,10 +4,23 @@
 #include "SpatialView/OpList/WorkerConnectionOpList.h"
 
 #include "Async/Async.h"
+#include "HAL/PlatformTime.h"
 #include "SpatialGDKSettings.h"
 
 DEFINE_LOG_CATEGORY(LogSpatialWorkerConnection);
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Coalesced component updates in"), STAT_SpatialCoalescedComponentUpdatesIn, STATGROUP_SpatialNet);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Coalesced component updates out"), STAT_SpatialCoalescedComponentUpdatesOut, STATGROUP_SpatialNet);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Component update merge ratio"), STAT_SpatialComponentUpdateMergeRatio, STATGROUP_SpatialNet);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Op list receive to dispatch latency p50 (ms)"), STAT_SpatialOpListLatencyP50, STATGROUP_SpatialNet);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Op list receive to dispatch latency p99 (ms)"), STAT_SpatialOpListLatencyP99, STATGROUP_SpatialNet);
+
+namespace
+{
+// Number of op lists the latency percentiles are computed over.
+constexpr int32 OpListLatencySampleCount = 256;
+} // anonymous namespace
+
 using namespace SpatialGDK;
 
 void ULegacySpatialWorkerConnection::SetConnection(Worker_Connection* WorkerConnectionIn)
@@ -31,6 +44,11 @@ void ULegacySpatialWorkerConnection::SetConnection(Worker_Connection* WorkerConn
 			}
 			ThreadWaitCondition.Emplace(bCanWake, WaitTimeMs);
 
+			if (SpatialGDKSettings->bUseLowLatencyOpListHandoff)
+			{
+				OpListRing = MakeUnique<FOpListRing>(SpatialGDKSettings->OpListHandoffCapacity);
+			}
+
 			InitializeOpsProcessingThread();
 		}
 	}
@@ -55,6 +73,11 @@ void ULegacySpatialWorkerConnection::DestroyConnection()
 	}
 
 	ThreadWaitCondition.Reset(); // Set TOptional value to null
+	OpListRing.Reset();
+	OpListLatencySamplesMs.Reset();
+
+	ComponentUpdateCoalescer.Clear();
+	ComponentUpdateCoalescer.ResetCounters();
 
 	if (WorkerConnection)
 	{
@@ -79,11 +102,23 @@ TArray<OpList> ULegacySpatialWorkerConnection::GetOpList()
 	}
 
 	TArray<OpList> OpLists;
-	while (!OpListQueue.IsEmpty())
+	const uint64 DispatchedCycles = FPlatformTime::Cycles64();
+
+	if (OpListRing.IsValid())
 	{
-		OpList OutOpList;
-		OpListQueue.Dequeue(OutOpList);
-		OpLists.Add(MoveTemp(OutOpList));
+		OpListRing->ConsumeAll([this, &OpLists, DispatchedCycles](OpList& Ops, uint64 ReceivedCycles)
+		{
+			RecordOpListLatency(ReceivedCycles, DispatchedCycles);
+			OpLists.Add(MoveTemp(Ops));
+		});
+		return OpLists;
+	}
+
+	FReceivedOpList ReceivedOpList;
+	while (OpListQueue.Dequeue(ReceivedOpList))
+	{
+		RecordOpListLatency(ReceivedOpList.ReceivedCycles, DispatchedCycles);
+		OpLists.Add(MoveTemp(ReceivedOpList.Ops));
 	}
 
 	return OpLists;
@@ -119,6 +154,12 @@ void ULegacySpatialWorkerConnection::SendRemoveComponent(Worker_EntityId EntityI
 
 void ULegacySpatialWorkerConnection::SendComponentUpdate(Worker_EntityId EntityId, FWorkerComponentUpdate* ComponentUpdate)
 {
+	if (GetDefault<USpatialGDKSettings>()->bCoalesceComponentUpdates)
+	{
+		ComponentUpdateCoalescer.AddUpdate(EntityId, *ComponentUpdate);
+		return;
+	}
+
 	QueueOutgoingMessage<FComponentUpdate>(EntityId, *ComponentUpdate);
 }
 
@@ -193,8 +234,16 @@ uint32 ULegacySpatialWorkerConnection::Run()
 
 	while (KeepRunning)
 	{
-		ThreadWaitCondition->Wait();
-		QueueLatestOpList();
+		if (OpListRing.IsValid())
+		{
+			// Blocks in the worker SDK until ops arrive or the timeout elapses, rather than sleeping for a fixed interval.
+			PublishLatestOpList();
+		}
+		else
+		{
+			ThreadWaitCondition->Wait();
+			QueueLatestOpList();
+		}
 		ProcessOutgoingMessages();
 	}
 
@@ -220,21 +269,54 @@ void ULegacySpatialWorkerConnection::QueueLatestOpList()
 
 	if (Ops.Count > 0)
 	{
-		OpListQueue.Enqueue(MoveTemp(Ops));
+		OpListQueue.Enqueue(FReceivedOpList{ MoveTemp(Ops), FPlatformTime::Cycles64() });
 	}
 }
 
+void ULegacySpatialWorkerConnection::PublishLatestOpList()
+{
+	// Leave ops with the worker SDK until the game thread has made room, rather than dropping them.
+	if (OpListRing->IsFull())
+	{
+		ThreadWaitCondition->Wait();
+		return;
+	}
+
+	// A zero timeout returns immediately, which would spin the ops thread.
+	const uint32 TimeoutMs = FMath::Max<uint32>(GetDefault<USpatialGDKSettings>()->OpListHandoffTimeoutMs, 1);
+	OpList Ops = GetOpListFromConnection(WorkerConnection, TimeoutMs);
+
+	if (Ops.Count > 0)
+	{
+		const bool bPublished = OpListRing->Publish(Ops, FPlatformTime::Cycles64());
+		check(bPublished);
+	}
+}
+
+void ULegacySpatialWorkerConnection::RecordOpListLatency(uint64 ReceivedCycles, uint64 DispatchedCycles)
+{
+#if STATS
+	OpListLatencySamplesMs.Add(static_cast<float>(FPlatformTime::ToMilliseconds64(DispatchedCycles - ReceivedCycles)));
+
+	if (OpListLatencySamplesMs.Num() >= OpListLatencySampleCount)
+	{
+		OpListLatencySamplesMs.Sort();
+		const int32 NumSamples = OpListLatencySamplesMs.Num();
+		SET_FLOAT_STAT(STAT_SpatialOpListLatencyP50, OpListLatencySamplesMs[NumSamples / 2]);
+		SET_FLOAT_STAT(STAT_SpatialOpListLatencyP99, OpListLatencySamplesMs[(NumSamples * 99) / 100]);
+		OpListLatencySamplesMs.Reset();
+	}
+#endif // STATS
+}
+
 void ULegacySpatialWorkerConnection::ProcessOutgoingMessages()
 {
 	bool bSentData = false;
-	while (!OutgoingMessagesQueue.IsEmpty())
+	while (FOutgoingMessage* OutgoingMessage = OutgoingMessagesQueue.Peek())
 	{
 		bSentData = true;
 
-		TUniquePtr<FOutgoingMessage> OutgoingMessage;
-		OutgoingMessagesQueue.Dequeue(OutgoingMessage);
-
-		OnDequeueMessage.Broadcast(OutgoingMessage.Get());
+		OnDequeueMessage.Broadcast(OutgoingMessage);
 
 		static const Worker_UpdateParameters DisableLoopback{ /*loopback*/ WORKER_COMPONENT_UPDATE_LOOPBACK_NONE };
 
@@ -242,7 +324,7 @@ void ULegacySpatialWorkerConnection::ProcessOutgoingMessages()
 		{
 		case EOutgoingMessageType::ReserveEntityIdsRequest:
 		{
-			FReserveEntityIdsRequest* Message = static_cast<FReserveEntityIdsRequest*>(OutgoingMessage.Get());
+			FReserveEntityIdsRequest* Message = static_cast<FReserveEntityIdsRequest*>(OutgoingMessage);
 
 			Worker_Connection_SendReserveEntityIdsRequest(WorkerConnection,
 				Message->NumOfEntities,
@@ -251,7 +333,7 @@ void ULegacySpatialWorkerConnection::ProcessOutgoingMessages()
 		}
 		case EOutgoingMessageType::CreateEntityRequest:
 		{
-			FCreateEntityRequest* Message = static_cast<FCreateEntityRequest*>(OutgoingMessage.Get());
+			FCreateEntityRequest* Message = static_cast<FCreateEntityRequest*>(OutgoingMessage);
 
 #if TRACE_LIB_ACTIVE
 			// We have to unpack these as Worker_ComponentData is not the same as FWorkerComponentData
@@ -276,7 +358,7 @@ void ULegacySpatialWorkerConnection::ProcessOutgoingMessages()
 		}
 		case EOutgoingMessageType::DeleteEntityRequest:
 		{
-			FDeleteEntityRequest* Message = static_cast<FDeleteEntityRequest*>(OutgoingMessage.Get());
+			FDeleteEntityRequest* Message = static_cast<FDeleteEntityRequest*>(OutgoingMessage);
 
 			Worker_Connection_SendDeleteEntityRequest(WorkerConnection,
 				Message->EntityId,
@@ -285,7 +367,7 @@ void ULegacySpatialWorkerConnection::ProcessOutgoingMessages()
 		}
 		case EOutgoingMessageType::AddComponent:
 		{
-			FAddComponent* Message = static_cast<FAddComponent*>(OutgoingMessage.Get());
+			FAddComponent* Message = static_cast<FAddComponent*>(OutgoingMessage);
 
 			Worker_Connection_SendAddComponent(WorkerConnection,
 				Message->EntityId,
@@ -295,7 +377,7 @@ void ULegacySpatialWorkerConnection::ProcessOutgoingMessages()
 		}
 		case EOutgoingMessageType::RemoveComponent:
 		{
-			FRemoveComponent* Message = static_cast<FRemoveComponent*>(OutgoingMessage.Get());
+			FRemoveComponent* Message = static_cast<FRemoveComponent*>(OutgoingMessage);
 
 			Worker_Connection_SendRemoveComponent(WorkerConnection,
 				Message->EntityId,
@@ -305,7 +387,7 @@ void ULegacySpatialWorkerConnection::ProcessOutgoingMessages()
 		}
 		case EOutgoingMessageType::ComponentUpdate:
 		{
-			FComponentUpdate* Message = static_cast<FComponentUpdate*>(OutgoingMessage.Get());
+			FComponentUpdate* Message = static_cast<FComponentUpdate*>(OutgoingMessage);
 
 			Worker_Connection_SendComponentUpdate(WorkerConnection,
 				Message->EntityId,
@@ -316,7 +398,7 @@ void ULegacySpatialWorkerConnection::ProcessOutgoingMessages()
 		}
 		case EOutgoingMessageType::CommandRequest:
 		{
-			FCommandRequest* Message = static_cast<FCommandRequest*>(OutgoingMessage.Get());
+			FCommandRequest* Message = static_cast<FCommandRequest*>(OutgoingMessage);
 
 			static const Worker_CommandParameters DefaultCommandParams{};
 			Worker_Connection_SendCommandRequest(WorkerConnection,
@@ -328,7 +410,7 @@ void ULegacySpatialWorkerConnection::ProcessOutgoingMessages()
 		}
 		case EOutgoingMessageType::CommandResponse:
 		{
-			FCommandResponse* Message = static_cast<FCommandResponse*>(OutgoingMessage.Get());
+			FCommandResponse* Message = static_cast<FCommandResponse*>(OutgoingMessage);
 
 			Worker_Connection_SendCommandResponse(WorkerConnection,
 				Message->RequestId,
@@ -337,7 +419,7 @@ void ULegacySpatialWorkerConnection::ProcessOutgoingMessages()
 		}
 		case EOutgoingMessageType::CommandFailure:
 		{
-			FCommandFailure* Message = static_cast<FCommandFailure*>(OutgoingMessage.Get());
+			FCommandFailure* Message = static_cast<FCommandFailure*>(OutgoingMessage);
 
 			Worker_Connection_SendCommandFailure(WorkerConnection,
 				Message->RequestId,
@@ -346,7 +428,7 @@ void ULegacySpatialWorkerConnection::ProcessOutgoingMessages()
 		}
 		case EOutgoingMessageType::LogMessage:
 		{
-			FLogMessage* Message = static_cast<FLogMessage*>(OutgoingMessage.Get());
+			FLogMessage* Message = static_cast<FLogMessage*>(OutgoingMessage);
 
 			FTCHARToUTF8 LoggerName(*Message->LoggerName.ToString());
 			FTCHARToUTF8 LogString(*Message->Message);
@@ -360,7 +442,7 @@ void ULegacySpatialWorkerConnection::ProcessOutgoingMessages()
 		}
 		case EOutgoingMessageType::ComponentInterest:
 		{
-			FComponentInterest* Message = static_cast<FComponentInterest*>(OutgoingMessage.Get());
+			FComponentInterest* Message = static_cast<FComponentInterest*>(OutgoingMessage);
 
 			Worker_Connection_SendComponentInterest(WorkerConnection,
 				Message->EntityId,
@@ -370,7 +452,7 @@ void ULegacySpatialWorkerConnection::ProcessOutgoingMessages()
 		}
 		case EOutgoingMessageType::EntityQueryRequest:
 		{
-			FEntityQueryRequest* Message = static_cast<FEntityQueryRequest*>(OutgoingMessage.Get());
+			FEntityQueryRequest* Message = static_cast<FEntityQueryRequest*>(OutgoingMessage);
 
 			Worker_Connection_SendEntityQueryRequest(WorkerConnection,
 				&Message->EntityQuery,
@@ -379,7 +461,7 @@ void ULegacySpatialWorkerConnection::ProcessOutgoingMessages()
 		}
 		case EOutgoingMessageType::Metrics:
 		{
-			FMetrics* Message = static_cast<FMetrics*>(OutgoingMessage.Get());
+			FMetrics* Message = static_cast<FMetrics*>(OutgoingMessage);
 
 			Message->Metrics.SendToConnection(WorkerConnection);
 			break;
@@ -390,6 +472,8 @@ void ULegacySpatialWorkerConnection::ProcessOutgoingMessages()
 			break;
 		}
 		}
+
+		OutgoingMessagesQueue.Pop();
 	}
 
 	// Flush worker API calls
@@ -410,6 +494,8 @@ void ULegacySpatialWorkerConnection::MaybeFlush()
 
 void ULegacySpatialWorkerConnection::Flush()
 {
+	QueueCoalescedComponentUpdates();
+
 	const USpatialGDKSettings* Settings = GetDefault<USpatialGDKSettings>();
 	if (Settings->bRunSpatialWorkerConnectionOnGameThread)
 	{
@@ -421,12 +507,33 @@ void ULegacySpatialWorkerConnection::Flush()
 	}
 }
 
+void ULegacySpatialWorkerConnection::QueueCoalescedComponentUpdates()
+{
+	if (ComponentUpdateCoalescer.IsEmpty())
+	{
+		return;
+	}
+
+	ComponentUpdateCoalescer.ReleaseUpdates([this](Worker_EntityId EntityId, FWorkerComponentUpdate& Update)
+	{
+		FComponentUpdate* Message = OutgoingMessagesQueue.Emplace<FComponentUpdate>(EntityId, Update);
+		OnEnqueueMessage.Broadcast(Message);
+		OutgoingMessagesQueue.Publish();
+	});
+
+	INC_DWORD_STAT_BY(STAT_SpatialCoalescedComponentUpdatesIn, ComponentUpdateCoalescer.GetNumAdded());
+	INC_DWORD_STAT_BY(STAT_SpatialCoalescedComponentUpdatesOut, ComponentUpdateCoalescer.GetNumReleased());
+	SET_FLOAT_STAT(STAT_SpatialComponentUpdateMergeRatio, ComponentUpdateCoalescer.GetMergeRatio());
+	ComponentUpdateCoalescer.ResetCounters();
+}
+
 template <typename T, typename... ArgsType>
 void ULegacySpatialWorkerConnection::QueueOutgoingMessage(ArgsType&&... Args)
 {
-	// TODO UNR-1271: As later optimization, we can change the queue to hold a union
-	// of all outgoing message types, rather than having a pointer.
-	auto Message = MakeUnique<T>(Forward<ArgsType>(Args)...);
-	OnEnqueueMessage.Broadcast(Message.Get());
-	OutgoingMessagesQueue.Enqueue(MoveTemp(Message));
+	// Any message other than a coalesced update must not overtake updates that were sent before it.
+	QueueCoalescedComponentUpdates();
+
+	T* Message = OutgoingMessagesQueue.Emplace<T>(Forward<ArgsType>(Args)...);
+	OnEnqueueMessage.Broadcast(Message);
+	OutgoingMessagesQueue.Publish();
 }
@@ -0,0 +1,41 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Interop/Connection/OpListRing.h"
+
+#include "Math/UnrealMathUtility.h"
+
+namespace SpatialGDK
+{
+
+FOpListRing::FOpListRing(uint32 InCapacity)
+	: Mask(FMath::RoundUpToPowerOfTwo(FMath::Max(InCapacity, 1u)) - 1)
+	, NumPublished(0)
+	, ConsumedIndex(0)
+{
+	Slots.SetNum(Mask + 1);
+}
+
+bool FOpListRing::IsFull() const
+{
+	return WriteIndex - ConsumedIndex.Load() > Mask;
+}
+
+bool FOpListRing::Publish(OpList& Ops, uint64 ReceivedCycles)
+{
+	if (IsFull())
+	{
+		return false;
+	}
+
+	FSlot& Slot = Slots[WriteIndex & Mask];
+	Slot.Ops.Ops = Ops.Ops;
+	Slot.Ops.Count = Ops.Count;
+	Slot.Ops.Storage = MoveTemp(Ops.Storage);
+	Slot.ReceivedCycles = ReceivedCycles;
+
+	++WriteIndex;
+	++NumPublished;
+	return true;
+}
+
+} // namespace SpatialGDK
@@ -0,0 +1,156 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Interop/Connection/OutgoingMessageQueue.h"
+
+namespace SpatialGDK
+{
+
+FOutgoingMessageQueue::FSpillArena::~FSpillArena()
+{
+	for (const FBlock& Block : Blocks)
+	{
+		FMemory::Free(Block.Data);
+	}
+}
+
+void* FOutgoingMessageQueue::FSpillArena::Allocate(SIZE_T Size, uint32 Alignment)
+{
+	SIZE_T Offset = Align(BlockOffset, Alignment);
+	if (Blocks.Num() == 0 || Offset + Size > Blocks.Last().Size)
+	{
+		const SIZE_T NewBlockSize = FMath::Max(BlockSize, Size);
+		uint8* NewBlock = static_cast<uint8*>(FMemory::Malloc(NewBlockSize, FMath::Max<uint32>(Alignment, PLATFORM_CACHE_LINE_SIZE)));
+		Blocks.Add(FBlock{ NewBlock, NewBlockSize });
+		Offset = 0;
+	}
+
+	BlockOffset = Offset + Size;
+	return Blocks.Last().Data + Offset;
+}
+
+void FOutgoingMessageQueue::FSpillArena::Reset()
+{
+	for (int32 i = 1; i < Blocks.Num(); ++i)
+	{
+		FMemory::Free(Blocks[i].Data);
+	}
+	Blocks.SetNum(FMath::Min(Blocks.Num(), 1), false);
+	BlockOffset = 0;
+}
+
+FOutgoingMessageQueue::FOutgoingMessageQueue()
+	: WriteChunk(CreateChunk())
+	, ReadChunk(WriteChunk)
+	, SpareChunk(nullptr)
+{
+}
+
+FOutgoingMessageQueue::~FOutgoingMessageQueue()
+{
+	while (Peek() != nullptr)
+	{
+		Pop();
+	}
+
+	if (bHasUnpublishedMessage)
+	{
+		WriteChunk->Messages[WriteIndex]->~FOutgoingMessage();
+	}
+
+	// Once drained, the consumer has caught up with the producer's chunk.
+	check(ReadChunk == WriteChunk);
+	DestroyChunk(WriteChunk);
+
+	if (FChunk* Spare = SpareChunk.Exchange(nullptr))
+	{
+		DestroyChunk(Spare);
+	}
+}
+
+void FOutgoingMessageQueue::Publish()
+{
+	check(bHasUnpublishedMessage);
+	bHasUnpublishedMessage = false;
+	++WriteIndex;
+	WriteChunk->NumPublished.Store(WriteIndex);
+}
+
+FOutgoingMessage* FOutgoingMessageQueue::Peek()
+{
+	if (ReadIndex == SlotsPerChunk)
+	{
+		FChunk* NextChunk = ReadChunk->Next.Load();
+		if (NextChunk == nullptr)
+		{
+			return nullptr;
+		}
+
+		FChunk* DrainedChunk = ReadChunk;
+		ReadChunk = NextChunk;
+		ReadIndex = 0;
+		RecycleChunk(DrainedChunk);
+	}
+
+	if (ReadIndex < ReadChunk->NumPublished.Load())
+	{
+		return ReadChunk->Messages[ReadIndex];
+	}
+
+	return nullptr;
+}
+
+void FOutgoingMessageQueue::Pop()
+{
+	check(ReadIndex < ReadChunk->NumPublished.Load());
+	ReadChunk->Messages[ReadIndex]->~FOutgoingMessage();
+	++ReadIndex;
+}
+
+FOutgoingMessageQueue::FChunk* FOutgoingMessageQueue::CreateChunk()
+{
+	void* Memory = FMemory::Malloc(sizeof(FChunk), alignof(FChunk));
+	FChunk* Chunk = new (Memory) FChunk;
+	Chunk->NumPublished.Store(0);
+	Chunk->Next.Store(nullptr);
+	return Chunk;
+}
+
+void FOutgoingMessageQueue::DestroyChunk(FChunk* Chunk)
+{
+	Chunk->~FChunk();
+	FMemory::Free(Chunk);
+}
+
+FOutgoingMessageQueue::FChunk* FOutgoingMessageQueue::GetChunkForWrite()
+{
+	if (WriteIndex == SlotsPerChunk)
+	{
+		FChunk* NewChunk = SpareChunk.Exchange(nullptr);
+		if (NewChunk == nullptr)
+		{
+			NewChunk = CreateChunk();
+		}
+
+		WriteChunk->Next.Store(NewChunk);
+		WriteChunk = NewChunk;
+		WriteIndex = 0;
+	}
+
+	return WriteChunk;
+}
+
+void FOutgoingMessageQueue::RecycleChunk(FChunk* Chunk)
+{
+	// Only called once the producer has moved on to a later chunk, so the consumer has exclusive access.
+	Chunk->Spill.Reset();
+	Chunk->NumPublished.Store(0);
+	Chunk->Next.Store(nullptr);
+
+	// Keep at most one spare chunk around.
+	if (FChunk* PreviousSpare = SpareChunk.Exchange(Chunk))
+	{
+		DestroyChunk(PreviousSpare);
+	}
+}
+
+} // namespace SpatialGDK
@@ -54,13 +54,14 @@ void FEntityQueryRequest::TraverseConstraint(Worker_Constraint* Constraint)
 
 void SpatialMetrics::SendToConnection(Worker_Connection* Connection)
 {
-	// Do the conversion here so we can store everything on the stack.
+	// Do the conversion here so we can store everything on the stack. The inline sizes fit the GDK's own reports,
+	// and all histogram buckets share one array.
 	Worker_Metrics WorkerMetrics;
 
 	WorkerMetrics.load = Load.IsSet() ? &Load.GetValue() : nullptr;
 
-	TArray<Worker_GaugeMetric> WorkerGaugeMetrics;
-	WorkerGaugeMetrics.SetNum(GaugeMetrics.Num());
+	TArray<Worker_GaugeMetric, TInlineAllocator<64>> WorkerGaugeMetrics;
+	WorkerGaugeMetrics.SetNumUninitialized(GaugeMetrics.Num());
 	for (int i = 0; i < GaugeMetrics.Num(); i++)
 	{
 		WorkerGaugeMetrics[i].key = GaugeMetrics[i].Key.c_str();
@@ -70,24 +71,31 @@ void SpatialMetrics::SendToConnection(Worker_Connection* Connection)
 	WorkerMetrics.gauge_metric_count = static_cast<uint32_t>(WorkerGaugeMetrics.Num());
 	WorkerMetrics.gauge_metrics = WorkerGaugeMetrics.GetData();
 
-	TArray<Worker_HistogramMetric> WorkerHistogramMetrics;
-	TArray<TArray<Worker_HistogramMetricBucket>> WorkerHistogramMetricBuckets;
-	WorkerHistogramMetrics.SetNum(HistogramMetrics.Num());
-	WorkerHistogramMetricBuckets.SetNum(HistogramMetrics.Num());
+	int32 NumBuckets = 0;
+	for (const HistogramMetric& Metric : HistogramMetrics)
+	{
+		NumBuckets += Metric.Buckets.Num();
+	}
+
+	TArray<Worker_HistogramMetric, TInlineAllocator<16>> WorkerHistogramMetrics;
+	TArray<Worker_HistogramMetricBucket, TInlineAllocator<128>> WorkerHistogramMetricBuckets;
+	WorkerHistogramMetrics.SetNumUninitialized(HistogramMetrics.Num());
+	WorkerHistogramMetricBuckets.SetNumUninitialized(NumBuckets);
+	int32 FirstBucket = 0;
 	for (int i = 0; i < HistogramMetrics.Num(); i++)
 	{
 		WorkerHistogramMetrics[i].key = HistogramMetrics[i].Key.c_str();
 		WorkerHistogramMetrics[i].sum = HistogramMetrics[i].Sum;
 
-		WorkerHistogramMetricBuckets[i].SetNum(HistogramMetrics[i].Buckets.Num());
 		for (int j = 0; j < HistogramMetrics[i].Buckets.Num(); j++)
 		{
-			WorkerHistogramMetricBuckets[i][j].upper_bound = HistogramMetrics[i].Buckets[j].UpperBound;
-			WorkerHistogramMetricBuckets[i][j].samples = HistogramMetrics[i].Buckets[j].Samples;
+			WorkerHistogramMetricBuckets[FirstBucket + j].upper_bound = HistogramMetrics[i].Buckets[j].UpperBound;
+			WorkerHistogramMetricBuckets[FirstBucket + j].samples = HistogramMetrics[i].Buckets[j].Samples;
 		}
 
-		WorkerHistogramMetrics[i].bucket_count = static_cast<uint32_t>(WorkerHistogramMetricBuckets[i].Num());
-		WorkerHistogramMetrics[i].buckets = WorkerHistogramMetricBuckets[i].GetData();
+		WorkerHistogramMetrics[i].bucket_count = static_cast<uint32_t>(HistogramMetrics[i].Buckets.Num());
+		WorkerHistogramMetrics[i].buckets = WorkerHistogramMetricBuckets.GetData() + FirstBucket;
+		FirstBucket += HistogramMetrics[i].Buckets.Num();
 	}
 
 	WorkerMetrics.histogram_metric_count = static_cast<uint32_t>(WorkerHistogramMetrics.Num());
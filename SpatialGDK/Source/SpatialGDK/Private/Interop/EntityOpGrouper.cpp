@@ -0,0 +1,84 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Interop/EntityOpGrouper.h"
+
+namespace SpatialGDK
+{
+
+namespace
+{
+constexpr uint32 NumRadixPasses = sizeof(Worker_EntityId);
+constexpr uint32 RadixSize = 256;
+
+uint32 GetRadix(const Worker_ComponentUpdateOp* Op, uint32 Pass)
+{
+	return (static_cast<uint64>(Op->entity_id) >> (Pass * 8)) & (RadixSize - 1);
+}
+} // anonymous namespace
+
+void FEntityOpGrouper::Flush(TFunctionRef<void(Worker_EntityId, FEntityOps)> Callback)
+{
+	SortByEntityId();
+
+	int32 GroupStart = 0;
+	for (int32 i = 1; i <= Ops.Num(); ++i)
+	{
+		if (i == Ops.Num() || Ops[i]->entity_id != Ops[GroupStart]->entity_id)
+		{
+			Callback(Ops[GroupStart]->entity_id, FEntityOps(Ops.GetData() + GroupStart, i - GroupStart));
+			GroupStart = i;
+		}
+	}
+
+	Ops.Reset();
+}
+
+void FEntityOpGrouper::SortByEntityId()
+{
+	const int32 NumOps = Ops.Num();
+	if (NumOps < 2)
+	{
+		return;
+	}
+
+	// Count every byte of every entity ID up front, so each pass only has to scatter.
+	uint32 Counts[NumRadixPasses][RadixSize] = {};
+	for (const Worker_ComponentUpdateOp* Op : Ops)
+	{
+		for (uint32 Pass = 0; Pass < NumRadixPasses; ++Pass)
+		{
+			++Counts[Pass][GetRadix(Op, Pass)];
+		}
+	}
+
+	Scratch.SetNumUninitialized(NumOps, /* bAllowShrinking */ false);
+
+	for (uint32 Pass = 0; Pass < NumRadixPasses; ++Pass)
+	{
+		uint32* PassCounts = Counts[Pass];
+
+		// Every op is in the same bucket, so this pass wouldn't move anything.
+		if (PassCounts[GetRadix(Ops[0], Pass)] == static_cast<uint32>(NumOps))
+		{
+			continue;
+		}
+
+		uint32 Offset = 0;
+		for (uint32 Radix = 0; Radix < RadixSize; ++Radix)
+		{
+			const uint32 Count = PassCounts[Radix];
+			PassCounts[Radix] = Offset;
+			Offset += Count;
+		}
+
+		// Scattering in list order keeps the sort stable, which keeps the order of ops within an entity.
+		for (const Worker_ComponentUpdateOp* Op : Ops)
+		{
+			Scratch[PassCounts[GetRadix(Op, Pass)]++] = Op;
+		}
+
+		Swap(Ops, Scratch);
+	}
+}
+
+} // namespace SpatialGDK
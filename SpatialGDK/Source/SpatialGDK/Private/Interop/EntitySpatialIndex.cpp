@@ -0,0 +1,218 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Interop/EntitySpatialIndex.h"
+
+namespace SpatialGDK
+{
+
+FEntitySpatialIndex::FEntitySpatialIndex(double InCellSize)
+	: CellSize(InCellSize)
+	, LastQueryStamp(0)
+{
+	check(CellSize > 0.0);
+}
+
+template <typename VisitorType>
+void FEntitySpatialIndex::ForEachEntryInBounds(double MinX, double MinZ, double MaxX, double MaxZ, VisitorType&& Visit) const
+{
+	const FIntPoint MinCell = GetCell(MinX, MinZ);
+	const FIntPoint MaxCell = GetCell(MaxX, MaxZ);
+	const int64 NumCellsInBounds = int64(MaxCell.X - MinCell.X + 1) * int64(MaxCell.Y - MinCell.Y + 1);
+
+	// Shapes covering more cells than are occupied are cheaper to answer by visiting the occupied cells.
+	if (NumCellsInBounds > Cells.Num())
+	{
+		for (const auto& CellEntries : Cells)
+		{
+			const FIntPoint& Cell = CellEntries.Key;
+			if (Cell.X >= MinCell.X && Cell.X <= MaxCell.X && Cell.Y >= MinCell.Y && Cell.Y <= MaxCell.Y)
+			{
+				for (int32 EntryIndex : CellEntries.Value)
+				{
+					Visit(Entries[EntryIndex]);
+				}
+			}
+		}
+		return;
+	}
+
+	for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+	{
+		for (int32 CellZ = MinCell.Y; CellZ <= MaxCell.Y; ++CellZ)
+		{
+			if (const TArray<int32>* CellEntries = Cells.Find(FIntPoint(CellX, CellZ)))
+			{
+				for (int32 EntryIndex : *CellEntries)
+				{
+					Visit(Entries[EntryIndex]);
+				}
+			}
+		}
+	}
+}
+
+void FEntitySpatialIndex::SetEntityPosition(Worker_EntityId EntityId, const Coordinates& Position)
+{
+	const FIntPoint Cell = GetCell(Position.X, Position.Z);
+
+	if (const int32* ExistingIndex = EntityToEntryIndex.Find(EntityId))
+	{
+		FEntry& Entry = Entries[*ExistingIndex];
+		Entry.Position = Position;
+
+		if (Entry.Cell != Cell)
+		{
+			RemoveFromCell(*ExistingIndex);
+			Entry.Cell = Cell;
+			AddToCell(*ExistingIndex);
+		}
+		return;
+	}
+
+	const int32 EntryIndex = Entries.Add(FEntry{ EntityId, Position, Cell, INDEX_NONE, 0 });
+	EntityToEntryIndex.Add(EntityId, EntryIndex);
+	AddToCell(EntryIndex);
+}
+
+void FEntitySpatialIndex::RemoveEntity(Worker_EntityId EntityId)
+{
+	int32 EntryIndex;
+	if (!EntityToEntryIndex.RemoveAndCopyValue(EntityId, EntryIndex))
+	{
+		return;
+	}
+
+	RemoveFromCell(EntryIndex);
+
+	// Move the last entry into the gap, and point its cell and entity at its new index.
+	const int32 LastIndex = Entries.Num() - 1;
+	if (EntryIndex != LastIndex)
+	{
+		const FEntry& Moved = Entries[LastIndex];
+		Cells.FindChecked(Moved.Cell)[Moved.IndexInCell] = EntryIndex;
+		EntityToEntryIndex.FindChecked(Moved.EntityId) = EntryIndex;
+	}
+	Entries.RemoveAtSwap(EntryIndex, 1, /* bAllowShrinking */ false);
+}
+
+void FEntitySpatialIndex::QuerySpheres(TArrayView<const SphereConstraint> Spheres, TArray<Worker_EntityId>& OutEntityIds) const
+{
+	const uint32 Stamp = BeginQuery();
+
+	for (const SphereConstraint& Sphere : Spheres)
+	{
+		const Coordinates& Center = Sphere.Center;
+		const double RadiusSquared = Sphere.Radius * Sphere.Radius;
+
+		ForEachEntryInBounds(Center.X - Sphere.Radius, Center.Z - Sphere.Radius, Center.X + Sphere.Radius, Center.Z + Sphere.Radius, [&](const FEntry& Entry)
+		{
+			const double DX = Entry.Position.X - Center.X;
+			const double DY = Entry.Position.Y - Center.Y;
+			const double DZ = Entry.Position.Z - Center.Z;
+			if (Entry.QueryStamp != Stamp && DX * DX + DY * DY + DZ * DZ <= RadiusSquared)
+			{
+				Entry.QueryStamp = Stamp;
+				OutEntityIds.Add(Entry.EntityId);
+			}
+		});
+	}
+}
+
+void FEntitySpatialIndex::QueryCylinders(TArrayView<const CylinderConstraint> Cylinders, TArray<Worker_EntityId>& OutEntityIds) const
+{
+	const uint32 Stamp = BeginQuery();
+
+	for (const CylinderConstraint& Cylinder : Cylinders)
+	{
+		const Coordinates& Center = Cylinder.Center;
+		const double RadiusSquared = Cylinder.Radius * Cylinder.Radius;
+
+		ForEachEntryInBounds(Center.X - Cylinder.Radius, Center.Z - Cylinder.Radius, Center.X + Cylinder.Radius, Center.Z + Cylinder.Radius, [&](const FEntry& Entry)
+		{
+			const double DX = Entry.Position.X - Center.X;
+			const double DZ = Entry.Position.Z - Center.Z;
+			if (Entry.QueryStamp != Stamp && DX * DX + DZ * DZ <= RadiusSquared)
+			{
+				Entry.QueryStamp = Stamp;
+				OutEntityIds.Add(Entry.EntityId);
+			}
+		});
+	}
+}
+
+void FEntitySpatialIndex::QueryBoxes(TArrayView<const BoxConstraint> Boxes, TArray<Worker_EntityId>& OutEntityIds) const
+{
+	const uint32 Stamp = BeginQuery();
+
+	for (const BoxConstraint& Box : Boxes)
+	{
+		const Coordinates& Center = Box.Center;
+		const double HalfX = 0.5 * Box.EdgeLength.X;
+		const double HalfY = 0.5 * Box.EdgeLength.Y;
+		const double HalfZ = 0.5 * Box.EdgeLength.Z;
+
+		ForEachEntryInBounds(Center.X - HalfX, Center.Z - HalfZ, Center.X + HalfX, Center.Z + HalfZ, [&](const FEntry& Entry)
+		{
+			if (Entry.QueryStamp != Stamp
+				&& FMath::Abs(Entry.Position.X - Center.X) <= HalfX
+				&& FMath::Abs(Entry.Position.Y - Center.Y) <= HalfY
+				&& FMath::Abs(Entry.Position.Z - Center.Z) <= HalfZ)
+			{
+				Entry.QueryStamp = Stamp;
+				OutEntityIds.Add(Entry.EntityId);
+			}
+		});
+	}
+}
+
+bool FEntitySpatialIndex::IsOutsideLastQuery(Worker_EntityId EntityId) const
+{
+	const int32* EntryIndex = EntityToEntryIndex.Find(EntityId);
+	return EntryIndex != nullptr && Entries[*EntryIndex].QueryStamp != LastQueryStamp;
+}
+
+FIntPoint FEntitySpatialIndex::GetCell(double X, double Z) const
+{
+	return FIntPoint(FMath::FloorToInt(X / CellSize), FMath::FloorToInt(Z / CellSize));
+}
+
+void FEntitySpatialIndex::AddToCell(int32 EntryIndex)
+{
+	FEntry& Entry = Entries[EntryIndex];
+	TArray<int32>& Cell = Cells.FindOrAdd(Entry.Cell);
+	Entry.IndexInCell = Cell.Add(EntryIndex);
+}
+
+void FEntitySpatialIndex::RemoveFromCell(int32 EntryIndex)
+{
+	const FEntry& Entry = Entries[EntryIndex];
+	TArray<int32>& Cell = Cells.FindChecked(Entry.Cell);
+
+	Cell.RemoveAtSwap(Entry.IndexInCell, 1, /* bAllowShrinking */ false);
+	if (Entry.IndexInCell < Cell.Num())
+	{
+		Entries[Cell[Entry.IndexInCell]].IndexInCell = Entry.IndexInCell;
+	}
+
+	if (Cell.Num() == 0)
+	{
+		Cells.Remove(Entry.Cell);
+	}
+}
+
+uint32 FEntitySpatialIndex::BeginQuery() const
+{
+	++LastQueryStamp;
+	if (LastQueryStamp == 0)
+	{
+		// The stamp wrapped around, so old stamps could match new queries.
+		for (const FEntry& Entry : Entries)
+		{
+			Entry.QueryStamp = 0;
+		}
+		LastQueryStamp = 1;
+	}
+	return LastQueryStamp;
+}
+
+} // namespace SpatialGDK
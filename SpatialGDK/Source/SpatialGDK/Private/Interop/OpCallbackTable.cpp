@@ -0,0 +1,169 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Interop/OpCallbackTable.h"
+
+#include "Algo/BinarySearch.h"
+
+namespace SpatialGDK
+{
+
+FOpCallbackTable::FOpCallbackTable()
+{
+	Ranges.SetNumZeroed(NumComponentIds * NumRoutedOpTypes);
+}
+
+void FOpCallbackTable::Add(FCallbackId Id, Worker_ComponentId ComponentId, const TFunction<void(const Worker_AddComponentOp&)>& Callback)
+{
+	AddToList(AddComponentCallbacks, AddComponent, Id, ComponentId, Callback);
+}
+
+void FOpCallbackTable::Add(FCallbackId Id, Worker_ComponentId ComponentId, const TFunction<void(const Worker_RemoveComponentOp&)>& Callback)
+{
+	AddToList(RemoveComponentCallbacks, RemoveComponent, Id, ComponentId, Callback);
+}
+
+void FOpCallbackTable::Add(FCallbackId Id, Worker_ComponentId ComponentId, const TFunction<void(const Worker_AuthorityChangeOp&)>& Callback)
+{
+	AddToList(AuthorityChangeCallbacks, AuthorityChange, Id, ComponentId, Callback);
+}
+
+void FOpCallbackTable::Add(FCallbackId Id, Worker_ComponentId ComponentId, const TFunction<void(const Worker_ComponentUpdateOp&)>& Callback)
+{
+	AddToList(ComponentUpdateCallbacks, ComponentUpdate, Id, ComponentId, Callback);
+}
+
+void FOpCallbackTable::Add(FCallbackId Id, Worker_ComponentId ComponentId, const TFunction<void(const Worker_CommandRequestOp&)>& Callback)
+{
+	AddToList(CommandRequestCallbacks, CommandRequest, Id, ComponentId, Callback);
+}
+
+void FOpCallbackTable::Add(FCallbackId Id, Worker_ComponentId ComponentId, const TFunction<void(const Worker_CommandResponseOp&)>& Callback)
+{
+	AddToList(CommandResponseCallbacks, CommandResponse, Id, ComponentId, Callback);
+}
+
+bool FOpCallbackTable::Remove(FCallbackId Id)
+{
+	ERoutedOpType OpType;
+	if (!CallbackIdToOpType.RemoveAndCopyValue(Id, OpType))
+	{
+		return false;
+	}
+
+	switch (OpType)
+	{
+	case AddComponent:
+		RemoveFromList(AddComponentCallbacks, OpType, Id);
+		break;
+	case RemoveComponent:
+		RemoveFromList(RemoveComponentCallbacks, OpType, Id);
+		break;
+	case AuthorityChange:
+		RemoveFromList(AuthorityChangeCallbacks, OpType, Id);
+		break;
+	case ComponentUpdate:
+		RemoveFromList(ComponentUpdateCallbacks, OpType, Id);
+		break;
+	case CommandRequest:
+		RemoveFromList(CommandRequestCallbacks, OpType, Id);
+		break;
+	case CommandResponse:
+		RemoveFromList(CommandResponseCallbacks, OpType, Id);
+		break;
+	default:
+		checkNoEntry();
+		return false;
+	}
+
+	return true;
+}
+
+void FOpCallbackTable::Dispatch(Worker_ComponentId ComponentId, const Worker_Op& Op) const
+{
+	check(IsExternalSchemaComponent(ComponentId));
+	const uint32 ComponentIndex = ComponentId - SpatialConstants::MIN_EXTERNAL_SCHEMA_ID;
+
+	switch (Op.op_type)
+	{
+	case WORKER_OP_TYPE_ADD_COMPONENT:
+		RunCallbacks(AddComponentCallbacks, AddComponent, ComponentIndex, Op.op.add_component);
+		break;
+	case WORKER_OP_TYPE_REMOVE_COMPONENT:
+		RunCallbacks(RemoveComponentCallbacks, RemoveComponent, ComponentIndex, Op.op.remove_component);
+		break;
+	case WORKER_OP_TYPE_AUTHORITY_CHANGE:
+		RunCallbacks(AuthorityChangeCallbacks, AuthorityChange, ComponentIndex, Op.op.authority_change);
+		break;
+	case WORKER_OP_TYPE_COMPONENT_UPDATE:
+		RunCallbacks(ComponentUpdateCallbacks, ComponentUpdate, ComponentIndex, Op.op.component_update);
+		break;
+	case WORKER_OP_TYPE_COMMAND_REQUEST:
+		RunCallbacks(CommandRequestCallbacks, CommandRequest, ComponentIndex, Op.op.command_request);
+		break;
+	case WORKER_OP_TYPE_COMMAND_RESPONSE:
+		RunCallbacks(CommandResponseCallbacks, CommandResponse, ComponentIndex, Op.op.command_response);
+		break;
+	default:
+		// Only ops which have a component ID can be routed.
+		checkNoEntry();
+		break;
+	}
+}
+
+template <typename OpDataType>
+void FOpCallbackTable::AddToList(TCallbackList<OpDataType>& List, ERoutedOpType OpType, FCallbackId Id, Worker_ComponentId ComponentId, const TFunction<void(const OpDataType&)>& Callback)
+{
+	check(IsExternalSchemaComponent(ComponentId));
+	check(!CallbackIdToOpType.Contains(Id));
+
+	// Insert after the existing callbacks for the component, so callbacks run in registration order.
+	const int32 Index = Algo::UpperBound(List.ComponentIds, ComponentId);
+	List.Callbacks.Insert(Callback, Index);
+	List.Ids.Insert(Id, Index);
+	List.ComponentIds.Insert(ComponentId, Index);
+
+	CallbackIdToOpType.Add(Id, OpType);
+	RebuildRanges(OpType, List.ComponentIds);
+}
+
+template <typename OpDataType>
+void FOpCallbackTable::RemoveFromList(TCallbackList<OpDataType>& List, ERoutedOpType OpType, FCallbackId Id)
+{
+	const int32 Index = List.Ids.IndexOfByKey(Id);
+	check(Index != INDEX_NONE);
+
+	List.Callbacks.RemoveAt(Index);
+	List.Ids.RemoveAt(Index);
+	List.ComponentIds.RemoveAt(Index);
+
+	RebuildRanges(OpType, List.ComponentIds);
+}
+
+template <typename OpDataType>
+void FOpCallbackTable::RunCallbacks(const TCallbackList<OpDataType>& List, ERoutedOpType OpType, uint32 ComponentIndex, const OpDataType& Op) const
+{
+	const FCallbackRange& Range = GetRange(ComponentIndex, OpType);
+	for (uint32 Index = Range.Begin; Index < Range.End; ++Index)
+	{
+		List.Callbacks[Index](Op);
+	}
+}
+
+void FOpCallbackTable::RebuildRanges(ERoutedOpType OpType, const TArray<Worker_ComponentId>& SortedComponentIds)
+{
+	int32 Index = 0;
+	for (uint32 ComponentIndex = 0; ComponentIndex < NumComponentIds; ++ComponentIndex)
+	{
+		const Worker_ComponentId ComponentId = SpatialConstants::MIN_EXTERNAL_SCHEMA_ID + ComponentIndex;
+
+		FCallbackRange& Range = GetRange(ComponentIndex, OpType);
+		Range.Begin = Index;
+		while (Index < SortedComponentIds.Num() && SortedComponentIds[Index] == ComponentId)
+		{
+			++Index;
+		}
+		Range.End = Index;
+	}
+}
+
+} // namespace SpatialGDK
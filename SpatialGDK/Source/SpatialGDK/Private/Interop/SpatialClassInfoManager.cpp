@@ -7,6 +7,7 @@
 #include "Engine/Engine.h"
 #include "GameFramework/Actor.h"
 #include "Misc/MessageDialog.h"
+#include "Net/RepLayout.h"
 #include "Runtime/Launch/Resources/Version.h"
 #include "UObject/Class.h"
 #include "UObject/UObjectIterator.h"
@@ -19,7 +20,9 @@
 #include "EngineClasses/SpatialPackageMapClient.h"
 #include "EngineClasses/SpatialWorldSettings.h"
 #include "LoadBalancing/AbstractLBStrategy.h"
+#include "SpatialGDKSettings.h"
 #include "Utils/GDKPropertyMacros.h"
+#include "Utils/ObjectRefPathTable.h"
 #include "Utils/RepLayoutUtils.h"
 
 DEFINE_LOG_CATEGORY(LogSpatialClassInfoManager);
@@ -39,6 +42,8 @@ bool USpatialClassInfoManager::TryInit(USpatialNetDriver* InNetDriver)
 		return false;
 	}
 
+	SpatialGDK::FObjectRefPathTable::Get().Init(*SchemaDatabase, GetDefault<USpatialGDKSettings>()->bInternObjectRefPaths);
+
 	return true;
 }
 
@@ -137,6 +142,12 @@ void USpatialClassInfoManager::CreateClassInfoForClass(UClass* Class)
 		Info->RPCInfoMap.Add(RemoteFunction, RPCInfo);
 	}
 
+	// Uses the same rep layout as the replicators of objects of this class, so field infos line up with rep handles.
+	if (TSharedPtr<FRepLayout> RepLayout = NetDriver->GetObjectClassRepLayout(Class))
+	{
+		Info->RepFieldInfos = SpatialGDK::GetRepLayoutFieldInfos(*RepLayout);
+	}
+
 	const bool bTrackHandoverProperties = ShouldTrackHandoverProperties();
 	for (TFieldIterator<GDK_PROPERTY(Property)> PropertyIt(Class); PropertyIt; ++PropertyIt)
 	{
@@ -151,6 +162,7 @@ void USpatialClassInfoManager::CreateClassInfoForClass(UClass* Class)
 				HandoverInfo.Offset = Property->GetOffset_ForGC() + Property->ElementSize * ArrayIdx;
 				HandoverInfo.ArrayIdx = ArrayIdx;
 				HandoverInfo.Property = Property;
+				HandoverInfo.FieldInfo = SpatialGDK::GetSchemaFieldInfo(Property);
 
 				Info->HandoverProperties.Add(HandoverInfo);
 			}
@@ -169,6 +181,8 @@ void USpatialClassInfoManager::CreateClassInfoForClass(UClass* Class)
 		}
 	}
 
+	Info->HandoverLayout.Init(Info->HandoverProperties);
+
 	if (Class->IsChildOf<AActor>())
 	{
 		FinishConstructingActorClassInfo(ClassPath, Info);
@@ -5,6 +5,7 @@
 #include "Interop/SpatialReceiver.h"
 #include "Interop/SpatialStaticComponentView.h"
 #include "Interop/SpatialWorkerFlags.h"
+#include "SpatialGDKSettings.h"
 #include "UObject/UObjectIterator.h"
 #include "Utils/OpUtils.h"
 #include "Utils/SpatialMetrics.h"
@@ -31,20 +32,31 @@ void SpatialDispatcher::ProcessOps(const SpatialGDK::OpList& Ops)
 	check(Receiver.IsValid());
 	check(StaticComponentView.IsValid());
 
-	for (size_t i = 0; i < Ops.Count; ++i)
+	const bool bHasOpsToSkip = TakeOpsToSkip(Ops);
+	const bool bBatchComponentUpdates = GetDefault<USpatialGDKSettings>()->bBatchComponentUpdatesByEntity;
+
+	for (uint32 i = 0; i < Ops.Count; ++i)
 	{
 		Worker_Op* Op = &Ops.Ops[i];
 
-		if (OpsToSkip.Num() != 0 &&
-			OpsToSkip.Contains(Op))
+		if (bHasOpsToSkip && OpsToSkipInList[i])
+		{
+			continue;
+		}
+
+		const Worker_ComponentId ComponentId = SpatialGDK::GetComponentId(Op);
+		if (bBatchComponentUpdates && Op->op_type == WORKER_OP_TYPE_COMPONENT_UPDATE && !SpatialGDK::FOpCallbackTable::IsExternalSchemaComponent(ComponentId))
 		{
-			OpsToSkip.Remove(Op);
+			ComponentUpdatesByEntity.Add(Op->op.component_update);
 			continue;
 		}
 
-		if (IsExternalSchemaOp(Op))
+		// Any other op may depend on the updates received before it.
+		FlushComponentUpdates();
+
+		if (SpatialGDK::FOpCallbackTable::IsExternalSchemaComponent(ComponentId))
 		{
-			ProcessExternalSchemaOp(Op);
+			ProcessExternalSchemaOp(ComponentId, Op);
 			continue;
 		}
 
@@ -125,162 +137,107 @@ void SpatialDispatcher::ProcessOps(const SpatialGDK::OpList& Ops)
 		}
 	}
 
+	FlushComponentUpdates();
+
 	Receiver->FlushRemoveComponentOps();
 	Receiver->FlushRetryRPCs();
 }
 
-bool SpatialDispatcher::IsExternalSchemaOp(Worker_Op* Op) const
+void SpatialDispatcher::FlushComponentUpdates()
 {
-	Worker_ComponentId ComponentId = SpatialGDK::GetComponentId(Op);
-	return SpatialConstants::MIN_EXTERNAL_SCHEMA_ID <= ComponentId && ComponentId <= SpatialConstants::MAX_EXTERNAL_SCHEMA_ID;
+	if (ComponentUpdatesByEntity.IsEmpty())
+	{
+		return;
+	}
+
+	// The receiver applies each update to the static component view as it handles it.
+	ComponentUpdatesByEntity.Flush([this](Worker_EntityId EntityId, SpatialGDK::FEntityOpGrouper::FEntityOps EntityOps)
+	{
+		Receiver->OnEntityComponentUpdates(EntityId, EntityOps);
+	});
 }
 
-void SpatialDispatcher::ProcessExternalSchemaOp(Worker_Op* Op)
+bool SpatialDispatcher::TakeOpsToSkip(const SpatialGDK::OpList& Ops)
+{
+	if (OpsToSkip.Num() == 0)
+	{
+		return false;
+	}
+
+	bool bHasOpsToSkip = false;
+	OpsToSkipInList.Init(false, Ops.Count);
+
+	for (int32 i = OpsToSkip.Num() - 1; i >= 0; --i)
+	{
+		const Worker_Op* Op = OpsToSkip[i];
+		if (Op >= Ops.Ops && Op < Ops.Ops + Ops.Count)
+		{
+			OpsToSkipInList[Op - Ops.Ops] = true;
+			OpsToSkip.RemoveAtSwap(i);
+			bHasOpsToSkip = true;
+		}
+	}
+
+	return bHasOpsToSkip;
+}
+
+void SpatialDispatcher::ProcessExternalSchemaOp(Worker_ComponentId ComponentId, const Worker_Op* Op)
 {
-	Worker_ComponentId ComponentId = SpatialGDK::GetComponentId(Op);
-	check(ComponentId != SpatialConstants::INVALID_COMPONENT_ID);
 	check(StaticComponentView.IsValid());
 
-	switch (Op->op_type)
+	if (Op->op_type == WORKER_OP_TYPE_AUTHORITY_CHANGE)
 	{
-	case WORKER_OP_TYPE_AUTHORITY_CHANGE:
 		StaticComponentView->OnAuthorityChange(Op->op.authority_change);
-		// Intentional fall-through
-	case WORKER_OP_TYPE_ADD_COMPONENT:
-	case WORKER_OP_TYPE_REMOVE_COMPONENT:
-	case WORKER_OP_TYPE_COMPONENT_UPDATE:
-	case WORKER_OP_TYPE_COMMAND_REQUEST:
-	case WORKER_OP_TYPE_COMMAND_RESPONSE:
-		RunCallbacks(ComponentId, Op);
-		break;
-	default:
-		// This should never happen providing the GetComponentId function has
-		// the same explicit cases as the switch in this method
-		checkNoEntry();
-		return;
 	}
+
+	Callbacks.Dispatch(ComponentId, *Op);
 }
 
 SpatialDispatcher::FCallbackId SpatialDispatcher::OnAddComponent(Worker_ComponentId ComponentId, const TFunction<void(const Worker_AddComponentOp&)>& Callback)
 {
-	return AddGenericOpCallback(ComponentId, WORKER_OP_TYPE_ADD_COMPONENT, [Callback](const Worker_Op* Op)
-	{
-		Callback(Op->op.add_component);
-	});
+	const FCallbackId NewCallbackId = NextCallbackId++;
+	Callbacks.Add(NewCallbackId, ComponentId, Callback);
+	return NewCallbackId;
 }
 
 SpatialDispatcher::FCallbackId SpatialDispatcher::OnRemoveComponent(Worker_ComponentId ComponentId, const TFunction<void(const Worker_RemoveComponentOp&)>& Callback)
 {
-	return AddGenericOpCallback(ComponentId, WORKER_OP_TYPE_REMOVE_COMPONENT, [Callback](const Worker_Op* Op)
-	{
-		Callback(Op->op.remove_component);
-	});
+	const FCallbackId NewCallbackId = NextCallbackId++;
+	Callbacks.Add(NewCallbackId, ComponentId, Callback);
+	return NewCallbackId;
 }
 
 SpatialDispatcher::FCallbackId SpatialDispatcher::OnAuthorityChange(Worker_ComponentId ComponentId, const TFunction<void(const Worker_AuthorityChangeOp&)>& Callback)
 {
-	return AddGenericOpCallback(ComponentId, WORKER_OP_TYPE_AUTHORITY_CHANGE, [Callback](const Worker_Op* Op)
-	{
-		Callback(Op->op.authority_change);
-	});
+	const FCallbackId NewCallbackId = NextCallbackId++;
+	Callbacks.Add(NewCallbackId, ComponentId, Callback);
+	return NewCallbackId;
 }
 
 SpatialDispatcher::FCallbackId SpatialDispatcher::OnComponentUpdate(Worker_ComponentId ComponentId, const TFunction<void(const Worker_ComponentUpdateOp&)>& Callback)
 {
-	return AddGenericOpCallback(ComponentId, WORKER_OP_TYPE_COMPONENT_UPDATE, [Callback](const Worker_Op* Op)
-	{
-		Callback(Op->op.component_update);
-	});
+	const FCallbackId NewCallbackId = NextCallbackId++;
+	Callbacks.Add(NewCallbackId, ComponentId, Callback);
+	return NewCallbackId;
 }
 
 SpatialDispatcher::FCallbackId SpatialDispatcher::OnCommandRequest(Worker_ComponentId ComponentId, const TFunction<void(const Worker_CommandRequestOp&)>& Callback)
 {
-	return AddGenericOpCallback(ComponentId, WORKER_OP_TYPE_COMMAND_REQUEST, [Callback](const Worker_Op* Op)
-	{
-		Callback(Op->op.command_request);
-	});
+	const FCallbackId NewCallbackId = NextCallbackId++;
+	Callbacks.Add(NewCallbackId, ComponentId, Callback);
+	return NewCallbackId;
 }
 
 SpatialDispatcher::FCallbackId SpatialDispatcher::OnCommandResponse(Worker_ComponentId ComponentId, const TFunction<void(const Worker_CommandResponseOp&)>& Callback)
 {
-	return AddGenericOpCallback(ComponentId, WORKER_OP_TYPE_COMMAND_RESPONSE, [Callback](const Worker_Op* Op)
-	{
-		Callback(Op->op.command_response);
-	});
-}
-
-SpatialDispatcher::FCallbackId SpatialDispatcher::AddGenericOpCallback(Worker_ComponentId ComponentId, Worker_OpType OpType, const TFunction<void(const Worker_Op*)>& Callback)
-{
-	check(SpatialConstants::MIN_EXTERNAL_SCHEMA_ID <= ComponentId && ComponentId <= SpatialConstants::MAX_EXTERNAL_SCHEMA_ID);
 	const FCallbackId NewCallbackId = NextCallbackId++;
-	ComponentOpTypeToCallbacksMap.FindOrAdd(ComponentId).FindOrAdd(OpType).Add(UserOpCallbackData{ NewCallbackId, Callback });
-	CallbackIdToDataMap.Add(NewCallbackId, CallbackIdData{ ComponentId, OpType });
+	Callbacks.Add(NewCallbackId, ComponentId, Callback);
 	return NewCallbackId;
 }
 
 bool SpatialDispatcher::RemoveOpCallback(FCallbackId CallbackId)
 {
-	CallbackIdData* CallbackData = CallbackIdToDataMap.Find(CallbackId);
-	if (CallbackData == nullptr)
-	{
-		return false;
-	}
-
-	OpTypeToCallbacksMap* OpTypesToCallbacks = ComponentOpTypeToCallbacksMap.Find(CallbackData->ComponentId);
-	if (OpTypesToCallbacks == nullptr)
-	{
-		return false;
-	}
-
-	TArray<UserOpCallbackData>* ComponentCallbacks = OpTypesToCallbacks->Find(CallbackData->OpType);
-	if (ComponentCallbacks == nullptr)
-	{
-		return false;
-	}
-
-	int32 CallbackIndex = ComponentCallbacks->IndexOfByPredicate([CallbackId](const UserOpCallbackData& Data)
-	{
-		return Data.Id == CallbackId;
-	});
-	if (CallbackIndex == INDEX_NONE)
-	{
-		return false;
-	}
-
-	// If removing the only callback for a component ID / op type, delete map entries as applicable
-	if (ComponentCallbacks->Num() == 1)
-	{
-		if (OpTypesToCallbacks->Num() == 1)
-		{
-			ComponentOpTypeToCallbacksMap.Remove(CallbackData->ComponentId);
-			return true;
-		}
-		OpTypesToCallbacks->Remove(CallbackData->OpType);
-		return true;
-	}
-
-	ComponentCallbacks->RemoveAt(CallbackIndex);
-	return true;
-}
-
-void SpatialDispatcher::RunCallbacks(Worker_ComponentId ComponentId, const Worker_Op* Op)
-{
-	OpTypeToCallbacksMap* OpTypeCallbacks = ComponentOpTypeToCallbacksMap.Find(ComponentId);
-	if (OpTypeCallbacks == nullptr)
-	{
-		return;
-	}
-
-	TArray<UserOpCallbackData>* ComponentCallbacks = OpTypeCallbacks->Find(static_cast<Worker_OpType>(Op->op_type));
-	if (ComponentCallbacks == nullptr)
-	{
-		return;
-	}
-
-	for (UserOpCallbackData CallbackData : *ComponentCallbacks)
-	{
-		CallbackData.Callback(Op);
-	}
+	return Callbacks.Remove(CallbackId);
 }
 
 void SpatialDispatcher::MarkOpToSkip(const Worker_Op* Op)
@@ -6,6 +6,7 @@
 #include "Schema/ClientEndpoint.h"
 #include "Schema/MulticastRPCs.h"
 #include "Schema/ServerEndpoint.h"
+#include "SpatialGDKSettings.h"
 #include "Utils/SpatialLatencyTracer.h"
 
 DEFINE_LOG_CATEGORY(LogSpatialRPCService);
@@ -17,6 +18,7 @@ SpatialRPCService::SpatialRPCService(ExtractRPCDelegate ExtractRPCCallback, cons
 	: ExtractRPCCallback(ExtractRPCCallback)
 	, View(View)
 	, SpatialLatencyTracer(SpatialLatencyTracer)
+	, OverflowQueue(GetDefault<USpatialGDKSettings>()->RPCOverflowQueueMaxBytes)
 {
 }
 
@@ -26,11 +28,10 @@ EPushRPCResult SpatialRPCService::PushRPC(Worker_EntityId EntityId, ERPCType Typ
 
 	EPushRPCResult Result = EPushRPCResult::Success;
 
-	if (RPCRingBufferUtils::ShouldQueueOverflowed(Type) && OverflowedRPCs.Contains(EntityType))
+	if (RPCRingBufferUtils::ShouldQueueOverflowed(Type) && OverflowQueue.Contains(EntityType))
 	{
 		// Already has queued RPCs of this type, queue until those are pushed.
-		AddOverflowedRPC(EntityType, MoveTemp(Payload));
-		Result = EPushRPCResult::QueueOverflowed;
+		Result = AddOverflowedRPC(EntityType, MoveTemp(Payload));
 	}
 	else
 	{
@@ -38,7 +39,7 @@ EPushRPCResult SpatialRPCService::PushRPC(Worker_EntityId EntityId, ERPCType Typ
 
 		if (Result == EPushRPCResult::QueueOverflowed)
 		{
-			AddOverflowedRPC(EntityType, MoveTemp(Payload));
+			Result = AddOverflowedRPC(EntityType, MoveTemp(Payload));
 		}
 	}
 
@@ -102,11 +103,25 @@ EPushRPCResult SpatialRPCService::PushRPCInternal(Worker_EntityId EntityId, ERPC
 
 	uint64 NewRPCId = LastSentRPCIds.FindRef(EntityType) + 1;
 
+	const RPCRingBufferDescriptor Descriptor = RPCRingBufferUtils::GetRingBufferDescriptor(Type);
+
 	// Check capacity.
-	if (LastAckedRPCId + RPCRingBufferUtils::GetRingBufferSize(Type) >= NewRPCId)
+	bool bWritten = false;
+	if (LastAckedRPCId + Descriptor.GetCapacity() >= NewRPCId)
 	{
-		RPCRingBufferUtils::WriteRPCToSchema(EndpointObject, Type, NewRPCId, Payload);
+		if (Descriptor.IsPacked())
+		{
+			bWritten = WritePackedRPC(EntityType, Descriptor, EndpointObject, NewRPCId, LastAckedRPCId, Payload);
+		}
+		else
+		{
+			RPCRingBufferUtils::WriteRPCToSchema(EndpointObject, Type, NewRPCId, Payload);
+			bWritten = true;
+		}
+	}
 
+	if (bWritten)
+	{
 #if TRACE_LIB_ACTIVE
 		if (SpatialLatencyTracer != nullptr && Payload.Trace != InvalidTraceKey)
 		{
@@ -139,76 +154,113 @@ EPushRPCResult SpatialRPCService::PushRPCInternal(Worker_EntityId EntityId, ERPC
 	return EPushRPCResult::Success;
 }
 
-void SpatialRPCService::PushOverflowedRPCs()
+bool SpatialRPCService::WritePackedRPC(EntityRPCType EntityType, const RPCRingBufferDescriptor& Descriptor, Schema_Object* EndpointObject, uint64 RPCId, uint64 LastAckedRPCId, const RPCPayload& Payload)
 {
-	for (auto It = OverflowedRPCs.CreateIterator(); It; ++It)
+	PackedRingBufferState& State = PackedRingBufferStates.FindOrAdd(EntityType);
+	if (State.SlotLastRPCIds.Num() != Descriptor.RingBufferSize)
 	{
-		Worker_EntityId EntityId = It.Key().EntityId;
-		ERPCType Type = It.Key().Type;
-		TArray<RPCPayload>& OverflowedRPCArray = It.Value();
+		State.SlotLastRPCIds.SetNumZeroed(Descriptor.RingBufferSize);
+		State.NextSlot = 0;
+	}
 
-		int NumProcessed = 0;
-		bool bShouldDrop = false;
-		for (RPCPayload& Payload : OverflowedRPCArray)
-		{
-			const EPushRPCResult Result = PushRPCInternal(EntityId, Type, MoveTemp(Payload), false);
+	const bool bCanAppendToOpenSlot = State.OpenSlotObject != nullptr
+		&& State.OpenSlotEndpointObject == EndpointObject
+		&& State.OpenSlotGeneration == PendingSchemaObjectGeneration
+		&& State.NumRPCsInOpenSlot < Descriptor.PayloadsPerSlot;
 
-			switch (Result)
-			{
-			case EPushRPCResult::Success:
-				NumProcessed++;
-				break;
-			case EPushRPCResult::QueueOverflowed:
-				UE_LOG(LogSpatialRPCService, Log,
-					TEXT("SpatialRPCService::PushOverflowedRPCs: Sent some but not all overflowed RPCs. RPCs sent %d, RPCs still overflowed: %d, Entity: %lld, RPC type: %s"),
-					NumProcessed, OverflowedRPCArray.Num() - NumProcessed, EntityId, *SpatialConstants::RPCTypeToString(Type));
-				break;
-			case EPushRPCResult::DropOverflowed:
-				checkf(false, TEXT("Shouldn't be able to drop on overflow for RPC type that was previously queued."));
-				break;
-			case EPushRPCResult::HasAckAuthority:
-				UE_LOG(LogSpatialRPCService, Warning,
-					TEXT("SpatialRPCService::PushOverflowedRPCs: Gained authority over ack component for RPC type that was overflowed. Entity: %lld, RPC type: %s"),
-					EntityId, *SpatialConstants::RPCTypeToString(Type));
-				bShouldDrop = true;
-				break;
-			case EPushRPCResult::NoRingBufferAuthority:
-				UE_LOG(LogSpatialRPCService, Warning,
-					TEXT("SpatialRPCService::PushOverflowedRPCs: Lost authority over ring buffer component for RPC type that was overflowed. Entity: %lld, RPC type: %s"),
-					EntityId, *SpatialConstants::RPCTypeToString(Type));
-				bShouldDrop = true;
-				break;
-			default:
-				checkNoEntry();
-			}
+	if (bCanAppendToOpenSlot)
+	{
+		RPCRingBufferUtils::AppendRPCToSlot(EndpointObject, EntityType.Type, State.OpenSlotObject, RPCId, Payload);
+		State.NumRPCsInOpenSlot++;
+		State.SlotLastRPCIds[(State.NextSlot + Descriptor.RingBufferSize - 1) % Descriptor.RingBufferSize] = RPCId;
+		return true;
+	}
 
-#if TRACE_LIB_ACTIVE
-			ProcessResultToLatencyTrace(Result, Payload.Trace);
-#endif
+	// A slot can only be overwritten once every RPC in it has been acked, and only once per update.
+	if (State.SlotLastRPCIds[State.NextSlot] > LastAckedRPCId
+		|| Schema_GetObjectCount(EndpointObject, Descriptor.GetSlotFieldId(State.NextSlot)) > 0)
+	{
+		return false;
+	}
 
-			// This includes the valid case of RPCs still overflowing (EPushRPCResult::QueueOverflowed), as well as the error cases.
-			if (Result != EPushRPCResult::Success)
-			{
-				break;
-			}
-		}
+	State.OpenSlotObject = RPCRingBufferUtils::WriteRPCToSlot(EndpointObject, EntityType.Type, State.NextSlot, RPCId, Payload);
+	State.OpenSlotEndpointObject = EndpointObject;
+	State.OpenSlotGeneration = PendingSchemaObjectGeneration;
+	State.NumRPCsInOpenSlot = 1;
+	State.SlotLastRPCIds[State.NextSlot] = RPCId;
+	State.NextSlot = (State.NextSlot + 1) % Descriptor.RingBufferSize;
+
+	return true;
+}
 
-		if (NumProcessed == OverflowedRPCArray.Num() || bShouldDrop)
+void SpatialRPCService::InitPackedRingBufferState(EntityRPCType EntityType, const RPCRingBuffer& Buffer)
+{
+	if (Buffer.SlotLastRPCIds.Num() == 0)
+	{
+		return;
+	}
+
+	PackedRingBufferState& State = PackedRingBufferStates.Add(EntityType);
+	State.SlotLastRPCIds = Buffer.SlotLastRPCIds;
+
+	// Continue writing after the slot holding the most recent RPC.
+	uint64 LatestRPCId = 0;
+	for (int32 SlotIndex = 0; SlotIndex < State.SlotLastRPCIds.Num(); SlotIndex++)
+	{
+		if (State.SlotLastRPCIds[SlotIndex] > LatestRPCId)
 		{
-			It.RemoveCurrent();
+			LatestRPCId = State.SlotLastRPCIds[SlotIndex];
+			State.NextSlot = (SlotIndex + 1) % State.SlotLastRPCIds.Num();
 		}
-		else
+	}
+}
+
+void SpatialRPCService::PushOverflowedRPCs()
+{
+	OverflowQueue.Flush([this](EntityRPCType EntityType, RPCPayload& Payload) {
+		const Worker_EntityId EntityId = EntityType.EntityId;
+		const ERPCType Type = EntityType.Type;
+
+		const EPushRPCResult Result = PushRPCInternal(EntityId, Type, MoveTemp(Payload), false);
+
+#if TRACE_LIB_ACTIVE
+		ProcessResultToLatencyTrace(Result, Payload.Trace);
+#endif
+
+		switch (Result)
 		{
-			OverflowedRPCArray.RemoveAt(0, NumProcessed);
+		case EPushRPCResult::Success:
+			return EOverflowFlushResult::Pushed;
+		case EPushRPCResult::QueueOverflowed:
+			UE_LOG(LogSpatialRPCService, Log,
+				TEXT("SpatialRPCService::PushOverflowedRPCs: Sent some but not all overflowed RPCs. RPCs still overflowed: %u, Entity: %lld, RPC type: %s"),
+				OverflowQueue.Num(EntityType), EntityId, *SpatialConstants::RPCTypeToString(Type));
+			return EOverflowFlushResult::Stop;
+		case EPushRPCResult::DropOverflowed:
+			checkf(false, TEXT("Shouldn't be able to drop on overflow for RPC type that was previously queued."));
+			return EOverflowFlushResult::DropAll;
+		case EPushRPCResult::HasAckAuthority:
+			UE_LOG(LogSpatialRPCService, Warning,
+				TEXT("SpatialRPCService::PushOverflowedRPCs: Gained authority over ack component for RPC type that was overflowed. Entity: %lld, RPC type: %s"),
+				EntityId, *SpatialConstants::RPCTypeToString(Type));
+			return EOverflowFlushResult::DropAll;
+		case EPushRPCResult::NoRingBufferAuthority:
+			UE_LOG(LogSpatialRPCService, Warning,
+				TEXT("SpatialRPCService::PushOverflowedRPCs: Lost authority over ring buffer component for RPC type that was overflowed. Entity: %lld, RPC type: %s"),
+				EntityId, *SpatialConstants::RPCTypeToString(Type));
+			return EOverflowFlushResult::DropAll;
+		default:
+			checkNoEntry();
+			return EOverflowFlushResult::Stop;
 		}
-	}
+	});
 }
 
 void SpatialRPCService::ClearOverflowedRPCs(Worker_EntityId EntityId)
 {
 	for (uint8 RPCType = static_cast<uint8>(ERPCType::ClientReliable); RPCType <= static_cast<uint8>(ERPCType::NetMulticast); RPCType++)
 	{
-		OverflowedRPCs.Remove(EntityRPCType(EntityId, static_cast<ERPCType>(RPCType)));
+		OverflowQueue.Remove(EntityRPCType(EntityId, static_cast<ERPCType>(RPCType)));
 	}
 }
 
@@ -230,6 +282,7 @@ TArray<SpatialRPCService::UpdateToSend> SpatialRPCService::GetRPCsAndAcksToSend(
 	}
 
 	PendingComponentUpdatesToSend.Empty();
+	PendingSchemaObjectGeneration++;
 
 	return UpdatesToSend;
 }
@@ -244,6 +297,8 @@ TArray<FWorkerComponentData> SpatialRPCService::GetRPCComponentsOnEntityCreation
 
 	TArray<FWorkerComponentData> Components;
 
+	PendingSchemaObjectGeneration++;
+
 	for (Worker_ComponentId EndpointComponentId : EndpointComponentIds)
 	{
 		const EntityComponentId EntityComponent = { EntityId, EndpointComponentId };
@@ -309,6 +364,69 @@ void SpatialRPCService::ExtractRPCsForEntity(Worker_EntityId EntityId, Worker_Co
 	}
 }
 
+void SpatialRPCService::ExtractRPCsForUpdatedComponent(Worker_EntityId EntityId, Worker_ComponentId ComponentId)
+{
+	switch (ComponentId)
+	{
+	case SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID:
+		if (View->HasAuthority(EntityId, SpatialConstants::SERVER_ENDPOINT_COMPONENT_ID))
+		{
+			const ClientEndpoint* Endpoint = View->GetComponentData<ClientEndpoint>(EntityId);
+			ExtractRPCsIfChanged(EntityId, Endpoint->ReliableRPCBuffer, Endpoint->UpdateTick);
+			ExtractRPCsIfChanged(EntityId, Endpoint->UnreliableRPCBuffer, Endpoint->UpdateTick);
+		}
+		break;
+	case SpatialConstants::SERVER_ENDPOINT_COMPONENT_ID:
+		if (View->HasAuthority(EntityId, SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID))
+		{
+			const ServerEndpoint* Endpoint = View->GetComponentData<ServerEndpoint>(EntityId);
+			ExtractRPCsIfChanged(EntityId, Endpoint->ReliableRPCBuffer, Endpoint->UpdateTick);
+			ExtractRPCsIfChanged(EntityId, Endpoint->UnreliableRPCBuffer, Endpoint->UpdateTick);
+		}
+		break;
+	case SpatialConstants::MULTICAST_RPCS_COMPONENT_ID:
+	{
+		const MulticastRPCs* Component = View->GetComponentData<MulticastRPCs>(EntityId);
+		ExtractRPCsIfChanged(EntityId, Component->MulticastRPCBuffer, Component->UpdateTick);
+		break;
+	}
+	default:
+		checkNoEntry();
+		break;
+	}
+}
+
+void SpatialRPCService::SkipExtractingRPCsForUpdatedComponent(Worker_EntityId EntityId, Worker_ComponentId ComponentId)
+{
+	switch (ComponentId)
+	{
+	case SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID:
+		PartiallyExtractedBuffers.Add(EntityRPCType(EntityId, ERPCType::ServerReliable));
+		PartiallyExtractedBuffers.Add(EntityRPCType(EntityId, ERPCType::ServerUnreliable));
+		break;
+	case SpatialConstants::SERVER_ENDPOINT_COMPONENT_ID:
+		PartiallyExtractedBuffers.Add(EntityRPCType(EntityId, ERPCType::ClientReliable));
+		PartiallyExtractedBuffers.Add(EntityRPCType(EntityId, ERPCType::ClientUnreliable));
+		break;
+	case SpatialConstants::MULTICAST_RPCS_COMPONENT_ID:
+		PartiallyExtractedBuffers.Add(EntityRPCType(EntityId, ERPCType::NetMulticast));
+		break;
+	default:
+		checkNoEntry();
+		break;
+	}
+}
+
+void SpatialRPCService::ExtractRPCsIfChanged(Worker_EntityId EntityId, const RPCRingBuffer& Buffer, uint64 UpdateTick)
+{
+	// Updates which only touch acks or the other buffer can't hold new RPCs for this one.
+	if (Buffer.HasChangedSince(UpdateTick - 1)
+		|| (PartiallyExtractedBuffers.Num() > 0 && PartiallyExtractedBuffers.Contains(EntityRPCType(EntityId, Buffer.Type))))
+	{
+		ExtractRPCsForType(EntityId, Buffer.Type);
+	}
+}
+
 void SpatialRPCService::OnCheckoutMulticastRPCComponentOnEntity(Worker_EntityId EntityId)
 {
 	const MulticastRPCs* Component = View->GetComponentData<MulticastRPCs>(EntityId);
@@ -326,6 +444,7 @@ void SpatialRPCService::OnCheckoutMulticastRPCComponentOnEntity(Worker_EntityId
 void SpatialRPCService::OnRemoveMulticastRPCComponentForEntity(Worker_EntityId EntityId)
 {
 	LastSeenMulticastRPCIds.Remove(EntityId);
+	PartiallyExtractedBuffers.Remove(EntityRPCType(EntityId, ERPCType::NetMulticast));
 }
 
 void SpatialRPCService::OnEndpointAuthorityGained(Worker_EntityId EntityId, Worker_ComponentId ComponentId)
@@ -341,6 +460,8 @@ void SpatialRPCService::OnEndpointAuthorityGained(Worker_EntityId EntityId, Work
 		LastAckedRPCIds.Add(EntityRPCType(EntityId, ERPCType::ClientUnreliable), Endpoint->UnreliableRPCAck);
 		LastSentRPCIds.Add(EntityRPCType(EntityId, ERPCType::ServerReliable), Endpoint->ReliableRPCBuffer.LastSentRPCId);
 		LastSentRPCIds.Add(EntityRPCType(EntityId, ERPCType::ServerUnreliable), Endpoint->UnreliableRPCBuffer.LastSentRPCId);
+		InitPackedRingBufferState(EntityRPCType(EntityId, ERPCType::ServerReliable), Endpoint->ReliableRPCBuffer);
+		InitPackedRingBufferState(EntityRPCType(EntityId, ERPCType::ServerUnreliable), Endpoint->UnreliableRPCBuffer);
 		break;
 	}
 	case SpatialConstants::SERVER_ENDPOINT_COMPONENT_ID:
@@ -352,6 +473,8 @@ void SpatialRPCService::OnEndpointAuthorityGained(Worker_EntityId EntityId, Work
 		LastAckedRPCIds.Add(EntityRPCType(EntityId, ERPCType::ServerUnreliable), Endpoint->UnreliableRPCAck);
 		LastSentRPCIds.Add(EntityRPCType(EntityId, ERPCType::ClientReliable), Endpoint->ReliableRPCBuffer.LastSentRPCId);
 		LastSentRPCIds.Add(EntityRPCType(EntityId, ERPCType::ClientUnreliable), Endpoint->UnreliableRPCBuffer.LastSentRPCId);
+		InitPackedRingBufferState(EntityRPCType(EntityId, ERPCType::ClientReliable), Endpoint->ReliableRPCBuffer);
+		InitPackedRingBufferState(EntityRPCType(EntityId, ERPCType::ClientUnreliable), Endpoint->UnreliableRPCBuffer);
 		break;
 	}
 	case SpatialConstants::MULTICAST_RPCS_COMPONENT_ID:
@@ -373,6 +496,7 @@ void SpatialRPCService::OnEndpointAuthorityGained(Worker_EntityId EntityId, Work
 			LastSentRPCIds.Add(EntityRPCType(EntityId, ERPCType::NetMulticast), Component->MulticastRPCBuffer.LastSentRPCId);
 		}
 
+		InitPackedRingBufferState(EntityRPCType(EntityId, ERPCType::NetMulticast), Component->MulticastRPCBuffer);
 		break;
 	}
 	default:
@@ -389,10 +513,14 @@ void SpatialRPCService::OnEndpointAuthorityLost(Worker_EntityId EntityId, Worker
 	{
 		LastSeenRPCIds.Remove(EntityRPCType(EntityId, ERPCType::ClientReliable));
 		LastSeenRPCIds.Remove(EntityRPCType(EntityId, ERPCType::ClientUnreliable));
+		PartiallyExtractedBuffers.Remove(EntityRPCType(EntityId, ERPCType::ClientReliable));
+		PartiallyExtractedBuffers.Remove(EntityRPCType(EntityId, ERPCType::ClientUnreliable));
 		LastAckedRPCIds.Remove(EntityRPCType(EntityId, ERPCType::ClientReliable));
 		LastAckedRPCIds.Remove(EntityRPCType(EntityId, ERPCType::ClientUnreliable));
 		LastSentRPCIds.Remove(EntityRPCType(EntityId, ERPCType::ServerReliable));
 		LastSentRPCIds.Remove(EntityRPCType(EntityId, ERPCType::ServerUnreliable));
+		PackedRingBufferStates.Remove(EntityRPCType(EntityId, ERPCType::ServerReliable));
+		PackedRingBufferStates.Remove(EntityRPCType(EntityId, ERPCType::ServerUnreliable));
 
 		ClearOverflowedRPCs(EntityId);
 		break;
@@ -401,10 +529,14 @@ void SpatialRPCService::OnEndpointAuthorityLost(Worker_EntityId EntityId, Worker
 	{
 		LastSeenRPCIds.Remove(EntityRPCType(EntityId, ERPCType::ServerReliable));
 		LastSeenRPCIds.Remove(EntityRPCType(EntityId, ERPCType::ServerUnreliable));
+		PartiallyExtractedBuffers.Remove(EntityRPCType(EntityId, ERPCType::ServerReliable));
+		PartiallyExtractedBuffers.Remove(EntityRPCType(EntityId, ERPCType::ServerUnreliable));
 		LastAckedRPCIds.Remove(EntityRPCType(EntityId, ERPCType::ServerReliable));
 		LastAckedRPCIds.Remove(EntityRPCType(EntityId, ERPCType::ServerUnreliable));
 		LastSentRPCIds.Remove(EntityRPCType(EntityId, ERPCType::ClientReliable));
 		LastSentRPCIds.Remove(EntityRPCType(EntityId, ERPCType::ClientUnreliable));
+		PackedRingBufferStates.Remove(EntityRPCType(EntityId, ERPCType::ClientReliable));
+		PackedRingBufferStates.Remove(EntityRPCType(EntityId, ERPCType::ClientUnreliable));
 		ClearOverflowedRPCs(EntityId);
 		break;
 	}
@@ -413,6 +545,7 @@ void SpatialRPCService::OnEndpointAuthorityLost(Worker_EntityId EntityId, Worker
 		// Set last seen to last sent, so we don't process own RPCs after crossing the boundary.
 		LastSeenMulticastRPCIds.Add(EntityId, LastSentRPCIds[EntityRPCType(EntityId, ERPCType::NetMulticast)]);
 		LastSentRPCIds.Remove(EntityRPCType(EntityId, ERPCType::NetMulticast));
+		PackedRingBufferStates.Remove(EntityRPCType(EntityId, ERPCType::NetMulticast));
 		break;
 	}
 	default:
@@ -453,11 +586,12 @@ void SpatialRPCService::ExtractRPCsForType(Worker_EntityId EntityId, ERPCType Ty
 	const RPCRingBuffer& Buffer = GetBufferFromView(EntityId, Type);
 
 	uint64 LastProcessedRPCId = LastSeenRPCId;
+	bool bStoppedExtracting = false;
 	if (Buffer.LastSentRPCId >= LastSeenRPCId)
 	{
 		uint64 FirstRPCIdToRead = LastSeenRPCId + 1;
 
-		uint32 BufferSize = RPCRingBufferUtils::GetRingBufferSize(Type);
+		uint32 BufferSize = RPCRingBufferUtils::GetRingBufferCapacity(Type);
 		if (Buffer.LastSentRPCId > LastSeenRPCId + BufferSize)
 		{
 			UE_LOG(LogSpatialRPCService, Warning, TEXT("SpatialRPCService::ExtractRPCsForType: RPCs were overwritten without being processed! Entity: %lld, RPC type: %s, last seen RPC ID: %d, last sent ID: %d, buffer size: %d"),
@@ -473,6 +607,7 @@ void SpatialRPCService::ExtractRPCsForType(Worker_EntityId EntityId, ERPCType Ty
 				const bool bKeepExtracting = ExtractRPCCallback.Execute(EntityId, Type, Element.GetValue());
 				if (!bKeepExtracting)
 				{
+					bStoppedExtracting = true;
 					break;
 				}
 				LastProcessedRPCId = RPCId;
@@ -489,6 +624,15 @@ void SpatialRPCService::ExtractRPCsForType(Worker_EntityId EntityId, ERPCType Ty
 			EntityId, *SpatialConstants::RPCTypeToString(Type), Buffer.LastSentRPCId, LastSeenRPCId);
 	}
 
+	if (bStoppedExtracting)
+	{
+		PartiallyExtractedBuffers.Add(EntityTypePair);
+	}
+	else if (PartiallyExtractedBuffers.Num() > 0)
+	{
+		PartiallyExtractedBuffers.Remove(EntityTypePair);
+	}
+
 	if (LastProcessedRPCId > LastSeenRPCId)
 	{
 		if (Type == ERPCType::NetMulticast)
@@ -525,9 +669,20 @@ void SpatialRPCService::IncrementAckedRPCID(Worker_EntityId EntityId, ERPCType T
 	RPCRingBufferUtils::WriteAckToSchema(EndpointObject, Type, *LastAckedRPCId);
 }
 
-void SpatialRPCService::AddOverflowedRPC(EntityRPCType EntityType, RPCPayload&& Payload)
+EPushRPCResult SpatialRPCService::AddOverflowedRPC(EntityRPCType EntityType, RPCPayload&& Payload)
 {
-	OverflowedRPCs.FindOrAdd(EntityType).Add(MoveTemp(Payload));
+	switch (OverflowQueue.Enqueue(EntityType, MoveTemp(Payload)))
+	{
+	case EOverflowEnqueueResult::Queued:
+		return EPushRPCResult::QueueOverflowed;
+	case EOverflowEnqueueResult::Dropped:
+		return EPushRPCResult::DropOverflowed;
+	case EOverflowEnqueueResult::QueueFull:
+		return EPushRPCResult::OverflowQueueFull;
+	default:
+		checkNoEntry();
+		return EPushRPCResult::DropOverflowed;
+	}
 }
 
 uint64 SpatialRPCService::GetAckFromView(Worker_EntityId EntityId, ERPCType Type)
@@ -612,6 +767,10 @@ void SpatialRPCService::ProcessResultToLatencyTrace(const EPushRPCResult Result,
 			TraceMsg = TEXT("OverflowedAndDropped");
 			bEndTrace = true;
 			break;
+		case SpatialGDK::EPushRPCResult::OverflowQueueFull:
+			// The RPC is kept by the caller and pushed again later.
+			TraceMsg = TEXT("OverflowQueueFull");
+			break;
 		case SpatialGDK::EPushRPCResult::HasAckAuthority:
 			TraceMsg = TEXT("NoAckAuth");
 			bEndTrace = true;
@@ -41,6 +41,7 @@ DECLARE_CYCLE_STAT(TEXT("Receiver LeaveCritSection"), STAT_ReceiverLeaveCritSect
 DECLARE_CYCLE_STAT(TEXT("Receiver RemoveEntity"), STAT_ReceiverRemoveEntity, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("Receiver AddComponent"), STAT_ReceiverAddComponent, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("Receiver ComponentUpdate"), STAT_ReceiverComponentUpdate, STATGROUP_SpatialNet);
+DECLARE_CYCLE_STAT(TEXT("Receiver EntityComponentUpdates"), STAT_ReceiverEntityComponentUpdates, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("Receiver ApplyData"), STAT_ReceiverApplyData, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("Receiver ApplyHandover"), STAT_ReceiverApplyHandover, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("Receiver HandleRPC"), STAT_ReceiverHandleRPC, STATGROUP_SpatialNet);
@@ -70,6 +71,12 @@ void USpatialReceiver::Init(USpatialNetDriver* InNetDriver, FTimerManager* InTim
 	RPCService = InRPCService;
 
 	IncomingRPCs.BindProcessingFunction(FProcessRPCDelegate::CreateUObject(this, &USpatialReceiver::ApplyRPC));
+	if (GetDefault<USpatialGDKSettings>()->bResolveQueuedRPCsOnObjectResolution)
+	{
+		// RPCs waiting on unresolved objects are processed when the objects resolve. They are only retried periodically
+		// once they have waited long enough to be executed with unresolved parameters.
+		IncomingRPCs.SetUnresolvedRefsRetryTime(GetDefault<USpatialGDKSettings>()->QueuedIncomingRPCWaitTime);
+	}
 	PeriodicallyProcessIncomingRPCs();
 }
 
@@ -1586,32 +1593,10 @@ void USpatialReceiver::OnComponentUpdate(const Worker_ComponentUpdateOp& Op)
 		return;
 	}
 
-	USpatialActorChannel* Channel = NetDriver->GetActorChannelByEntityId(Op.entity_id);
+	USpatialActorChannel* Channel = GetChannelForComponentUpdate(Op.entity_id, Op.update.component_id);
 	if (Channel == nullptr)
 	{
-		// If there is no actor channel as a result of the actor being dormant, then assume the actor is about to become active.
-		if (StaticComponentView->HasComponent(Op.entity_id, SpatialConstants::DORMANT_COMPONENT_ID))
-		{
-			if (AActor* Actor = Cast<AActor>(PackageMap->GetObjectFromEntityId(Op.entity_id)))
-			{
-				Channel = GetOrRecreateChannelForDomantActor(Actor, Op.entity_id);
-
-				// As we haven't removed the dormant component just yet, this might be a single replication update where the actor
-				// remains dormant. Add it back to pending dormancy so the local worker can clean up the channel. If we do process
-				// a dormant component removal later in this frame, we'll clear the channel from pending dormancy channel then.
-				NetDriver->AddPendingDormantChannel(Channel);
-			}
-			else
-			{
-				UE_LOG(LogSpatialReceiver, Warning, TEXT("Worker: %s Dormant actor (entity: %lld) has been deleted on this worker but we have received a component update (id: %d) from the server."), *NetDriver->Connection->GetWorkerId(), Op.entity_id, Op.update.component_id);
-				return;
-			}
-		}
-		else
-		{
-			UE_LOG(LogSpatialReceiver, Log, TEXT("Worker: %s Entity: %lld Component: %d - No actor channel for update. This most likely occured due to the component updates that are sent when authority is lost during entity deletion."), *NetDriver->Connection->GetWorkerId(), Op.entity_id, Op.update.component_id);
-			return;
-		}
+		return;
 	}
 
 	uint32 Offset;
@@ -1663,6 +1648,188 @@ void USpatialReceiver::OnComponentUpdate(const Worker_ComponentUpdateOp& Op)
 	}
 }
 
+struct USpatialReceiver::DeferredObjectUpdate
+{
+	DeferredObjectUpdate(USpatialNetDriver* NetDriver, USpatialActorChannel& InChannel, UObject& InTargetObject)
+		: Channel(InChannel)
+		, TargetObject(InTargetObject)
+		, RepStateHelper(InChannel, InTargetObject)
+		, Reader(NetDriver, RepStateHelper.GetRefMap())
+	{
+		Reader.BeginDeferredUpdates();
+	}
+
+	void Finish(USpatialReceiver& Receiver)
+	{
+		Reader.EndDeferredUpdates(TargetObject, Channel);
+		RepStateHelper.Update(Receiver, Channel, TargetObject, bReferencesChanged);
+	}
+
+	USpatialActorChannel& Channel;
+	UObject& TargetObject;
+	RepStateUpdateHelper RepStateHelper;
+	ComponentReader Reader;
+	bool bReferencesChanged = false;
+};
+
+void USpatialReceiver::OnEntityComponentUpdates(Worker_EntityId EntityId, TArrayView<const Worker_ComponentUpdateOp* const> Ops)
+{
+	SCOPE_CYCLE_COUNTER(STAT_ReceiverEntityComponentUpdates);
+	if (IsEntityWaitingForAsyncLoad(EntityId))
+	{
+		for (const Worker_ComponentUpdateOp* Op : Ops)
+		{
+			StaticComponentView->OnComponentUpdate(*Op);
+			QueueComponentUpdateOpForAsyncLoad(*Op);
+		}
+		return;
+	}
+
+	// Consecutive updates to the same object are applied together, so it only gets one PreNetReceive / PostNetReceive
+	// and one round of RepNotifies. The object is finished before any other update is handled, so hand-written
+	// components and RPCs still see every update received before them.
+	// Each update is applied to the static component view just before it is handled, as on the per-op path, so handlers
+	// reading the view see the state as of their own update rather than the entity's final state.
+	TOptional<DeferredObjectUpdate> ObjectUpdate;
+	auto FinishObjectUpdate = [this, &ObjectUpdate]()
+	{
+		if (ObjectUpdate.IsSet())
+		{
+			ObjectUpdate->Finish(*this);
+			ObjectUpdate.Reset();
+		}
+	};
+
+	USpatialActorChannel* Channel = nullptr;
+	UObject* TargetObject = nullptr;
+	uint32 TargetObjectOffset = 0;
+
+	for (const Worker_ComponentUpdateOp* Op : Ops)
+	{
+		const Worker_ComponentId ComponentId = Op->update.component_id;
+
+		if (ComponentId < SpatialConstants::STARTING_GENERATED_COMPONENT_ID || ClassInfoManager->IsGeneratedQBIMarkerComponent(ComponentId))
+		{
+			FinishObjectUpdate();
+			StaticComponentView->OnComponentUpdate(*Op);
+			OnComponentUpdate(*Op);
+
+			// Handling RPCs can close the channel or destroy objects, so look them up again for the next update.
+			Channel = nullptr;
+			TargetObject = nullptr;
+			continue;
+		}
+
+		// Generated components are not stored in the view, but it still sees every update.
+		StaticComponentView->OnComponentUpdate(*Op);
+
+		if (Channel == nullptr)
+		{
+			// If this entity has a Tombstone component, abort all component processing
+			if (StaticComponentView->GetComponentData<Tombstone>(EntityId) != nullptr)
+			{
+				UE_LOG(LogSpatialReceiver, Warning, TEXT("Received component update for Entity: %lld Component: %d after tombstone marked dead.  Aborting update."), EntityId, ComponentId);
+				continue;
+			}
+
+			Channel = GetChannelForComponentUpdate(EntityId, ComponentId);
+			if (Channel == nullptr)
+			{
+				continue;
+			}
+		}
+
+		uint32 Offset;
+		bool bFoundOffset = ClassInfoManager->GetOffsetByComponentId(ComponentId, Offset);
+		if (!bFoundOffset)
+		{
+			UE_LOG(LogSpatialReceiver, Warning, TEXT("Worker: %s EntityId %d ComponentId %d - Could not find offset for component id when receiving a component update."), *NetDriver->Connection->GetWorkerId(), EntityId, ComponentId);
+			continue;
+		}
+
+		if (TargetObject == nullptr || Offset != TargetObjectOffset)
+		{
+			TargetObjectOffset = Offset;
+			if (Offset == 0)
+			{
+				TargetObject = Channel->GetActor();
+			}
+			else
+			{
+				TargetObject = PackageMap->GetObjectFromUnrealObjectRef(FUnrealObjectRef(EntityId, Offset)).Get();
+			}
+
+			if (TargetObject == nullptr)
+			{
+				UE_LOG(LogSpatialReceiver, Warning, TEXT("Entity: %d Component: %d - Couldn't find target object for update"), EntityId, ComponentId);
+				continue;
+			}
+		}
+
+		ESchemaComponentType Category = ClassInfoManager->GetCategoryByComponentId(ComponentId);
+		const bool bIsHandover = Category == ESchemaComponentType::SCHEMA_Handover;
+
+		if (bIsHandover && !NetDriver->IsServer())
+		{
+			UE_LOG(LogSpatialReceiver, Verbose, TEXT("Entity: %d Component: %d - Skipping Handover component because we're a client."), EntityId, ComponentId);
+			continue;
+		}
+		if (!bIsHandover && Category != ESchemaComponentType::SCHEMA_Data && Category != ESchemaComponentType::SCHEMA_OwnerOnly)
+		{
+			UE_LOG(LogSpatialReceiver, Verbose, TEXT("Entity: %d Component: %d - Skipping because it's an empty component update from an RPC component. (most likely as a result of gaining authority)"), EntityId, ComponentId);
+			continue;
+		}
+
+		if (!ObjectUpdate.IsSet() || &ObjectUpdate->TargetObject != TargetObject)
+		{
+			FinishObjectUpdate();
+			ObjectUpdate.Emplace(NetDriver, *Channel, *TargetObject);
+		}
+
+		ObjectUpdate->Reader.ApplyComponentUpdate(Op->update, *TargetObject, *Channel, bIsHandover, ObjectUpdate->bReferencesChanged);
+
+		if (IsTearOffUpdate(Op->update, *TargetObject))
+		{
+			FinishObjectUpdate();
+			Channel->ConditionalCleanUp(false, EChannelCloseReason::TearOff);
+			Channel = nullptr;
+			TargetObject = nullptr;
+		}
+	}
+
+	FinishObjectUpdate();
+}
+
+USpatialActorChannel* USpatialReceiver::GetChannelForComponentUpdate(Worker_EntityId EntityId, Worker_ComponentId ComponentId)
+{
+	USpatialActorChannel* Channel = NetDriver->GetActorChannelByEntityId(EntityId);
+	if (Channel != nullptr)
+	{
+		return Channel;
+	}
+
+	// If there is no actor channel as a result of the actor being dormant, then assume the actor is about to become active.
+	if (StaticComponentView->HasComponent(EntityId, SpatialConstants::DORMANT_COMPONENT_ID))
+	{
+		if (AActor* Actor = Cast<AActor>(PackageMap->GetObjectFromEntityId(EntityId)))
+		{
+			Channel = GetOrRecreateChannelForDomantActor(Actor, EntityId);
+
+			// As we haven't removed the dormant component just yet, this might be a single replication update where the actor
+			// remains dormant. Add it back to pending dormancy so the local worker can clean up the channel. If we do process
+			// a dormant component removal later in this frame, we'll clear the channel from pending dormancy channel then.
+			NetDriver->AddPendingDormantChannel(Channel);
+			return Channel;
+		}
+
+		UE_LOG(LogSpatialReceiver, Warning, TEXT("Worker: %s Dormant actor (entity: %lld) has been deleted on this worker but we have received a component update (id: %d) from the server."), *NetDriver->Connection->GetWorkerId(), EntityId, ComponentId);
+		return nullptr;
+	}
+
+	UE_LOG(LogSpatialReceiver, Log, TEXT("Worker: %s Entity: %lld Component: %d - No actor channel for update. This most likely occured due to the component updates that are sent when authority is lost during entity deletion."), *NetDriver->Connection->GetWorkerId(), EntityId, ComponentId);
+	return nullptr;
+}
+
 void USpatialReceiver::HandleRPCLegacy(const Worker_ComponentUpdateOp& Op)
 {
 	SCOPE_CYCLE_COUNTER(STAT_ReceiverHandleRPCLegacy);
@@ -1726,6 +1893,7 @@ void USpatialReceiver::HandleRPC(const Worker_ComponentUpdateOp& Op)
 		if (!ActorReceivingRPC.IsValid())
 		{
 			UE_LOG(LogSpatialReceiver, Error, TEXT("Entity receiving ring buffer RPC does not exist in PackageMap! Entity: %lld, Component: %d"), Op.entity_id, Op.update.component_id);
+			RPCService->SkipExtractingRPCsForUpdatedComponent(Op.entity_id, Op.update.component_id);
 			return;
 		}
 
@@ -1733,10 +1901,11 @@ void USpatialReceiver::HandleRPC(const Worker_ComponentUpdateOp& Op)
 		if (bActorRoleIsSimulatedProxy)
 		{
 			UE_LOG(LogSpatialReceiver, Verbose, TEXT("Will not process server RPC, Actor role changed to SimulatedProxy. This happens on migration. Entity: %lld"), Op.entity_id);
+			RPCService->SkipExtractingRPCsForUpdatedComponent(Op.entity_id, Op.update.component_id);
 			return;
 		}
 	}
-	RPCService->ExtractRPCsForEntity(Op.entity_id, Op.update.component_id);
+	RPCService->ExtractRPCsForUpdatedComponent(Op.entity_id, Op.update.component_id);
 }
 
 void USpatialReceiver::OnCommandRequest(const Worker_CommandRequestOp& Op)
@@ -1915,16 +2084,22 @@ void USpatialReceiver::ApplyComponentUpdate(const Worker_ComponentUpdate& Compon
 
 	// This is a temporary workaround, see UNR-841:
 	// If the update includes tearoff, close the channel and clean up the entity.
+	if (IsTearOffUpdate(ComponentUpdate, TargetObject))
+	{
+		Channel.ConditionalCleanUp(false, EChannelCloseReason::TearOff);
+	}
+}
+
+bool USpatialReceiver::IsTearOffUpdate(const Worker_ComponentUpdate& ComponentUpdate, const UObject& TargetObject) const
+{
 	if (TargetObject.IsA<AActor>() && ClassInfoManager->GetCategoryByComponentId(ComponentUpdate.component_id) == SCHEMA_Data)
 	{
 		Schema_Object* ComponentObject = Schema_GetComponentUpdateFields(ComponentUpdate.schema_type);
 
 		// Check if bTearOff has been set to true
-		if (GetBoolFromSchema(ComponentObject, SpatialConstants::ACTOR_TEAROFF_ID))
-		{
-			Channel.ConditionalCleanUp(false, EChannelCloseReason::TearOff);
-		}
+		return GetBoolFromSchema(ComponentObject, SpatialConstants::ACTOR_TEAROFF_ID);
 	}
+	return false;
 }
 
 FRPCErrorInfo USpatialReceiver::ApplyRPCInternal(UObject* TargetObject, UFunction* Function, const FPendingRPCParams& PendingRPCParams)
@@ -1987,6 +2162,10 @@ FRPCErrorInfo USpatialReceiver::ApplyRPCInternal(UObject* TargetObject, UFunctio
 			ErrorInfo.ErrorCode = ERPCResult::Success;
 		}
 	}
+	else
+	{
+		ErrorInfo.UnresolvedRefs = UnresolvedRefs.Array();
+	}
 
 	// Destroy the parameters.
 	// warning: highly dependent on UObject::ProcessEvent freeing of parms!
@@ -2243,11 +2422,22 @@ void USpatialReceiver::ResolvePendingOperations(UObject* Object, const FUnrealOb
 		if (ClassObjectRef.IsValid())
 		{
 			ResolveIncomingOperations(Object, ClassObjectRef);
+			if (GetDefault<USpatialGDKSettings>()->bResolveQueuedRPCsOnObjectResolution)
+			{
+				IncomingRPCs.ProcessRPCsWaitingOn(ClassObjectRef);
+			}
 		}
 	}
 
-	// TODO: UNR-1650 We're trying to resolve all queues, which introduces more overhead.
-	IncomingRPCs.ProcessRPCs();
+	if (GetDefault<USpatialGDKSettings>()->bResolveQueuedRPCsOnObjectResolution)
+	{
+		IncomingRPCs.ProcessRPCsWaitingOn(ObjectRef);
+	}
+	else
+	{
+		// TODO: UNR-1650 We're trying to resolve all queues, which introduces more overhead.
+		IncomingRPCs.ProcessRPCs();
+	}
 }
 
 void USpatialReceiver::ResolveIncomingOperations(UObject* Object, const FUnrealObjectRef& ObjectRef)
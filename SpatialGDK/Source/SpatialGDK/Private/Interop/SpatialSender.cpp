@@ -69,6 +69,8 @@ void USpatialSender::Init(USpatialNetDriver* InNetDriver, FTimerManager* InTimer
 	TimerManager = InTimerManager;
 	RPCService = InRPCService;
 
+	ParallelSerializer.Init(InNetDriver, GetDefault<USpatialGDKSettings>()->ParallelComponentSerializationMinObjectsPerTask);
+
 	OutgoingRPCs.BindProcessingFunction(FProcessRPCDelegate::CreateUObject(this, &USpatialSender::SendRPC));
 
 	// Attempt to send RPCs that might have been queued while waiting for authority over entities this worker created.
@@ -146,6 +148,8 @@ void USpatialSender::SendAddComponents(Worker_EntityId EntityId, TArray<FWorkerC
 		return;
 	}
 
+	FlushDeferredComponentUpdatesForEntity(EntityId);
+
 	// Update ComponentPresence.
 	check(StaticComponentView->HasAuthority(EntityId, SpatialConstants::COMPONENT_PRESENCE_COMPONENT_ID));
 	ComponentPresence* Presence = StaticComponentView->GetComponentData<ComponentPresence>(EntityId);
@@ -163,6 +167,8 @@ void USpatialSender::GainAuthorityThenAddComponent(USpatialActorChannel* Channel
 {
 	Worker_EntityId EntityId = Channel->GetEntityId();
 
+	FlushDeferredComponentUpdatesForEntity(EntityId);
+
 	TSharedRef<FPendingSubobjectAttachment> PendingSubobjectAttachment = MakeShared<FPendingSubobjectAttachment>();
 	PendingSubobjectAttachment->Subobject = Object;
 	PendingSubobjectAttachment->Info = Info;
@@ -228,6 +234,8 @@ void USpatialSender::SendRemoveComponentForClassInfo(Worker_EntityId EntityId, c
 
 void USpatialSender::SendRemoveComponents(Worker_EntityId EntityId, TArray<Worker_ComponentId> ComponentIds)
 {
+	FlushDeferredComponentUpdatesForEntity(EntityId);
+
 	check(StaticComponentView->HasAuthority(EntityId, SpatialConstants::COMPONENT_PRESENCE_COMPONENT_ID));
 	ComponentPresence* ComponentPresenceData = StaticComponentView->GetComponentData<ComponentPresence>(EntityId);
 	ComponentPresenceData->RemoveComponentIds(ComponentIds);
@@ -414,6 +422,24 @@ void USpatialSender::UpdateServerWorkerEntityInterestAndPosition()
 	}
 }
 
+void USpatialSender::SendServerWorkerLoadUpdate(double Load, uint32 AuthoritativeActorCount)
+{
+	if (NetDriver->WorkerEntityId == SpatialConstants::INVALID_ENTITY_ID
+		|| !StaticComponentView->HasAuthority(NetDriver->WorkerEntityId, SpatialConstants::SERVER_WORKER_COMPONENT_ID))
+	{
+		return;
+	}
+
+	FWorkerComponentUpdate Update = {};
+	Update.component_id = SpatialConstants::SERVER_WORKER_COMPONENT_ID;
+	Update.schema_type = Schema_CreateComponentUpdate();
+	Schema_Object* UpdateObject = Schema_GetComponentUpdateFields(Update.schema_type);
+	Schema_AddDouble(UpdateObject, SpatialConstants::SERVER_WORKER_LOAD_ID, Load);
+	Schema_AddUint32(UpdateObject, SpatialConstants::SERVER_WORKER_AUTHORITATIVE_ACTOR_COUNT_ID, AuthoritativeActorCount);
+
+	Connection->SendComponentUpdate(NetDriver->WorkerEntityId, &Update);
+}
+
 void USpatialSender::SendComponentUpdates(UObject* Object, const FClassInfo& Info, USpatialActorChannel* Channel, const FRepChangeState* RepChanges, const FHandoverChangeState* HandoverChanges, uint32& OutBytesWritten)
 {
 	SCOPE_CYCLE_COUNTER(STAT_SpatialSenderSendComponentUpdates);
@@ -421,6 +447,17 @@ void USpatialSender::SendComponentUpdates(UObject* Object, const FClassInfo& Inf
 
 	UE_LOG(LogSpatialSender, Verbose, TEXT("Sending component update (object: %s, entity: %lld)"), *Object->GetName(), EntityId);
 
+	if (bDeferringComponentUpdates)
+	{
+		// Bytes written by deferred updates are returned by FlushDeferredComponentUpdates.
+		if (!Channel->Actor->GetTearOff() && ParallelSerializer.TryDefer(Object, Info, EntityId, RepChanges, HandoverChanges, Channel->GetInterestDirty()))
+		{
+			return;
+		}
+
+		FlushDeferredComponentUpdatesForEntity(EntityId);
+	}
+
 	USpatialLatencyTracer* Tracer = USpatialLatencyTracer::GetTracer(Object);
 	ComponentFactory UpdateFactory(Channel->GetInterestDirty(), NetDriver, Tracer);
 
@@ -428,21 +465,54 @@ void USpatialSender::SendComponentUpdates(UObject* Object, const FClassInfo& Inf
 
 	for(int i = 0; i < ComponentUpdates.Num(); i++)
 	{
-		FWorkerComponentUpdate& Update = ComponentUpdates[i];
-		if (!NetDriver->StaticComponentView->HasAuthority(EntityId, Update.component_id))
-		{
-			UE_LOG(LogSpatialSender, Verbose, TEXT("Trying to send component update but don't have authority! Update will be queued and sent when authority gained. Component Id: %d, entity: %lld"), Update.component_id, EntityId);
+		SendOrQueueComponentUpdate(EntityId, ComponentUpdates[i]);
+	}
+}
 
-			// This is a temporary fix. A task to improve this has been created: UNR-955
-			// It may be the case that upon resolving a component, we do not have authority to send the update. In this case, we queue the update, to send upon receiving authority.
-			// Note: This will break in a multi-worker context, if we try to create an entity that we don't intend to have authority over. For this reason, this fix is only temporary.
-			TArray<FWorkerComponentUpdate>& UpdatesQueuedUntilAuthority = UpdatesQueuedUntilAuthorityMap.FindOrAdd(EntityId);
-			UpdatesQueuedUntilAuthority.Add(Update);
-			continue;
-		}
+void USpatialSender::BeginDeferringComponentUpdates()
+{
+	check(ParallelSerializer.GetNumDeferred() == 0);
+	bDeferringComponentUpdates = true;
+}
+
+uint32 USpatialSender::FlushDeferredComponentUpdates()
+{
+	bDeferringComponentUpdates = false;
+
+	return ParallelSerializer.Flush([this](Worker_EntityId EntityId, FWorkerComponentUpdate& Update)
+	{
+		SendOrQueueComponentUpdate(EntityId, Update);
+	});
+}
+
+void USpatialSender::FlushDeferredComponentUpdatesForEntity(Worker_EntityId EntityId)
+{
+	if (!bDeferringComponentUpdates)
+	{
+		return;
+	}
+
+	ParallelSerializer.FlushEntity(EntityId, [this](Worker_EntityId UpdateEntityId, FWorkerComponentUpdate& Update)
+	{
+		SendOrQueueComponentUpdate(UpdateEntityId, Update);
+	});
+}
+
+void USpatialSender::SendOrQueueComponentUpdate(Worker_EntityId EntityId, FWorkerComponentUpdate& Update)
+{
+	if (!NetDriver->StaticComponentView->HasAuthority(EntityId, Update.component_id))
+	{
+		UE_LOG(LogSpatialSender, Verbose, TEXT("Trying to send component update but don't have authority! Update will be queued and sent when authority gained. Component Id: %d, entity: %lld"), Update.component_id, EntityId);
 
-		Connection->SendComponentUpdate(EntityId, &Update);
+		// This is a temporary fix. A task to improve this has been created: UNR-955
+		// It may be the case that upon resolving a component, we do not have authority to send the update. In this case, we queue the update, to send upon receiving authority.
+		// Note: This will break in a multi-worker context, if we try to create an entity that we don't intend to have authority over. For this reason, this fix is only temporary.
+		TArray<FWorkerComponentUpdate>& UpdatesQueuedUntilAuthority = UpdatesQueuedUntilAuthorityMap.FindOrAdd(EntityId);
+		UpdatesQueuedUntilAuthority.Add(Update);
+		return;
 	}
+
+	Connection->SendComponentUpdate(EntityId, &Update);
 }
 
 // Apply (and clean up) any updates queued, due to being sent previously when they didn't have authority.
@@ -492,9 +562,9 @@ RPCPayload USpatialSender::CreateRPCPayloadFromParams(UObject* TargetObject, con
 	FSpatialNetBitWriter PayloadWriter = PackRPCDataToSpatialNetBitWriter(Function, Params);
 
 #if TRACE_LIB_ACTIVE
-	return RPCPayload(TargetObjectRef.Offset, RPCInfo.Index, TArray<uint8>(PayloadWriter.GetData(), PayloadWriter.GetNumBytes()), USpatialLatencyTracer::GetTracer(TargetObject)->RetrievePendingTrace(TargetObject, Function));
+	return RPCPayload(TargetObjectRef.Offset, RPCInfo.Index, PayloadWriter.MoveBytes(), USpatialLatencyTracer::GetTracer(TargetObject)->RetrievePendingTrace(TargetObject, Function));
 #else
-	return RPCPayload(TargetObjectRef.Offset, RPCInfo.Index, TArray<uint8>(PayloadWriter.GetData(), PayloadWriter.GetNumBytes()));
+	return RPCPayload(TargetObjectRef.Offset, RPCInfo.Index, PayloadWriter.MoveBytes());
 #endif
 }
 
@@ -527,6 +597,8 @@ void USpatialSender::SendInterestBucketComponentChange(const Worker_EntityId Ent
 
 void USpatialSender::SendActorTornOffUpdate(Worker_EntityId EntityId, Worker_ComponentId ComponentId)
 {
+	FlushDeferredComponentUpdatesForEntity(EntityId);
+
 	FWorkerComponentUpdate ComponentUpdate = {};
 
 	ComponentUpdate.component_id = ComponentId;
@@ -548,7 +620,12 @@ void USpatialSender::SendPositionUpdate(Worker_EntityId EntityId, const FVector&
 	}
 #endif
 
-	FWorkerComponentUpdate Update = Position::CreatePositionUpdate(Coordinates::FromFVector(Location));
+	FlushDeferredComponentUpdatesForEntity(EntityId);
+
+	const Coordinates Coords = Coordinates::FromFVector(Location);
+	StaticComponentView->OnLocalPositionUpdate(EntityId, Coords);
+
+	FWorkerComponentUpdate Update = Position::CreatePositionUpdate(Coords);
 	Connection->SendComponentUpdate(EntityId, &Update);
 }
 
@@ -568,6 +645,8 @@ void USpatialSender::SendAuthorityIntentUpdate(const AActor& Actor, VirtualWorke
 		return;
 	}
 
+	FlushDeferredComponentUpdatesForEntity(EntityId);
+
 	AuthorityIntentComponent->VirtualWorkerId = NewAuthoritativeVirtualWorkerId;
 	UE_LOG(LogSpatialSender, Log, TEXT("(%s) Sending authority intent update for entity id %d. Virtual worker '%d' should become authoritative over %s"),
 		*NetDriver->Connection->GetWorkerId(), EntityId, NewAuthoritativeVirtualWorkerId, *GetNameSafe(&Actor));
@@ -633,6 +712,9 @@ FRPCErrorInfo USpatialSender::SendRPC(const FPendingRPCParams& Params)
 	}
 	UObject* TargetObject = TargetObjectWeakPtr.Get();
 
+	// RPCs can refer to state replicated earlier in the frame, so that state must arrive first.
+	FlushDeferredComponentUpdatesForEntity(Params.ObjectRef.Entity);
+
 	const FClassInfo& ClassInfo = ClassInfoManager->GetOrCreateClassInfoByObject(TargetObject);
 	UFunction* Function = ClassInfo.RPCs[Params.Payload.Index];
 	if (Function == nullptr)
@@ -785,6 +867,11 @@ bool USpatialSender::SendRingBufferedRPC(UObject* TargetObject, UFunction* Funct
 		UE_LOG(LogSpatialSender, Log, TEXT("USpatialSender::SendRingBufferedRPC: Ring buffer queue overflowed, dropping RPC. Actor: %s, entity: %lld, function: %s"),
 			*TargetObject->GetPathName(), TargetObjectRef.Entity, *Function->GetName());
 		return true;
+	case EPushRPCResult::OverflowQueueFull:
+		// Keep the RPC in the RPC container so that it is pushed again once the overflow queue has drained.
+		UE_LOG(LogSpatialSender, Log, TEXT("USpatialSender::SendRingBufferedRPC: Ring buffer overflow queue is full, retrying RPC later. Actor: %s, entity: %lld, function: %s"),
+			*TargetObject->GetPathName(), TargetObjectRef.Entity, *Function->GetName());
+		return false;
 	case EPushRPCResult::HasAckAuthority:
 		UE_LOG(LogSpatialSender, Warning,
 			TEXT("USpatialSender::SendRingBufferedRPC: Worker has authority over ack component for RPC it is sending. RPC will not be sent. Actor: %s, entity: %lld, function: %s"),
@@ -848,6 +935,8 @@ void USpatialSender::RetryReliableRPC(TSharedRef<FReliableRPCForRetry> RetryRPC)
 		return;
 	}
 
+	FlushDeferredComponentUpdatesForEntity(TargetObjectRef.Entity);
+
 	Worker_CommandRequest CommandRequest = CreateRetryRPCCommandRequest(*RetryRPC, TargetObjectRef.Offset);
 	Worker_RequestId RequestId = Connection->SendCommandRequest(TargetObjectRef.Entity, &CommandRequest, SpatialConstants::UNREAL_RPC_ENDPOINT_COMMAND_ID);
 
@@ -865,14 +954,21 @@ void USpatialSender::RegisterChannelForPositionUpdate(USpatialActorChannel* Chan
 
 void USpatialSender::ProcessPositionUpdates()
 {
+	// Flatten the hierarchies of all moved actors first, then send every position update in one pass.
+	PendingPositionUpdates.Reset();
 	for (auto& Channel : ChannelsToUpdatePosition)
 	{
 		if (Channel.IsValid())
 		{
-			Channel->UpdateSpatialPosition();
+			Channel->GatherPositionUpdates(PendingPositionUpdates);
 		}
 	}
 
+	for (const TPair<Worker_EntityId, FVector>& PositionUpdate : PendingPositionUpdates)
+	{
+		SendPositionUpdate(PositionUpdate.Key, PositionUpdate.Value);
+	}
+
 	ChannelsToUpdatePosition.Empty();
 }
 
@@ -1044,13 +1140,32 @@ void USpatialSender::UpdateInterestComponent(AActor* Actor)
 		return;
 	}
 
-	FWorkerComponentUpdate Update = NetDriver->InterestFactory->CreateInterestUpdate(Actor, ClassInfoManager->GetOrCreateClassInfoByObject(Actor), EntityId);
+	FlushDeferredComponentUpdatesForEntity(EntityId);
+
+	const FClassInfo& Info = ClassInfoManager->GetOrCreateClassInfoByObject(Actor);
+
+	Worker_ComponentUpdate InterestUpdate;
+	if (USpatialActorChannel* Channel = NetDriver->GetActorChannelByEntityId(EntityId))
+	{
+		if (!NetDriver->InterestFactory->CreateInterestUpdateIfChanged(Actor, Info, EntityId, Channel->LastSentInterest, InterestUpdate))
+		{
+			return;
+		}
+	}
+	else
+	{
+		InterestUpdate = NetDriver->InterestFactory->CreateInterestUpdate(Actor, Info, EntityId);
+	}
+
+	FWorkerComponentUpdate Update = InterestUpdate;
 
 	Connection->SendComponentUpdate(EntityId, &Update);
 }
 
 void USpatialSender::RetireEntity(const Worker_EntityId EntityId, bool bIsNetStartupActor)
 {
+	FlushDeferredComponentUpdatesForEntity(EntityId);
+
 	if (bIsNetStartupActor)
 	{
 		Receiver->RemoveActor(EntityId);
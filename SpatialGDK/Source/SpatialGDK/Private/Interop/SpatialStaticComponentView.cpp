@@ -17,23 +17,55 @@
 #include "Schema/SpatialDebugging.h"
 #include "Schema/SpawnData.h"
 #include "Schema/UnrealMetadata.h"
+#include "SpatialGDKSettings.h"
 
-Worker_Authority USpatialStaticComponentView::GetAuthority(Worker_EntityId EntityId, Worker_ComponentId ComponentId) const
+namespace
 {
-	if (const TMap<Worker_ComponentId, Worker_Authority>* ComponentAuthorityMap = EntityComponentAuthorityMap.Find(EntityId))
+const int32 NumWellKnownComponentBits = 32;
+
+// Returns the bit of a well-known component in the authority bitset, or INDEX_NONE. GDK components are numbered down from
+// STARTING_GENERATED_COMPONENT_ID, and SpatialOS standard library components up from ENTITY_ACL_COMPONENT_ID.
+int32 GetWellKnownComponentBit(Worker_ComponentId ComponentId)
+{
+	if (ComponentId < SpatialConstants::STARTING_GENERATED_COMPONENT_ID && ComponentId >= SpatialConstants::STARTING_GENERATED_COMPONENT_ID - NumWellKnownComponentBits)
 	{
-		if (const Worker_Authority* Authority = ComponentAuthorityMap->Find(ComponentId))
-		{
-			return *Authority;
-		}
+		return SpatialConstants::STARTING_GENERATED_COMPONENT_ID - 1 - ComponentId;
 	}
 
-	return WORKER_AUTHORITY_NOT_AUTHORITATIVE;
+	if (ComponentId >= SpatialConstants::ENTITY_ACL_COMPONENT_ID && ComponentId < SpatialConstants::ENTITY_ACL_COMPONENT_ID + NumWellKnownComponentBits)
+	{
+		return NumWellKnownComponentBits + ComponentId - SpatialConstants::ENTITY_ACL_COMPONENT_ID;
+	}
+
+	return INDEX_NONE;
 }
+} // anonymous namespace
 
 bool USpatialStaticComponentView::HasAuthority(Worker_EntityId EntityId, Worker_ComponentId ComponentId) const
 {
-	return GetAuthority(EntityId, ComponentId) == WORKER_AUTHORITY_AUTHORITATIVE;
+	const FEntityAuthority* EntityAuthority = EntityAuthorityMap.Find(EntityId);
+	if (EntityAuthority == nullptr)
+	{
+		return false;
+	}
+
+	const int32 Bit = GetWellKnownComponentBit(ComponentId);
+	if (Bit != INDEX_NONE)
+	{
+		return (EntityAuthority->WellKnownComponentBits & (1ull << Bit)) != 0;
+	}
+
+	return EntityAuthority->OtherAuthoritativeComponents.Contains(ComponentId);
+}
+
+uint64 USpatialStaticComponentView::GetAuthorityGeneration(Worker_EntityId EntityId) const
+{
+	if (const FEntityAuthority* EntityAuthority = EntityAuthorityMap.Find(EntityId))
+	{
+		return EntityAuthority->Generation;
+	}
+
+	return 0;
 }
 
 bool USpatialStaticComponentView::HasComponent(Worker_EntityId EntityId, Worker_ComponentId ComponentId) const
@@ -119,6 +151,14 @@ void USpatialStaticComponentView::OnAddComponent(const Worker_AddComponentOp& Op
 		// Component is not hand written, but we still want to know the existence of it on this entity.
 		Data = nullptr;
 	}
+	if (Op.data.component_id == SpatialConstants::POSITION_COMPONENT_ID)
+	{
+		if (SpatialGDK::FEntitySpatialIndex* Index = GetOrCreateSpatialIndex())
+		{
+			Index->SetEntityPosition(Op.entity_id, static_cast<SpatialGDK::Position*>(Data.Get())->Coords);
+		}
+	}
+
 	EntityComponentMap.FindOrAdd(Op.entity_id).FindOrAdd(Op.data.component_id) = MoveTemp(Data);
 }
 
@@ -128,12 +168,22 @@ void USpatialStaticComponentView::OnRemoveComponent(const Worker_RemoveComponent
 	{
 		ComponentMap->Remove(Op.component_id);
 	}
+
+	if (SpatialIndex.IsValid() && Op.component_id == SpatialConstants::POSITION_COMPONENT_ID)
+	{
+		SpatialIndex->RemoveEntity(Op.entity_id);
+	}
 }
 
 void USpatialStaticComponentView::OnRemoveEntity(Worker_EntityId EntityId)
 {
 	EntityComponentMap.Remove(EntityId);
-	EntityComponentAuthorityMap.Remove(EntityId);
+	EntityAuthorityMap.Remove(EntityId);
+
+	if (SpatialIndex.IsValid())
+	{
+		SpatialIndex->RemoveEntity(EntityId);
+	}
 }
 
 void USpatialStaticComponentView::OnComponentUpdate(const Worker_ComponentUpdateOp& Op)
@@ -182,10 +232,61 @@ void USpatialStaticComponentView::OnComponentUpdate(const Worker_ComponentUpdate
 	if (Component)
 	{
 		Component->ApplyComponentUpdate(Op.update);
+
+		if (SpatialIndex.IsValid() && Op.update.component_id == SpatialConstants::POSITION_COMPONENT_ID)
+		{
+			SpatialIndex->SetEntityPosition(Op.entity_id, static_cast<SpatialGDK::Position*>(Component)->Coords);
+		}
 	}
 }
 
 void USpatialStaticComponentView::OnAuthorityChange(const Worker_AuthorityChangeOp& Op)
 {
-	EntityComponentAuthorityMap.FindOrAdd(Op.entity_id).FindOrAdd(Op.component_id) = (Worker_Authority)Op.authority;
+	FEntityAuthority& EntityAuthority = EntityAuthorityMap.FindOrAdd(Op.entity_id);
+	const bool bAuthoritative = Op.authority == WORKER_AUTHORITY_AUTHORITATIVE;
+
+	const int32 Bit = GetWellKnownComponentBit(Op.component_id);
+	if (Bit != INDEX_NONE)
+	{
+		if (bAuthoritative)
+		{
+			EntityAuthority.WellKnownComponentBits |= 1ull << Bit;
+		}
+		else
+		{
+			EntityAuthority.WellKnownComponentBits &= ~(1ull << Bit);
+		}
+	}
+	else if (bAuthoritative)
+	{
+		EntityAuthority.OtherAuthoritativeComponents.AddUnique(Op.component_id);
+	}
+	else
+	{
+		EntityAuthority.OtherAuthoritativeComponents.RemoveSingleSwap(Op.component_id);
+	}
+
+	EntityAuthority.Generation = ++LastAuthorityGeneration;
+}
+
+void USpatialStaticComponentView::OnLocalPositionUpdate(Worker_EntityId EntityId, const SpatialGDK::Coordinates& Coords)
+{
+	if (SpatialIndex.IsValid() && SpatialIndex->Contains(EntityId))
+	{
+		SpatialIndex->SetEntityPosition(EntityId, Coords);
+	}
+}
+
+SpatialGDK::FEntitySpatialIndex* USpatialStaticComponentView::GetOrCreateSpatialIndex()
+{
+	if (!SpatialIndex.IsValid())
+	{
+		const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+		if (!SpatialGDKSettings->bEnableEntitySpatialIndex)
+		{
+			return nullptr;
+		}
+		SpatialIndex = MakeUnique<SpatialGDK::FEntitySpatialIndex>(SpatialGDKSettings->EntitySpatialIndexCellSize);
+	}
+	return SpatialIndex.Get();
 }
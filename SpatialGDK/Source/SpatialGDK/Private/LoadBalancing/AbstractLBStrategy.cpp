@@ -14,3 +14,13 @@ void UAbstractLBStrategy::SetLocalVirtualWorkerId(VirtualWorkerId InLocalVirtual
 {
 	LocalVirtualWorkerId = InLocalVirtualWorkerId;
 }
+
+void UAbstractLBStrategy::WhoShouldHaveAuthority(TArrayView<const AActor*> Actors, TArrayView<VirtualWorkerId> OutVirtualWorkerIds) const
+{
+	check(Actors.Num() == OutVirtualWorkerIds.Num());
+
+	for (int32 i = 0; i < Actors.Num(); i++)
+	{
+		OutVirtualWorkerIds[i] = WhoShouldHaveAuthority(*Actors[i]);
+	}
+}
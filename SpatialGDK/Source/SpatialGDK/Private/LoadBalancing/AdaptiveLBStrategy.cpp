@@ -0,0 +1,438 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "LoadBalancing/AdaptiveLBStrategy.h"
+
+#include "SpatialConstants.h"
+#include "Utils/SpatialActorUtils.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+
+DEFINE_LOG_CATEGORY(LogAdaptiveLBStrategy);
+
+namespace
+{
+// Enough to find a balanced split to well under a centimetre in any sensible world size.
+const int32 NumSplitSearchIterations = 24;
+
+// Rebalances that move no split further than this, in cm, are not published.
+const float MinSplitMovement = 1.f;
+} // anonymous namespace
+
+UAdaptiveLBStrategy::UAdaptiveLBStrategy()
+	: Super()
+	, NumWorkers(4)
+	, WorldWidth(1000000.f)
+	, WorldHeight(1000000.f)
+	, InterestBorder(0.f)
+	, RebalanceInterval(10.f)
+	, ImbalanceThreshold(1.2f)
+	, RebalanceRate(0.5f)
+	, MinRegionSize(1000.f)
+	, ActorCountLoadWeight(0.5f)
+	, LocalRegionIndex(0)
+	, bIsStrategyUsedOnLocalWorker(false)
+{
+}
+
+void UAdaptiveLBStrategy::Init()
+{
+	Super::Init();
+
+	UE_LOG(LogAdaptiveLBStrategy, Log, TEXT("AdaptiveLBStrategy initialized with NumWorkers = %d."), NumWorkers);
+
+	Nodes.Reset();
+	SplitPositions.Reset();
+	Regions.SetNum(NumWorkers);
+
+	int32 NextLeafIndex = 0;
+	BuildNode(GetWorldBounds(), NumWorkers, NextLeafIndex);
+	UpdateRegions(0, GetWorldBounds());
+}
+
+void UAdaptiveLBStrategy::SetLocalVirtualWorkerId(VirtualWorkerId InLocalVirtualWorkerId)
+{
+	if (!VirtualWorkerIds.Contains(InLocalVirtualWorkerId))
+	{
+		// This worker is simulating a layer which is not part of this strategy.
+		LocalRegionIndex = Regions.Num();
+		bIsStrategyUsedOnLocalWorker = false;
+	}
+	else
+	{
+		LocalRegionIndex = VirtualWorkerIds.IndexOfByKey(InLocalVirtualWorkerId);
+		bIsStrategyUsedOnLocalWorker = true;
+	}
+	LocalVirtualWorkerId = InLocalVirtualWorkerId;
+}
+
+TSet<VirtualWorkerId> UAdaptiveLBStrategy::GetVirtualWorkerIds() const
+{
+	return TSet<VirtualWorkerId>(VirtualWorkerIds);
+}
+
+bool UAdaptiveLBStrategy::ShouldHaveAuthority(const AActor& Actor) const
+{
+	if (!IsReady())
+	{
+		UE_LOG(LogAdaptiveLBStrategy, Warning, TEXT("AdaptiveLBStrategy not ready to relinquish authority for Actor %s."), *AActor::GetDebugName(&Actor));
+		return false;
+	}
+
+	if (!bIsStrategyUsedOnLocalWorker)
+	{
+		return false;
+	}
+
+	const FVector2D Actor2DLocation = FVector2D(SpatialGDK::GetActorSpatialPosition(&Actor));
+	return IsInside(Regions[LocalRegionIndex], Actor2DLocation);
+}
+
+VirtualWorkerId UAdaptiveLBStrategy::WhoShouldHaveAuthority(const AActor& Actor) const
+{
+	if (!IsReady())
+	{
+		UE_LOG(LogAdaptiveLBStrategy, Warning, TEXT("AdaptiveLBStrategy not ready to decide on authority for Actor %s."), *AActor::GetDebugName(&Actor));
+		return SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+	}
+
+	const FVector2D Actor2DLocation = FVector2D(SpatialGDK::GetActorSpatialPosition(&Actor));
+	const VirtualWorkerId VirtualWorker = GetVirtualWorkerForLocation(Actor2DLocation);
+	if (VirtualWorker == SpatialConstants::INVALID_VIRTUAL_WORKER_ID)
+	{
+		UE_LOG(LogAdaptiveLBStrategy, Error, TEXT("AdaptiveLBStrategy couldn't determine virtual worker for Actor %s at position %s"), *AActor::GetDebugName(&Actor), *Actor2DLocation.ToString());
+		return SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+	}
+
+	UE_LOG(LogAdaptiveLBStrategy, Verbose, TEXT("Actor: %s, worker %d for position %s"), *AActor::GetDebugName(&Actor), VirtualWorker, *Actor2DLocation.ToString());
+	return VirtualWorker;
+}
+
+SpatialGDK::QueryConstraint UAdaptiveLBStrategy::GetWorkerInterestQueryConstraint() const
+{
+	// The interest area is the region that the worker is authoritative over plus some border region.
+	check(IsReady());
+	check(bIsStrategyUsedOnLocalWorker);
+
+	const FBox2D Interest2D = Regions[LocalRegionIndex].ExpandBy(InterestBorder);
+
+	const FVector2D Center2D = Interest2D.GetCenter();
+	const FVector Center3D{ Center2D.X, Center2D.Y, 0.0f };
+
+	const FVector2D EdgeLengths2D = Interest2D.GetSize();
+	check(EdgeLengths2D.X > 0.0f && EdgeLengths2D.Y > 0.0f);
+	const FVector EdgeLengths3D{ EdgeLengths2D.X, EdgeLengths2D.Y, FLT_MAX };
+
+	SpatialGDK::QueryConstraint Constraint;
+	Constraint.BoxConstraint = SpatialGDK::BoxConstraint{ SpatialGDK::Coordinates::FromFVector(Center3D), SpatialGDK::EdgeLength::FromFVector(EdgeLengths3D) };
+	return Constraint;
+}
+
+FVector UAdaptiveLBStrategy::GetWorkerEntityPosition() const
+{
+	check(IsReady());
+	check(bIsStrategyUsedOnLocalWorker);
+	const FVector2D Centre = Regions[LocalRegionIndex].GetCenter();
+	return FVector{ Centre.X, Centre.Y, 0.f };
+}
+
+uint32 UAdaptiveLBStrategy::GetMinimumRequiredWorkers() const
+{
+	return NumWorkers;
+}
+
+void UAdaptiveLBStrategy::SetVirtualWorkerIds(const VirtualWorkerId& FirstVirtualWorkerId, const VirtualWorkerId& LastVirtualWorkerId)
+{
+	UE_LOG(LogAdaptiveLBStrategy, Log, TEXT("Setting VirtualWorkerIds %d to %d"), FirstVirtualWorkerId, LastVirtualWorkerId);
+	for (VirtualWorkerId CurrentVirtualWorkerId = FirstVirtualWorkerId; CurrentVirtualWorkerId <= LastVirtualWorkerId; CurrentVirtualWorkerId++)
+	{
+		VirtualWorkerIds.Add(CurrentVirtualWorkerId);
+	}
+}
+
+bool UAdaptiveLBStrategy::UpdateRegionsFromLoad(const TMap<VirtualWorkerId, FWorkerLoadReport>& LoadReports)
+{
+	if (!IsDynamic() || VirtualWorkerIds.Num() != Regions.Num())
+	{
+		return false;
+	}
+
+	double TotalReportedLoad = 0.0;
+	double TotalActorCount = 0.0;
+	for (VirtualWorkerId VirtualWorker : VirtualWorkerIds)
+	{
+		const FWorkerLoadReport* Report = LoadReports.Find(VirtualWorker);
+		if (Report == nullptr)
+		{
+			UE_LOG(LogAdaptiveLBStrategy, Verbose, TEXT("No load reported for virtual worker %d yet, not rebalancing."), VirtualWorker);
+			return false;
+		}
+		TotalReportedLoad += FMath::Max(Report->Load, 0.0);
+		TotalActorCount += Report->AuthoritativeActorCount;
+	}
+
+	if (TotalReportedLoad <= 0.0 && TotalActorCount <= 0.0)
+	{
+		return false;
+	}
+
+	// Both measures are normalised by their mean before blending, so the mean blended load is 1.
+	// If one of them is missing, for example because metrics are disabled, the other one is used alone.
+	const float ActorCountWeight = TotalReportedLoad <= 0.0 ? 1.f : (TotalActorCount <= 0.0 ? 0.f : ActorCountLoadWeight);
+	const double MeanReportedLoad = TotalReportedLoad / VirtualWorkerIds.Num();
+	const double MeanActorCount = TotalActorCount / VirtualWorkerIds.Num();
+
+	TArray<float> Loads;
+	Loads.SetNumUninitialized(VirtualWorkerIds.Num());
+	for (int32 i = 0; i < VirtualWorkerIds.Num(); i++)
+	{
+		const FWorkerLoadReport& Report = LoadReports[VirtualWorkerIds[i]];
+		const double NormalisedLoad = MeanReportedLoad > 0.0 ? FMath::Max(Report.Load, 0.0) / MeanReportedLoad : 0.0;
+		const double NormalisedActorCount = MeanActorCount > 0.0 ? Report.AuthoritativeActorCount / MeanActorCount : 0.0;
+		Loads[i] = static_cast<float>((1.f - ActorCountWeight) * NormalisedLoad + ActorCountWeight * NormalisedActorCount);
+	}
+
+	const float PeakLoad = FMath::Max(Loads);
+	if (PeakLoad < ImbalanceThreshold)
+	{
+		UE_LOG(LogAdaptiveLBStrategy, Verbose, TEXT("Peak to mean load ratio %.2f is below the imbalance threshold %.2f, not rebalancing."), PeakLoad, ImbalanceThreshold);
+		return false;
+	}
+
+	// Assume the load of each region is spread evenly over it.
+	TArray<float> LoadDensities;
+	LoadDensities.SetNumUninitialized(Regions.Num());
+	for (int32 i = 0; i < Regions.Num(); i++)
+	{
+		const FVector2D Size = Regions[i].GetSize();
+		LoadDensities[i] = Loads[i] / FMath::Max(Size.X * Size.Y, KINDA_SMALL_NUMBER);
+	}
+
+	const TArray<FBox2D> LoadRegions = Regions;
+	const TArray<float> PreviousSplitPositions = SplitPositions;
+
+	float MaxSplitMovement = 0.f;
+	RebalanceNode(0, GetWorldBounds(), LoadRegions, LoadDensities, MaxSplitMovement);
+
+	if (MaxSplitMovement < MinSplitMovement)
+	{
+		SplitPositions = PreviousSplitPositions;
+		return false;
+	}
+
+	UpdateRegions(0, GetWorldBounds());
+
+	UE_LOG(LogAdaptiveLBStrategy, Log, TEXT("Rebalanced regions with peak to mean load ratio %.2f, largest split movement %.0f."), PeakLoad, MaxSplitMovement);
+	return true;
+}
+
+void UAdaptiveLBStrategy::WriteRegionsToSchema(Schema_Object* Object) const
+{
+	if (VirtualWorkerIds.Num() == 0)
+	{
+		return;
+	}
+
+	Schema_Object* RegionsObject = Schema_AddObject(Object, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_LOAD_BALANCING_REGIONS_ID);
+	Schema_AddUint32(RegionsObject, SpatialConstants::LOAD_BALANCING_REGIONS_FIRST_VIRTUAL_WORKER_ID, VirtualWorkerIds[0]);
+	Schema_AddFloatList(RegionsObject, SpatialConstants::LOAD_BALANCING_REGIONS_SPLIT_POSITIONS_ID, SplitPositions.GetData(), SplitPositions.Num());
+}
+
+bool UAdaptiveLBStrategy::ApplyRegionsFromSchema(Schema_Object* Object)
+{
+	if (VirtualWorkerIds.Num() == 0)
+	{
+		return false;
+	}
+
+	const uint32 RegionsCount = Schema_GetObjectCount(Object, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_LOAD_BALANCING_REGIONS_ID);
+	for (uint32 i = 0; i < RegionsCount; i++)
+	{
+		Schema_Object* RegionsObject = Schema_IndexObject(Object, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_LOAD_BALANCING_REGIONS_ID, i);
+		if (Schema_GetUint32(RegionsObject, SpatialConstants::LOAD_BALANCING_REGIONS_FIRST_VIRTUAL_WORKER_ID) != VirtualWorkerIds[0])
+		{
+			continue;
+		}
+
+		const uint32 SplitPositionsCount = Schema_GetFloatCount(RegionsObject, SpatialConstants::LOAD_BALANCING_REGIONS_SPLIT_POSITIONS_ID);
+		if (SplitPositionsCount != static_cast<uint32>(SplitPositions.Num()))
+		{
+			UE_LOG(LogAdaptiveLBStrategy, Error, TEXT("AdaptiveLBStrategy received %d split positions but expected %d. Are all workers using the same strategy?"), SplitPositionsCount, SplitPositions.Num());
+			return false;
+		}
+
+		Schema_GetFloatList(RegionsObject, SpatialConstants::LOAD_BALANCING_REGIONS_SPLIT_POSITIONS_ID, SplitPositions.GetData());
+		UpdateRegions(0, GetWorldBounds());
+
+		if (bIsStrategyUsedOnLocalWorker)
+		{
+			UE_LOG(LogAdaptiveLBStrategy, Log, TEXT("Local region is now %s"), *Regions[LocalRegionIndex].ToString());
+		}
+		return true;
+	}
+
+	return false;
+}
+
+VirtualWorkerId UAdaptiveLBStrategy::GetVirtualWorkerForLocation(const FVector2D& Location) const
+{
+	check(VirtualWorkerIds.Num() == Regions.Num());
+
+	const int32 RegionIndex = FindRegionIndex(Location);
+	return RegionIndex != INDEX_NONE ? VirtualWorkerIds[RegionIndex] : SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+}
+
+FBox2D UAdaptiveLBStrategy::GetRegionForVirtualWorker(VirtualWorkerId VirtualWorker) const
+{
+	const int32 RegionIndex = VirtualWorkerIds.IndexOfByKey(VirtualWorker);
+	return RegionIndex != INDEX_NONE ? Regions[RegionIndex] : FBox2D(ForceInit);
+}
+
+FBox2D UAdaptiveLBStrategy::GetWorldBounds() const
+{
+	// Match the grid strategy: +x is forward, so the world height is measured along the x-axis.
+	return FBox2D(FVector2D(-(WorldHeight / 2.f), -(WorldWidth / 2.f)), FVector2D(WorldHeight / 2.f, WorldWidth / 2.f));
+}
+
+int32 UAdaptiveLBStrategy::BuildNode(const FBox2D& Region, int32 NumLeavesInNode, int32& NextLeafIndex)
+{
+	const int32 NodeIndex = Nodes.AddUninitialized();
+
+	if (NumLeavesInNode == 1)
+	{
+		Nodes[NodeIndex] = FNode{ { INDEX_NONE, INDEX_NONE }, 1, NextLeafIndex++, 0 };
+		return NodeIndex;
+	}
+
+	// Split the longer side so regions stay close to square, with each side's share of the region matching its share of workers.
+	const FVector2D Size = Region.GetSize();
+	const int32 Axis = Size.X >= Size.Y ? 0 : 1;
+	const int32 NumLeftLeaves = NumLeavesInNode / 2;
+	const float Split = Region.Min[Axis] + Size[Axis] * NumLeftLeaves / NumLeavesInNode;
+	const int32 SplitIndex = SplitPositions.Add(Split);
+
+	FBox2D LeftRegion = Region;
+	LeftRegion.Max[Axis] = Split;
+	FBox2D RightRegion = Region;
+	RightRegion.Min[Axis] = Split;
+
+	const int32 LeftChild = BuildNode(LeftRegion, NumLeftLeaves, NextLeafIndex);
+	const int32 RightChild = BuildNode(RightRegion, NumLeavesInNode - NumLeftLeaves, NextLeafIndex);
+
+	Nodes[NodeIndex] = FNode{ { LeftChild, RightChild }, NumLeavesInNode, SplitIndex, Axis };
+	return NodeIndex;
+}
+
+void UAdaptiveLBStrategy::UpdateRegions(int32 NodeIndex, const FBox2D& Region)
+{
+	const FNode& Node = Nodes[NodeIndex];
+	if (Node.IsLeaf())
+	{
+		Regions[Node.Index] = Region;
+		return;
+	}
+
+	const float Split = SplitPositions[Node.Index];
+
+	FBox2D LeftRegion = Region;
+	LeftRegion.Max[Node.Axis] = Split;
+	FBox2D RightRegion = Region;
+	RightRegion.Min[Node.Axis] = Split;
+
+	UpdateRegions(Node.Children[0], LeftRegion);
+	UpdateRegions(Node.Children[1], RightRegion);
+}
+
+void UAdaptiveLBStrategy::RebalanceNode(int32 NodeIndex, const FBox2D& Region, const TArray<FBox2D>& LoadRegions, const TArray<float>& LoadDensities, float& OutMaxSplitMovement)
+{
+	const FNode& Node = Nodes[NodeIndex];
+	if (Node.IsLeaf())
+	{
+		return;
+	}
+
+	const int32 Axis = Node.Axis;
+	const int32 NumLeftLeaves = Nodes[Node.Children[0]].NumLeaves;
+	const int32 NumRightLeaves = Nodes[Node.Children[1]].NumLeaves;
+	const float RegionMin = Region.Min[Axis];
+	const float RegionMax = Region.Max[Axis];
+
+	float& Split = SplitPositions[Node.Index];
+	const float PreviousSplit = Split;
+
+	float TargetSplit = PreviousSplit;
+	const float TotalLoad = GetLoadInBox(Region, LoadRegions, LoadDensities);
+	if (TotalLoad > 0.f)
+	{
+		// The load on the left of the split only grows as the split moves right, so search for the position
+		// that leaves each side a share of the load proportional to its number of workers.
+		const float TargetLeftLoad = TotalLoad * NumLeftLeaves / Node.NumLeaves;
+		float Low = RegionMin;
+		float High = RegionMax;
+		FBox2D LeftBox = Region;
+		for (int32 Iteration = 0; Iteration < NumSplitSearchIterations; Iteration++)
+		{
+			const float Mid = 0.5f * (Low + High);
+			LeftBox.Max[Axis] = Mid;
+			if (GetLoadInBox(LeftBox, LoadRegions, LoadDensities) < TargetLeftLoad)
+			{
+				Low = Mid;
+			}
+			else
+			{
+				High = Mid;
+			}
+		}
+		TargetSplit = 0.5f * (Low + High);
+	}
+
+	// Keep every region at least MinRegionSize wide, unless the parent region is too small to allow it.
+	const float MinSize = FMath::Min(MinRegionSize, (RegionMax - RegionMin) / Node.NumLeaves);
+	Split = FMath::Clamp(PreviousSplit + RebalanceRate * (TargetSplit - PreviousSplit), RegionMin + MinSize * NumLeftLeaves, RegionMax - MinSize * NumRightLeaves);
+	OutMaxSplitMovement = FMath::Max(OutMaxSplitMovement, FMath::Abs(Split - PreviousSplit));
+
+	FBox2D LeftRegion = Region;
+	LeftRegion.Max[Axis] = Split;
+	FBox2D RightRegion = Region;
+	RightRegion.Min[Axis] = Split;
+
+	RebalanceNode(Node.Children[0], LeftRegion, LoadRegions, LoadDensities, OutMaxSplitMovement);
+	RebalanceNode(Node.Children[1], RightRegion, LoadRegions, LoadDensities, OutMaxSplitMovement);
+}
+
+int32 UAdaptiveLBStrategy::FindRegionIndex(const FVector2D& Location) const
+{
+	if (Nodes.Num() == 0 || !IsInside(GetWorldBounds(), Location))
+	{
+		return INDEX_NONE;
+	}
+
+	int32 NodeIndex = 0;
+	while (!Nodes[NodeIndex].IsLeaf())
+	{
+		const FNode& Node = Nodes[NodeIndex];
+		NodeIndex = Location[Node.Axis] < SplitPositions[Node.Index] ? Node.Children[0] : Node.Children[1];
+	}
+
+	return Nodes[NodeIndex].Index;
+}
+
+bool UAdaptiveLBStrategy::IsInside(const FBox2D& Box, const FVector2D& Location)
+{
+	return Location.X >= Box.Min.X && Location.Y >= Box.Min.Y
+		&& Location.X < Box.Max.X && Location.Y < Box.Max.Y;
+}
+
+float UAdaptiveLBStrategy::GetLoadInBox(const FBox2D& Box, const TArray<FBox2D>& LoadRegions, const TArray<float>& LoadDensities)
+{
+	float Load = 0.f;
+	for (int32 i = 0; i < LoadRegions.Num(); i++)
+	{
+		const float OverlapX = FMath::Min(Box.Max.X, LoadRegions[i].Max.X) - FMath::Max(Box.Min.X, LoadRegions[i].Min.X);
+		const float OverlapY = FMath::Min(Box.Max.Y, LoadRegions[i].Max.Y) - FMath::Max(Box.Min.Y, LoadRegions[i].Min.Y);
+		if (OverlapX > 0.f && OverlapY > 0.f)
+		{
+			Load += LoadDensities[i] * OverlapX * OverlapY;
+		}
+	}
+	return Load;
+}
@@ -5,6 +5,7 @@
 #include "EngineClasses/SpatialNetDriver.h"
 #include "Utils/SpatialActorUtils.h"
 
+#include "Algo/BinarySearch.h"
 #include "Templates/Tuple.h"
 
 DEFINE_LOG_CATEGORY(LogGridBasedLBStrategy);
@@ -18,6 +19,8 @@ UGridBasedLBStrategy::UGridBasedLBStrategy()
 	, InterestBorder(0.f)
 	, LocalCellId(0)
 	, bIsStrategyUsedOnLocalWorker(false)
+	, bIsUniformX(true)
+	, bIsUniformY(true)
 {
 }
 
@@ -27,36 +30,20 @@ void UGridBasedLBStrategy::Init()
 
 	UE_LOG(LogGridBasedLBStrategy, Log, TEXT("GridBasedLBStrategy initialized with Rows = %d and Cols = %d."), Rows, Cols);
 
-	const float WorldWidthMin = -(WorldWidth / 2.f);
-	const float WorldHeightMin = -(WorldHeight / 2.f);
-
-	const float ColumnWidth = WorldWidth / Cols;
-	const float RowHeight = WorldHeight / Rows;
-
 	// We would like the inspector's representation of the load balancing strategy to match our intuition.
 	// +x is forward, so rows are perpendicular to the x-axis and columns are perpendicular to the y-axis.
-	float XMin = WorldHeightMin;
-	float YMin = WorldWidthMin;
-	float XMax, YMax;
+	XBoundaries = ComputeBoundaries(-(WorldHeight / 2.f), WorldHeight, Rows, RowWeights, bIsUniformX);
+	YBoundaries = ComputeBoundaries(-(WorldWidth / 2.f), WorldWidth, Cols, ColumnWeights, bIsUniformY);
 
 	for (uint32 Col = 0; Col < Cols; ++Col)
 	{
-		YMax = YMin + ColumnWidth;
-
 		for (uint32 Row = 0; Row < Rows; ++Row)
 		{
-			XMax = XMin + RowHeight;
-
-			FVector2D Min(XMin, YMin);
-			FVector2D Max(XMax, YMax);
+			FVector2D Min(XBoundaries[Row], YBoundaries[Col]);
+			FVector2D Max(XBoundaries[Row + 1], YBoundaries[Col + 1]);
 			FBox2D Cell(Min, Max);
 			WorkerCells.Add(Cell);
-
-			XMin = XMax;
 		}
-
-		XMin = WorldHeightMin;
-		YMin = YMax;
 	}
 }
 
@@ -109,19 +96,61 @@ VirtualWorkerId UGridBasedLBStrategy::WhoShouldHaveAuthority(const AActor& Actor
 	const FVector2D Actor2DLocation = FVector2D(SpatialGDK::GetActorSpatialPosition(&Actor));
 
 	check(VirtualWorkerIds.Num() == WorkerCells.Num());
-	for (int i = 0; i < WorkerCells.Num(); i++)
+	const int32 CellIndex = FindCellIndex(Actor2DLocation);
+	if (CellIndex != INDEX_NONE)
 	{
-		if (IsInside(WorkerCells[i], Actor2DLocation))
-		{
-			UE_LOG(LogGridBasedLBStrategy, Log, TEXT("Actor: %s, grid %d, worker %d for position %s"), *AActor::GetDebugName(&Actor), i, VirtualWorkerIds[i], *Actor2DLocation.ToString());
-			return VirtualWorkerIds[i];
-		}
+		UE_LOG(LogGridBasedLBStrategy, Verbose, TEXT("Actor: %s, grid %d, worker %d for position %s"), *AActor::GetDebugName(&Actor), CellIndex, VirtualWorkerIds[CellIndex], *Actor2DLocation.ToString());
+		return VirtualWorkerIds[CellIndex];
 	}
 
 	UE_LOG(LogGridBasedLBStrategy, Error, TEXT("GridBasedLBStrategy couldn't determine virtual worker for Actor %s at position %s"), *AActor::GetDebugName(&Actor), *Actor2DLocation.ToString());
 	return SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
 }
 
+void UGridBasedLBStrategy::WhoShouldHaveAuthority(TArrayView<const AActor*> Actors, TArrayView<VirtualWorkerId> OutVirtualWorkerIds) const
+{
+	check(Actors.Num() == OutVirtualWorkerIds.Num());
+
+	if (!IsReady())
+	{
+		UE_LOG(LogGridBasedLBStrategy, Warning, TEXT("GridBasedLBStrategy not ready to decide on authority for %d Actors."), Actors.Num());
+		for (VirtualWorkerId& OutVirtualWorkerId : OutVirtualWorkerIds)
+		{
+			OutVirtualWorkerId = SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+		}
+		return;
+	}
+
+	check(VirtualWorkerIds.Num() == WorkerCells.Num());
+
+	// Gather positions first so the cell lookups run over contiguous arrays.
+	TArray<float> PositionsX;
+	TArray<float> PositionsY;
+	PositionsX.SetNumUninitialized(Actors.Num());
+	PositionsY.SetNumUninitialized(Actors.Num());
+	for (int32 i = 0; i < Actors.Num(); i++)
+	{
+		const FVector Position = SpatialGDK::GetActorSpatialPosition(Actors[i]);
+		PositionsX[i] = Position.X;
+		PositionsY[i] = Position.Y;
+	}
+
+	for (int32 i = 0; i < Actors.Num(); i++)
+	{
+		const int32 Row = FindInterval(XBoundaries, bIsUniformX, PositionsX[i]);
+		const int32 Col = FindInterval(YBoundaries, bIsUniformY, PositionsY[i]);
+		if (Row == INDEX_NONE || Col == INDEX_NONE)
+		{
+			UE_LOG(LogGridBasedLBStrategy, Error, TEXT("GridBasedLBStrategy couldn't determine virtual worker for Actor %s at position %s"),
+				*AActor::GetDebugName(Actors[i]), *FVector2D(PositionsX[i], PositionsY[i]).ToString());
+			OutVirtualWorkerIds[i] = SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+			continue;
+		}
+
+		OutVirtualWorkerIds[i] = VirtualWorkerIds[Col * Rows + Row];
+	}
+}
+
 SpatialGDK::QueryConstraint UGridBasedLBStrategy::GetWorkerInterestQueryConstraint() const
 {
 	// For a grid-based strategy, the interest area is the cell that the worker is authoritative over plus some border region.
@@ -170,6 +199,92 @@ bool UGridBasedLBStrategy::IsInside(const FBox2D& Box, const FVector2D& Location
 		&& Location.X < Box.Max.X && Location.Y < Box.Max.Y;
 }
 
+TArray<float> UGridBasedLBStrategy::ComputeBoundaries(float Min, float Length, uint32 NumDivisions, const TArray<float>& Weights, bool& bOutIsUniform)
+{
+	bool bUseWeights = Weights.Num() > 0;
+	if (bUseWeights && (Weights.Num() != static_cast<int32>(NumDivisions) || Weights.ContainsByPredicate([](float Weight) { return !(Weight > 0.f); })))
+	{
+		UE_LOG(LogGridBasedLBStrategy, Warning, TEXT("GridBasedLBStrategy ignoring weights: expected %d positive weights but got %d. Cells will be evenly sized."), NumDivisions, Weights.Num());
+		bUseWeights = false;
+	}
+
+	TArray<float> Boundaries;
+	Boundaries.SetNum(NumDivisions + 1);
+	Boundaries[0] = Min;
+
+	if (!bUseWeights)
+	{
+		const float Size = Length / NumDivisions;
+		for (uint32 i = 0; i < NumDivisions; ++i)
+		{
+			Boundaries[i + 1] = Boundaries[i] + Size;
+		}
+	}
+	else
+	{
+		float TotalWeight = 0.f;
+		for (float Weight : Weights)
+		{
+			TotalWeight += Weight;
+		}
+
+		float AccumulatedWeight = 0.f;
+		for (uint32 i = 0; i < NumDivisions; ++i)
+		{
+			AccumulatedWeight += Weights[i];
+			Boundaries[i + 1] = Min + Length * (AccumulatedWeight / TotalWeight);
+		}
+		Boundaries[NumDivisions] = Min + Length;
+	}
+
+	bOutIsUniform = !bUseWeights;
+	return Boundaries;
+}
+
+int32 UGridBasedLBStrategy::FindInterval(const TArray<float>& Boundaries, bool bIsUniform, float Value)
+{
+	const int32 NumIntervals = Boundaries.Num() - 1;
+
+	// Written so that NaN is also rejected.
+	if (!(Value >= Boundaries[0] && Value < Boundaries[NumIntervals]))
+	{
+		return INDEX_NONE;
+	}
+
+	if (!bIsUniform)
+	{
+		// First boundary strictly greater than Value closes the interval containing it.
+		return Algo::UpperBound(Boundaries, Value) - 1;
+	}
+
+	const float IntervalSize = (Boundaries[NumIntervals] - Boundaries[0]) / NumIntervals;
+	int32 Index = FMath::Clamp(FMath::FloorToInt((Value - Boundaries[0]) / IntervalSize), 0, NumIntervals - 1);
+
+	// Boundaries are accumulated, so correct for rounding against the stored values to match IsInside exactly.
+	while (Value < Boundaries[Index])
+	{
+		--Index;
+	}
+	while (Value >= Boundaries[Index + 1])
+	{
+		++Index;
+	}
+
+	return Index;
+}
+
+int32 UGridBasedLBStrategy::FindCellIndex(const FVector2D& Location) const
+{
+	const int32 Row = FindInterval(XBoundaries, bIsUniformX, Location.X);
+	const int32 Col = FindInterval(YBoundaries, bIsUniformY, Location.Y);
+	if (Row == INDEX_NONE || Col == INDEX_NONE)
+	{
+		return INDEX_NONE;
+	}
+
+	return Col * Rows + Row;
+}
+
 UGridBasedLBStrategy::LBStrategyRegions UGridBasedLBStrategy::GetLBStrategyRegions() const
 {
 	LBStrategyRegions VirtualWorkerToCell;
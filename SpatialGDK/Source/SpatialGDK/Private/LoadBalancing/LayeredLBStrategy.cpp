@@ -202,6 +202,71 @@ void ULayeredLBStrategy::SetVirtualWorkerIds(const VirtualWorkerId& FirstVirtual
 	}
 }
 
+bool ULayeredLBStrategy::IsDynamic() const
+{
+	for (const auto& Elem : LayerNameToLBStrategy)
+	{
+		if (Elem.Value->IsDynamic())
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+float ULayeredLBStrategy::GetRebalanceInterval() const
+{
+	// Rebalance as often as the most frequent dynamic layer strategy asks for.
+	float RebalanceInterval = 0.f;
+	for (const auto& Elem : LayerNameToLBStrategy)
+	{
+		if (Elem.Value->IsDynamic())
+		{
+			const float LayerRebalanceInterval = Elem.Value->GetRebalanceInterval();
+			RebalanceInterval = RebalanceInterval > 0.f ? FMath::Min(RebalanceInterval, LayerRebalanceInterval) : LayerRebalanceInterval;
+		}
+	}
+	return RebalanceInterval;
+}
+
+bool ULayeredLBStrategy::UpdateRegionsFromLoad(const TMap<VirtualWorkerId, FWorkerLoadReport>& LoadReports)
+{
+	// Each layer strategy only reads the reports for the virtual workers it was given.
+	bool bRegionsChanged = false;
+	for (const auto& Elem : LayerNameToLBStrategy)
+	{
+		if (Elem.Value->IsDynamic())
+		{
+			bRegionsChanged |= Elem.Value->UpdateRegionsFromLoad(LoadReports);
+		}
+	}
+	return bRegionsChanged;
+}
+
+void ULayeredLBStrategy::WriteRegionsToSchema(Schema_Object* Object) const
+{
+	for (const auto& Elem : LayerNameToLBStrategy)
+	{
+		if (Elem.Value->IsDynamic())
+		{
+			Elem.Value->WriteRegionsToSchema(Object);
+		}
+	}
+}
+
+bool ULayeredLBStrategy::ApplyRegionsFromSchema(Schema_Object* Object)
+{
+	bool bRegionsApplied = false;
+	for (const auto& Elem : LayerNameToLBStrategy)
+	{
+		if (Elem.Value->IsDynamic())
+		{
+			bRegionsApplied |= Elem.Value->ApplyRegionsFromSchema(Object);
+		}
+	}
+	return bRegionsApplied;
+}
+
 // DEPRECATED
 // This is only included because Scavengers uses the function in SpatialStatics that calls this.
 // Once they are pick up this code, they should be able to switch to another method and we can remove this.
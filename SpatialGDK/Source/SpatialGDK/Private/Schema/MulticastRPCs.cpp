@@ -13,7 +13,28 @@ MulticastRPCs::MulticastRPCs(const Worker_ComponentData& Data)
 
 void MulticastRPCs::ApplyComponentUpdate(const Worker_ComponentUpdate& Update)
 {
-	ReadFromSchema(Schema_GetComponentUpdateFields(Update.schema_type));
+	Schema_Object* SchemaObject = Schema_GetComponentUpdateFields(Update.schema_type);
+	UpdateTick++;
+
+	const RPCRingBufferDescriptor Descriptor = RPCRingBufferUtils::GetRingBufferDescriptor(MulticastRPCBuffer.Type);
+	const Schema_FieldId InitiallyPresentCountFieldId = RPCRingBufferUtils::GetInitiallyPresentMulticastRPCsCountFieldId();
+
+	// Updates usually touch a few slots, so only the fields in the update are read.
+	TArray<Schema_FieldId, TInlineAllocator<16>> FieldIds;
+	FieldIds.SetNumUninitialized(Schema_GetUniqueFieldIdCount(SchemaObject));
+	Schema_GetUniqueFieldIds(SchemaObject, FieldIds.GetData());
+
+	for (const Schema_FieldId FieldId : FieldIds)
+	{
+		if (FieldId == InitiallyPresentCountFieldId)
+		{
+			InitiallyPresentMulticastRPCsCount = Schema_GetUint32(SchemaObject, FieldId);
+		}
+		else
+		{
+			RPCRingBufferUtils::ReadBufferFieldFromSchema(SchemaObject, FieldId, Descriptor, UpdateTick, MulticastRPCBuffer);
+		}
+	}
 }
 
 void MulticastRPCs::ReadFromSchema(Schema_Object* SchemaObject)
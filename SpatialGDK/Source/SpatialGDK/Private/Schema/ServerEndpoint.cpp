@@ -14,7 +14,34 @@ ServerEndpoint::ServerEndpoint(const Worker_ComponentData& Data)
 
 void ServerEndpoint::ApplyComponentUpdate(const Worker_ComponentUpdate& Update)
 {
-	ReadFromSchema(Schema_GetComponentUpdateFields(Update.schema_type));
+	Schema_Object* SchemaObject = Schema_GetComponentUpdateFields(Update.schema_type);
+	UpdateTick++;
+
+	const RPCRingBufferDescriptor ReliableDescriptor = RPCRingBufferUtils::GetRingBufferDescriptor(ReliableRPCBuffer.Type);
+	const RPCRingBufferDescriptor UnreliableDescriptor = RPCRingBufferUtils::GetRingBufferDescriptor(UnreliableRPCBuffer.Type);
+	const Schema_FieldId ReliableAckFieldId = RPCRingBufferUtils::GetAckFieldId(ERPCType::ServerReliable);
+	const Schema_FieldId UnreliableAckFieldId = RPCRingBufferUtils::GetAckFieldId(ERPCType::ServerUnreliable);
+
+	// Updates usually touch a few slots and acks, so only the fields in the update are read.
+	TArray<Schema_FieldId, TInlineAllocator<16>> FieldIds;
+	FieldIds.SetNumUninitialized(Schema_GetUniqueFieldIdCount(SchemaObject));
+	Schema_GetUniqueFieldIds(SchemaObject, FieldIds.GetData());
+
+	for (const Schema_FieldId FieldId : FieldIds)
+	{
+		if (FieldId == ReliableAckFieldId)
+		{
+			ReliableRPCAck = Schema_GetUint64(SchemaObject, FieldId);
+		}
+		else if (FieldId == UnreliableAckFieldId)
+		{
+			UnreliableRPCAck = Schema_GetUint64(SchemaObject, FieldId);
+		}
+		else if (!RPCRingBufferUtils::ReadBufferFieldFromSchema(SchemaObject, FieldId, ReliableDescriptor, UpdateTick, ReliableRPCBuffer))
+		{
+			RPCRingBufferUtils::ReadBufferFieldFromSchema(SchemaObject, FieldId, UnreliableDescriptor, UpdateTick, UnreliableRPCBuffer);
+		}
+	}
 }
 
 void ServerEndpoint::ReadFromSchema(Schema_Object* SchemaObject)
@@ -91,14 +91,31 @@ USpatialGDKSettings::USpatialGDKSettings(const FObjectInitializer& ObjectInitial
 	, ServicesRegion(EServicesRegion::Default)
 	, WorkerLogLevel(ESettingsWorkerLogVerbosity::Warning)
 	, bRunSpatialWorkerConnectionOnGameThread(false)
+	, bUseLowLatencyOpListHandoff(false)
+	, OpListHandoffTimeoutMs(1)
+	, OpListHandoffCapacity(64)
 	, bUseRPCRingBuffers(true)
 	, DefaultRPCRingBufferSize(32)
 	, MaxRPCRingBufferSize(32)
+	, DefaultRPCRingBufferPayloadsPerSlot(1)
+	, RPCOverflowQueueMaxBytes(16 * 1024 * 1024)
 	// TODO - UNR 2514 - These defaults are not necessarily optimal - readdress when we have better data
 	, bTcpNoDelay(false)
 	, UdpServerDownstreamUpdateIntervalMS(1)
 	, UdpClientDownstreamUpdateIntervalMS(1)
 	, bWorkerFlushAfterOutgoingNetworkOp(false)
+	, bCoalesceComponentUpdates(false)
+	, bEnableParallelComponentSerialization(false)
+	, ParallelComponentSerializationMinObjectsPerTask(32)
+	, bBatchComponentUpdatesByEntity(false)
+	, bSkipUnchangedInterestUpdates(false)
+	, bEnableEntitySpatialIndex(false)
+	, EntitySpatialIndexCellSize(50.0f)
+	, EntitySpatialIndexRelevancyMargin(1000.0f)
+	, EntitySpatialIndexMaxRelevancyQueryDistance(15000.0f)
+	, bUseActorPriorityTable(false)
+	, bResolveQueuedRPCsOnObjectResolution(false)
+	, bInternObjectRefPaths(false)
 	// TODO - end
 	, bAsyncLoadNewClassesOnEntityCheckout(false)
 	, RPCQueueWarningDefaultTimeout(2.0f)
@@ -125,12 +142,21 @@ void USpatialGDKSettings::PostInitProperties()
 	CheckCmdLineOverrideBool(CommandLine, TEXT("EnableMultiWorkerDebuggingWarnings"), TEXT("Multi-Worker Debugging Warnings"), bEnableMultiWorkerDebuggingWarnings);
 	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideRPCRingBuffers"), TEXT("RPC ring buffers"), bUseRPCRingBuffers);
 	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideSpatialWorkerConnectionOnGameThread"), TEXT("Spatial worker connection on game thread"), bRunSpatialWorkerConnectionOnGameThread);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideLowLatencyOpListHandoff"), TEXT("Low latency op list handoff"), bUseLowLatencyOpListHandoff);
 	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideNetCullDistanceInterest"), TEXT("Net cull distance interest"), bEnableNetCullDistanceInterest);
 	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideNetCullDistanceInterestFrequency"), TEXT("Net cull distance interest frequency"), bEnableNetCullDistanceFrequency);
 	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideActorRelevantForConnection"), TEXT("Actor relevant for connection"), bUseIsActorRelevantForConnection);
 	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideBatchSpatialPositionUpdates"), TEXT("Batch spatial position updates"), bBatchSpatialPositionUpdates);
 	CheckCmdLineOverrideBool(CommandLine, TEXT("OverridePreventClientCloudDeploymentAutoConnect"), TEXT("Prevent client cloud deployment auto connect"), bPreventClientCloudDeploymentAutoConnect);
 	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideWorkerFlushAfterOutgoingNetworkOp"), TEXT("Flush worker ops after sending an outgoing network op."), bWorkerFlushAfterOutgoingNetworkOp);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideCoalesceComponentUpdates"), TEXT("Coalesce component updates"), bCoalesceComponentUpdates);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideParallelComponentSerialization"), TEXT("Parallel component serialization"), bEnableParallelComponentSerialization);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideBatchComponentUpdatesByEntity"), TEXT("Batch component updates by entity"), bBatchComponentUpdatesByEntity);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideSkipUnchangedInterestUpdates"), TEXT("Skip unchanged interest updates"), bSkipUnchangedInterestUpdates);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideEntitySpatialIndex"), TEXT("Entity spatial index"), bEnableEntitySpatialIndex);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideActorPriorityTable"), TEXT("Actor priority table"), bUseActorPriorityTable);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideResolveQueuedRPCsOnObjectResolution"), TEXT("Resolve queued RPCs on object resolution"), bResolveQueuedRPCsOnObjectResolution);
+	CheckCmdLineOverrideBool(CommandLine, TEXT("OverrideInternObjectRefPaths"), TEXT("Intern object ref paths"), bInternObjectRefPaths);
 }
 
 #if WITH_EDITOR
@@ -166,6 +192,8 @@ bool USpatialGDKSettings::CanEditChange(const GDK_PROPERTY(Property)* InProperty
 
 	if (Name == GET_MEMBER_NAME_CHECKED(USpatialGDKSettings, DefaultRPCRingBufferSize)
 	 || Name == GET_MEMBER_NAME_CHECKED(USpatialGDKSettings, RPCRingBufferSizeMap)
+	 || Name == GET_MEMBER_NAME_CHECKED(USpatialGDKSettings, DefaultRPCRingBufferPayloadsPerSlot)
+	 || Name == GET_MEMBER_NAME_CHECKED(USpatialGDKSettings, RPCRingBufferPayloadsPerSlotMap)
 	 || Name == GET_MEMBER_NAME_CHECKED(USpatialGDKSettings, MaxRPCRingBufferSize))
 	{
 		return UseRPCRingBuffer();
@@ -206,6 +234,16 @@ uint32 USpatialGDKSettings::GetRPCRingBufferSize(ERPCType RPCType) const
 	return DefaultRPCRingBufferSize;
 }
 
+uint32 USpatialGDKSettings::GetRPCRingBufferPayloadsPerSlot(ERPCType RPCType) const
+{
+	if (const uint32* PayloadsPerSlot = RPCRingBufferPayloadsPerSlotMap.Find(RPCType))
+	{
+		return FMath::Max(*PayloadsPerSlot, 1u);
+	}
+
+	return FMath::Max(DefaultRPCRingBufferPayloadsPerSlot, 1u);
+}
+
 
 bool USpatialGDKSettings::UseRPCRingBuffer() const
 {
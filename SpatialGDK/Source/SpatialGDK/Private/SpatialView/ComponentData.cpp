@@ -9,29 +9,65 @@ namespace SpatialGDK
 ComponentData::ComponentData(Worker_ComponentId Id)
 	: ComponentId(Id)
 	, Data(Schema_CreateComponentData())
+	, Underlying(Data.Get())
 {
 }
 
 ComponentData::ComponentData(OwningComponentDataPtr Data, Worker_ComponentId Id)
 	: ComponentId(Id)
 	, Data(MoveTemp(Data))
+	, Underlying(this->Data.Get())
 {
 }
 
+ComponentData::ComponentData(Schema_ComponentData* ViewedData, Worker_ComponentId Id)
+	: ComponentId(Id)
+	, Underlying(ViewedData)
+{
+}
+
+ComponentData::ComponentData(ComponentData&& Other)
+	: ComponentId(Other.ComponentId)
+	, Data(MoveTemp(Other.Data))
+	, Underlying(Other.Underlying)
+{
+	Other.Underlying = nullptr;
+}
+
+ComponentData& ComponentData::operator=(ComponentData&& Other)
+{
+	if (this != &Other)
+	{
+		ComponentId = Other.ComponentId;
+		Data = MoveTemp(Other.Data);
+		Underlying = Other.Underlying;
+		Other.Underlying = nullptr;
+	}
+	return *this;
+}
+
 ComponentData ComponentData::CreateCopy(const Schema_ComponentData* Data, Worker_ComponentId Id)
 {
 	return ComponentData(OwningComponentDataPtr(Schema_CopyComponentData(Data)), Id);
 }
 
+ComponentData ComponentData::CreateView(Schema_ComponentData* Data, Worker_ComponentId Id)
+{
+	check(Data != nullptr);
+	return ComponentData(Data, Id);
+}
+
 ComponentData ComponentData::DeepCopy() const
 {
-	check(Data.IsValid());
-	return CreateCopy(Data.Get(), ComponentId);
+	check(Underlying != nullptr);
+	return CreateCopy(Underlying, ComponentId);
 }
 
 Schema_ComponentData* ComponentData::Release() &&
 {
-	check(Data.IsValid());
+	check(Underlying != nullptr);
+	MakeOwning();
+	Underlying = nullptr;
 	return Data.Release();
 }
 
@@ -40,25 +76,31 @@ bool ComponentData::ApplyUpdate(const ComponentUpdate& Update)
 	check(Update.GetComponentId() == GetComponentId());
 	check(Update.GetUnderlying() != nullptr);
 
+	MakeOwning();
 	return Schema_ApplyComponentUpdateToData(Update.GetUnderlying(), Data.Get()) != 0;
 }
 
+bool ComponentData::IsOwning() const
+{
+	return Data.IsValid();
+}
+
 Schema_Object* ComponentData::GetFields() const
 {
-	check(Data.IsValid());
-	return Schema_GetComponentDataFields(Data.Get());
+	check(Underlying != nullptr);
+	return Schema_GetComponentDataFields(Underlying);
 }
 
 Schema_ComponentData* ComponentData::GetUnderlying() const
 {
-	check(Data.IsValid());
-	return Data.Get();
+	check(Underlying != nullptr);
+	return Underlying;
 }
 
 Worker_ComponentData ComponentData::GetWorkerComponentData() const
 {
-	check(Data.IsValid());
-	return {nullptr, ComponentId, Data.Get(), nullptr};
+	check(Underlying != nullptr);
+	return {nullptr, ComponentId, Underlying, nullptr};
 }
 
 Worker_ComponentId ComponentData::GetComponentId() const
@@ -66,4 +108,14 @@ Worker_ComponentId ComponentData::GetComponentId() const
 	return ComponentId;
 }
 
+void ComponentData::MakeOwning()
+{
+	check(Underlying != nullptr);
+	if (!Data.IsValid())
+	{
+		Data = OwningComponentDataPtr(Schema_CopyComponentData(Underlying));
+		Underlying = Data.Get();
+	}
+}
+
 } // namespace SpatialGDK
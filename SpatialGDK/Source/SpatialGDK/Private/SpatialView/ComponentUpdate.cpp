@@ -8,63 +8,105 @@ namespace SpatialGDK
 ComponentUpdate::ComponentUpdate(Worker_ComponentId Id)
 	: ComponentId(Id)
 	, Update(Schema_CreateComponentUpdate())
+	, Underlying(Update.Get())
 {
 }
 
 ComponentUpdate::ComponentUpdate(OwningComponentUpdatePtr Update, Worker_ComponentId Id)
 	: ComponentId(Id)
 	, Update(MoveTemp(Update))
+	, Underlying(this->Update.Get())
 {
 }
 
+ComponentUpdate::ComponentUpdate(Schema_ComponentUpdate* ViewedUpdate, Worker_ComponentId Id)
+	: ComponentId(Id)
+	, Underlying(ViewedUpdate)
+{
+}
+
+ComponentUpdate::ComponentUpdate(ComponentUpdate&& Other)
+	: ComponentId(Other.ComponentId)
+	, Update(MoveTemp(Other.Update))
+	, Underlying(Other.Underlying)
+{
+	Other.Underlying = nullptr;
+}
+
+ComponentUpdate& ComponentUpdate::operator=(ComponentUpdate&& Other)
+{
+	if (this != &Other)
+	{
+		ComponentId = Other.ComponentId;
+		Update = MoveTemp(Other.Update);
+		Underlying = Other.Underlying;
+		Other.Underlying = nullptr;
+	}
+	return *this;
+}
+
 ComponentUpdate ComponentUpdate::CreateCopy(const Schema_ComponentUpdate* Update, Worker_ComponentId Id)
 {
 	return ComponentUpdate(OwningComponentUpdatePtr(Schema_CopyComponentUpdate(Update)), Id);
 }
 
+ComponentUpdate ComponentUpdate::CreateView(Schema_ComponentUpdate* Update, Worker_ComponentId Id)
+{
+	check(Update != nullptr);
+	return ComponentUpdate(Update, Id);
+}
+
 ComponentUpdate ComponentUpdate::DeepCopy() const
 {
-	check(Update.IsValid());
-	return CreateCopy(Update.Get(), ComponentId);
+	check(Underlying != nullptr);
+	return CreateCopy(Underlying, ComponentId);
 }
 
 Schema_ComponentUpdate* ComponentUpdate::Release() &&
 {
-	check(Update.IsValid());
+	check(Underlying != nullptr);
+	MakeOwning();
+	Underlying = nullptr;
 	return Update.Release();
 }
 
 bool ComponentUpdate::Merge(ComponentUpdate Other)
 {
 	check(Other.GetComponentId() == GetComponentId());
-	check(Other.Update.IsValid());
+	check(Other.Underlying != nullptr);
+	MakeOwning();
 	// Calling GetUnderlying instead of Release
 	// as we still need to manually destroy Other.
 	return Schema_MergeComponentUpdateIntoUpdate(Other.GetUnderlying(), Update.Get()) != 0;
 }
 
+bool ComponentUpdate::IsOwning() const
+{
+	return Update.IsValid();
+}
+
 Schema_Object* ComponentUpdate::GetFields() const
 {
-	check(Update.IsValid());
-	return Schema_GetComponentUpdateFields(Update.Get());
+	check(Underlying != nullptr);
+	return Schema_GetComponentUpdateFields(Underlying);
 }
 
 Schema_Object* ComponentUpdate::GetEvents() const
 {
-	check(Update.IsValid());
-	return Schema_GetComponentUpdateEvents(Update.Get());
+	check(Underlying != nullptr);
+	return Schema_GetComponentUpdateEvents(Underlying);
 }
 
 Schema_ComponentUpdate* ComponentUpdate::GetUnderlying() const
 {
-	check(Update.IsValid());
-	return Update.Get();
+	check(Underlying != nullptr);
+	return Underlying;
 }
 
 Worker_ComponentUpdate ComponentUpdate::GetWorkerComponentUpdate() const
 {
-	check(Update.IsValid());
-	return {nullptr, ComponentId, Update.Get(), nullptr};
+	check(Underlying != nullptr);
+	return {nullptr, ComponentId, Underlying, nullptr};
 }
 
 Worker_ComponentId ComponentUpdate::GetComponentId() const
@@ -72,4 +114,14 @@ Worker_ComponentId ComponentUpdate::GetComponentId() const
 	return ComponentId;
 }
 
+void ComponentUpdate::MakeOwning()
+{
+	check(Underlying != nullptr);
+	if (!Update.IsValid())
+	{
+		Update = OwningComponentUpdatePtr(Schema_CopyComponentUpdate(Underlying));
+		Underlying = Update.Get();
+	}
+}
+
 } // namespace SpatialGDK
@@ -147,18 +147,18 @@ void ViewDelta::HandleAddComponent(const Worker_AddComponentOp& Op, TSet<EntityC
 	const EntityComponentId Id = { Op.entity_id, Op.data.component_id };
 	if (ComponentsPresent.Contains(Id))
 	{
-		EntityComponentChanges.AddComponentAsUpdate(Id.EntityId, ComponentData::CreateCopy(Op.data.schema_type, Id.ComponentId));
+		EntityComponentChanges.AddComponentAsUpdate(Id.EntityId, ComponentData::CreateView(Op.data.schema_type, Id.ComponentId));
 	}
 	else
 	{
 		ComponentsPresent.Add(Id);
-		EntityComponentChanges.AddComponent(Id.EntityId, ComponentData::CreateCopy(Op.data.schema_type, Id.ComponentId));
+		EntityComponentChanges.AddComponent(Id.EntityId, ComponentData::CreateView(Op.data.schema_type, Id.ComponentId));
 	}
 }
 
 void ViewDelta::HandleComponentUpdate(const Worker_ComponentUpdateOp& Op)
 {
-	EntityComponentChanges.AddUpdate(Op.entity_id, ComponentUpdate::CreateCopy(Op.update.schema_type, Op.update.component_id));
+	EntityComponentChanges.AddUpdate(Op.entity_id, ComponentUpdate::CreateView(Op.update.schema_type, Op.update.component_id));
 }
 
 void ViewDelta::HandleRemoveComponent(const Worker_RemoveComponentOp& Op, TSet<EntityComponentId>& ComponentsPresent)
@@ -0,0 +1,214 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "CoreMinimal.h"
+
+#include "Misc/AutomationTest.h"
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/RPCOverflowQueue.h"
+#include "Utils/RPCRingBuffer.h"
+
+#define RPC_OVERFLOW_QUEUE_TEST(TestName) \
+	GDK_TEST(Core, RPCOverflowQueue, TestName)
+
+namespace
+{
+
+constexpr Worker_EntityId OverflowTestEntityId_1 = 201;
+constexpr Worker_EntityId OverflowTestEntityId_2 = 42;
+
+constexpr uint32 UnlimitedBytes = TNumericLimits<uint32>::Max();
+
+SpatialGDK::RPCPayload MakePayload(uint32 Index)
+{
+	return SpatialGDK::RPCPayload(0, Index, TArray<uint8>({ 1, 2, 3, 4 }, 4));
+}
+
+// Returns the bytes that one RPC created with MakePayload counts towards the queue's limit.
+uint32 GetBytesPerRPC()
+{
+	SpatialGDK::RPCOverflowQueue Queue(UnlimitedBytes);
+	Queue.Enqueue(SpatialGDK::EntityRPCType(OverflowTestEntityId_1, ERPCType::ClientReliable), MakePayload(0));
+	return Queue.GetStats().BytesHeld;
+}
+
+struct FlushedRPC
+{
+	SpatialGDK::EntityRPCType EntityType;
+	uint32 Index;
+};
+
+TArray<FlushedRPC> FlushAll(SpatialGDK::RPCOverflowQueue& Queue)
+{
+	TArray<FlushedRPC> Flushed;
+	Queue.Flush([&Flushed](SpatialGDK::EntityRPCType EntityType, SpatialGDK::RPCPayload& Payload) {
+		Flushed.Add(FlushedRPC{ EntityType, Payload.Index });
+		return SpatialGDK::EOverflowFlushResult::Pushed;
+	});
+	return Flushed;
+}
+
+} // anonymous namespace
+
+RPC_OVERFLOW_QUEUE_TEST(GIVEN_queued_rpcs_WHEN_flushed_THEN_rpcs_are_pushed_in_order)
+{
+	SpatialGDK::RPCOverflowQueue Queue(UnlimitedBytes);
+	const SpatialGDK::EntityRPCType EntityType(OverflowTestEntityId_1, ERPCType::ClientReliable);
+
+	for (uint32 i = 0; i < 5; ++i)
+	{
+		Queue.Enqueue(EntityType, MakePayload(i));
+	}
+	TestEqual("All RPCs are queued", Queue.Num(EntityType), 5u);
+
+	const TArray<FlushedRPC> Flushed = FlushAll(Queue);
+
+	bool bInOrder = Flushed.Num() == 5;
+	for (int32 i = 0; i < Flushed.Num(); ++i)
+	{
+		bInOrder &= Flushed[i].Index == static_cast<uint32>(i);
+	}
+	TestTrue("RPCs are pushed in the order they were queued", bInOrder);
+	TestFalse("Queue no longer contains the entity", Queue.Contains(EntityType));
+	TestEqual("Queue depth is back to zero", Queue.GetStats().QueueDepth, 0u);
+	TestEqual("No bytes are held", Queue.GetStats().BytesHeld, 0u);
+	return true;
+}
+
+RPC_OVERFLOW_QUEUE_TEST(GIVEN_queued_rpcs_WHEN_push_stops_THEN_remaining_rpcs_stay_queued)
+{
+	SpatialGDK::RPCOverflowQueue Queue(UnlimitedBytes);
+	const SpatialGDK::EntityRPCType EntityType(OverflowTestEntityId_1, ERPCType::ServerReliable);
+
+	for (uint32 i = 0; i < 4; ++i)
+	{
+		Queue.Enqueue(EntityType, MakePayload(i));
+	}
+
+	uint32 NumPushed = 0;
+	Queue.Flush([&NumPushed](SpatialGDK::EntityRPCType, SpatialGDK::RPCPayload&) {
+		if (NumPushed == 2)
+		{
+			return SpatialGDK::EOverflowFlushResult::Stop;
+		}
+		NumPushed++;
+		return SpatialGDK::EOverflowFlushResult::Pushed;
+	});
+
+	TestEqual("RPCs that weren't pushed stay queued", Queue.Num(EntityType), 2u);
+
+	const TArray<FlushedRPC> Flushed = FlushAll(Queue);
+	TestTrue("The stopped RPC is pushed next with its payload intact", Flushed.Num() == 2 && Flushed[0].Index == 2 && Flushed[1].Index == 3);
+	return true;
+}
+
+RPC_OVERFLOW_QUEUE_TEST(GIVEN_unreliable_rpcs_over_the_ring_buffer_capacity_WHEN_queued_THEN_oldest_rpcs_are_dropped)
+{
+	SpatialGDK::RPCOverflowQueue Queue(UnlimitedBytes);
+	const SpatialGDK::EntityRPCType EntityType(OverflowTestEntityId_1, ERPCType::ClientUnreliable);
+	const uint32 Capacity = SpatialGDK::RPCRingBufferUtils::GetRingBufferCapacity(ERPCType::ClientUnreliable);
+
+	for (uint32 i = 0; i < Capacity + 3; ++i)
+	{
+		Queue.Enqueue(EntityType, MakePayload(i));
+	}
+
+	TestEqual("Queue holds at most the ring buffer capacity", Queue.Num(EntityType), Capacity);
+	TestEqual("Oldest RPCs are counted as dropped", Queue.GetStats().NumDropped[static_cast<int32>(ERPCType::ClientUnreliable)], 3u);
+
+	const TArray<FlushedRPC> Flushed = FlushAll(Queue);
+	TestTrue("Newest RPCs are kept", Flushed.Num() > 0 && Flushed[0].Index == 3 && Flushed.Last().Index == Capacity + 2);
+	return true;
+}
+
+RPC_OVERFLOW_QUEUE_TEST(GIVEN_full_queue_WHEN_queue_unreliable_rpc_THEN_oldest_unreliable_rpc_of_any_entity_is_dropped)
+{
+	SpatialGDK::RPCOverflowQueue Queue(2 * GetBytesPerRPC());
+	const SpatialGDK::EntityRPCType EntityType_1(OverflowTestEntityId_1, ERPCType::ClientUnreliable);
+	const SpatialGDK::EntityRPCType EntityType_2(OverflowTestEntityId_2, ERPCType::ClientUnreliable);
+
+	Queue.Enqueue(EntityType_1, MakePayload(0));
+	Queue.Enqueue(EntityType_2, MakePayload(1));
+	const SpatialGDK::EOverflowEnqueueResult Result = Queue.Enqueue(EntityType_2, MakePayload(2));
+
+	TestTrue("RPC is queued", Result == SpatialGDK::EOverflowEnqueueResult::Queued);
+	TestFalse("Oldest RPC was dropped", Queue.Contains(EntityType_1));
+	TestEqual("Newer RPCs are kept", Queue.Num(EntityType_2), 2u);
+	TestEqual("Bytes held stay within the limit", Queue.GetStats().BytesHeld, 2 * GetBytesPerRPC());
+	return true;
+}
+
+RPC_OVERFLOW_QUEUE_TEST(GIVEN_queue_full_of_unreliable_rpcs_WHEN_queue_reliable_rpc_THEN_unreliable_rpc_is_dropped)
+{
+	SpatialGDK::RPCOverflowQueue Queue(2 * GetBytesPerRPC());
+	const SpatialGDK::EntityRPCType UnreliableType(OverflowTestEntityId_1, ERPCType::ClientUnreliable);
+	const SpatialGDK::EntityRPCType ReliableType(OverflowTestEntityId_1, ERPCType::ClientReliable);
+
+	Queue.Enqueue(UnreliableType, MakePayload(0));
+	Queue.Enqueue(UnreliableType, MakePayload(1));
+	const SpatialGDK::EOverflowEnqueueResult Result = Queue.Enqueue(ReliableType, MakePayload(2));
+
+	TestTrue("Reliable RPC is queued", Result == SpatialGDK::EOverflowEnqueueResult::Queued);
+	TestEqual("Oldest unreliable RPC was dropped", Queue.Num(UnreliableType), 1u);
+	TestEqual("Drop is counted against the unreliable type", Queue.GetStats().NumDropped[static_cast<int32>(ERPCType::ClientUnreliable)], 1u);
+	return true;
+}
+
+RPC_OVERFLOW_QUEUE_TEST(GIVEN_queue_full_of_reliable_rpcs_WHEN_queue_rpcs_THEN_reliable_rpc_is_rejected_and_unreliable_rpc_is_dropped)
+{
+	SpatialGDK::RPCOverflowQueue Queue(2 * GetBytesPerRPC());
+	const SpatialGDK::EntityRPCType ReliableType(OverflowTestEntityId_1, ERPCType::ServerReliable);
+	const SpatialGDK::EntityRPCType UnreliableType(OverflowTestEntityId_1, ERPCType::ServerUnreliable);
+
+	Queue.Enqueue(ReliableType, MakePayload(0));
+	Queue.Enqueue(ReliableType, MakePayload(1));
+
+	TestTrue("Reliable RPC is rejected", Queue.Enqueue(ReliableType, MakePayload(2)) == SpatialGDK::EOverflowEnqueueResult::QueueFull);
+	TestTrue("Unreliable RPC is dropped", Queue.Enqueue(UnreliableType, MakePayload(3)) == SpatialGDK::EOverflowEnqueueResult::Dropped);
+	TestEqual("Queued reliable RPCs are kept", Queue.Num(ReliableType), 2u);
+
+	const SpatialGDK::RPCOverflowStats& Stats = Queue.GetStats();
+	TestEqual("Rejected reliable RPC is counted", Stats.NumRejected[static_cast<int32>(ERPCType::ServerReliable)], 1u);
+	TestEqual("Reliable RPCs are never dropped", Stats.NumDropped[static_cast<int32>(ERPCType::ServerReliable)], 0u);
+	TestEqual("Dropped unreliable RPC is counted", Stats.NumDropped[static_cast<int32>(ERPCType::ServerUnreliable)], 1u);
+	return true;
+}
+
+RPC_OVERFLOW_QUEUE_TEST(GIVEN_reliable_and_unreliable_rpcs_WHEN_flushed_THEN_reliable_rpcs_are_pushed_first)
+{
+	SpatialGDK::RPCOverflowQueue Queue(UnlimitedBytes);
+	const SpatialGDK::EntityRPCType UnreliableType(OverflowTestEntityId_1, ERPCType::ClientUnreliable);
+	const SpatialGDK::EntityRPCType ReliableType(OverflowTestEntityId_2, ERPCType::ClientReliable);
+
+	Queue.Enqueue(UnreliableType, MakePayload(0));
+	Queue.Enqueue(ReliableType, MakePayload(1));
+
+	const TArray<FlushedRPC> Flushed = FlushAll(Queue);
+	TestTrue("Reliable RPC is pushed before the older unreliable RPC", Flushed.Num() == 2 && Flushed[0].EntityType == ReliableType && Flushed[1].EntityType == UnreliableType);
+	return true;
+}
+
+RPC_OVERFLOW_QUEUE_TEST(GIVEN_queued_rpcs_WHEN_push_drops_all_or_removed_THEN_rpcs_are_counted_as_dropped)
+{
+	SpatialGDK::RPCOverflowQueue Queue(UnlimitedBytes);
+	const SpatialGDK::EntityRPCType ReliableType(OverflowTestEntityId_1, ERPCType::ClientReliable);
+	const SpatialGDK::EntityRPCType UnreliableType(OverflowTestEntityId_2, ERPCType::ServerUnreliable);
+
+	for (uint32 i = 0; i < 3; ++i)
+	{
+		Queue.Enqueue(ReliableType, MakePayload(i));
+		Queue.Enqueue(UnreliableType, MakePayload(i));
+	}
+
+	Queue.Remove(UnreliableType);
+	Queue.Flush([](SpatialGDK::EntityRPCType, SpatialGDK::RPCPayload&) {
+		return SpatialGDK::EOverflowFlushResult::DropAll;
+	});
+
+	const SpatialGDK::RPCOverflowStats& Stats = Queue.GetStats();
+	TestEqual("Removed RPCs are counted as dropped", Stats.NumDropped[static_cast<int32>(ERPCType::ServerUnreliable)], 3u);
+	TestEqual("RPCs dropped while pushing are counted as dropped", Stats.NumDropped[static_cast<int32>(ERPCType::ClientReliable)], 3u);
+	TestEqual("Queue is empty", Stats.QueueDepth, 0u);
+	TestEqual("No bytes are held", Stats.BytesHeld, 0u);
+	return true;
+}
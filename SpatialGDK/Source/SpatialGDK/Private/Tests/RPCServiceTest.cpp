@@ -15,6 +15,7 @@
 #include "Interop/SpatialReceiver.h"
 #include "Interop/SpatialRPCService.h"
 #include "Interop/SpatialStaticComponentView.h"
+#include "Schema/ClientEndpoint.h"
 #include "Schema/RPCPayload.h"
 #include "SpatialConstants.h"
 #include "SpatialGDKSettings.h"
@@ -190,6 +191,97 @@ FWorkerComponentData GetComponentDataOnEntityCreationFromRPCService(SpatialGDK::
 	return *ComponentData;
 }
 
+// Packs several RPCs of the given type into each ring buffer field for the lifetime of the object.
+class ScopedRingBufferPayloadsPerSlot
+{
+public:
+	ScopedRingBufferPayloadsPerSlot(ERPCType InType, uint32 PayloadsPerSlot)
+		: Type(InType)
+	{
+		USpatialGDKSettings* SpatialGDKSettings = GetMutableDefault<USpatialGDKSettings>();
+		if (const uint32* CachedValue = SpatialGDKSettings->RPCRingBufferPayloadsPerSlotMap.Find(Type))
+		{
+			CachedPayloadsPerSlot = *CachedValue;
+		}
+		SpatialGDKSettings->RPCRingBufferPayloadsPerSlotMap.Add(Type, PayloadsPerSlot);
+	}
+
+	~ScopedRingBufferPayloadsPerSlot()
+	{
+		USpatialGDKSettings* SpatialGDKSettings = GetMutableDefault<USpatialGDKSettings>();
+		if (CachedPayloadsPerSlot.IsSet())
+		{
+			SpatialGDKSettings->RPCRingBufferPayloadsPerSlotMap.Add(Type, CachedPayloadsPerSlot.GetValue());
+		}
+		else
+		{
+			SpatialGDKSettings->RPCRingBufferPayloadsPerSlotMap.Remove(Type);
+		}
+	}
+
+private:
+	ERPCType Type;
+	TOptional<uint32> CachedPayloadsPerSlot;
+};
+
+struct SustainedRPCResult
+{
+	uint32 NumDelivered = 0;
+	uint32 NumUpdates = 0;
+	uint32 NumBytes = 0;
+};
+
+// Every frame, pushes RPCsPerFrame client reliable RPCs on top of those still queued from overflowing. The client reads
+// the update sent at the end of the frame, and the server sees the client's ack for those RPCs before the next frame.
+SustainedRPCResult SimulateSustainedClientReliableRPCs(uint32 NumFrames, uint32 RPCsPerFrame)
+{
+	USpatialStaticComponentView* StaticComponentView = CreateStaticComponentView({ RPCTestEntityId_1 }, SERVER_AUTH);
+	SpatialGDK::SpatialRPCService RPCService = CreateRPCService({ RPCTestEntityId_1 }, SERVER_AUTH, DefaultRPCDelegate, StaticComponentView);
+
+	// The client's copy of the ring buffer on the server endpoint.
+	SpatialGDK::RPCRingBuffer ClientBuffer(ERPCType::ClientReliable);
+	uint64 LastReceivedRPCId = 0;
+
+	SustainedRPCResult Result;
+	for (uint32 Frame = 0; Frame < NumFrames; Frame++)
+	{
+		RPCService.PushOverflowedRPCs();
+		for (uint32 i = 0; i < RPCsPerFrame; i++)
+		{
+			RPCService.PushRPC(RPCTestEntityId_1, ERPCType::ClientReliable, SimplePayload, false);
+		}
+
+		for (SpatialGDK::SpatialRPCService::UpdateToSend& Update : RPCService.GetRPCsAndAcksToSend())
+		{
+			Schema_Object* UpdateObject = Schema_GetComponentUpdateFields(Update.Update.schema_type);
+			Result.NumUpdates++;
+			Result.NumBytes += Schema_GetWriteBufferLength(UpdateObject);
+			SpatialGDK::RPCRingBufferUtils::ReadBufferFromSchema(UpdateObject, ClientBuffer);
+			Schema_DestroyComponentUpdate(Update.Update.schema_type);
+		}
+
+		for (uint64 RPCId = LastReceivedRPCId + 1; RPCId <= ClientBuffer.LastSentRPCId; RPCId++)
+		{
+			const TOptional<SpatialGDK::RPCPayload>& Element = ClientBuffer.GetRingBufferElement(RPCId);
+			if (Element.IsSet() && CompareRPCPayload(Element.GetValue(), SimplePayload))
+			{
+				Result.NumDelivered++;
+			}
+		}
+		LastReceivedRPCId = ClientBuffer.LastSentRPCId;
+
+		Worker_ComponentUpdateOp AckOp = {};
+		AckOp.entity_id = RPCTestEntityId_1;
+		AckOp.update.component_id = SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID;
+		AckOp.update.schema_type = Schema_CreateComponentUpdate();
+		SpatialGDK::RPCRingBufferUtils::WriteAckToSchema(Schema_GetComponentUpdateFields(AckOp.update.schema_type), ERPCType::ClientReliable, LastReceivedRPCId);
+		StaticComponentView->OnComponentUpdate(AckOp);
+		Schema_DestroyComponentUpdate(AckOp.update.schema_type);
+	}
+
+	return Result;
+}
+
 } // anonymous namespace
 
 RPC_SERVICE_TEST(GIVEN_authority_over_server_endpoint_WHEN_push_client_reliable_rpcs_to_the_service_THEN_rpc_push_result_success)
@@ -296,7 +388,7 @@ RPC_SERVICE_TEST(GIVEN_authority_over_server_endpoint_WHEN_push_overflow_client_
 	return true;
 }
 
-RPC_SERVICE_TEST(GIVEN_authority_over_server_endpoint_WHEN_push_overflow_client_unreliable_rpcs_to_the_service_THEN_rpc_push_result_drop_overflow)
+RPC_SERVICE_TEST(GIVEN_authority_over_server_endpoint_WHEN_push_overflow_client_unreliable_rpcs_to_the_service_THEN_rpc_push_result_queue_overflowed)
 {
 	SpatialGDK::SpatialRPCService RPCService = CreateRPCService({ RPCTestEntityId_1 }, SERVER_AUTH);
 
@@ -308,7 +400,7 @@ RPC_SERVICE_TEST(GIVEN_authority_over_server_endpoint_WHEN_push_overflow_client_
 	}
 
 	SpatialGDK::EPushRPCResult Result = RPCService.PushRPC(RPCTestEntityId_1, ERPCType::ClientUnreliable, SimplePayload, false);
-	TestTrue("Push RPC returned expected results", (Result == SpatialGDK::EPushRPCResult::DropOverflowed));
+	TestTrue("Push RPC returned expected results", (Result == SpatialGDK::EPushRPCResult::QueueOverflowed));
 	return true;
 }
 
@@ -328,7 +420,7 @@ RPC_SERVICE_TEST(GIVEN_authority_over_client_endpoint_WHEN_push_overflow_client_
 	return true;
 }
 
-RPC_SERVICE_TEST(GIVEN_authority_over_client_endpoint_WHEN_push_overflow_client_unreliable_rpcs_to_the_service_THEN_rpc_push_result_drop_overflow)
+RPC_SERVICE_TEST(GIVEN_authority_over_client_endpoint_WHEN_push_overflow_client_unreliable_rpcs_to_the_service_THEN_rpc_push_result_queue_overflowed)
 {
 	SpatialGDK::SpatialRPCService RPCService = CreateRPCService({ RPCTestEntityId_1 }, CLIENT_AUTH);
 
@@ -340,7 +432,7 @@ RPC_SERVICE_TEST(GIVEN_authority_over_client_endpoint_WHEN_push_overflow_client_
 	}
 
 	SpatialGDK::EPushRPCResult Result = RPCService.PushRPC(RPCTestEntityId_1, ERPCType::ServerUnreliable, SimplePayload, false);
-	TestTrue("Push RPC returned expected results", (Result == SpatialGDK::EPushRPCResult::DropOverflowed));
+	TestTrue("Push RPC returned expected results", (Result == SpatialGDK::EPushRPCResult::QueueOverflowed));
 	return true;
 }
 
@@ -461,6 +553,210 @@ RPC_SERVICE_TEST(GIVEN_client_endpoint_with_rpcs_in_view_and_authority_over_serv
 	return true;
 }
 
+RPC_SERVICE_TEST(GIVEN_client_endpoint_in_view_WHEN_updates_applied_THEN_only_buffers_in_the_update_change)
+{
+	USpatialStaticComponentView* StaticComponentView = NewObject<USpatialStaticComponentView>();
+	TestingComponentViewHelpers::AddEntityComponentToStaticComponentView(*StaticComponentView,
+		RPCTestEntityId_1, SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID,
+		GetClientAuthorityFromRPCEndpointType(SERVER_AUTH));
+
+	Worker_ComponentUpdateOp UpdateOp = {};
+	UpdateOp.entity_id = RPCTestEntityId_1;
+	UpdateOp.update.component_id = SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID;
+
+	UpdateOp.update.schema_type = Schema_CreateComponentUpdate();
+	SpatialGDK::RPCRingBufferUtils::WriteRPCToSchema(Schema_GetComponentUpdateFields(UpdateOp.update.schema_type), ERPCType::ServerReliable, 1, SimplePayload);
+	StaticComponentView->OnComponentUpdate(UpdateOp);
+	Schema_DestroyComponentUpdate(UpdateOp.update.schema_type);
+
+	const SpatialGDK::ClientEndpoint* Endpoint = StaticComponentView->GetComponentData<SpatialGDK::ClientEndpoint>(RPCTestEntityId_1);
+	const uint64 RPCUpdateTick = Endpoint->UpdateTick;
+	TestTrue("Reliable buffer changed by RPC update", Endpoint->ReliableRPCBuffer.HasChangedSince(RPCUpdateTick - 1));
+	TestFalse("Unreliable buffer changed by RPC update", Endpoint->UnreliableRPCBuffer.HasChangedSince(RPCUpdateTick - 1));
+	TestEqual("Last sent RPC ID", Endpoint->ReliableRPCBuffer.LastSentRPCId, 1ull);
+	TestTrue("RPC read into buffer", Endpoint->ReliableRPCBuffer.GetRingBufferElement(1).IsSet());
+
+	UpdateOp.update.schema_type = Schema_CreateComponentUpdate();
+	SpatialGDK::RPCRingBufferUtils::WriteAckToSchema(Schema_GetComponentUpdateFields(UpdateOp.update.schema_type), ERPCType::ClientReliable, 3);
+	StaticComponentView->OnComponentUpdate(UpdateOp);
+	Schema_DestroyComponentUpdate(UpdateOp.update.schema_type);
+
+	TestFalse("Reliable buffer changed by ack update", Endpoint->ReliableRPCBuffer.HasChangedSince(RPCUpdateTick));
+	TestFalse("Unreliable buffer changed by ack update", Endpoint->UnreliableRPCBuffer.HasChangedSince(RPCUpdateTick));
+	TestEqual("Reliable ack", Endpoint->ReliableRPCAck, 3ull);
+
+	return true;
+}
+
+RPC_SERVICE_TEST(GIVEN_authority_over_server_endpoint_WHEN_client_endpoint_updated_with_rpc_THEN_only_the_new_rpc_is_extracted)
+{
+	USpatialStaticComponentView* StaticComponentView = NewObject<USpatialStaticComponentView>();
+	TestingComponentViewHelpers::AddEntityComponentToStaticComponentView(*StaticComponentView,
+		RPCTestEntityId_1, SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID,
+		GetClientAuthorityFromRPCEndpointType(SERVER_AUTH));
+	TestingComponentViewHelpers::AddEntityComponentToStaticComponentView(*StaticComponentView,
+		RPCTestEntityId_1, SpatialConstants::SERVER_ENDPOINT_COMPONENT_ID,
+		GetServerAuthorityFromRPCEndpointType(SERVER_AUTH));
+
+	TArray<ERPCType> ExtractedRPCTypes;
+	ExtractRPCDelegate RPCDelegate = ExtractRPCDelegate::CreateLambda([&ExtractedRPCTypes](Worker_EntityId EntityId, ERPCType RPCType, const SpatialGDK::RPCPayload& Payload) {
+		ExtractedRPCTypes.Add(RPCType);
+		return true;
+	});
+	SpatialGDK::SpatialRPCService RPCService = CreateRPCService({ RPCTestEntityId_1 }, SERVER_AUTH, RPCDelegate, StaticComponentView);
+
+	Worker_ComponentUpdateOp UpdateOp = {};
+	UpdateOp.entity_id = RPCTestEntityId_1;
+	UpdateOp.update.component_id = SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID;
+	UpdateOp.update.schema_type = Schema_CreateComponentUpdate();
+	SpatialGDK::RPCRingBufferUtils::WriteRPCToSchema(Schema_GetComponentUpdateFields(UpdateOp.update.schema_type), ERPCType::ServerUnreliable, 1, SimplePayload);
+	StaticComponentView->OnComponentUpdate(UpdateOp);
+	Schema_DestroyComponentUpdate(UpdateOp.update.schema_type);
+
+	RPCService.ExtractRPCsForUpdatedComponent(RPCTestEntityId_1, SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID);
+
+	TestEqual("Extracted RPCs", ExtractedRPCTypes.Num(), 1);
+	TestTrue("Extracted RPC type", ExtractedRPCTypes.Num() == 1 && ExtractedRPCTypes[0] == ERPCType::ServerUnreliable);
+	return true;
+}
+
+RPC_SERVICE_TEST(GIVEN_client_endpoint_update_with_rpc_skipped_WHEN_ack_only_update_received_THEN_the_rpc_is_extracted)
+{
+	USpatialStaticComponentView* StaticComponentView = NewObject<USpatialStaticComponentView>();
+	TestingComponentViewHelpers::AddEntityComponentToStaticComponentView(*StaticComponentView,
+		RPCTestEntityId_1, SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID,
+		GetClientAuthorityFromRPCEndpointType(SERVER_AUTH));
+	TestingComponentViewHelpers::AddEntityComponentToStaticComponentView(*StaticComponentView,
+		RPCTestEntityId_1, SpatialConstants::SERVER_ENDPOINT_COMPONENT_ID,
+		GetServerAuthorityFromRPCEndpointType(SERVER_AUTH));
+
+	TArray<ERPCType> ExtractedRPCTypes;
+	ExtractRPCDelegate RPCDelegate = ExtractRPCDelegate::CreateLambda([&ExtractedRPCTypes](Worker_EntityId EntityId, ERPCType RPCType, const SpatialGDK::RPCPayload& Payload) {
+		ExtractedRPCTypes.Add(RPCType);
+		return true;
+	});
+	SpatialGDK::SpatialRPCService RPCService = CreateRPCService({ RPCTestEntityId_1 }, SERVER_AUTH, RPCDelegate, StaticComponentView);
+
+	Worker_ComponentUpdateOp UpdateOp = {};
+	UpdateOp.entity_id = RPCTestEntityId_1;
+	UpdateOp.update.component_id = SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID;
+
+	// The receiver doesn't extract from this update, such as while the actor is migrating.
+	UpdateOp.update.schema_type = Schema_CreateComponentUpdate();
+	SpatialGDK::RPCRingBufferUtils::WriteRPCToSchema(Schema_GetComponentUpdateFields(UpdateOp.update.schema_type), ERPCType::ServerReliable, 1, SimplePayload);
+	StaticComponentView->OnComponentUpdate(UpdateOp);
+	Schema_DestroyComponentUpdate(UpdateOp.update.schema_type);
+	RPCService.SkipExtractingRPCsForUpdatedComponent(RPCTestEntityId_1, SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID);
+
+	UpdateOp.update.schema_type = Schema_CreateComponentUpdate();
+	SpatialGDK::RPCRingBufferUtils::WriteAckToSchema(Schema_GetComponentUpdateFields(UpdateOp.update.schema_type), ERPCType::ClientReliable, 1);
+	StaticComponentView->OnComponentUpdate(UpdateOp);
+	Schema_DestroyComponentUpdate(UpdateOp.update.schema_type);
+	RPCService.ExtractRPCsForUpdatedComponent(RPCTestEntityId_1, SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID);
+
+	TestEqual("Extracted RPCs", ExtractedRPCTypes.Num(), 1);
+	TestTrue("Extracted RPC type", ExtractedRPCTypes.Num() == 1 && ExtractedRPCTypes[0] == ERPCType::ServerReliable);
+
+	// The buffer has been fully extracted, so later ack-only updates don't extract from it again.
+	UpdateOp.update.schema_type = Schema_CreateComponentUpdate();
+	SpatialGDK::RPCRingBufferUtils::WriteAckToSchema(Schema_GetComponentUpdateFields(UpdateOp.update.schema_type), ERPCType::ClientReliable, 2);
+	StaticComponentView->OnComponentUpdate(UpdateOp);
+	Schema_DestroyComponentUpdate(UpdateOp.update.schema_type);
+	RPCService.ExtractRPCsForUpdatedComponent(RPCTestEntityId_1, SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID);
+
+	TestEqual("Extracted RPCs after the next ack-only update", ExtractedRPCTypes.Num(), 1);
+	return true;
+}
+
+RPC_SERVICE_TEST(GIVEN_packed_ring_buffer_WHEN_push_overflow_client_unreliable_rpcs_to_the_service_THEN_rpcs_up_to_capacity_succeed)
+{
+	ScopedRingBufferPayloadsPerSlot PackedRingBuffer(ERPCType::ClientUnreliable, 4);
+	SpatialGDK::SpatialRPCService RPCService = CreateRPCService({ RPCTestEntityId_1 }, SERVER_AUTH);
+
+	const uint32 RingBufferSize = SpatialGDK::RPCRingBufferUtils::GetRingBufferSize(ERPCType::ClientUnreliable);
+	const uint32 Capacity = SpatialGDK::RPCRingBufferUtils::GetRingBufferCapacity(ERPCType::ClientUnreliable);
+	TestEqual("Capacity is the ring buffer size times the number of RPCs per field", Capacity, 4 * RingBufferSize);
+
+	bool bAllSucceeded = true;
+	for (uint32 i = 0; i < Capacity; ++i)
+	{
+		bAllSucceeded &= RPCService.PushRPC(RPCTestEntityId_1, ERPCType::ClientUnreliable, SimplePayload, false) == SpatialGDK::EPushRPCResult::Success;
+	}
+	TestTrue("RPCs beyond the ring buffer size fit in the packed ring buffer", bAllSucceeded);
+
+	SpatialGDK::EPushRPCResult Result = RPCService.PushRPC(RPCTestEntityId_1, ERPCType::ClientUnreliable, SimplePayload, false);
+	TestTrue("Push RPC returned expected results", (Result == SpatialGDK::EPushRPCResult::QueueOverflowed));
+	return true;
+}
+
+RPC_SERVICE_TEST(GIVEN_packed_ring_buffer_WHEN_push_client_reliable_rpcs_to_the_service_THEN_payloads_are_read_back_in_order)
+{
+	ScopedRingBufferPayloadsPerSlot PackedRingBuffer(ERPCType::ClientReliable, 4);
+	SpatialGDK::SpatialRPCService RPCService = CreateRPCService({ RPCTestEntityId_1 }, SERVER_AUTH);
+
+	// Offsets and indices both above and below the first RPC in a field, and payloads of different sizes.
+	TArray<SpatialGDK::RPCPayload> Payloads;
+	for (uint32 i = 0; i < 10; ++i)
+	{
+		TArray<uint8> Data;
+		Data.Init(static_cast<uint8>(i), i * 50);
+		Payloads.Add(SpatialGDK::RPCPayload(i % 3, 1000 - i * 300, MoveTemp(Data)));
+	}
+
+	for (const SpatialGDK::RPCPayload& Payload : Payloads)
+	{
+		RPCService.PushRPC(RPCTestEntityId_1, ERPCType::ClientReliable, Payload, false);
+	}
+
+	TArray<SpatialGDK::SpatialRPCService::UpdateToSend> UpdateToSendArray = RPCService.GetRPCsAndAcksToSend();
+	TestEqual("All RPCs were sent in one update", UpdateToSendArray.Num(), 1);
+	if (UpdateToSendArray.Num() != 1)
+	{
+		return true;
+	}
+
+	SpatialGDK::RPCRingBuffer ClientBuffer(ERPCType::ClientReliable);
+	SpatialGDK::RPCRingBufferUtils::ReadBufferFromSchema(Schema_GetComponentUpdateFields(UpdateToSendArray[0].Update.schema_type), ClientBuffer);
+
+	TestEqual("Last sent RPC ID matches the number of RPCs", ClientBuffer.LastSentRPCId, static_cast<uint64>(Payloads.Num()));
+	bool bPayloadsMatch = true;
+	for (int32 i = 0; i < Payloads.Num(); ++i)
+	{
+		const TOptional<SpatialGDK::RPCPayload>& Element = ClientBuffer.GetRingBufferElement(i + 1);
+		bPayloadsMatch &= Element.IsSet() && CompareRPCPayload(Element.GetValue(), Payloads[i]);
+	}
+	TestTrue("Read payloads match pushed payloads", bPayloadsMatch);
+
+	Schema_DestroyComponentUpdate(UpdateToSendArray[0].Update.schema_type);
+	return true;
+}
+
+RPC_SERVICE_TEST(GIVEN_sustained_client_reliable_overflow_WHEN_ring_buffer_is_packed_THEN_more_rpcs_are_delivered_per_update)
+{
+	const uint32 NumFrames = 10;
+	const uint32 RPCsPerFrame = 200;
+	const uint32 PayloadsPerSlot = 4;
+
+	SustainedRPCResult Unpacked = SimulateSustainedClientReliableRPCs(NumFrames, RPCsPerFrame);
+	SustainedRPCResult Packed;
+	{
+		ScopedRingBufferPayloadsPerSlot PackedRingBuffer(ERPCType::ClientReliable, PayloadsPerSlot);
+		Packed = SimulateSustainedClientReliableRPCs(NumFrames, RPCsPerFrame);
+	}
+
+	AddInfo(FString::Printf(TEXT("RPCs delivered over %u frames. Unpacked: %u in %u updates, %.1f bytes per RPC. Packed: %u in %u updates, %.1f bytes per RPC."),
+		NumFrames, Unpacked.NumDelivered, Unpacked.NumUpdates, static_cast<float>(Unpacked.NumBytes) / Unpacked.NumDelivered,
+		Packed.NumDelivered, Packed.NumUpdates, static_cast<float>(Packed.NumBytes) / Packed.NumDelivered));
+
+	const uint32 RingBufferSize = SpatialGDK::RPCRingBufferUtils::GetRingBufferSize(ERPCType::ClientReliable);
+	TestEqual("Unpacked ring buffer delivers one ring buffer of RPCs per frame", Unpacked.NumDelivered, NumFrames * RingBufferSize);
+	TestEqual("Packed ring buffer delivers a full packed ring buffer of RPCs per frame", Packed.NumDelivered, NumFrames * RingBufferSize * PayloadsPerSlot);
+	TestEqual("Packed ring buffer sends the same number of updates", Packed.NumUpdates, Unpacked.NumUpdates);
+	TestTrue("Packed ring buffer uses fewer bytes per RPC", Packed.NumBytes * Unpacked.NumDelivered < Unpacked.NumBytes * Packed.NumDelivered);
+
+	return true;
+}
+
 DEFINE_LATENT_AUTOMATION_COMMAND_ONE_PARAMETER(FWaitForWorld, TSharedPtr<TestData>, Data);
 bool FWaitForWorld::Update()
 {
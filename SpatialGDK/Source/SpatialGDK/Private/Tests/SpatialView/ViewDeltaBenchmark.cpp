@@ -0,0 +1,151 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "SpatialView/ViewDelta.h"
+#include "SpatialView/OpList/EntityComponentOpList.h"
+
+#include "HAL/MemoryBase.h"
+#include "HAL/PlatformTLS.h"
+#include "HAL/PlatformTime.h"
+
+#define VIEWDELTA_BENCHMARK(TestName) \
+	GDK_SLOW_TEST(Core, ViewDeltaBenchmark, TestName)
+
+DEFINE_LOG_CATEGORY_STATIC(LogViewDeltaBenchmark, Log, All);
+
+namespace SpatialGDK
+{
+
+namespace
+{
+	const uint32 BENCHMARK_OP_COUNT = 50000;
+	const Worker_ComponentId BENCHMARK_COMPONENT_ID = 1338;
+	const Schema_FieldId BENCHMARK_PAYLOAD_FIELD_ID = 1;
+	// Roughly the size of a replicated actor component with a handful of properties.
+	const uint32 BENCHMARK_PAYLOAD_BYTES = 256;
+
+	OpList CreateAddComponentOpList(uint32 OpCount)
+	{
+		TArray<uint8> Payload;
+		Payload.SetNumZeroed(BENCHMARK_PAYLOAD_BYTES);
+
+		EntityComponentOpListBuilder Builder;
+		for (uint32 i = 0; i < OpCount; ++i)
+		{
+			ComponentData Data(BENCHMARK_COMPONENT_ID);
+			Schema_AddBytes(Data.GetFields(), BENCHMARK_PAYLOAD_FIELD_ID, Payload.GetData(), Payload.Num());
+			Builder.AddComponent(static_cast<Worker_EntityId>(i + 1), MoveTemp(Data));
+		}
+		return MoveTemp(Builder).CreateOpList();
+	}
+
+	// Forwards to the allocator it replaces, counting the allocations made on the thread that installed it.
+	class FCountingMalloc final : public FMalloc
+	{
+	public:
+		FCountingMalloc()
+			: InnerMalloc(GMalloc)
+			, ThreadId(FPlatformTLS::GetCurrentThreadId())
+		{
+			GMalloc = this;
+		}
+
+		virtual ~FCountingMalloc()
+		{
+			GMalloc = InnerMalloc;
+		}
+
+		virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+		{
+			Record(Count);
+			return InnerMalloc->Malloc(Count, Alignment);
+		}
+
+		virtual void* TryMalloc(SIZE_T Count, uint32 Alignment) override
+		{
+			Record(Count);
+			return InnerMalloc->TryMalloc(Count, Alignment);
+		}
+
+		virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			Record(Count);
+			return InnerMalloc->Realloc(Original, Count, Alignment);
+		}
+
+		virtual void* TryRealloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			Record(Count);
+			return InnerMalloc->TryRealloc(Original, Count, Alignment);
+		}
+
+		virtual void Free(void* Original) override { InnerMalloc->Free(Original); }
+		virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return InnerMalloc->QuantizeSize(Count, Alignment); }
+		virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return InnerMalloc->GetAllocationSize(Original, SizeOut); }
+		virtual void Trim(bool bTrimThreadCaches) override { InnerMalloc->Trim(bTrimThreadCaches); }
+		virtual bool IsInternallyThreadSafe() const override { return InnerMalloc->IsInternallyThreadSafe(); }
+		virtual const TCHAR* GetDescriptiveName() override { return TEXT("CountingMalloc"); }
+
+		uint64 GetNumAllocations() const { return NumAllocations; }
+		uint64 GetBytesRequested() const { return BytesRequested; }
+
+	private:
+		void Record(SIZE_T Count)
+		{
+			// Reallocs to zero bytes are frees.
+			if (Count > 0 && FPlatformTLS::GetCurrentThreadId() == ThreadId)
+			{
+				++NumAllocations;
+				BytesRequested += Count;
+			}
+		}
+
+		FMalloc* InnerMalloc;
+		uint32 ThreadId;
+		uint64 NumAllocations = 0;
+		uint64 BytesRequested = 0;
+	};
+}  // anonymous namespace
+
+VIEWDELTA_BENCHMARK(GIVEN_op_list_with_many_added_components_WHEN_op_list_added_THEN_report_time_and_allocations_per_op)
+{
+	// GIVEN
+	OpList Ops = CreateAddComponentOpList(BENCHMARK_OP_COUNT);
+	TSet<EntityComponentId> ComponentsPresent;
+	ComponentsPresent.Reserve(BENCHMARK_OP_COUNT);
+	ViewDelta Delta;
+
+	// WHEN
+	uint64 NumAllocations = 0;
+	uint64 BytesAllocated = 0;
+	const double StartTime = FPlatformTime::Seconds();
+	{
+		FCountingMalloc CountingMalloc;
+		Delta.AddOpList(MoveTemp(Ops), ComponentsPresent);
+		NumAllocations = CountingMalloc.GetNumAllocations();
+		BytesAllocated = CountingMalloc.GetBytesRequested();
+	}
+	const double EndTime = FPlatformTime::Seconds();
+
+	// THEN
+	TestEqual(TEXT("Number of components added"), Delta.GetComponentsAdded().Num(), static_cast<int32>(BENCHMARK_OP_COUNT));
+
+	int32 OwningCopies = 0;
+	for (const EntityComponentData& Added : Delta.GetComponentsAdded())
+	{
+		if (Added.Data.IsOwning())
+		{
+			++OwningCopies;
+		}
+	}
+	TestEqual(TEXT("No component data was copied"), OwningCopies, 0);
+
+	const double NanosecondsPerOp = (EndTime - StartTime) * 1e9 / BENCHMARK_OP_COUNT;
+	UE_LOG(LogViewDeltaBenchmark, Display, TEXT("ViewDelta::AddOpList: %u add component ops, %.1f ns/op, %llu allocations, %llu bytes allocated (%.1f bytes/op)"),
+		BENCHMARK_OP_COUNT, NanosecondsPerOp, NumAllocations, BytesAllocated, static_cast<double>(BytesAllocated) / BENCHMARK_OP_COUNT);
+
+	return true;
+}
+
+} // namespace SpatialGDK
@@ -3,6 +3,102 @@
 #include "Tests/TestDefinitions.h"
 
 #include "SpatialView/ViewDelta.h"
+#include "SpatialView/OpList/EntityComponentOpList.h"
+
+#include "EntityComponentTestUtils.h"
 
 #define VIEWDELTA_TEST(TestName) \
 	GDK_TEST(Core, ViewDelta, TestName)
+
+namespace SpatialGDK
+{
+
+namespace
+{
+	const Worker_EntityId TEST_ENTITY_ID = 1337;
+	const Worker_ComponentId TEST_COMPONENT_ID = 1338;
+	const double TEST_VALUE = 7331;
+	const double TEST_UPDATE_VALUE = 7332;
+}  // anonymous namespace
+
+VIEWDELTA_TEST(GIVEN_op_list_with_added_component_WHEN_op_list_added_THEN_component_added_is_view_of_op_data)
+{
+	// GIVEN
+	ComponentData TestData = CreateTestComponentData(TEST_COMPONENT_ID, TEST_VALUE);
+	Schema_ComponentData* OpData = TestData.GetUnderlying();
+
+	TArray<EntityComponentData> ExpectedComponentsAdded;
+	ExpectedComponentsAdded.Push(EntityComponentData{ TEST_ENTITY_ID, TestData.DeepCopy() });
+
+	EntityComponentOpListBuilder Builder;
+	Builder.AddComponent(TEST_ENTITY_ID, MoveTemp(TestData));
+
+	TSet<EntityComponentId> ComponentsPresent;
+	ViewDelta Delta;
+
+	// WHEN
+	Delta.AddOpList(MoveTemp(Builder).CreateOpList(), ComponentsPresent);
+
+	// THEN
+	TestTrue(TEXT("ComponentsAdded are equal to expected"), AreEquivalent(Delta.GetComponentsAdded(), ExpectedComponentsAdded));
+	TestFalse(TEXT("Added component does not own its data"), Delta.GetComponentsAdded()[0].Data.IsOwning());
+	TestTrue(TEXT("Added component references the op data"), Delta.GetComponentsAdded()[0].Data.GetUnderlying() == OpData);
+	return true;
+}
+
+VIEWDELTA_TEST(GIVEN_op_list_with_added_component_and_update_WHEN_op_list_added_THEN_component_added_is_updated_copy)
+{
+	// GIVEN
+	ComponentData TestData = CreateTestComponentData(TEST_COMPONENT_ID, TEST_VALUE);
+	ComponentUpdate TestUpdate = CreateTestComponentUpdate(TEST_COMPONENT_ID, TEST_UPDATE_VALUE);
+	Schema_ComponentData* OpData = TestData.GetUnderlying();
+
+	TArray<EntityComponentData> ExpectedComponentsAdded;
+	ExpectedComponentsAdded.Push(EntityComponentData{ TEST_ENTITY_ID, CreateTestComponentData(TEST_COMPONENT_ID, TEST_UPDATE_VALUE) });
+	const ComponentData ExpectedOpData = TestData.DeepCopy();
+
+	EntityComponentOpListBuilder Builder;
+	Builder.AddComponent(TEST_ENTITY_ID, MoveTemp(TestData));
+	Builder.UpdateComponent(TEST_ENTITY_ID, MoveTemp(TestUpdate));
+
+	TSet<EntityComponentId> ComponentsPresent;
+	ViewDelta Delta;
+
+	// WHEN
+	Delta.AddOpList(MoveTemp(Builder).CreateOpList(), ComponentsPresent);
+
+	// THEN
+	TestTrue(TEXT("ComponentsAdded are equal to expected"), AreEquivalent(Delta.GetComponentsAdded(), ExpectedComponentsAdded));
+	TestTrue(TEXT("Added component owns its data"), Delta.GetComponentsAdded()[0].Data.IsOwning());
+	TestTrue(TEXT("Op data is unchanged"), CompareSchemaObjects(Schema_GetComponentDataFields(OpData), ExpectedOpData.GetFields()));
+	return true;
+}
+
+VIEWDELTA_TEST(GIVEN_op_list_with_two_updates_WHEN_op_list_added_THEN_update_is_merged_copy)
+{
+	// GIVEN
+	ComponentUpdate FirstUpdate = CreateTestComponentEvent(TEST_COMPONENT_ID, 1);
+	ComponentUpdate SecondUpdate = CreateTestComponentEvent(TEST_COMPONENT_ID, 2);
+
+	ComponentUpdate ExpectedUpdate = CreateTestComponentEvent(TEST_COMPONENT_ID, 1);
+	AddTestEvent(&ExpectedUpdate, 2);
+	TArray<EntityComponentUpdate> ExpectedUpdates;
+	ExpectedUpdates.Push(EntityComponentUpdate{ TEST_ENTITY_ID, MoveTemp(ExpectedUpdate) });
+
+	EntityComponentOpListBuilder Builder;
+	Builder.UpdateComponent(TEST_ENTITY_ID, MoveTemp(FirstUpdate));
+	Builder.UpdateComponent(TEST_ENTITY_ID, MoveTemp(SecondUpdate));
+
+	TSet<EntityComponentId> ComponentsPresent;
+	ViewDelta Delta;
+
+	// WHEN
+	Delta.AddOpList(MoveTemp(Builder).CreateOpList(), ComponentsPresent);
+
+	// THEN
+	TestTrue(TEXT("Updates are equal to expected"), AreEquivalent(Delta.GetUpdates(), ExpectedUpdates));
+	TestTrue(TEXT("Merged update owns its data"), Delta.GetUpdates()[0].Update.IsOwning());
+	return true;
+}
+
+} // namespace SpatialGDK
@@ -0,0 +1,155 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/ActorPriorityTable.h"
+
+#include "Engine/ActorChannel.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/WorldSettings.h"
+
+namespace
+{
+// The distance thresholds used by AActor::GetNetPriority.
+const float CloseProximitySquared = 500.f * 500.f;
+const float NearSightThresholdSquared = 2000.f * 2000.f;
+const float MedSightThresholdSquared = 3162.f * 3162.f;
+const float FarSightThresholdSquared = 8000.f * 8000.f;
+} // anonymous namespace
+
+namespace SpatialGDK
+{
+
+int32 FActorPriorityTable::FindOrAddRow(AActor* Actor)
+{
+	check(Actor != nullptr);
+
+	if (const int32* Row = ActorToRow.Find(Actor))
+	{
+		return *Row;
+	}
+
+	const int32 Row = AddUnmappedRow();
+	Actors[Row] = Actor;
+	ActorToRow.Add(Actor, Row);
+	return Row;
+}
+
+void FActorPriorityTable::RemoveRow(const AActor* Actor)
+{
+	int32 Row;
+	if (!ActorToRow.RemoveAndCopyValue(Actor, Row))
+	{
+		return;
+	}
+
+	// Move the last row into the gap, and point its actor at its new index.
+	const int32 LastRow = Num() - 1;
+	if (Row != LastRow && Actors[LastRow] != nullptr)
+	{
+		ActorToRow.FindChecked(Actors[LastRow]) = Row;
+	}
+
+	Actors.RemoveAtSwap(Row, 1, /* bAllowShrinking */ false);
+	LocationX.RemoveAtSwap(Row, 1, /* bAllowShrinking */ false);
+	LocationY.RemoveAtSwap(Row, 1, /* bAllowShrinking */ false);
+	LocationZ.RemoveAtSwap(Row, 1, /* bAllowShrinking */ false);
+	NetPriorities.RemoveAtSwap(Row, 1, /* bAllowShrinking */ false);
+	LastUpdateTimes.RemoveAtSwap(Row, 1, /* bAllowShrinking */ false);
+	Instigators.RemoveAtSwap(Row, 1, /* bAllowShrinking */ false);
+	Flags.RemoveAtSwap(Row, 1, /* bAllowShrinking */ false);
+}
+
+int32 FActorPriorityTable::AddUnmappedRow()
+{
+	Actors.Add(nullptr);
+	LocationX.Add(0.f);
+	LocationY.Add(0.f);
+	LocationZ.Add(0.f);
+	NetPriorities.Add(0.f);
+	LastUpdateTimes.Add(0.0);
+	Instigators.Add(nullptr);
+	return Flags.Add(NoLocation);
+}
+
+void FActorPriorityTable::UpdateRow(int32 Row, const AActor* Actor, const UActorChannel* Channel)
+{
+	uint8 RowFlags = 0;
+	if (Actor->IsHidden() || Actor->GetRootComponent() == nullptr)
+	{
+		RowFlags |= NoLocation;
+	}
+	if (Channel != nullptr)
+	{
+		RowFlags |= HasChannel;
+	}
+	if (Actor->bNetUseOwnerRelevancy && Actor->GetOwner() != nullptr)
+	{
+		RowFlags |= UsesOwnerPriority;
+	}
+
+	const FVector Location = (RowFlags & NoLocation) ? FVector::ZeroVector : Actor->GetActorLocation();
+	SetRow(Row, Location, Actor->NetPriority, Channel != nullptr ? Channel->LastUpdateTime : 0.0, Actor->GetInstigator(), RowFlags);
+}
+
+void FActorPriorityTable::SetRow(int32 Row, const FVector& Location, float NetPriority, double LastUpdateTime, const AActor* Instigator, uint8 RowFlags)
+{
+	LocationX[Row] = Location.X;
+	LocationY[Row] = Location.Y;
+	LocationZ[Row] = Location.Z;
+	NetPriorities[Row] = NetPriority;
+	LastUpdateTimes[Row] = LastUpdateTime;
+	Instigators[Row] = Instigator;
+	Flags[Row] = RowFlags;
+}
+
+void FActorPriorityTable::ComputePriorities(TArrayView<const int32> Rows, TArrayView<const FNetViewer> Viewers, double ElapsedTime, float SpawnPrioritySeconds, TArray<int32>& OutPriorities) const
+{
+	OutPriorities.Reset(Rows.Num());
+	OutPriorities.AddZeroed(Rows.Num());
+
+	// Viewers are the outer loop, so the inner loop is a tight pass over the row columns with no calls.
+	for (const FNetViewer& Viewer : Viewers)
+	{
+		const AActor* ViewTarget = Viewer.ViewTarget;
+		const FVector ViewLocation = Viewer.ViewLocation;
+		const FVector ViewDir = Viewer.ViewDir;
+
+		for (int32 i = 0; i < Rows.Num(); ++i)
+		{
+			const int32 Row = Rows[i];
+			const uint8 RowFlags = Flags[Row];
+
+			const float Time = (RowFlags & HasChannel) ? static_cast<float>(ElapsedTime - LastUpdateTimes[Row]) : SpawnPrioritySeconds;
+
+			const float DirX = LocationX[Row] - ViewLocation.X;
+			const float DirY = LocationY[Row] - ViewLocation.Y;
+			const float DirZ = LocationZ[Row] - ViewLocation.Z;
+			const float DistSq = DirX * DirX + DirY * DirY + DirZ * DirZ;
+			const float Dot = ViewDir.X * DirX + ViewDir.Y * DirY + ViewDir.Z * DirZ;
+
+			float Scale;
+			if (Dot < 0.f)
+			{
+				Scale = DistSq > NearSightThresholdSquared ? 0.2f : (DistSq > CloseProximitySquared ? 0.4f : 1.f);
+			}
+			else if (DistSq < FarSightThresholdSquared && Dot * Dot > 0.5f * DistSq)
+			{
+				// Being looked directly at.
+				Scale = 2.f;
+			}
+			else
+			{
+				Scale = DistSq > MedSightThresholdSquared ? 0.4f : 1.f;
+			}
+			Scale = (RowFlags & NoLocation) ? 1.f : Scale;
+
+			const bool bIsViewTarget = ViewTarget != nullptr && (Actors[Row] == ViewTarget || Instigators[Row] == ViewTarget);
+			Scale = bIsViewTarget ? 4.f : Scale;
+
+			// Grouped as FActorPriority and AActor::GetNetPriority do, so the results match exactly.
+			const int32 Priority = FMath::RoundToInt(65536.0f * (NetPriorities[Row] * (Time * Scale)));
+			OutPriorities[i] = FMath::Max(OutPriorities[i], Priority);
+		}
+	}
+}
+
+} // namespace SpatialGDK
@@ -41,13 +41,13 @@ namespace SpatialGDK
 
 ComponentFactory::ComponentFactory(bool bInterestDirty, USpatialNetDriver* InNetDriver, USpatialLatencyTracer* InLatencyTracer)
 	: NetDriver(InNetDriver)
-	, PackageMap(InNetDriver->PackageMap)
-	, ClassInfoManager(InNetDriver->ClassInfoManager)
+	, PackageMap(InNetDriver != nullptr ? InNetDriver->PackageMap : nullptr)
+	, ClassInfoManager(InNetDriver != nullptr ? InNetDriver->ClassInfoManager : nullptr)
 	, bInterestHasChanged(bInterestDirty)
 	, LatencyTracer(InLatencyTracer)
 { }
 
-uint32 ComponentFactory::FillSchemaObject(Schema_Object* ComponentObject, UObject* Object, const FRepChangeState& Changes, ESchemaComponentType PropertyGroup, bool bIsInitialData, TraceKey* OutLatencyTraceId, TArray<Schema_FieldId>* ClearedIds /*= nullptr*/)
+uint32 ComponentFactory::FillSchemaObject(Schema_Object* ComponentObject, UObject* Object, const uint8* ObjectData, const FClassInfo& Info, const FRepChangeState& Changes, ESchemaComponentType PropertyGroup, bool bIsInitialData, TraceKey* OutLatencyTraceId, TArray<Schema_FieldId>* ClearedIds /*= nullptr*/)
 {
 	SCOPE_CYCLE_COUNTER(STAT_FactoryProcessPropertyUpdates);
 
@@ -56,6 +56,9 @@ uint32 ComponentFactory::FillSchemaObject(Schema_Object* ComponentObject, UObjec
 	// Populate the replicated data component updates from the replicated property changelist.
 	if (Changes.RepChanged.Num() > 0)
 	{
+		// The class info holds the schema field info of each rep handle, so fields can be written without casting their properties.
+		const bool bHasRepFieldInfos = Info.RepFieldInfos.Num() == Changes.RepLayout.BaseHandleToCmdIndex.Num();
+
 		FChangelistIterator ChangelistIterator(Changes.RepChanged, 0);
 		FRepHandleIterator HandleIterator(static_cast<UStruct*>(Changes.RepLayout.GetOwner()), ChangelistIterator, Changes.RepLayout.Cmds, Changes.RepLayout.BaseHandleToCmdIndex, 0, 1, 0, Changes.RepLayout.Cmds.Num() - 1);
 		while (HandleIterator.NextHandle())
@@ -87,7 +90,7 @@ uint32 ComponentFactory::FillSchemaObject(Schema_Object* ComponentObject, UObjec
 #endif
 			if (GetGroupFromCondition(Parent.Condition) == PropertyGroup)
 			{
-				const uint8* Data = (uint8*)Object + Cmd.Offset;
+				const uint8* Data = ObjectData + Cmd.Offset;
 
 				bool bProcessedFastArrayProperty = false;
 
@@ -95,29 +98,28 @@ uint32 ComponentFactory::FillSchemaObject(Schema_Object* ComponentObject, UObjec
 				const uint32 ProfilerBytesStart = Schema_GetWriteBufferLength(ComponentObject);
 #endif
 
-				if (Cmd.Type == ERepLayoutCmdType::DynamicArray)
-				{
-					GDK_PROPERTY(ArrayProperty)* ArrayProperty = GDK_CASTFIELD<GDK_PROPERTY(ArrayProperty)>(Cmd.Property);
-
-					// Check if this is a FastArraySerializer array and if so, call our custom delta serialization
-					if (UScriptStruct* NetDeltaStruct = GetFastArraySerializerProperty(ArrayProperty))
-					{
-						SCOPE_CYCLE_COUNTER(STAT_FactoryProcessFastArrayUpdate);
+				const FSchemaFieldInfo FieldInfo = bHasRepFieldInfos ? Info.RepFieldInfos[HandleIterator.Handle - 1] : GetSchemaFieldInfo(Cmd.Property);
 
-						FSpatialNetBitWriter ValueDataWriter(PackageMap);
+				// Check if this is a FastArraySerializer array and if so, call our custom delta serialization
+				if (Cmd.Type == ERepLayoutCmdType::DynamicArray && FieldInfo.Type == ESchemaFieldType::FastArray)
+				{
+					SCOPE_CYCLE_COUNTER(STAT_FactoryProcessFastArrayUpdate);
+					check(Object != nullptr);
 
-						if (FSpatialNetDeltaSerializeInfo::DeltaSerializeWrite(NetDriver, ValueDataWriter, Object, Parent.ArrayIndex, Parent.Property, NetDeltaStruct) || bIsInitialData)
-						{
-							AddBytesToSchema(ComponentObject, HandleIterator.Handle, ValueDataWriter);
-						}
+					UScriptStruct* NetDeltaStruct = GetFastArraySerializerProperty(static_cast<GDK_PROPERTY(ArrayProperty)*>(FieldInfo.Property));
+					FSpatialNetBitWriter ValueDataWriter(PackageMap);
 
-						bProcessedFastArrayProperty = true;
+					if (FSpatialNetDeltaSerializeInfo::DeltaSerializeWrite(NetDriver, ValueDataWriter, Object, Parent.ArrayIndex, Parent.Property, NetDeltaStruct) || bIsInitialData)
+					{
+						AddBytesToSchema(ComponentObject, HandleIterator.Handle, ValueDataWriter);
 					}
+
+					bProcessedFastArrayProperty = true;
 				}
 
 				if (!bProcessedFastArrayProperty)
 				{
-					AddProperty(ComponentObject, HandleIterator.Handle, Cmd.Property, Data, ClearedIds);
+					AddProperty(ComponentObject, HandleIterator.Handle, FieldInfo, Data, ClearedIds);
 				}
 
 #if USE_NETWORK_PROFILER
@@ -148,7 +150,7 @@ uint32 ComponentFactory::FillSchemaObject(Schema_Object* ComponentObject, UObjec
 	return BytesEnd - BytesStart;
 }
 
-uint32 ComponentFactory::FillHandoverSchemaObject(Schema_Object* ComponentObject, UObject* Object, const FClassInfo& Info, const FHandoverChangeState& Changes, bool bIsInitialData, TraceKey* OutLatencyTraceId, TArray<Schema_FieldId>* ClearedIds /* = nullptr */)
+uint32 ComponentFactory::FillHandoverSchemaObject(Schema_Object* ComponentObject, UObject* Object, const uint8* ObjectData, const FClassInfo& Info, const FHandoverChangeState& Changes, bool bIsInitialData, TraceKey* OutLatencyTraceId, TArray<Schema_FieldId>* ClearedIds /* = nullptr */)
 {
 	const uint32 BytesStart = Schema_GetWriteBufferLength(ComponentObject);
 
@@ -157,7 +159,7 @@ uint32 ComponentFactory::FillHandoverSchemaObject(Schema_Object* ComponentObject
 		check(ChangedHandle > 0 && ChangedHandle - 1 < Info.HandoverProperties.Num());
 		const FHandoverPropertyInfo& PropertyInfo = Info.HandoverProperties[ChangedHandle - 1];
 
-		const uint8* Data = (uint8*)Object + PropertyInfo.Offset;
+		const uint8* Data = ObjectData + PropertyInfo.Offset;
 
 #if TRACE_LIB_ACTIVE
 		if (LatencyTracer != nullptr && OutLatencyTraceId != nullptr)
@@ -171,7 +173,7 @@ uint32 ComponentFactory::FillHandoverSchemaObject(Schema_Object* ComponentObject
 			*OutLatencyTraceId = LatencyTracer->RetrievePendingTrace(Object, PropertyInfo.Property);
 		}
 #endif
-		AddProperty(ComponentObject, ChangedHandle, PropertyInfo.Property, Data, ClearedIds);
+		AddProperty(ComponentObject, ChangedHandle, PropertyInfo.FieldInfo, Data, ClearedIds);
 	}
 
 	const uint32 BytesEnd = Schema_GetWriteBufferLength(ComponentObject);
@@ -179,11 +181,34 @@ uint32 ComponentFactory::FillHandoverSchemaObject(Schema_Object* ComponentObject
 	return BytesEnd - BytesStart;
 }
 
-void ComponentFactory::AddProperty(Schema_Object* Object, Schema_FieldId FieldId, GDK_PROPERTY(Property)* Property, const uint8* Data, TArray<Schema_FieldId>* ClearedIds)
+void ComponentFactory::AddProperty(Schema_Object* Object, Schema_FieldId FieldId, const FSchemaFieldInfo& FieldInfo, const uint8* Data, TArray<Schema_FieldId>* ClearedIds)
+{
+	if (FieldInfo.Type == ESchemaFieldType::Array || FieldInfo.Type == ESchemaFieldType::FastArray)
+	{
+		FScriptArrayHelper ArrayHelper(static_cast<GDK_PROPERTY(ArrayProperty)*>(FieldInfo.Property), Data);
+		for (int i = 0; i < ArrayHelper.Num(); i++)
+		{
+			AddValue(Object, FieldId, FieldInfo.InnerType, FieldInfo.InnerProperty, ArrayHelper.GetRawPtr(i));
+		}
+
+		if (ArrayHelper.Num() == 0 && ClearedIds)
+		{
+			ClearedIds->Add(FieldId);
+		}
+	}
+	else
+	{
+		AddValue(Object, FieldId, FieldInfo.Type, FieldInfo.Property, Data);
+	}
+}
+
+void ComponentFactory::AddValue(Schema_Object* Object, Schema_FieldId FieldId, ESchemaFieldType Type, GDK_PROPERTY(Property)* Property, const uint8* Data)
 {
-	if (GDK_PROPERTY(StructProperty)* StructProperty = GDK_CASTFIELD<GDK_PROPERTY(StructProperty)>(Property))
+	switch (Type)
 	{
-		UScriptStruct* Struct = StructProperty->Struct;
+	case ESchemaFieldType::Struct:
+	{
+		UScriptStruct* Struct = static_cast<GDK_PROPERTY(StructProperty)*>(Property)->Struct;
 		FSpatialNetBitWriter ValueDataWriter(PackageMap);
 		bool bHasUnmapped = false;
 
@@ -212,121 +237,84 @@ void ComponentFactory::AddProperty(Schema_Object* Object, Schema_FieldId FieldId
 		}
 
 		AddBytesToSchema(Object, FieldId, ValueDataWriter);
-	}
-	else if (GDK_PROPERTY(BoolProperty)* BoolProperty = GDK_CASTFIELD<GDK_PROPERTY(BoolProperty)>(Property))
-	{
-		Schema_AddBool(Object, FieldId, (uint8)BoolProperty->GetPropertyValue(Data));
-	}
-	else if (GDK_PROPERTY(FloatProperty)* FloatProperty = GDK_CASTFIELD<GDK_PROPERTY(FloatProperty)>(Property))
-	{
-		Schema_AddFloat(Object, FieldId, FloatProperty->GetPropertyValue(Data));
-	}
-	else if (GDK_PROPERTY(DoubleProperty)* DoubleProperty = GDK_CASTFIELD<GDK_PROPERTY(DoubleProperty)>(Property))
-	{
-		Schema_AddDouble(Object, FieldId, DoubleProperty->GetPropertyValue(Data));
-	}
-	else if (GDK_PROPERTY(Int8Property)* Int8Property = GDK_CASTFIELD<GDK_PROPERTY(Int8Property)>(Property))
-	{
-		Schema_AddInt32(Object, FieldId, (int32)Int8Property->GetPropertyValue(Data));
-	}
-	else if (GDK_PROPERTY(Int16Property)* Int16Property = GDK_CASTFIELD<GDK_PROPERTY(Int16Property)>(Property))
-	{
-		Schema_AddInt32(Object, FieldId, (int32)Int16Property->GetPropertyValue(Data));
-	}
-	else if (GDK_PROPERTY(IntProperty)* IntProperty = GDK_CASTFIELD<GDK_PROPERTY(IntProperty)>(Property))
-	{
-		Schema_AddInt32(Object, FieldId, IntProperty->GetPropertyValue(Data));
-	}
-	else if (GDK_PROPERTY(Int64Property)* Int64Property = GDK_CASTFIELD<GDK_PROPERTY(Int64Property)>(Property))
-	{
-		Schema_AddInt64(Object, FieldId, Int64Property->GetPropertyValue(Data));
-	}
-	else if (GDK_PROPERTY(ByteProperty)* ByteProperty = GDK_CASTFIELD<GDK_PROPERTY(ByteProperty)>(Property))
-	{
-		Schema_AddUint32(Object, FieldId, (uint32)ByteProperty->GetPropertyValue(Data));
-	}
-	else if (GDK_PROPERTY(UInt16Property)* UInt16PropertyPtr = GDK_CASTFIELD<GDK_PROPERTY(UInt16Property)>(Property))
-	{
-		Schema_AddUint32(Object, FieldId, (uint32)UInt16PropertyPtr->GetPropertyValue(Data));
-	}
-	else if (GDK_PROPERTY(UInt32Property)* UInt32PropertyPtr = GDK_CASTFIELD<GDK_PROPERTY(UInt32Property)>(Property))
-	{
-		Schema_AddUint32(Object, FieldId, UInt32PropertyPtr->GetPropertyValue(Data));
-	}
-	else if (GDK_PROPERTY(UInt64Property)* UInt64PropertyPtr = GDK_CASTFIELD<GDK_PROPERTY(UInt64Property)>(Property))
-	{
-		Schema_AddUint64(Object, FieldId, UInt64PropertyPtr->GetPropertyValue(Data));
-	}
-	else if (GDK_PROPERTY(ObjectPropertyBase)* ObjectProperty = GDK_CASTFIELD<GDK_PROPERTY(ObjectPropertyBase)>(Property))
-	{
-		if (GDK_CASTFIELD<GDK_PROPERTY(SoftObjectProperty)>(Property))
-		{
-			const FSoftObjectPtr* ObjectPtr = reinterpret_cast<const FSoftObjectPtr*>(Data);
-
-			AddObjectRefToSchema(Object, FieldId, FUnrealObjectRef::FromSoftObjectPath(ObjectPtr->ToSoftObjectPath()));
-		}
-		else
-		{
-			UObject* ObjectValue = ObjectProperty->GetObjectPropertyValue(Data);
-
-			if (ObjectProperty->PropertyFlags & CPF_AlwaysInterested)
-			{
-				bInterestHasChanged = true;
-			}
-			AddObjectRefToSchema(Object, FieldId, FUnrealObjectRef::FromObjectPtr(ObjectValue, PackageMap));
-		}
-	}
-	else if (GDK_PROPERTY(NameProperty)* NameProperty = GDK_CASTFIELD<GDK_PROPERTY(NameProperty)>(Property))
-	{
-		AddStringToSchema(Object, FieldId, NameProperty->GetPropertyValue(Data).ToString());
-	}
-	else if (GDK_PROPERTY(StrProperty)* StrProperty = GDK_CASTFIELD<GDK_PROPERTY(StrProperty)>(Property))
-	{
-		AddStringToSchema(Object, FieldId, StrProperty->GetPropertyValue(Data));
-	}
-	else if (GDK_PROPERTY(TextProperty)* TextProperty = GDK_CASTFIELD<GDK_PROPERTY(TextProperty)>(Property))
-	{
-		AddStringToSchema(Object, FieldId, TextProperty->GetPropertyValue(Data).ToString());
-	}
-	else if (GDK_PROPERTY(ArrayProperty)* ArrayProperty = GDK_CASTFIELD<GDK_PROPERTY(ArrayProperty)>(Property))
-	{
-		FScriptArrayHelper ArrayHelper(ArrayProperty, Data);
-		for (int i = 0; i < ArrayHelper.Num(); i++)
-		{
-			AddProperty(Object, FieldId, ArrayProperty->Inner, ArrayHelper.GetRawPtr(i), ClearedIds);
-		}
-
-		if (ArrayHelper.Num() == 0 && ClearedIds)
-		{
-			ClearedIds->Add(FieldId);
-		}
-	}
-	else if (GDK_PROPERTY(EnumProperty)* EnumProperty = GDK_CASTFIELD<GDK_PROPERTY(EnumProperty)>(Property))
-	{
-		if (EnumProperty->ElementSize < 4)
-		{
-			Schema_AddUint32(Object, FieldId, (uint32)EnumProperty->GetUnderlyingProperty()->GetUnsignedIntPropertyValue(Data));
-		}
-		else
+		break;
+	}
+	case ESchemaFieldType::Bool:
+		Schema_AddBool(Object, FieldId, (uint8)static_cast<GDK_PROPERTY(BoolProperty)*>(Property)->GetPropertyValue(Data));
+		break;
+	case ESchemaFieldType::Float:
+		Schema_AddFloat(Object, FieldId, static_cast<GDK_PROPERTY(FloatProperty)*>(Property)->GetPropertyValue(Data));
+		break;
+	case ESchemaFieldType::Double:
+		Schema_AddDouble(Object, FieldId, static_cast<GDK_PROPERTY(DoubleProperty)*>(Property)->GetPropertyValue(Data));
+		break;
+	case ESchemaFieldType::Int8:
+		Schema_AddInt32(Object, FieldId, (int32)static_cast<GDK_PROPERTY(Int8Property)*>(Property)->GetPropertyValue(Data));
+		break;
+	case ESchemaFieldType::Int16:
+		Schema_AddInt32(Object, FieldId, (int32)static_cast<GDK_PROPERTY(Int16Property)*>(Property)->GetPropertyValue(Data));
+		break;
+	case ESchemaFieldType::Int32:
+		Schema_AddInt32(Object, FieldId, static_cast<GDK_PROPERTY(IntProperty)*>(Property)->GetPropertyValue(Data));
+		break;
+	case ESchemaFieldType::Int64:
+		Schema_AddInt64(Object, FieldId, static_cast<GDK_PROPERTY(Int64Property)*>(Property)->GetPropertyValue(Data));
+		break;
+	case ESchemaFieldType::Byte:
+		Schema_AddUint32(Object, FieldId, (uint32)static_cast<GDK_PROPERTY(ByteProperty)*>(Property)->GetPropertyValue(Data));
+		break;
+	case ESchemaFieldType::UInt16:
+		Schema_AddUint32(Object, FieldId, (uint32)static_cast<GDK_PROPERTY(UInt16Property)*>(Property)->GetPropertyValue(Data));
+		break;
+	case ESchemaFieldType::UInt32:
+		Schema_AddUint32(Object, FieldId, static_cast<GDK_PROPERTY(UInt32Property)*>(Property)->GetPropertyValue(Data));
+		break;
+	case ESchemaFieldType::UInt64:
+		Schema_AddUint64(Object, FieldId, static_cast<GDK_PROPERTY(UInt64Property)*>(Property)->GetPropertyValue(Data));
+		break;
+	case ESchemaFieldType::SmallEnum:
+		Schema_AddUint32(Object, FieldId, (uint32)static_cast<GDK_PROPERTY(EnumProperty)*>(Property)->GetUnderlyingProperty()->GetUnsignedIntPropertyValue(Data));
+		break;
+	case ESchemaFieldType::SoftObject:
+	{
+		const FSoftObjectPtr* ObjectPtr = reinterpret_cast<const FSoftObjectPtr*>(Data);
+
+		AddObjectRefToSchema(Object, FieldId, FUnrealObjectRef::FromSoftObjectPath(ObjectPtr->ToSoftObjectPath()));
+		break;
+	}
+	case ESchemaFieldType::Object:
+	{
+		GDK_PROPERTY(ObjectPropertyBase)* ObjectProperty = static_cast<GDK_PROPERTY(ObjectPropertyBase)*>(Property);
+		UObject* ObjectValue = ObjectProperty->GetObjectPropertyValue(Data);
+
+		if (ObjectProperty->PropertyFlags & CPF_AlwaysInterested)
 		{
-			AddProperty(Object, FieldId, EnumProperty->GetUnderlyingProperty(), Data, ClearedIds);
+			bInterestHasChanged = true;
 		}
-	}
-	else if (Property->IsA<GDK_PROPERTY(DelegateProperty)>() || Property->IsA<GDK_PROPERTY(MulticastDelegateProperty)>() || Property->IsA<GDK_PROPERTY(InterfaceProperty)>())
-	{
+		AddObjectRefToSchema(Object, FieldId, FUnrealObjectRef::FromObjectPtr(ObjectValue, PackageMap));
+		break;
+	}
+	case ESchemaFieldType::Name:
+		AddStringToSchema(Object, FieldId, static_cast<GDK_PROPERTY(NameProperty)*>(Property)->GetPropertyValue(Data).ToString());
+		break;
+	case ESchemaFieldType::String:
+		AddStringToSchema(Object, FieldId, static_cast<GDK_PROPERTY(StrProperty)*>(Property)->GetPropertyValue(Data));
+		break;
+	case ESchemaFieldType::Text:
+		AddStringToSchema(Object, FieldId, static_cast<GDK_PROPERTY(TextProperty)*>(Property)->GetPropertyValue(Data).ToString());
+		break;
+	case ESchemaFieldType::NotSerialized:
 		// These properties can be set to replicate, but won't serialize across the network.
-	}
-	else if (Property->IsA<GDK_PROPERTY(MapProperty)>())
-	{
+		break;
+	case ESchemaFieldType::Map:
 		UE_LOG(LogComponentFactory, Error, TEXT("Class %s with name %s in field %d: Replicated TMaps are not supported."), *Property->GetClass()->GetName(), *Property->GetName(), FieldId);
-	}
-	else if (Property->IsA<GDK_PROPERTY(SetProperty)>())
-	{
+		break;
+	case ESchemaFieldType::Set:
 		UE_LOG(LogComponentFactory, Error, TEXT("Class %s with name %s in field %d: Replicated TSets are not supported."), *Property->GetClass()->GetName(), *Property->GetName(), FieldId);
-	}
-	else
-	{
+		break;
+	default:
 		UE_LOG(LogComponentFactory, Error, TEXT("Class %s with name %s in field %d: Attempted to add unknown property type."), *Property->GetClass()->GetName(), *Property->GetName(), FieldId);
+		break;
 	}
 }
 
@@ -336,12 +324,12 @@ TArray<FWorkerComponentData> ComponentFactory::CreateComponentDatas(UObject* Obj
 
 	if (Info.SchemaComponents[SCHEMA_Data] != SpatialConstants::INVALID_COMPONENT_ID)
 	{
-		ComponentDatas.Add(CreateComponentData(Info.SchemaComponents[SCHEMA_Data], Object, RepChangeState, SCHEMA_Data, OutBytesWritten));
+		ComponentDatas.Add(CreateComponentData(Info.SchemaComponents[SCHEMA_Data], Object, Info, RepChangeState, SCHEMA_Data, OutBytesWritten));
 	}
 
 	if (Info.SchemaComponents[SCHEMA_OwnerOnly] != SpatialConstants::INVALID_COMPONENT_ID)
 	{
-		ComponentDatas.Add(CreateComponentData(Info.SchemaComponents[SCHEMA_OwnerOnly], Object, RepChangeState, SCHEMA_OwnerOnly, OutBytesWritten));
+		ComponentDatas.Add(CreateComponentData(Info.SchemaComponents[SCHEMA_OwnerOnly], Object, Info, RepChangeState, SCHEMA_OwnerOnly, OutBytesWritten));
 	}
 
 	if (Info.SchemaComponents[SCHEMA_Handover] != SpatialConstants::INVALID_COMPONENT_ID)
@@ -352,7 +340,7 @@ TArray<FWorkerComponentData> ComponentFactory::CreateComponentDatas(UObject* Obj
 	return ComponentDatas;
 }
 
-FWorkerComponentData ComponentFactory::CreateComponentData(Worker_ComponentId ComponentId, UObject* Object, const FRepChangeState& Changes, ESchemaComponentType PropertyGroup, uint32& OutBytesWritten)
+FWorkerComponentData ComponentFactory::CreateComponentData(Worker_ComponentId ComponentId, UObject* Object, const FClassInfo& Info, const FRepChangeState& Changes, ESchemaComponentType PropertyGroup, uint32& OutBytesWritten)
 {
 	FWorkerComponentData ComponentData = {};
 	ComponentData.component_id = ComponentId;
@@ -361,7 +349,7 @@ FWorkerComponentData ComponentFactory::CreateComponentData(Worker_ComponentId Co
 
 	// We're currently ignoring ClearedId fields, which is problematic if the initial replicated state
 	// is different to what the default state is (the client will have the incorrect data). UNR:959
-	OutBytesWritten += FillSchemaObject(ComponentObject, Object, Changes, PropertyGroup, true, GetTraceKeyFromComponentObject(ComponentData));
+	OutBytesWritten += FillSchemaObject(ComponentObject, Object, reinterpret_cast<const uint8*>(Object), Info, Changes, PropertyGroup, true, GetTraceKeyFromComponentObject(ComponentData));
 
 	return ComponentData;
 }
@@ -380,7 +368,7 @@ FWorkerComponentData ComponentFactory::CreateHandoverComponentData(Worker_Compon
 	FWorkerComponentData ComponentData = CreateEmptyComponentData(ComponentId);
 	Schema_Object* ComponentObject = Schema_GetComponentDataFields(ComponentData.schema_type);
 
-	OutBytesWritten += FillHandoverSchemaObject(ComponentObject, Object, Info, Changes, true, GetTraceKeyFromComponentObject(ComponentData));
+	OutBytesWritten += FillHandoverSchemaObject(ComponentObject, Object, reinterpret_cast<const uint8*>(Object), Info, Changes, true, GetTraceKeyFromComponentObject(ComponentData));
 
 	return ComponentData;
 }
@@ -389,15 +377,49 @@ TArray<FWorkerComponentUpdate> ComponentFactory::CreateComponentUpdates(UObject*
 {
 	TArray<FWorkerComponentUpdate> ComponentUpdates;
 
+	AddPropertyComponentUpdates(Object, reinterpret_cast<const uint8*>(Object), Info, RepChangeState, HandoverChangeState, OutBytesWritten, ComponentUpdates);
+
+	// Only support Interest for Actors for now.
+	if (Object->IsA<AActor>() && bInterestHasChanged)
+	{
+		USpatialActorChannel* Channel = NetDriver->GetActorChannelByEntityId(EntityId);
+		if (Channel == nullptr)
+		{
+			ComponentUpdates.Add(NetDriver->InterestFactory->CreateInterestUpdate((AActor*)Object, Info, EntityId));
+		}
+		else
+		{
+			Worker_ComponentUpdate InterestUpdate;
+			if (NetDriver->InterestFactory->CreateInterestUpdateIfChanged((AActor*)Object, Info, EntityId, Channel->LastSentInterest, InterestUpdate))
+			{
+				ComponentUpdates.Add(InterestUpdate);
+			}
+		}
+	}
+
+	return ComponentUpdates;
+}
+
+TArray<FWorkerComponentUpdate> ComponentFactory::CreateComponentUpdatesFromSnapshot(const uint8* Snapshot, const FClassInfo& Info, const FRepChangeState* RepChangeState, const FHandoverChangeState* HandoverChangeState, uint32& OutBytesWritten)
+{
+	TArray<FWorkerComponentUpdate> ComponentUpdates;
+
+	AddPropertyComponentUpdates(nullptr, Snapshot, Info, RepChangeState, HandoverChangeState, OutBytesWritten, ComponentUpdates);
+
+	return ComponentUpdates;
+}
+
+void ComponentFactory::AddPropertyComponentUpdates(UObject* Object, const uint8* ObjectData, const FClassInfo& Info, const FRepChangeState* RepChangeState, const FHandoverChangeState* HandoverChangeState, uint32& OutBytesWritten, TArray<FWorkerComponentUpdate>& OutUpdates)
+{
 	if (RepChangeState)
 	{
 		if (Info.SchemaComponents[SCHEMA_Data] != SpatialConstants::INVALID_COMPONENT_ID)
 		{
 			uint32 BytesWritten = 0;
-			FWorkerComponentUpdate MultiClientUpdate = CreateComponentUpdate(Info.SchemaComponents[SCHEMA_Data], Object, *RepChangeState, SCHEMA_Data, BytesWritten);
+			FWorkerComponentUpdate MultiClientUpdate = CreateComponentUpdate(Info.SchemaComponents[SCHEMA_Data], Object, ObjectData, Info, *RepChangeState, SCHEMA_Data, BytesWritten);
 			if (BytesWritten > 0)
 			{
-				ComponentUpdates.Add(MultiClientUpdate);
+				OutUpdates.Add(MultiClientUpdate);
 				OutBytesWritten += BytesWritten;
 			}
 		}
@@ -405,10 +427,10 @@ TArray<FWorkerComponentUpdate> ComponentFactory::CreateComponentUpdates(UObject*
 		if (Info.SchemaComponents[SCHEMA_OwnerOnly] != SpatialConstants::INVALID_COMPONENT_ID)
 		{
 			uint32 BytesWritten = 0;
-			FWorkerComponentUpdate SingleClientUpdate = CreateComponentUpdate(Info.SchemaComponents[SCHEMA_OwnerOnly], Object, *RepChangeState, SCHEMA_OwnerOnly, BytesWritten);
+			FWorkerComponentUpdate SingleClientUpdate = CreateComponentUpdate(Info.SchemaComponents[SCHEMA_OwnerOnly], Object, ObjectData, Info, *RepChangeState, SCHEMA_OwnerOnly, BytesWritten);
 			if (BytesWritten > 0)
 			{
-				ComponentUpdates.Add(SingleClientUpdate);
+				OutUpdates.Add(SingleClientUpdate);
 				OutBytesWritten += BytesWritten;
 			}
 		}
@@ -419,25 +441,17 @@ TArray<FWorkerComponentUpdate> ComponentFactory::CreateComponentUpdates(UObject*
 		if (Info.SchemaComponents[SCHEMA_Handover] != SpatialConstants::INVALID_COMPONENT_ID)
 		{
 			uint32 BytesWritten = 0;
-			FWorkerComponentUpdate HandoverUpdate = CreateHandoverComponentUpdate(Info.SchemaComponents[SCHEMA_Handover], Object, Info, *HandoverChangeState, BytesWritten);
+			FWorkerComponentUpdate HandoverUpdate = CreateHandoverComponentUpdate(Info.SchemaComponents[SCHEMA_Handover], Object, ObjectData, Info, *HandoverChangeState, BytesWritten);
 			if (BytesWritten > 0)
 			{
-				ComponentUpdates.Add(HandoverUpdate);
+				OutUpdates.Add(HandoverUpdate);
 				OutBytesWritten += BytesWritten;
 			}
 		}
 	}
-
-	// Only support Interest for Actors for now.
-	if (Object->IsA<AActor>() && bInterestHasChanged)
-	{
-		ComponentUpdates.Add(NetDriver->InterestFactory->CreateInterestUpdate((AActor*)Object, Info, EntityId));
-	}
-
-	return ComponentUpdates;
 }
 
-FWorkerComponentUpdate ComponentFactory::CreateComponentUpdate(Worker_ComponentId ComponentId, UObject* Object, const FRepChangeState& Changes, ESchemaComponentType PropertyGroup, uint32& OutBytesWritten)
+FWorkerComponentUpdate ComponentFactory::CreateComponentUpdate(Worker_ComponentId ComponentId, UObject* Object, const uint8* ObjectData, const FClassInfo& Info, const FRepChangeState& Changes, ESchemaComponentType PropertyGroup, uint32& OutBytesWritten)
 {
 	FWorkerComponentUpdate ComponentUpdate = {};
 
@@ -447,7 +461,7 @@ FWorkerComponentUpdate ComponentFactory::CreateComponentUpdate(Worker_ComponentI
 
 	TArray<Schema_FieldId> ClearedIds;
 
-	uint32 BytesWritten = FillSchemaObject(ComponentObject, Object, Changes, PropertyGroup, false, GetTraceKeyFromComponentObject(ComponentUpdate), &ClearedIds);
+	uint32 BytesWritten = FillSchemaObject(ComponentObject, Object, ObjectData, Info, Changes, PropertyGroup, false, GetTraceKeyFromComponentObject(ComponentUpdate), &ClearedIds);
 
 	for (Schema_FieldId Id : ClearedIds)
 	{
@@ -465,7 +479,7 @@ FWorkerComponentUpdate ComponentFactory::CreateComponentUpdate(Worker_ComponentI
 	return ComponentUpdate;
 }
 
-FWorkerComponentUpdate ComponentFactory::CreateHandoverComponentUpdate(Worker_ComponentId ComponentId, UObject* Object, const FClassInfo& Info, const FHandoverChangeState& Changes, uint32& OutBytesWritten)
+FWorkerComponentUpdate ComponentFactory::CreateHandoverComponentUpdate(Worker_ComponentId ComponentId, UObject* Object, const uint8* ObjectData, const FClassInfo& Info, const FHandoverChangeState& Changes, uint32& OutBytesWritten)
 {
 	FWorkerComponentUpdate ComponentUpdate = {};
 
@@ -475,7 +489,7 @@ FWorkerComponentUpdate ComponentFactory::CreateHandoverComponentUpdate(Worker_Co
 
 	TArray<Schema_FieldId> ClearedIds;
 
-	uint32 BytesWritten = FillHandoverSchemaObject(ComponentObject, Object, Info, Changes, false, GetTraceKeyFromComponentObject(ComponentUpdate), &ClearedIds);
+	uint32 BytesWritten = FillHandoverSchemaObject(ComponentObject, Object, ObjectData, Info, Changes, false, GetTraceKeyFromComponentObject(ComponentUpdate), &ClearedIds);
 
 	for (Schema_FieldId Id : ClearedIds)
 	{
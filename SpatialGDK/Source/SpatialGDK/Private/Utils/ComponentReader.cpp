@@ -102,8 +102,7 @@ void ComponentReader::ApplyComponentData(const Worker_ComponentData& ComponentDa
 
 	Schema_Object* ComponentObject = Schema_GetComponentDataFields(ComponentData.schema_type);
 
-	TArray<uint32> UpdatedIds;
-	UpdatedIds.SetNumUninitialized(Schema_GetUniqueFieldIdCount(ComponentObject));
+	UpdatedIds.SetNumUninitialized(Schema_GetUniqueFieldIdCount(ComponentObject), /* bAllowShrinking */ false);
 	Schema_GetUniqueFieldIds(ComponentObject, UpdatedIds.GetData());
 
 	if (bIsHandover)
@@ -125,18 +124,13 @@ void ComponentReader::ApplyComponentUpdate(const Worker_ComponentUpdate& Compone
 
 	Schema_Object* ComponentObject = Schema_GetComponentUpdateFields(ComponentUpdate.schema_type);
 
-	// Retrieve all the fields that have been updated in this component update
-	TArray<uint32> UpdatedIds;
-	UpdatedIds.SetNumUninitialized(Schema_GetUniqueFieldIdCount(ComponentObject));
+	// Retrieve all the fields that have been updated in this component update, followed by all the fields that
+	// have been cleared (eg. list with no entries), so cleared fields are processed too.
+	const uint32 NumUpdatedIds = Schema_GetUniqueFieldIdCount(ComponentObject);
+	const uint32 NumClearedIds = Schema_GetComponentUpdateClearedFieldCount(ComponentUpdate.schema_type);
+	UpdatedIds.SetNumUninitialized(NumUpdatedIds + NumClearedIds, /* bAllowShrinking */ false);
 	Schema_GetUniqueFieldIds(ComponentObject, UpdatedIds.GetData());
-
-	// Retrieve all the fields that have been cleared (eg. list with no entries)
-	TArray<Schema_FieldId> ClearedIds;
-	ClearedIds.SetNumUninitialized(Schema_GetComponentUpdateClearedFieldCount(ComponentUpdate.schema_type));
-	Schema_GetComponentUpdateClearedFieldList(ComponentUpdate.schema_type, ClearedIds.GetData());
-
-	// Merge cleared fields into updated fields to ensure they will be processed (Schema_FieldId == uint32)
-	UpdatedIds.Append(ClearedIds);
+	Schema_GetComponentUpdateClearedFieldList(ComponentUpdate.schema_type, UpdatedIds.GetData() + NumUpdatedIds);
 
 	if (UpdatedIds.Num() > 0)
 	{
@@ -151,9 +145,81 @@ void ComponentReader::ApplyComponentUpdate(const Worker_ComponentUpdate& Compone
 	}
 }
 
+void ComponentReader::BeginDeferredUpdates()
+{
+	check(!bDeferPostReceive);
+	bDeferPostReceive = true;
+}
+
+void ComponentReader::EndDeferredUpdates(UObject& Object, USpatialActorChannel& Channel)
+{
+	check(bDeferPostReceive);
+	bDeferPostReceive = false;
+
+	if (DeferredReplicator != nullptr)
+	{
+		PostReceive(Object, Channel, *DeferredReplicator, DeferredRepNotifies);
+	}
+
+	DeferredReplicator = nullptr;
+	DeferredRepNotifies.Reset();
+	DeferredStoredShadowCmds.Reset();
+}
+
+FObjectReplicator* ComponentReader::PreReceive(UObject& Object, USpatialActorChannel& Channel)
+{
+	if (!bDeferPostReceive)
+	{
+		return Channel.PreReceiveSpatialUpdate(&Object);
+	}
+
+	if (DeferredReplicator == nullptr)
+	{
+		DeferredReplicator = Channel.PreReceiveSpatialUpdate(&Object);
+	}
+	return DeferredReplicator;
+}
+
+void ComponentReader::PostReceive(UObject& Object, USpatialActorChannel& Channel, FObjectReplicator& Replicator, TArray<GDK_PROPERTY(Property)*>& RepNotifies)
+{
+	if (bDeferPostReceive)
+	{
+		for (GDK_PROPERTY(Property)* RepNotify : RepNotifies)
+		{
+			DeferredRepNotifies.AddUnique(RepNotify);
+		}
+		return;
+	}
+
+	Channel.RemoveRepNotifiesWithUnresolvedObjs(RepNotifies, *Replicator.RepLayout, RootObjectReferencesMap, &Object);
+
+	Channel.PostReceiveSpatialUpdate(&Object, RepNotifies);
+}
+
+bool ComponentReader::ShouldStoreShadowValue(int32 CmdIndex, int32 NumCmds)
+{
+	if (!bDeferPostReceive)
+	{
+		return true;
+	}
+
+	if (DeferredStoredShadowCmds.Num() == 0)
+	{
+		DeferredStoredShadowCmds.Init(false, NumCmds);
+	}
+
+	// Keep the value from before the first deferred update, so RepNotifies see the value they had before this batch.
+	if (DeferredStoredShadowCmds[CmdIndex])
+	{
+		return false;
+	}
+	DeferredStoredShadowCmds[CmdIndex] = true;
+	return true;
+}
+
 void ComponentReader::ApplySchemaObject(Schema_Object* ComponentObject, UObject& Object, USpatialActorChannel& Channel, bool bIsInitialData, const TArray<Schema_FieldId>& UpdatedIds, Worker_ComponentId ComponentId, bool& bOutReferencesChanged)
 {
-	FObjectReplicator* Replicator = Channel.PreReceiveSpatialUpdate(&Object);
+	FObjectReplicator* Replicator = PreReceive(Object, Channel);
 	if (Replicator == nullptr)
 	{
 		// Can't apply this schema object. Error printed from PreReceiveSpatialUpdate.
@@ -165,6 +231,10 @@ void ComponentReader::ApplySchemaObject(Schema_Object* ComponentObject, UObject&
 	TArray<FHandleToCmdIndex>& BaseHandleToCmdIndex = Replicator->RepLayout->BaseHandleToCmdIndex;
 	TArray<FRepParentCmd>& Parents = Replicator->RepLayout->Parents;
 
+	// The class info holds the schema field info of each rep handle, so fields can be decoded without casting their properties.
+	const TArray<FSchemaFieldInfo>& RepFieldInfos = ClassInfoManager->GetOrCreateClassInfoByClass(Object.GetClass()).RepFieldInfos;
+	const bool bHasRepFieldInfos = RepFieldInfos.Num() == BaseHandleToCmdIndex.Num();
+
 	bool bIsAuthServer = Channel.IsAuthoritativeServer();
 	bool bAutonomousProxy = Channel.IsClientAutonomousProxy();
 	bool bIsClient = NetDriver->GetNetMode() == NM_Client;
@@ -226,28 +296,33 @@ void ComponentReader::ApplySchemaObject(Schema_Object* ComponentObject, UObject&
 				if (Parent.Property->HasAnyPropertyFlags(CPF_RepNotify))
 				{
 					FRepStateStaticBuffer& ShadowData = RepState->GetReceivingRepState()->StaticBuffer;
+					const bool bStoreShadowValue = ShouldStoreShadowValue(CmdIndex, Cmds.Num());
 					if (ShadowData.Num() == 0)
 					{
 						Channel.ResetShadowData(*Replicator->RepLayout.Get(), ShadowData, &Object);
 					}
-					else
+					else if (bStoreShadowValue)
 					{
 						Cmd.Property->CopySingleValue(ShadowData.GetData() + SwappedCmd.ShadowOffset, Data);
 					}
 				}
 
+				const FSchemaFieldInfo FieldInfo = bHasRepFieldInfos ? RepFieldInfos[FieldId - 1] : GetSchemaFieldInfo(Cmd.Property);
+
 				if (Cmd.Type == ERepLayoutCmdType::DynamicArray)
 				{
-					GDK_PROPERTY(ArrayProperty)* ArrayProperty = GDK_CASTFIELD<GDK_PROPERTY(ArrayProperty)>(Cmd.Property);
-					if (ArrayProperty == nullptr)
+					if (FieldInfo.Type != ESchemaFieldType::Array && FieldInfo.Type != ESchemaFieldType::FastArray)
 					{
 						UE_LOG(LogSpatialComponentReader, Error, TEXT("Failed to apply Schema Object %s. One of it's properties is null"), *Object.GetName());
 						continue;
 					}
+					GDK_PROPERTY(ArrayProperty)* ArrayProperty = static_cast<GDK_PROPERTY(ArrayProperty)*>(FieldInfo.Property);
 
 					// Check if this is a FastArraySerializer array and if so, call our custom delta serialization
-					if (UScriptStruct* NetDeltaStruct = GetFastArraySerializerProperty(ArrayProperty))
+					if (FieldInfo.Type == ESchemaFieldType::FastArray)
 					{
+						UScriptStruct* NetDeltaStruct = GetFastArraySerializerProperty(ArrayProperty);
+
 						SCOPE_CYCLE_COUNTER(STAT_ReaderApplyFastArrayUpdate);
 
 						TArray<uint8> ValueData = GetBytesFromSchema(ComponentObject, FieldId);
@@ -279,12 +354,12 @@ void ComponentReader::ApplySchemaObject(Schema_Object* ComponentObject, UObject&
 					}
 					else
 					{
-						ApplyArray(ComponentObject, FieldId, RootObjectReferencesMap, ArrayProperty, Data, SwappedCmd.Offset, ShadowOffset, Cmd.ParentIndex, bOutReferencesChanged);
+						ApplyArray(ComponentObject, FieldId, RootObjectReferencesMap, ArrayProperty, FieldInfo, Data, SwappedCmd.Offset, ShadowOffset, Cmd.ParentIndex, bOutReferencesChanged);
 					}
 				}
 				else
 				{
-					ApplyProperty(ComponentObject, FieldId, RootObjectReferencesMap, 0, Cmd.Property, Data, SwappedCmd.Offset, ShadowOffset, Cmd.ParentIndex, bOutReferencesChanged);
+					ApplyProperty(ComponentObject, FieldId, RootObjectReferencesMap, 0, FieldInfo.Type, FieldInfo.Property, Data, SwappedCmd.Offset, ShadowOffset, Cmd.ParentIndex, bOutReferencesChanged);
 				}
 
 				if (Cmd.Property->GetFName() == NAME_RemoteRole)
@@ -323,16 +398,14 @@ void ComponentReader::ApplySchemaObject(Schema_Object* ComponentObject, UObject&
 		}
 	}
 
-	Channel.RemoveRepNotifiesWithUnresolvedObjs(RepNotifies, *Replicator->RepLayout, RootObjectReferencesMap, &Object);
-
-	Channel.PostReceiveSpatialUpdate(&Object, RepNotifies);
+	PostReceive(Object, Channel, *Replicator, RepNotifies);
 }
 
 void ComponentReader::ApplyHandoverSchemaObject(Schema_Object* ComponentObject, UObject& Object, USpatialActorChannel& Channel, bool bIsInitialData, const TArray<Schema_FieldId>& UpdatedIds, Worker_ComponentId ComponentId, bool& bOutReferencesChanged)
 {
 	SCOPE_CYCLE_COUNTER(STAT_ReaderApplyHandoverPropertyUpdates);
 
-	FObjectReplicator* Replicator = Channel.PreReceiveSpatialUpdate(&Object);
+	FObjectReplicator* Replicator = PreReceive(Object, Channel);
 	if (Replicator == nullptr)
 	{
 		// Can't apply this schema object. Error printed from PreReceiveSpatialUpdate.
@@ -351,27 +424,33 @@ void ComponentReader::ApplyHandoverSchemaObject(Schema_Object* ComponentObject,
 		}
 		const FHandoverPropertyInfo& PropertyInfo = ClassInfo.HandoverProperties[FieldId - 1];
 
+		const FSchemaFieldInfo& FieldInfo = PropertyInfo.FieldInfo;
+
 		uint8* Data = (uint8*)&Object + PropertyInfo.Offset;
 
-		if (GDK_PROPERTY(ArrayProperty)* ArrayProperty = GDK_CASTFIELD<GDK_PROPERTY(ArrayProperty)>(PropertyInfo.Property))
+		if (FieldInfo.Type == ESchemaFieldType::Array || FieldInfo.Type == ESchemaFieldType::FastArray)
 		{
-			ApplyArray(ComponentObject, FieldId, RootObjectReferencesMap, ArrayProperty, Data, PropertyInfo.Offset, -1, -1, bOutReferencesChanged);
+			ApplyArray(ComponentObject, FieldId, RootObjectReferencesMap, static_cast<GDK_PROPERTY(ArrayProperty)*>(FieldInfo.Property), FieldInfo, Data, PropertyInfo.Offset, -1, -1, bOutReferencesChanged);
 		}
 		else
 		{
-			ApplyProperty(ComponentObject, FieldId, RootObjectReferencesMap, 0, PropertyInfo.Property, Data, PropertyInfo.Offset, -1, -1, bOutReferencesChanged);
+			ApplyProperty(ComponentObject, FieldId, RootObjectReferencesMap, 0, FieldInfo.Type, FieldInfo.Property, Data, PropertyInfo.Offset, -1, -1, bOutReferencesChanged);
 		}
 	}
 
-	Channel.PostReceiveSpatialUpdate(&Object, TArray<GDK_PROPERTY(Property)*>());
+	TArray<GDK_PROPERTY(Property)*> NoRepNotifies;
+	PostReceive(Object, Channel, *Replicator, NoRepNotifies);
 }
 
-void ComponentReader::ApplyProperty(Schema_Object* Object, Schema_FieldId FieldId, FObjectReferencesMap& InObjectReferencesMap, uint32 Index, GDK_PROPERTY(Property)* Property, uint8* Data, int32 Offset, int32 ShadowOffset, int32 ParentIndex, bool& bOutReferencesChanged)
+void ComponentReader::ApplyProperty(Schema_Object* Object, Schema_FieldId FieldId, FObjectReferencesMap& InObjectReferencesMap, uint32 Index, ESchemaFieldType Type, GDK_PROPERTY(Property)* Property, uint8* Data, int32 Offset, int32 ShadowOffset, int32 ParentIndex, bool& bOutReferencesChanged)
 {
 	SCOPE_CYCLE_COUNTER(STAT_ReaderApplyProperty);
 
-	if (GDK_PROPERTY(StructProperty)* StructProperty = GDK_CASTFIELD<GDK_PROPERTY(StructProperty)>(Property))
+	switch (Type)
+	{
+	case ESchemaFieldType::Struct:
 	{
+		GDK_PROPERTY(StructProperty)* StructProperty = static_cast<GDK_PROPERTY(StructProperty)*>(Property);
 		TArray<uint8> ValueData = IndexBytesFromSchema(Object, FieldId, Index);
 		// A bit hacky, we should probably include the number of bits with the data instead.
 		int64 CountBits = ValueData.Num() * 8;
@@ -396,120 +475,102 @@ void ComponentReader::ApplyProperty(Schema_Object* Object, Schema_FieldId FieldI
 
 			bOutReferencesChanged = true;
 		}
-	}
-	else if (GDK_PROPERTY(BoolProperty)* BoolProperty = GDK_CASTFIELD<GDK_PROPERTY(BoolProperty)>(Property))
-	{
-		BoolProperty->SetPropertyValue(Data, Schema_IndexBool(Object, FieldId, Index) != 0);
-	}
-	else if (GDK_PROPERTY(FloatProperty)* FloatProperty = GDK_CASTFIELD<GDK_PROPERTY(FloatProperty)>(Property))
+		break;
+	}
+	case ESchemaFieldType::Bool:
+		static_cast<GDK_PROPERTY(BoolProperty)*>(Property)->SetPropertyValue(Data, Schema_IndexBool(Object, FieldId, Index) != 0);
+		break;
+	case ESchemaFieldType::Float:
+		static_cast<GDK_PROPERTY(FloatProperty)*>(Property)->SetPropertyValue(Data, Schema_IndexFloat(Object, FieldId, Index));
+		break;
+	case ESchemaFieldType::Double:
+		static_cast<GDK_PROPERTY(DoubleProperty)*>(Property)->SetPropertyValue(Data, Schema_IndexDouble(Object, FieldId, Index));
+		break;
+	case ESchemaFieldType::Int8:
+		static_cast<GDK_PROPERTY(Int8Property)*>(Property)->SetPropertyValue(Data, (int8)Schema_IndexInt32(Object, FieldId, Index));
+		break;
+	case ESchemaFieldType::Int16:
+		static_cast<GDK_PROPERTY(Int16Property)*>(Property)->SetPropertyValue(Data, (int16)Schema_IndexInt32(Object, FieldId, Index));
+		break;
+	case ESchemaFieldType::Int32:
+		static_cast<GDK_PROPERTY(IntProperty)*>(Property)->SetPropertyValue(Data, Schema_IndexInt32(Object, FieldId, Index));
+		break;
+	case ESchemaFieldType::Int64:
+		static_cast<GDK_PROPERTY(Int64Property)*>(Property)->SetPropertyValue(Data, Schema_IndexInt64(Object, FieldId, Index));
+		break;
+	case ESchemaFieldType::Byte:
+		static_cast<GDK_PROPERTY(ByteProperty)*>(Property)->SetPropertyValue(Data, (uint8)Schema_IndexUint32(Object, FieldId, Index));
+		break;
+	case ESchemaFieldType::UInt16:
+		static_cast<GDK_PROPERTY(UInt16Property)*>(Property)->SetPropertyValue(Data, (uint16)Schema_IndexUint32(Object, FieldId, Index));
+		break;
+	case ESchemaFieldType::UInt32:
+		static_cast<GDK_PROPERTY(UInt32Property)*>(Property)->SetPropertyValue(Data, Schema_IndexUint32(Object, FieldId, Index));
+		break;
+	case ESchemaFieldType::UInt64:
+		static_cast<GDK_PROPERTY(UInt64Property)*>(Property)->SetPropertyValue(Data, Schema_IndexUint64(Object, FieldId, Index));
+		break;
+	case ESchemaFieldType::SmallEnum:
+		static_cast<GDK_PROPERTY(EnumProperty)*>(Property)->GetUnderlyingProperty()->SetIntPropertyValue(Data, (uint64)Schema_IndexUint32(Object, FieldId, Index));
+		break;
+	case ESchemaFieldType::SoftObject:
 	{
-		FloatProperty->SetPropertyValue(Data, Schema_IndexFloat(Object, FieldId, Index));
-	}
-	else if (GDK_PROPERTY(DoubleProperty)* DoubleProperty = GDK_CASTFIELD<GDK_PROPERTY(DoubleProperty)>(Property))
-	{
-		DoubleProperty->SetPropertyValue(Data, Schema_IndexDouble(Object, FieldId, Index));
-	}
-	else if (GDK_PROPERTY(Int8Property)* Int8Property = GDK_CASTFIELD<GDK_PROPERTY(Int8Property)>(Property))
-	{
-		Int8Property->SetPropertyValue(Data, (int8)Schema_IndexInt32(Object, FieldId, Index));
-	}
-	else if (GDK_PROPERTY(Int16Property)* Int16Property = GDK_CASTFIELD<GDK_PROPERTY(Int16Property)>(Property))
-	{
-		Int16Property->SetPropertyValue(Data, (int16)Schema_IndexInt32(Object, FieldId, Index));
-	}
-	else if (GDK_PROPERTY(IntProperty)* IntProperty = GDK_CASTFIELD<GDK_PROPERTY(IntProperty)>(Property))
-	{
-		IntProperty->SetPropertyValue(Data, Schema_IndexInt32(Object, FieldId, Index));
-	}
-	else if (GDK_PROPERTY(Int64Property)* Int64Property = GDK_CASTFIELD<GDK_PROPERTY(Int64Property)>(Property))
-	{
-		Int64Property->SetPropertyValue(Data, Schema_IndexInt64(Object, FieldId, Index));
-	}
-	else if (GDK_PROPERTY(ByteProperty)* ByteProperty = GDK_CASTFIELD<GDK_PROPERTY(ByteProperty)>(Property))
-	{
-		ByteProperty->SetPropertyValue(Data, (uint8)Schema_IndexUint32(Object, FieldId, Index));
-	}
-	else if (GDK_PROPERTY(UInt16Property)* UInt16PropertyPtr = GDK_CASTFIELD<GDK_PROPERTY(UInt16Property)>(Property))
-	{
-		UInt16PropertyPtr->SetPropertyValue(Data, (uint16)Schema_IndexUint32(Object, FieldId, Index));
-	}
-	else if (GDK_PROPERTY(UInt32Property)* UInt32PropertyPtr = GDK_CASTFIELD<GDK_PROPERTY(UInt32Property)>(Property))
-	{
-		UInt32PropertyPtr->SetPropertyValue(Data, Schema_IndexUint32(Object, FieldId, Index));
-	}
-	else if (GDK_PROPERTY(UInt64Property)* UInt64PropertyPtr = GDK_CASTFIELD<GDK_PROPERTY(UInt64Property)>(Property))
-	{
-		UInt64PropertyPtr->SetPropertyValue(Data, Schema_IndexUint64(Object, FieldId, Index));
+		FUnrealObjectRef ObjectRef = IndexObjectRefFromSchema(Object, FieldId, Index);
+		check(ObjectRef != FUnrealObjectRef::UNRESOLVED_OBJECT_REF);
+
+		FSoftObjectPtr* ObjectPtr = reinterpret_cast<FSoftObjectPtr*>(Data);
+		*ObjectPtr = FUnrealObjectRef::ToSoftObjectPath(ObjectRef);
+		break;
 	}
-	else if (GDK_PROPERTY(ObjectPropertyBase)* ObjectProperty = GDK_CASTFIELD<GDK_PROPERTY(ObjectPropertyBase)>(Property))
+	case ESchemaFieldType::Object:
 	{
+		GDK_PROPERTY(ObjectPropertyBase)* ObjectProperty = static_cast<GDK_PROPERTY(ObjectPropertyBase)*>(Property);
 		FUnrealObjectRef ObjectRef = IndexObjectRefFromSchema(Object, FieldId, Index);
 		check(ObjectRef != FUnrealObjectRef::UNRESOLVED_OBJECT_REF);
 
-		if (GDK_CASTFIELD<GDK_PROPERTY(SoftObjectProperty)>(Property))
-		{
-			FSoftObjectPtr* ObjectPtr = reinterpret_cast<FSoftObjectPtr*>(Data);
-			*ObjectPtr = FUnrealObjectRef::ToSoftObjectPath(ObjectRef);
-		}
-		else
-		{
-			bool bUnresolved = false;
-			UObject* ObjectValue = FUnrealObjectRef::ToObjectPtr(ObjectRef, PackageMap, bUnresolved);
+		bool bUnresolved = false;
+		UObject* ObjectValue = FUnrealObjectRef::ToObjectPtr(ObjectRef, PackageMap, bUnresolved);
 
-			const bool bHasReferences = bUnresolved || (ObjectValue && !ObjectValue->IsFullNameStableForNetworking());
+		const bool bHasReferences = bUnresolved || (ObjectValue && !ObjectValue->IsFullNameStableForNetworking());
 
-			if (ReferencesChanged(InObjectReferencesMap, Offset, bHasReferences, ObjectRef, bUnresolved))
+		if (ReferencesChanged(InObjectReferencesMap, Offset, bHasReferences, ObjectRef, bUnresolved))
+		{
+			if (bHasReferences)
 			{
-				if (bHasReferences)
-				{
-					InObjectReferencesMap.Add(Offset, FObjectReferences(ObjectRef, bUnresolved, ShadowOffset, ParentIndex, Property));
-				}
-				else
-				{
-					InObjectReferencesMap.Remove(Offset);
-				}
-				bOutReferencesChanged = true;
+				InObjectReferencesMap.Add(Offset, FObjectReferences(ObjectRef, bUnresolved, ShadowOffset, ParentIndex, Property));
 			}
-			if(!bUnresolved)
+			else
 			{
-				ObjectProperty->SetObjectPropertyValue(Data, ObjectValue);
-				if (ObjectValue != nullptr)
-				{
-					checkf(ObjectValue->IsA(ObjectProperty->PropertyClass), TEXT("Object ref %s maps to object %s with the wrong class."), *ObjectRef.ToString(), *ObjectValue->GetFullName());
-				}
+				InObjectReferencesMap.Remove(Offset);
 			}
+			bOutReferencesChanged = true;
 		}
-	}
-	else if (GDK_PROPERTY(NameProperty)* NameProperty = GDK_CASTFIELD<GDK_PROPERTY(NameProperty)>(Property))
-	{
-		NameProperty->SetPropertyValue(Data, FName(*IndexStringFromSchema(Object, FieldId, Index)));
-	}
-	else if (GDK_PROPERTY(StrProperty)* StrProperty = GDK_CASTFIELD<GDK_PROPERTY(StrProperty)>(Property))
-	{
-		StrProperty->SetPropertyValue(Data, IndexStringFromSchema(Object, FieldId, Index));
-	}
-	else if (GDK_PROPERTY(TextProperty)* TextProperty = GDK_CASTFIELD<GDK_PROPERTY(TextProperty)>(Property))
-	{
-		TextProperty->SetPropertyValue(Data, FText::FromString(IndexStringFromSchema(Object, FieldId, Index)));
-	}
-	else if (GDK_PROPERTY(EnumProperty)* EnumProperty = GDK_CASTFIELD<GDK_PROPERTY(EnumProperty)>(Property))
-	{
-		if (EnumProperty->ElementSize < 4)
-		{
-			EnumProperty->GetUnderlyingProperty()->SetIntPropertyValue(Data, (uint64)Schema_IndexUint32(Object, FieldId, Index));
-		}
-		else
+		if(!bUnresolved)
 		{
-			ApplyProperty(Object, FieldId, InObjectReferencesMap, Index, EnumProperty->GetUnderlyingProperty(), Data, Offset, ShadowOffset, ParentIndex, bOutReferencesChanged);
+			ObjectProperty->SetObjectPropertyValue(Data, ObjectValue);
+			if (ObjectValue != nullptr)
+			{
+				checkf(ObjectValue->IsA(ObjectProperty->PropertyClass), TEXT("Object ref %s maps to object %s with the wrong class."), *ObjectRef.ToString(), *ObjectValue->GetFullName());
+			}
 		}
-	}
-	else
-	{
+		break;
+	}
+	case ESchemaFieldType::Name:
+		static_cast<GDK_PROPERTY(NameProperty)*>(Property)->SetPropertyValue(Data, FName(*IndexStringFromSchema(Object, FieldId, Index)));
+		break;
+	case ESchemaFieldType::String:
+		static_cast<GDK_PROPERTY(StrProperty)*>(Property)->SetPropertyValue(Data, IndexStringFromSchema(Object, FieldId, Index));
+		break;
+	case ESchemaFieldType::Text:
+		static_cast<GDK_PROPERTY(TextProperty)*>(Property)->SetPropertyValue(Data, FText::FromString(IndexStringFromSchema(Object, FieldId, Index)));
+		break;
+	default:
 		checkf(false, TEXT("Tried to read unknown property in field %d"), FieldId);
+		break;
 	}
 }
 
-void ComponentReader::ApplyArray(Schema_Object* Object, Schema_FieldId FieldId, FObjectReferencesMap& InObjectReferencesMap, GDK_PROPERTY(ArrayProperty)* Property, uint8* Data, int32 Offset, int32 ShadowOffset, int32 ParentIndex, bool& bOutReferencesChanged)
+void ComponentReader::ApplyArray(Schema_Object* Object, Schema_FieldId FieldId, FObjectReferencesMap& InObjectReferencesMap, GDK_PROPERTY(ArrayProperty)* Property, const FSchemaFieldInfo& FieldInfo, uint8* Data, int32 Offset, int32 ShadowOffset, int32 ParentIndex, bool& bOutReferencesChanged)
 {
 	SCOPE_CYCLE_COUNTER(STAT_ReaderApplyArray);
 
@@ -529,7 +590,7 @@ void ComponentReader::ApplyArray(Schema_Object* Object, Schema_FieldId FieldId,
 
 	FScriptArrayHelper ArrayHelper(Property, Data);
 
-	int Count = GetPropertyCount(Object, FieldId, Property->Inner);
+	int Count = GetPropertyCount(Object, FieldId, FieldInfo.InnerType);
 	ArrayHelper.Resize(Count);
 
 	ArrayObjectReferences->Empty(Count);
@@ -537,7 +598,7 @@ void ComponentReader::ApplyArray(Schema_Object* Object, Schema_FieldId FieldId,
 	for (int i = 0; i < Count; i++)
 	{
 		int32 ElementOffset = i * Property->Inner->ElementSize;
-		ApplyProperty(Object, FieldId, *ArrayObjectReferences, i, Property->Inner, ArrayHelper.GetRawPtr(i), ElementOffset, ElementOffset, ParentIndex, bOutReferencesChanged);
+		ApplyProperty(Object, FieldId, *ArrayObjectReferences, i, FieldInfo.InnerType, FieldInfo.InnerProperty, ArrayHelper.GetRawPtr(i), ElementOffset, ElementOffset, ParentIndex, bOutReferencesChanged);
 	}
 
 	if (ArrayObjectReferences->Num() > 0)
@@ -561,89 +622,38 @@ void ComponentReader::ApplyArray(Schema_Object* Object, Schema_FieldId FieldId,
 	}
 }
 
-uint32 ComponentReader::GetPropertyCount(const Schema_Object* Object, Schema_FieldId FieldId, GDK_PROPERTY(Property)* Property)
+uint32 ComponentReader::GetPropertyCount(const Schema_Object* Object, Schema_FieldId FieldId, ESchemaFieldType Type)
 {
-	if (GDK_PROPERTY(StructProperty)* StructProperty = GDK_CASTFIELD<GDK_PROPERTY(StructProperty)>(Property))
+	switch (Type)
 	{
+	case ESchemaFieldType::Struct:
+	case ESchemaFieldType::Name:
+	case ESchemaFieldType::String:
+	case ESchemaFieldType::Text:
 		return Schema_GetBytesCount(Object, FieldId);
-	}
-	else if (GDK_PROPERTY(BoolProperty)* BoolProperty = GDK_CASTFIELD<GDK_PROPERTY(BoolProperty)>(Property))
-	{
+	case ESchemaFieldType::Bool:
 		return Schema_GetBoolCount(Object, FieldId);
-	}
-	else if (GDK_PROPERTY(FloatProperty)* FloatProperty = GDK_CASTFIELD<GDK_PROPERTY(FloatProperty)>(Property))
-	{
+	case ESchemaFieldType::Float:
 		return Schema_GetFloatCount(Object, FieldId);
-	}
-	else if (GDK_PROPERTY(DoubleProperty)* DoubleProperty = GDK_CASTFIELD<GDK_PROPERTY(DoubleProperty)>(Property))
-	{
+	case ESchemaFieldType::Double:
 		return Schema_GetDoubleCount(Object, FieldId);
-	}
-	else if (GDK_PROPERTY(Int8Property)* Int8Property = GDK_CASTFIELD<GDK_PROPERTY(Int8Property)>(Property))
-	{
-		return Schema_GetInt32Count(Object, FieldId);
-	}
-	else if (GDK_PROPERTY(Int16Property)* Int16Property = GDK_CASTFIELD<GDK_PROPERTY(Int16Property)>(Property))
-	{
+	case ESchemaFieldType::Int8:
+	case ESchemaFieldType::Int16:
+	case ESchemaFieldType::Int32:
 		return Schema_GetInt32Count(Object, FieldId);
-	}
-	else if (GDK_PROPERTY(IntProperty)* IntProperty = GDK_CASTFIELD<GDK_PROPERTY(IntProperty)>(Property))
-	{
-		return Schema_GetInt32Count(Object, FieldId);
-	}
-	else if (GDK_PROPERTY(Int64Property)* Int64Property = GDK_CASTFIELD<GDK_PROPERTY(Int64Property)>(Property))
-	{
+	case ESchemaFieldType::Int64:
 		return Schema_GetInt64Count(Object, FieldId);
-	}
-	else if (GDK_PROPERTY(ByteProperty)* ByteProperty = GDK_CASTFIELD<GDK_PROPERTY(ByteProperty)>(Property))
-	{
-		return Schema_GetUint32Count(Object, FieldId);
-	}
-	else if (GDK_PROPERTY(UInt16Property)* UInt16PropertyPtr = GDK_CASTFIELD<GDK_PROPERTY(UInt16Property)>(Property))
-	{
+	case ESchemaFieldType::Byte:
+	case ESchemaFieldType::UInt16:
+	case ESchemaFieldType::UInt32:
+	case ESchemaFieldType::SmallEnum:
 		return Schema_GetUint32Count(Object, FieldId);
-	}
-	else if (GDK_PROPERTY(UInt32Property)* UInt32PropertyPtr = GDK_CASTFIELD<GDK_PROPERTY(UInt32Property)>(Property))
-	{
-		return Schema_GetUint32Count(Object, FieldId);
-	}
-	else if (GDK_PROPERTY(UInt64Property)* UInt64PropertyPtr = GDK_CASTFIELD<GDK_PROPERTY(UInt64Property)>(Property))
-	{
+	case ESchemaFieldType::UInt64:
 		return Schema_GetUint64Count(Object, FieldId);
-	}
-	else if (GDK_PROPERTY(ObjectPropertyBase)* ObjectProperty = GDK_CASTFIELD<GDK_PROPERTY(ObjectPropertyBase)>(Property))
-	{
+	case ESchemaFieldType::Object:
+	case ESchemaFieldType::SoftObject:
 		return Schema_GetObjectCount(Object, FieldId);
-	}
-	else if (GDK_PROPERTY(NameProperty)* NameProperty = GDK_CASTFIELD<GDK_PROPERTY(NameProperty)>(Property))
-	{
-		return Schema_GetBytesCount(Object, FieldId);
-	}
-	else if (GDK_PROPERTY(StrProperty)* StrProperty = GDK_CASTFIELD<GDK_PROPERTY(StrProperty)>(Property))
-	{
-		return Schema_GetBytesCount(Object, FieldId);
-	}
-	else if (GDK_PROPERTY(TextProperty)* TextProperty = GDK_CASTFIELD<GDK_PROPERTY(TextProperty)>(Property))
-	{
-		return Schema_GetBytesCount(Object, FieldId);
-	}
-	else if (GDK_PROPERTY(ArrayProperty)* ArrayProperty = GDK_CASTFIELD<GDK_PROPERTY(ArrayProperty)>(Property))
-	{
-		return GetPropertyCount(Object, FieldId, ArrayProperty->Inner);
-	}
-	else if (GDK_PROPERTY(EnumProperty)* EnumProperty = GDK_CASTFIELD<GDK_PROPERTY(EnumProperty)>(Property))
-	{
-		if (EnumProperty->ElementSize < 4)
-		{
-			return Schema_GetUint32Count(Object, FieldId);
-		}
-		else
-		{
-			return GetPropertyCount(Object, FieldId, EnumProperty->GetUnderlyingProperty());
-		}
-	}
-	else
-	{
+	default:
 		checkf(false, TEXT("Tried to get count of unknown property in field %d"), FieldId);
 		return 0;
 	}
@@ -0,0 +1,120 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/HandoverLayout.h"
+
+#include "Interop/SpatialClassInfoManager.h"
+
+namespace SpatialGDK
+{
+
+void FHandoverLayout::Init(TArrayView<const FHandoverPropertyInfo> HandoverProperties)
+{
+	Segments.Reset();
+	ShadowOffsets.Reset(HandoverProperties.Num());
+
+	// Shadow data is laid out as in USpatialActorChannel::InitializeHandoverShadowData.
+	int32 ShadowOffset = 0;
+	for (int32 i = 0; i < HandoverProperties.Num(); ++i)
+	{
+		const FHandoverPropertyInfo& PropertyInfo = HandoverProperties[i];
+		const int32 Size = PropertyInfo.Property->ElementSize;
+		ShadowOffset = Align(ShadowOffset, PropertyInfo.Property->GetMinAlignment());
+		ShadowOffsets.Add(ShadowOffset);
+
+		const bool bBitwise = IsBitwiseComparable(PropertyInfo.Property);
+		FSegment* LastSegment = Segments.Num() > 0 ? &Segments.Last() : nullptr;
+		if (bBitwise && LastSegment != nullptr && LastSegment->bBitwise
+			&& LastSegment->ObjectOffset + LastSegment->Size == PropertyInfo.Offset
+			&& LastSegment->ShadowOffset + LastSegment->Size == ShadowOffset)
+		{
+			LastSegment->Size += Size;
+			LastSegment->NumProperties++;
+		}
+		else
+		{
+			Segments.Add(FSegment{ PropertyInfo.Offset, ShadowOffset, Size, i, 1, bBitwise });
+		}
+
+		ShadowOffset += Size;
+	}
+
+	ShadowDataSize = ShadowOffset;
+}
+
+void FHandoverLayout::GetChanges(TArrayView<const FHandoverPropertyInfo> HandoverProperties, uint8* ShadowData, const uint8* Object, bool bAllChanged, FHandoverChangeState& OutChanged) const
+{
+	check(HandoverProperties.Num() == ShadowOffsets.Num());
+
+	for (const FSegment& Segment : Segments)
+	{
+		uint8* StoredData = ShadowData + Segment.ShadowOffset;
+		const uint8* Data = Object + Segment.ObjectOffset;
+
+		if (!Segment.bBitwise)
+		{
+			const FHandoverPropertyInfo& PropertyInfo = HandoverProperties[Segment.FirstProperty];
+			if (bAllChanged || !PropertyInfo.Property->Identical(StoredData, Data))
+			{
+				OutChanged.Add(PropertyInfo.Handle);
+				PropertyInfo.Property->CopySingleValue(StoredData, Data);
+			}
+			continue;
+		}
+
+		// Most runs are unchanged from one tick to the next, so they're compared whole before looking at their properties.
+		if (!bAllChanged && FMemory::Memcmp(StoredData, Data, Segment.Size) == 0)
+		{
+			continue;
+		}
+
+		for (int32 i = Segment.FirstProperty; i < Segment.FirstProperty + Segment.NumProperties; ++i)
+		{
+			const int32 RunOffset = ShadowOffsets[i] - Segment.ShadowOffset;
+			if (bAllChanged || FMemory::Memcmp(StoredData + RunOffset, Data + RunOffset, HandoverProperties[i].Property->ElementSize) != 0)
+			{
+				OutChanged.Add(HandoverProperties[i].Handle);
+			}
+		}
+		FMemory::Memcpy(StoredData, Data, Segment.Size);
+	}
+}
+
+bool FHandoverLayout::IsBitwiseComparable(const GDK_PROPERTY(Property)* Property)
+{
+	if (const GDK_PROPERTY(BoolProperty)* BoolProperty = GDK_CASTFIELD<const GDK_PROPERTY(BoolProperty)>(Property))
+	{
+		// Bitfield bools share their byte with other bitfields.
+		return BoolProperty->IsNativeBool();
+	}
+
+	if (Property->IsA<GDK_PROPERTY(NumericProperty)>() || Property->IsA<GDK_PROPERTY(EnumProperty)>())
+	{
+		return true;
+	}
+
+	if (const GDK_PROPERTY(StructProperty)* StructProperty = GDK_CASTFIELD<const GDK_PROPERTY(StructProperty)>(Property))
+	{
+		const UScriptStruct* Struct = StructProperty->Struct;
+		if (Struct->StructFlags & STRUCT_IdenticalNative)
+		{
+			return false;
+		}
+
+		int32 MembersSize = 0;
+		for (TFieldIterator<GDK_PROPERTY(Property)> It(Struct); It; ++It)
+		{
+			if (!IsBitwiseComparable(*It))
+			{
+				return false;
+			}
+			MembersSize += It->GetSize();
+		}
+
+		// Identical compares members one by one, so padding between them must not be compared.
+		return MembersSize == Struct->GetStructureSize();
+	}
+
+	return false;
+}
+
+} // namespace SpatialGDK
@@ -22,6 +22,7 @@ DEFINE_LOG_CATEGORY(LogInterestFactory);
 
 DECLARE_STATS_GROUP(TEXT("InterestFactory"), STATGROUP_SpatialInterestFactory, STATCAT_Advanced);
 DECLARE_CYCLE_STAT(TEXT("AddUserDefinedQueries"), STAT_InterestFactoryAddUserDefinedQueries, STATGROUP_SpatialInterestFactory);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Unchanged interest updates skipped"), STAT_InterestFactoryUnchangedUpdatesSkipped, STATGROUP_SpatialInterestFactory);
 
 namespace SpatialGDK
 {
@@ -36,10 +37,14 @@ InterestFactory::InterestFactory(USpatialClassInfoManager* InClassInfoManager, U
 void InterestFactory::CreateAndCacheInterestState()
 {
 	ClientCheckoutRadiusConstraint = NetCullDistanceInterest::CreateCheckoutRadiusConstraints(ClassInfoManager);
+	AlwaysRelevantConstraint = CreateAlwaysRelevantConstraint();
 	ClientNonAuthInterestResultType = CreateClientNonAuthInterestResultType();
 	ClientAuthInterestResultType = CreateClientAuthInterestResultType();
 	ServerNonAuthInterestResultType = CreateServerNonAuthInterestResultType();
 	ServerAuthInterestResultType = CreateServerAuthInterestResultType();
+
+	// Cached queries are built from the state above.
+	NetCullDistanceQueriesCache.Reset();
 }
 
 SchemaResultType InterestFactory::CreateClientNonAuthInterestResultType()
@@ -101,6 +106,29 @@ Worker_ComponentUpdate InterestFactory::CreateInterestUpdate(AActor* InActor, co
 	return CreateInterest(InActor, InInfo, InEntityId).CreateInterestUpdate();
 }
 
+bool InterestFactory::CreateInterestUpdateIfChanged(AActor* InActor, const FClassInfo& InInfo, const Worker_EntityId InEntityId, TOptional<Interest>& LastSentInterest, Worker_ComponentUpdate& OutUpdate) const
+{
+	Interest NewInterest = CreateInterest(InActor, InInfo, InEntityId);
+
+	if (!GetDefault<USpatialGDKSettings>()->bSkipUnchangedInterestUpdates)
+	{
+		OutUpdate = NewInterest.CreateInterestUpdate();
+		return true;
+	}
+
+	// The interest component is a single map field, so an update always replaces all of it. The most that
+	// can be saved is the whole update, when nothing in the interest has changed since it was last sent.
+	if (LastSentInterest.IsSet() && LastSentInterest.GetValue() == NewInterest)
+	{
+		INC_DWORD_STAT(STAT_InterestFactoryUnchangedUpdatesSkipped);
+		return false;
+	}
+
+	OutUpdate = NewInterest.CreateInterestUpdate();
+	LastSentInterest = MoveTemp(NewInterest);
+	return true;
+}
+
 Interest InterestFactory::CreateServerWorkerInterest(const UAbstractLBStrategy* LBStrategy)
 {
 	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
@@ -115,8 +143,6 @@ Interest InterestFactory::CreateServerWorkerInterest(const UAbstractLBStrategy*
 	ServerQuery.ResultComponentIds = ServerNonAuthInterestResultType;
 
 	// Ensure server worker receives always relevant entities
-	QueryConstraint AlwaysRelevantConstraint = CreateAlwaysRelevantConstraint();
-
 	Constraint = AlwaysRelevantConstraint;
 
 	// Also add the server worker interest defined by the load balancing strategy if there is more than one worker.
@@ -224,7 +250,6 @@ void InterestFactory::AddAlwaysRelevantAndInterestedQuery(Interest& OutInterest,
 	const USpatialGDKSettings* Settings = GetDefault<USpatialGDKSettings>();
 
 	QueryConstraint AlwaysInterestedConstraint = CreateAlwaysInterestedConstraint(InActor, InInfo);
-	QueryConstraint AlwaysRelevantConstraint = CreateAlwaysRelevantConstraint();
 
 	QueryConstraint SystemDefinedConstraints;
 
@@ -377,6 +402,32 @@ void InterestFactory::AddNetCullDistanceQueries(Interest& OutInterest, const Que
 {
 	const USpatialGDKSettings* Settings = GetDefault<USpatialGDKSettings>();
 
+	const FNetCullDistanceQueries& NetCullDistanceQueries = GetNetCullDistanceQueries(LevelConstraint);
+
+	for (const Query& ClientQuery : NetCullDistanceQueries.ClientQueries)
+	{
+		AddComponentQueryPairToInterestComponent(OutInterest, SpatialConstants::GetClientAuthorityComponent(Settings->UseRPCRingBuffer()), ClientQuery);
+	}
+
+	// Add the queries to the server as well to ensure that all entities checked out on the client will be present on the server.
+	if (Settings->bEnableClientQueriesOnServer)
+	{
+		for (const Query& ServerQuery : NetCullDistanceQueries.ServerQueries)
+		{
+			AddComponentQueryPairToInterestComponent(OutInterest, SpatialConstants::POSITION_COMPONENT_ID, ServerQuery);
+		}
+	}
+}
+
+const FNetCullDistanceQueries& InterestFactory::GetNetCullDistanceQueries(const QueryConstraint& LevelConstraint) const
+{
+	if (const FNetCullDistanceQueries* CachedQueries = NetCullDistanceQueriesCache.Find(LevelConstraint))
+	{
+		return *CachedQueries;
+	}
+
+	FNetCullDistanceQueries NetCullDistanceQueries;
+
 	// The CheckoutConstraints list contains items with a constraint and a frequency.
 	// They are then converted to queries by adding a result type to them, and the constraints are conjoined with the level constraint.
 	for (const auto& CheckoutRadiusConstraintFrequencyPair : ClientCheckoutRadiusConstraint)
@@ -398,19 +449,22 @@ void InterestFactory::AddNetCullDistanceQueries(Interest& OutInterest, const Que
 		NewQuery.Frequency = CheckoutRadiusConstraintFrequencyPair.Frequency;
 		NewQuery.ResultComponentIds = ClientNonAuthInterestResultType;
 
-		AddComponentQueryPairToInterestComponent(OutInterest, SpatialConstants::GetClientAuthorityComponent(Settings->UseRPCRingBuffer()), NewQuery);
+		NetCullDistanceQueries.ClientQueries.Add(MoveTemp(NewQuery));
 
-		// Add the queries to the server as well to ensure that all entities checked out on the client will be present on the server.
-		if (Settings->bEnableClientQueriesOnServer)
-		{
-			Query ServerQuery;
-			ServerQuery.Constraint = CheckoutRadiusConstraintFrequencyPair.Constraint;
-			ServerQuery.Frequency = CheckoutRadiusConstraintFrequencyPair.Frequency;
-			ServerQuery.ResultComponentIds = ServerNonAuthInterestResultType;
+		Query ServerQuery;
+		ServerQuery.Constraint = CheckoutRadiusConstraintFrequencyPair.Constraint;
+		ServerQuery.Frequency = CheckoutRadiusConstraintFrequencyPair.Frequency;
+		ServerQuery.ResultComponentIds = ServerNonAuthInterestResultType;
 
-			AddComponentQueryPairToInterestComponent(OutInterest, SpatialConstants::POSITION_COMPONENT_ID, ServerQuery);
-		}
+		NetCullDistanceQueries.ServerQueries.Add(MoveTemp(ServerQuery));
 	}
+
+	if (NetCullDistanceQueriesCache.Num() >= MaxCachedNetCullDistanceQueries)
+	{
+		NetCullDistanceQueriesCache.Reset();
+	}
+
+	return NetCullDistanceQueriesCache.Add(LevelConstraint, MoveTemp(NetCullDistanceQueries));
 }
 
 void InterestFactory::AddComponentQueryPairToInterestComponent(Interest& OutInterest, const Worker_ComponentId ComponentId, const Query& QueryToAdd) const
@@ -506,15 +560,15 @@ QueryConstraint InterestFactory::CreateLevelConstraints(const AActor* InActor) c
 
 	const TSet<FName>& LoadedLevels = PlayerController->NetConnection->ClientVisibleLevelNames;
 
-	// Create component constraints for every loaded sub-level
+	TArray<Worker_ComponentId> LevelComponentIds;
+	LevelComponentIds.Reserve(LoadedLevels.Num());
+
 	for (const auto& LevelPath : LoadedLevels)
 	{
 		const Worker_ComponentId ComponentId = ClassInfoManager->GetComponentIdFromLevelPath(LevelPath.ToString());
 		if (ComponentId != SpatialConstants::INVALID_COMPONENT_ID)
 		{
-			QueryConstraint SpecificLevelConstraint;
-			SpecificLevelConstraint.ComponentConstraint = ComponentId;
-			LevelConstraint.OrConstraint.Add(SpecificLevelConstraint);
+			LevelComponentIds.Add(ComponentId);
 		}
 		else
 		{
@@ -523,6 +577,18 @@ QueryConstraint InterestFactory::CreateLevelConstraints(const AActor* InActor) c
 		}
 	}
 
+	// Sort the levels so the same loaded levels always produce the same constraint, whatever order they were loaded in.
+	// This lets the constraint be used to look up cached queries and to tell whether interest has changed.
+	LevelComponentIds.Sort();
+
+	// Create component constraints for every loaded sub-level
+	for (const Worker_ComponentId ComponentId : LevelComponentIds)
+	{
+		QueryConstraint SpecificLevelConstraint;
+		SpecificLevelConstraint.ComponentConstraint = ComponentId;
+		LevelConstraint.OrConstraint.Add(SpecificLevelConstraint);
+	}
+
 	return LevelConstraint;
 }
 
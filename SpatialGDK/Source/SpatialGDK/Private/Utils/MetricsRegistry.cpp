@@ -0,0 +1,157 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/MetricsRegistry.h"
+
+#include "Interop/Connection/OutgoingMessages.h"
+
+namespace
+{
+
+uint64 DoubleToBits(double Value)
+{
+	uint64 Bits;
+	FMemory::Memcpy(&Bits, &Value, sizeof(Bits));
+	return Bits;
+}
+
+double BitsToDouble(uint64 Bits)
+{
+	double Value;
+	FMemory::Memcpy(&Value, &Bits, sizeof(Value));
+	return Value;
+}
+
+} // anonymous namespace
+
+namespace SpatialGDK
+{
+
+FGaugeHandle FMetricsRegistry::RegisterGauge(const FString& Key)
+{
+	FGauge* Gauge = new FGauge;
+	Gauge->Key = TCHAR_TO_UTF8(*Key);
+	Gauge->ValueBits.Store(DoubleToBits(0.0));
+	return FGaugeHandle{ Gauges.Add(Gauge) };
+}
+
+FCounterHandle FMetricsRegistry::RegisterCounter(const FString& Key)
+{
+	FCounter* Counter = new FCounter;
+	Counter->Key = TCHAR_TO_UTF8(*Key);
+	Counter->Value.Store(0);
+	return FCounterHandle{ Counters.Add(Counter) };
+}
+
+FHistogramHandle FMetricsRegistry::RegisterHistogram(const FString& Key, TArrayView<const double> UpperBounds)
+{
+	FHistogram* Histogram = new FHistogram;
+	Histogram->Key = TCHAR_TO_UTF8(*Key);
+	Histogram->UpperBounds = TArray<double>(UpperBounds.GetData(), UpperBounds.Num());
+	if (Histogram->UpperBounds.Num() == 0 || Histogram->UpperBounds.Last() != TNumericLimits<double>::Max())
+	{
+		Histogram->UpperBounds.Add(TNumericLimits<double>::Max());
+	}
+	Histogram->BucketCounts = MakeUnique<TAtomic<uint32>[]>(Histogram->UpperBounds.Num());
+	for (int32 Bucket = 0; Bucket < Histogram->UpperBounds.Num(); Bucket++)
+	{
+		Histogram->BucketCounts[Bucket].Store(0);
+	}
+	Histogram->SumBits.Store(DoubleToBits(0.0));
+	return FHistogramHandle{ Histograms.Add(Histogram) };
+}
+
+void FMetricsRegistry::SetGauge(FGaugeHandle Handle, double Value)
+{
+	Gauges[Handle.Index].ValueBits.Store(DoubleToBits(Value));
+}
+
+void FMetricsRegistry::IncrementCounter(FCounterHandle Handle, int64 Amount)
+{
+	Counters[Handle.Index].Value.AddExchange(Amount);
+}
+
+void FMetricsRegistry::Observe(FHistogramHandle Handle, double Value)
+{
+	FHistogram& Histogram = Histograms[Handle.Index];
+
+	int32 Bucket = 0;
+	while (Value > Histogram.UpperBounds[Bucket] && Bucket < Histogram.UpperBounds.Num() - 1)
+	{
+		Bucket++;
+	}
+	Histogram.BucketCounts[Bucket].IncrementExchange();
+
+	uint64 SumBits = Histogram.SumBits.Load();
+	while (!Histogram.SumBits.CompareExchange(SumBits, DoubleToBits(BitsToDouble(SumBits) + Value)))
+	{
+	}
+}
+
+double FMetricsRegistry::GetGauge(FGaugeHandle Handle) const
+{
+	return BitsToDouble(Gauges[Handle.Index].ValueBits.Load());
+}
+
+int64 FMetricsRegistry::GetCounter(FCounterHandle Handle) const
+{
+	return Counters[Handle.Index].Value.Load();
+}
+
+double FMetricsRegistry::GetHistogramSum(FHistogramHandle Handle) const
+{
+	return BitsToDouble(Histograms[Handle.Index].SumBits.Load());
+}
+
+TArray<uint32> FMetricsRegistry::GetHistogramBucketCounts(FHistogramHandle Handle) const
+{
+	const FHistogram& Histogram = Histograms[Handle.Index];
+
+	TArray<uint32> BucketCounts;
+	BucketCounts.Reserve(Histogram.UpperBounds.Num());
+	for (int32 Bucket = 0; Bucket < Histogram.UpperBounds.Num(); Bucket++)
+	{
+		BucketCounts.Add(Histogram.BucketCounts[Bucket].Load());
+	}
+	return BucketCounts;
+}
+
+void FMetricsRegistry::AddToReport(SpatialMetrics& Metrics) const
+{
+	for (const FGauge& Gauge : Gauges)
+	{
+		GaugeMetric Metric;
+		Metric.Key = Gauge.Key;
+		Metric.Value = BitsToDouble(Gauge.ValueBits.Load());
+		Metrics.GaugeMetrics.Add(MoveTemp(Metric));
+	}
+
+	for (const FCounter& Counter : Counters)
+	{
+		GaugeMetric Metric;
+		Metric.Key = Counter.Key;
+		Metric.Value = static_cast<double>(Counter.Value.Load());
+		Metrics.GaugeMetrics.Add(MoveTemp(Metric));
+	}
+
+	for (const FHistogram& Histogram : Histograms)
+	{
+		// The sum is read first so it never includes samples which the buckets leave out.
+		HistogramMetric Metric;
+		Metric.Key = Histogram.Key;
+		Metric.Sum = BitsToDouble(Histogram.SumBits.Load());
+		Metric.Buckets.Reserve(Histogram.UpperBounds.Num());
+		uint32 Samples = 0;
+		for (int32 Bucket = 0; Bucket < Histogram.UpperBounds.Num(); Bucket++)
+		{
+			Samples += Histogram.BucketCounts[Bucket].Load();
+
+			HistogramMetricBucket SpatialBucket;
+			SpatialBucket.UpperBound = Histogram.UpperBounds[Bucket];
+			SpatialBucket.Samples = Samples;
+			Metric.Buckets.Push(SpatialBucket);
+		}
+		Metrics.HistogramMetrics.Add(MoveTemp(Metric));
+	}
+}
+
+} // namespace SpatialGDK
@@ -0,0 +1,113 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/ObjectRefPathTable.h"
+
+#include "Utils/SchemaDatabase.h"
+
+namespace
+{
+const TCHAR* DefaultObjectPrefix = TEXT("Default__");
+} // anonymous namespace
+
+namespace SpatialGDK
+{
+
+FObjectRefPathTable& FObjectRefPathTable::Get()
+{
+	static FObjectRefPathTable Table;
+	return Table;
+}
+
+void FObjectRefPathTable::Init(const USchemaDatabase& SchemaDatabase, bool bInInternWrittenPaths)
+{
+	TArray<FString> SourcePaths;
+	SchemaDatabase.ActorClassPathToSchema.GenerateKeyArray(SourcePaths);
+
+	TArray<FString> SubobjectClassPaths;
+	SchemaDatabase.SubobjectClassPathToSchema.GenerateKeyArray(SubobjectClassPaths);
+	SourcePaths.Append(SubobjectClassPaths);
+
+	// Class default objects are referred to by name, e.g. when loading singletons by class path.
+	const int32 NumClassPaths = SourcePaths.Num();
+	for (int32 i = 0; i < NumClassPaths; ++i)
+	{
+		TArray<FString> Segments;
+		SplitIntoSegments(SourcePaths[i], Segments);
+		if (Segments.Num() > 1)
+		{
+			SourcePaths.Add(DefaultObjectPrefix + Segments.Last());
+		}
+	}
+
+	for (const auto& ActorSchema : SchemaDatabase.ActorClassPathToSchema)
+	{
+		for (const auto& SubobjectData : ActorSchema.Value.SubobjectData)
+		{
+			SourcePaths.Add(SubobjectData.Value.Name.ToString());
+		}
+	}
+
+	TArray<FString> LevelPaths;
+	SchemaDatabase.LevelPathToComponentId.GenerateKeyArray(LevelPaths);
+	SourcePaths.Append(LevelPaths);
+	SourcePaths.Add(TEXT("PersistentLevel"));
+
+	Init(MoveTemp(SourcePaths), bInInternWrittenPaths);
+}
+
+void FObjectRefPathTable::Init(TArray<FString> SourcePaths, bool bInInternWrittenPaths)
+{
+	bInternWrittenPaths = bInInternWrittenPaths;
+
+	Paths.Reset();
+	for (const FString& SourcePath : SourcePaths)
+	{
+		SplitIntoSegments(SourcePath, Paths);
+	}
+
+	// IDs are indices into the sorted segments, so they don't depend on the order the schema database iterates in.
+	// Paths are compared case sensitively, as object ref paths are.
+	Paths.Sort([](const FString& A, const FString& B) { return A.Compare(B, ESearchCase::CaseSensitive) < 0; });
+	int32 NumUnique = 0;
+	for (int32 i = 0; i < Paths.Num(); ++i)
+	{
+		if (NumUnique == 0 || !Paths[i].Equals(Paths[NumUnique - 1], ESearchCase::CaseSensitive))
+		{
+			Swap(Paths[NumUnique++], Paths[i]);
+		}
+	}
+	Paths.SetNum(NumUnique);
+
+	PathNames.Reset(Paths.Num());
+	PathToId.Reset();
+	PathToId.Reserve(Paths.Num());
+	for (int32 i = 0; i < Paths.Num(); ++i)
+	{
+		PathNames.Add(FName(*Paths[i]));
+		PathToId.Add(Paths[i], static_cast<uint32>(i));
+	}
+}
+
+uint32 FObjectRefPathTable::FindPathId(const FString& Path) const
+{
+	const uint32* PathId = PathToId.Find(Path);
+	return PathId != nullptr ? *PathId : InvalidPathId;
+}
+
+void FObjectRefPathTable::SplitIntoSegments(const FString& FullPath, TArray<FString>& OutSegments)
+{
+	int32 SegmentStart = 0;
+	for (int32 i = 0; i <= FullPath.Len(); ++i)
+	{
+		if (i == FullPath.Len() || FullPath[i] == TEXT('.') || FullPath[i] == TEXT(':'))
+		{
+			if (i > SegmentStart)
+			{
+				OutSegments.Add(FullPath.Mid(SegmentStart, i - SegmentStart));
+			}
+			SegmentStart = i + 1;
+		}
+	}
+}
+
+} // namespace SpatialGDK
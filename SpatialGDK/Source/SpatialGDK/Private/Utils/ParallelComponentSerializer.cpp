@@ -0,0 +1,429 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/ParallelComponentSerializer.h"
+
+#include "Async/ParallelFor.h"
+#include "Engine/EngineTypes.h"
+#include "Engine/NetSerialization.h"
+#include "GameFramework/Actor.h"
+#include "Net/NetworkProfiler.h"
+
+#include "EngineClasses/SpatialActorChannel.h"
+#include "EngineClasses/SpatialNetDriver.h"
+#include "Utils/ComponentFactory.h"
+#include "Utils/InterestFactory.h"
+#include "Utils/RepLayoutUtils.h"
+#include "Utils/SpatialLatencyTracer.h"
+
+DEFINE_LOG_CATEGORY(LogParallelComponentSerializer);
+
+DECLARE_CYCLE_STAT(TEXT("ParallelComponentSerializer Flush"), STAT_ParallelComponentSerializerFlush, STATGROUP_SpatialNet);
+DECLARE_CYCLE_STAT(TEXT("ParallelComponentSerializer SerializeRange"), STAT_ParallelComponentSerializerSerializeRange, STATGROUP_SpatialNet);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Objects serialized in parallel"), STAT_ParallelComponentSerializerNumDeferred, STATGROUP_SpatialNet);
+
+namespace SpatialGDK
+{
+
+void FParallelComponentSerializer::Init(USpatialNetDriver* InNetDriver, int32 InMinObjectsPerTask)
+{
+	NetDriver = InNetDriver;
+	MinObjectsPerTask = FMath::Max(InMinObjectsPerTask, 1);
+
+	// Native NetSerialize implementations are opaque, so only engine structs known not to serialize object
+	// references or touch the package map are allowed off the game thread.
+	SafeNetSerializeStructs = {
+		FRepMovement::StaticStruct(),
+		FVector_NetQuantize::StaticStruct(),
+		FVector_NetQuantize10::StaticStruct(),
+		FVector_NetQuantize100::StaticStruct(),
+		FVector_NetQuantizeNormal::StaticStruct()
+	};
+}
+
+bool FParallelComponentSerializer::TryDefer(UObject* Object, const FClassInfo& Info, Worker_EntityId EntityId, const FRepChangeState* RepChanges, const FHandoverChangeState* HandoverChanges, bool bInterestDirty)
+{
+	check(IsInGameThread());
+
+#if USE_NETWORK_PROFILER
+	// The network profiler tracks properties as they are written and is not thread safe.
+	if (GNetworkProfiler.IsTrackingEnabled())
+	{
+		return false;
+	}
+#endif
+
+#if TRACE_LIB_ACTIVE
+	// Pending latency traces are retrieved and ended while serializing.
+	if (USpatialLatencyTracer::GetTracer(Object) != nullptr)
+	{
+		return false;
+	}
+#endif
+
+	if (RepChanges != nullptr && !CanSerializeOffGameThread(*RepChanges))
+	{
+		return false;
+	}
+
+	if (HandoverChanges != nullptr && !CanSerializeOffGameThread(Info, *HandoverChanges))
+	{
+		return false;
+	}
+
+	if (Object->GetClass()->GetMinAlignment() > static_cast<int32>(SnapshotAlignment))
+	{
+		return false;
+	}
+
+	const int32 EntryIndex = Deferred.Num();
+	FDeferredObject& Entry = Deferred.AddDefaulted_GetRef();
+	Entry.Object = Object;
+	Entry.Info = &Info;
+	Entry.EntityId = EntityId;
+	Entry.RepLayout = RepChanges != nullptr ? &RepChanges->RepLayout : nullptr;
+	Entry.bHasRepChanges = RepChanges != nullptr;
+	if (RepChanges != nullptr)
+	{
+		Entry.RepChanged = RepChanges->RepChanged;
+	}
+	Entry.bHasHandoverChanges = HandoverChanges != nullptr;
+	if (HandoverChanges != nullptr)
+	{
+		Entry.HandoverChanged = *HandoverChanges;
+	}
+	Entry.bInterestDirty = bInterestDirty;
+	Entry.bSent = false;
+
+	Snapshot(Object, Entry);
+
+	UnsentByEntity.FindOrAdd(EntityId).Add(EntryIndex);
+
+	return true;
+}
+
+void FParallelComponentSerializer::Snapshot(UObject* Object, FDeferredObject& Entry)
+{
+	// Whole top-level properties are copied, which covers every changed handle within them.
+	if (Entry.bHasRepChanges && Entry.RepChanged.Num() > 0)
+	{
+		FChangelistIterator ChangelistIterator(Entry.RepChanged, 0);
+		FRepHandleIterator HandleIterator(static_cast<UStruct*>(Entry.RepLayout->GetOwner()), ChangelistIterator, Entry.RepLayout->Cmds, Entry.RepLayout->BaseHandleToCmdIndex, 0, 1, 0, Entry.RepLayout->Cmds.Num() - 1);
+		while (HandleIterator.NextHandle())
+		{
+			const FRepLayoutCmd& Cmd = Entry.RepLayout->Cmds[HandleIterator.CmdIndex];
+			Entry.SnapshotProperties.AddUnique(Entry.RepLayout->Parents[Cmd.ParentIndex].Property);
+
+			if (Cmd.Type == ERepLayoutCmdType::DynamicArray)
+			{
+				if (!HandleIterator.JumpOverArray())
+				{
+					break;
+				}
+			}
+		}
+	}
+
+	if (Entry.bHasHandoverChanges)
+	{
+		for (uint16 ChangedHandle : Entry.HandoverChanged)
+		{
+			Entry.SnapshotProperties.AddUnique(Entry.Info->HandoverProperties[ChangedHandle - 1].Property);
+		}
+	}
+
+	int32 SpanStart = MAX_int32;
+	int32 SpanEnd = 0;
+	for (GDK_PROPERTY(Property)* Property : Entry.SnapshotProperties)
+	{
+		SpanStart = FMath::Min(SpanStart, Property->GetOffset_ForGC());
+		SpanEnd = FMath::Max(SpanEnd, Property->GetOffset_ForGC() + Property->GetSize());
+	}
+
+	if (Entry.SnapshotProperties.Num() == 0)
+	{
+		SpanStart = 0;
+	}
+
+	// Starting the span on an aligned offset keeps every copied value as aligned as it is in the object.
+	Entry.SnapshotBase = AlignDown(SpanStart, SnapshotAlignment);
+
+	// Offsets stay valid when the snapshot memory grows, and the copied values are relocatable like any other UE value.
+	Entry.SnapshotOffset = SnapshotMemory.AddUninitialized(Align(FMath::Max(SpanEnd - Entry.SnapshotBase, 0), SnapshotAlignment));
+	uint8* SnapshotData = GetSnapshotContainer(Entry);
+
+	for (GDK_PROPERTY(Property)* Property : Entry.SnapshotProperties)
+	{
+		void* Value = Property->ContainerPtrToValuePtr<void>(SnapshotData);
+		Property->InitializeValue(Value);
+		Property->CopyCompleteValue(Value, Property->ContainerPtrToValuePtr<void>(Object));
+	}
+}
+
+uint8* FParallelComponentSerializer::GetSnapshotContainer(const FDeferredObject& Entry) const
+{
+	// Only the offsets of the changed properties are read through it, and those are all inside the copied span.
+	return const_cast<uint8*>(SnapshotMemory.GetData()) + Entry.SnapshotOffset - Entry.SnapshotBase;
+}
+
+uint32 FParallelComponentSerializer::FlushEntity(Worker_EntityId EntityId, FSendUpdateFunction SendUpdate)
+{
+	check(IsInGameThread());
+
+	TArray<int32, TInlineAllocator<2>> EntryIndices;
+	if (!UnsentByEntity.RemoveAndCopyValue(EntityId, EntryIndices))
+	{
+		return 0;
+	}
+
+	ComponentFactory UpdateFactory(false, NetDriver, nullptr);
+	FOutputBuffer Buffer;
+
+	for (int32 EntryIndex : EntryIndices)
+	{
+		FDeferredObject& Entry = Deferred[EntryIndex];
+
+		SerializeEntry(UpdateFactory, Entry, Buffer);
+		for (FWorkerComponentUpdate& Update : Buffer.Updates)
+		{
+			SendUpdate(Entry.EntityId, Update);
+		}
+		SendInterestUpdate(Entry, SendUpdate);
+
+		Buffer.Updates.Reset();
+		Entry.bSent = true;
+	}
+
+	EntityFlushBytesWritten += Buffer.BytesWritten;
+
+	return Buffer.BytesWritten;
+}
+
+uint32 FParallelComponentSerializer::Flush(FSendUpdateFunction SendUpdate)
+{
+	check(IsInGameThread());
+
+	if (Deferred.Num() == 0)
+	{
+		return 0;
+	}
+
+	// Everything left is about to be sent, in order.
+	UnsentByEntity.Reset();
+
+	SCOPE_CYCLE_COUNTER(STAT_ParallelComponentSerializerFlush);
+	INC_DWORD_STAT_BY(STAT_ParallelComponentSerializerNumDeferred, Deferred.Num());
+
+	// One output buffer per task. Tasks cover contiguous ranges so concatenating the buffers preserves deferral order.
+	const int32 MaxTasks = FTaskGraphInterface::Get().GetNumWorkerThreads() + 1;
+	const int32 NumTasks = FMath::Clamp(Deferred.Num() / MinObjectsPerTask, 1, MaxTasks);
+	const int32 ObjectsPerTask = FMath::DivideAndRoundUp(Deferred.Num(), NumTasks);
+
+	OutputBuffers.SetNum(NumTasks);
+
+	ParallelFor(NumTasks, [this, ObjectsPerTask](int32 TaskIndex)
+	{
+		const int32 StartIndex = TaskIndex * ObjectsPerTask;
+		const int32 EndIndex = FMath::Min(StartIndex + ObjectsPerTask, Deferred.Num());
+		SerializeRange(StartIndex, EndIndex, OutputBuffers[TaskIndex]);
+	}, /*bForceSingleThread*/ NumTasks == 1);
+
+	uint32 BytesWritten = EntityFlushBytesWritten;
+	int32 ObjectIndex = 0;
+	for (FOutputBuffer& Buffer : OutputBuffers)
+	{
+		int32 UpdateIndex = 0;
+		for (int32 NumUpdates : Buffer.NumUpdatesPerObject)
+		{
+			const FDeferredObject& Entry = Deferred[ObjectIndex++];
+			if (Entry.bSent)
+			{
+				continue;
+			}
+
+			for (int32 i = 0; i < NumUpdates; i++)
+			{
+				SendUpdate(Entry.EntityId, Buffer.Updates[UpdateIndex++]);
+			}
+
+			SendInterestUpdate(Entry, SendUpdate);
+		}
+
+		BytesWritten += Buffer.BytesWritten;
+
+		Buffer.Updates.Reset();
+		Buffer.NumUpdatesPerObject.Reset();
+		Buffer.BytesWritten = 0;
+	}
+
+	ReleaseSnapshots();
+	Deferred.Reset();
+	EntityFlushBytesWritten = 0;
+
+	return BytesWritten;
+}
+
+void FParallelComponentSerializer::SerializeEntry(ComponentFactory& UpdateFactory, const FDeferredObject& Entry, FOutputBuffer& OutBuffer) const
+{
+	TOptional<FRepChangeState> RepChangeState;
+	if (Entry.bHasRepChanges)
+	{
+		RepChangeState.Emplace(FRepChangeState{ Entry.RepChanged, *Entry.RepLayout });
+	}
+
+	TArray<FWorkerComponentUpdate> Updates = UpdateFactory.CreateComponentUpdatesFromSnapshot(GetSnapshotContainer(Entry), *Entry.Info,
+		RepChangeState.GetPtrOrNull(), Entry.bHasHandoverChanges ? &Entry.HandoverChanged : nullptr, OutBuffer.BytesWritten);
+
+	OutBuffer.NumUpdatesPerObject.Add(Updates.Num());
+	OutBuffer.Updates.Append(MoveTemp(Updates));
+}
+
+void FParallelComponentSerializer::SerializeRange(int32 StartIndex, int32 EndIndex, FOutputBuffer& OutBuffer) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_ParallelComponentSerializerSerializeRange);
+
+	// Interest is sent separately on the game thread, and no property that could dirty it is deferred.
+	ComponentFactory UpdateFactory(false, NetDriver, nullptr);
+
+	for (int32 Index = StartIndex; Index < EndIndex; Index++)
+	{
+		const FDeferredObject& Entry = Deferred[Index];
+		if (Entry.bSent)
+		{
+			OutBuffer.NumUpdatesPerObject.Add(0);
+			continue;
+		}
+
+		SerializeEntry(UpdateFactory, Entry, OutBuffer);
+	}
+}
+
+void FParallelComponentSerializer::SendInterestUpdate(const FDeferredObject& Entry, FSendUpdateFunction SendUpdate) const
+{
+	// Interest is built from game state and is always created on the game thread.
+	AActor* Actor = Cast<AActor>(Entry.Object.Get());
+	if (!Entry.bInterestDirty || Actor == nullptr)
+	{
+		return;
+	}
+
+	USpatialActorChannel* Channel = NetDriver->GetActorChannelByEntityId(Entry.EntityId);
+
+	Worker_ComponentUpdate InterestUpdate;
+	if (Channel == nullptr)
+	{
+		InterestUpdate = NetDriver->InterestFactory->CreateInterestUpdate(Actor, *Entry.Info, Entry.EntityId);
+	}
+	else if (!NetDriver->InterestFactory->CreateInterestUpdateIfChanged(Actor, *Entry.Info, Entry.EntityId, Channel->LastSentInterest, InterestUpdate))
+	{
+		return;
+	}
+
+	FWorkerComponentUpdate Update = InterestUpdate;
+	SendUpdate(Entry.EntityId, Update);
+}
+
+void FParallelComponentSerializer::ReleaseSnapshots()
+{
+	for (const FDeferredObject& Entry : Deferred)
+	{
+		uint8* SnapshotData = GetSnapshotContainer(Entry);
+		for (GDK_PROPERTY(Property)* Property : Entry.SnapshotProperties)
+		{
+			Property->DestroyValue(Property->ContainerPtrToValuePtr<void>(SnapshotData));
+		}
+	}
+
+	SnapshotMemory.Reset();
+}
+
+bool FParallelComponentSerializer::CanSerializeOffGameThread(const FRepChangeState& RepChanges)
+{
+	if (RepChanges.RepChanged.Num() == 0)
+	{
+		return true;
+	}
+
+	// Walks the changelist the same way ComponentFactory::FillSchemaObject does.
+	FChangelistIterator ChangelistIterator(RepChanges.RepChanged, 0);
+	FRepHandleIterator HandleIterator(static_cast<UStruct*>(RepChanges.RepLayout.GetOwner()), ChangelistIterator, RepChanges.RepLayout.Cmds, RepChanges.RepLayout.BaseHandleToCmdIndex, 0, 1, 0, RepChanges.RepLayout.Cmds.Num() - 1);
+	while (HandleIterator.NextHandle())
+	{
+		const FRepLayoutCmd& Cmd = RepChanges.RepLayout.Cmds[HandleIterator.CmdIndex];
+
+		if (!IsPropertySafe(Cmd.Property))
+		{
+			return false;
+		}
+
+		if (Cmd.Type == ERepLayoutCmdType::DynamicArray)
+		{
+			if (!HandleIterator.JumpOverArray())
+			{
+				break;
+			}
+		}
+	}
+
+	return true;
+}
+
+bool FParallelComponentSerializer::CanSerializeOffGameThread(const FClassInfo& Info, const FHandoverChangeState& HandoverChanges)
+{
+	for (uint16 ChangedHandle : HandoverChanges)
+	{
+		if (ChangedHandle == 0 || ChangedHandle - 1 >= Info.HandoverProperties.Num())
+		{
+			return false;
+		}
+
+		if (!IsPropertySafe(Info.HandoverProperties[ChangedHandle - 1].Property))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool FParallelComponentSerializer::IsPropertySafe(GDK_PROPERTY(Property)* Property)
+{
+	if (const bool* bCachedIsSafe = PropertySafetyCache.Find(Property))
+	{
+		return *bCachedIsSafe;
+	}
+
+	const bool bIsSafe = ComputeIsPropertySafe(Property);
+	PropertySafetyCache.Add(Property, bIsSafe);
+	return bIsSafe;
+}
+
+bool FParallelComponentSerializer::ComputeIsPropertySafe(GDK_PROPERTY(Property)* Property) const
+{
+	// Mirrors the branches of ComponentFactory::AddProperty.
+	if (GDK_PROPERTY(StructProperty)* StructProperty = GDK_CASTFIELD<GDK_PROPERTY(StructProperty)>(Property))
+	{
+		// Non-native structs go through the net driver's shared struct rep layouts, which are not thread safe.
+		return (StructProperty->Struct->StructFlags & STRUCT_NetSerializeNative) != 0 && SafeNetSerializeStructs.Contains(StructProperty->Struct);
+	}
+
+	if (GDK_PROPERTY(ArrayProperty)* ArrayProperty = GDK_CASTFIELD<GDK_PROPERTY(ArrayProperty)>(Property))
+	{
+		if (GetFastArraySerializerProperty(ArrayProperty) != nullptr)
+		{
+			return false;
+		}
+		return ComputeIsPropertySafe(ArrayProperty->Inner);
+	}
+
+	if (GDK_PROPERTY(EnumProperty)* EnumProperty = GDK_CASTFIELD<GDK_PROPERTY(EnumProperty)>(Property))
+	{
+		return ComputeIsPropertySafe(EnumProperty->GetUnderlyingProperty());
+	}
+
+	return Property->IsA<GDK_PROPERTY(BoolProperty)>()
+		|| Property->IsA<GDK_PROPERTY(NumericProperty)>()
+		|| Property->IsA<GDK_PROPERTY(NameProperty)>()
+		|| Property->IsA<GDK_PROPERTY(StrProperty)>();
+}
+
+} // namespace SpatialGDK
@@ -0,0 +1,114 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/PositionHierarchy.h"
+
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "Interop/SpatialStaticComponentView.h"
+#include "SpatialConstants.h"
+
+namespace SpatialGDK
+{
+
+bool FPositionHierarchy::Update(AActor& Root, FGetEntityId GetEntityId, const USpatialStaticComponentView& StaticComponentView)
+{
+	AActor* Pawn = GetPawnOutsideHierarchy(Root);
+
+	int32 Index = 0;
+	const bool bActorsMatch = MatchesActors(Root, Index) && (Pawn == nullptr || MatchesActors(*Pawn, Index)) && Index == Actors.Num();
+	if (bActorsMatch && MatchesEntities(GetEntityId, StaticComponentView))
+	{
+		return false;
+	}
+
+	Actors.Reset();
+	AddActors(Root);
+	if (Pawn != nullptr)
+	{
+		AddActors(*Pawn);
+	}
+
+	Entities.Reset(Actors.Num());
+	for (const TWeakObjectPtr<AActor>& Actor : Actors)
+	{
+		const Worker_EntityId EntityId = GetEntityId(Actor.Get());
+		if (EntityId == SpatialConstants::INVALID_ENTITY_ID)
+		{
+			Entities.Add(FEntity{ EntityId, false, 0 });
+			continue;
+		}
+
+		const bool bAuthoritative = StaticComponentView.HasAuthority(EntityId, SpatialConstants::POSITION_COMPONENT_ID);
+		Entities.Add(FEntity{ EntityId, bAuthoritative, StaticComponentView.GetAuthorityGeneration(EntityId) });
+	}
+
+	return true;
+}
+
+AActor* FPositionHierarchy::GetPawnOutsideHierarchy(AActor& Root)
+{
+	// A possessed pawn is usually owned by its controller, in which case it's already one of the controller's children.
+	if (APlayerController* PlayerController = Cast<APlayerController>(&Root))
+	{
+		APawn* Pawn = PlayerController->GetPawn();
+		if (Pawn != nullptr && Pawn->GetOwner() != PlayerController)
+		{
+			return Pawn;
+		}
+	}
+	return nullptr;
+}
+
+bool FPositionHierarchy::MatchesEntities(FGetEntityId GetEntityId, const USpatialStaticComponentView& StaticComponentView) const
+{
+	for (int32 Index = 0; Index < Entities.Num(); ++Index)
+	{
+		const FEntity& Entity = Entities[Index];
+		if (Entity.EntityId == SpatialConstants::INVALID_ENTITY_ID)
+		{
+			// Actors don't change entity once they have one, so only those without one yet need to be looked up again.
+			if (GetEntityId(Actors[Index].Get()) != SpatialConstants::INVALID_ENTITY_ID)
+			{
+				return false;
+			}
+		}
+		else if (StaticComponentView.GetAuthorityGeneration(Entity.EntityId) != Entity.AuthorityGeneration)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool FPositionHierarchy::MatchesActors(AActor& Actor, int32& Index) const
+{
+	if (Index >= Actors.Num() || Actors[Index].Get() != &Actor)
+	{
+		return false;
+	}
+	++Index;
+
+	for (AActor* Child : Actor.Children)
+	{
+		if (Child != nullptr && !MatchesActors(*Child, Index))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void FPositionHierarchy::AddActors(AActor& Actor)
+{
+	Actors.Add(&Actor);
+
+	for (AActor* Child : Actor.Children)
+	{
+		if (Child != nullptr)
+		{
+			AddActors(*Child);
+		}
+	}
+}
+
+} // namespace SpatialGDK
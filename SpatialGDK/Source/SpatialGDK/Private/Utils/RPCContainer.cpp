@@ -95,13 +95,27 @@ FPendingRPCParams::FPendingRPCParams(const FUnrealObjectRef& InTargetObjectRef,
 {
 }
 
+const double FRPCContainerStats::AgeBucketUpperBounds[NumAgeBuckets] = { 0.01, 0.1, 0.5, 1.0, 5.0, 30.0, TNumericLimits<double>::Max() };
+
+void FRPCContainerStats::RecordAge(double AgeSeconds)
+{
+	int32 Bucket = 0;
+	while (AgeSeconds > AgeBucketUpperBounds[Bucket] && Bucket < NumAgeBuckets - 1)
+	{
+		Bucket++;
+	}
+	AgeBucketCounts[Bucket]++;
+	AgeSumSeconds += AgeSeconds;
+}
+
 void FRPCContainer::ProcessOrQueueRPC(const FUnrealObjectRef& TargetObjectRef, ERPCType Type, RPCPayload&& Payload)
 {
 	FPendingRPCParams Params {TargetObjectRef, Type, MoveTemp(Payload)};
+	TArray<FUnrealObjectRef> WaitingOnRefs;
 
 	if (!ObjectHasRPCsQueuedOfType(Params.ObjectRef.Entity, Params.Type))
 	{
-		const ERPCQueueProcessResult QueueProcessResult = ApplyFunction(Params);
+		const ERPCQueueProcessResult QueueProcessResult = ApplyFunction(Params, WaitingOnRefs);
 		switch (QueueProcessResult)
 		{
 		case ERPCQueueProcessResult::ContinueProcessing:
@@ -110,37 +124,185 @@ void FRPCContainer::ProcessOrQueueRPC(const FUnrealObjectRef& TargetObjectRef, E
 		}
 	}
 
-	FArrayOfParams& ArrayOfParams = QueuedRPCs.FindOrAdd(Params.Type).FindOrAdd(Params.ObjectRef.Entity);
-	ArrayOfParams.Push(MoveTemp(Params));
+	Enqueue(MoveTemp(Params), MoveTemp(WaitingOnRefs));
+}
+
+void FRPCContainer::Enqueue(FPendingRPCParams&& Params, TArray<FUnrealObjectRef>&& WaitingOnRefs)
+{
+	const FQueueKey Key(Params.ObjectRef.Entity, Params.Type);
+	int32 QueueIndex;
+	if (const int32* ExistingIndex = QueueIndices.Find(Key))
+	{
+		QueueIndex = *ExistingIndex;
+	}
+	else
+	{
+		QueueIndex = PendingQueues.Add(FRPCQueue{ Params.ObjectRef.Entity, Params.Type, INDEX_NONE, INDEX_NONE });
+		QueueIndices.Add(Key, QueueIndex);
+	}
+
+	const int32 RPCIndex = RPCPool.Add(FQueuedRPC{ MoveTemp(Params), INDEX_NONE, NextRPCSequence++ });
+
+	FRPCQueue& Queue = PendingQueues[QueueIndex];
+	if (Queue.Head == INDEX_NONE)
+	{
+		Queue.Head = RPCIndex;
+		Stats.NumPendingQueues++;
+		SetWaitingOnRefs(Queue, MoveTemp(WaitingOnRefs));
+	}
+	else
+	{
+		RPCPool[Queue.Tail].Next = RPCIndex;
+	}
+	Queue.Tail = RPCIndex;
+	Stats.NumQueuedRPCs++;
 }
 
-void FRPCContainer::ProcessRPCs(FArrayOfParams& RPCList)
+void FRPCContainer::ProcessQueue(int32 QueueIndex)
 {
 	// TODO: UNR-1651 Find a way to drop queued RPCs
-	int NumProcessedParams = 0;
-	for (auto& Params : RPCList)
+	// The processing function can queue more RPCs, which can move the queues and the pool, so nothing is held across calls to it.
+	while (PendingQueues[QueueIndex].Head != INDEX_NONE)
 	{
-		const ERPCQueueProcessResult QueueProcessResult = ApplyFunction(Params);
+		const int32 RPCIndex = PendingQueues[QueueIndex].Head;
+		const uint64 RPCSequence = RPCPool[RPCIndex].Sequence;
+		FPendingRPCParams Params = MoveTemp(RPCPool[RPCIndex].Params);
+		TArray<FUnrealObjectRef> WaitingOnRefs;
+		const ERPCQueueProcessResult QueueProcessResult = ApplyFunction(Params, WaitingOnRefs);
+
+		FRPCQueue& Queue = PendingQueues[QueueIndex];
+		if (Queue.Head != RPCIndex || RPCPool[RPCIndex].Sequence != RPCSequence)
+		{
+			// The queue was dropped while processing. An RPC queued since then can be at the head in the same pool slot.
+			return;
+		}
+
 		switch (QueueProcessResult)
 		{
 		case ERPCQueueProcessResult::ContinueProcessing:
-			NumProcessedParams++;
+			Stats.RecordAge((FDateTime::Now() - Params.Timestamp).GetTotalSeconds());
+			PopQueuedRPC(Queue);
 			break;
 		case ERPCQueueProcessResult::StopProcessing:
-			// The actual break out of the for loop is handled below
-			break;
+			RPCPool[Queue.Head].Params = MoveTemp(Params);
+			SetWaitingOnRefs(Queue, MoveTemp(WaitingOnRefs));
+			return;
 		case ERPCQueueProcessResult::DropEntireQueue:
-			RPCList.Empty();
+			RPCPool[Queue.Head].Params = MoveTemp(Params);
+			EmptyQueue(Queue);
 			return;
 		}
+	}
+}
 
-		if (QueueProcessResult == ERPCQueueProcessResult::StopProcessing)
+void FRPCContainer::PopQueuedRPC(FRPCQueue& Queue)
+{
+	// The next RPC hasn't been tried yet, so it isn't waiting on anything.
+	if (Queue.WaitingOnRefs.Num() > 0)
+	{
+		SetWaitingOnRefs(Queue, {});
+	}
+
+	const int32 RPCIndex = Queue.Head;
+	Queue.Head = RPCPool[RPCIndex].Next;
+	if (Queue.Head == INDEX_NONE)
+	{
+		Queue.Tail = INDEX_NONE;
+		Stats.NumPendingQueues--;
+	}
+	RPCPool.RemoveAt(RPCIndex);
+	Stats.NumQueuedRPCs--;
+}
+
+void FRPCContainer::EmptyQueue(FRPCQueue& Queue)
+{
+	const FDateTime Now = FDateTime::Now();
+	while (Queue.Head != INDEX_NONE)
+	{
+		Stats.RecordAge((Now - RPCPool[Queue.Head].Params.Timestamp).GetTotalSeconds());
+		PopQueuedRPC(Queue);
+	}
+}
+
+void FRPCContainer::SetWaitingOnRefs(FRPCQueue& Queue, TArray<FUnrealObjectRef>&& Refs)
+{
+	const FQueueKey Key(Queue.EntityId, Queue.Type);
+
+	for (const FUnrealObjectRef& Ref : Queue.WaitingOnRefs)
+	{
+		if (TArray<FQueueKey>* WaitingQueues = QueuesWaitingOnRef.Find(Ref))
 		{
-			break;
+			WaitingQueues->RemoveSingleSwap(Key, /* bAllowShrinking */ false);
+			if (WaitingQueues->Num() == 0)
+			{
+				QueuesWaitingOnRef.Remove(Ref);
+			}
 		}
 	}
 
-	RPCList.RemoveAt(0, NumProcessedParams);
+	Queue.WaitingOnRefs = MoveTemp(Refs);
+
+	for (const FUnrealObjectRef& Ref : Queue.WaitingOnRefs)
+	{
+		QueuesWaitingOnRef.FindOrAdd(Ref).AddUnique(Key);
+	}
+}
+
+bool FRPCContainer::IsWaitingOnRefs(const FRPCQueue& Queue, const FDateTime& Now) const
+{
+	if (UnresolvedRefsRetryTime < 0.0f || Queue.WaitingOnRefs.Num() == 0)
+	{
+		return false;
+	}
+
+	return (Now - RPCPool[Queue.Head].Params.Timestamp).GetTotalSeconds() <= UnresolvedRefsRetryTime;
+}
+
+void FRPCContainer::ProcessQueuesWaitingOn(const FUnrealObjectRef& ObjectRef)
+{
+	TArray<FQueueKey> WaitingQueues;
+	if (!QueuesWaitingOnRef.RemoveAndCopyValue(ObjectRef, WaitingQueues))
+	{
+		return;
+	}
+
+	for (const FQueueKey& Key : WaitingQueues)
+	{
+		// Queues aren't removed while processing, but may have been emptied by processing the queues before them.
+		if (const int32* QueueIndex = QueueIndices.Find(Key))
+		{
+			ProcessQueue(*QueueIndex);
+		}
+	}
+}
+
+void FRPCContainer::ProcessRefsResolvedWhileProcessing()
+{
+	while (RefsResolvedWhileProcessing.Num() > 0)
+	{
+		ProcessQueuesWaitingOn(RefsResolvedWhileProcessing.Pop(/* bAllowShrinking */ false));
+	}
+}
+
+void FRPCContainer::RemoveEmptyQueues()
+{
+	for (int32 QueueIndex = PendingQueues.Num() - 1; QueueIndex >= 0; --QueueIndex)
+	{
+		const FRPCQueue& Queue = PendingQueues[QueueIndex];
+		if (Queue.Head != INDEX_NONE)
+		{
+			continue;
+		}
+
+		QueueIndices.Remove(FQueueKey(Queue.EntityId, Queue.Type));
+		const int32 LastIndex = PendingQueues.Num() - 1;
+		if (QueueIndex != LastIndex)
+		{
+			const FRPCQueue& Moved = PendingQueues[LastIndex];
+			QueueIndices.FindChecked(FQueueKey(Moved.EntityId, Moved.Type)) = QueueIndex;
+		}
+		PendingQueues.RemoveAtSwap(QueueIndex, 1, /* bAllowShrinking */ false);
+	}
 }
 
 void FRPCContainer::ProcessRPCs()
@@ -153,41 +315,75 @@ void FRPCContainer::ProcessRPCs()
 
 	bAlreadyProcessingRPCs = true;
 
-	for (auto& RPCs : QueuedRPCs)
+	// Queues added while processing are left for the next call, as they were just tried.
+	const FDateTime Now = FDateTime::Now();
+	const int32 NumQueues = PendingQueues.Num();
+	for (int32 QueueIndex = 0; QueueIndex < NumQueues; ++QueueIndex)
 	{
-		FRPCMap& MapOfQueues = RPCs.Value;
-		for (auto It = MapOfQueues.CreateIterator(); It; ++It)
+		if (!IsWaitingOnRefs(PendingQueues[QueueIndex], Now))
 		{
-			FArrayOfParams& RPCList = It.Value();
-			ProcessRPCs(RPCList);
-			if (RPCList.Num() == 0)
-			{
-				It.RemoveCurrent();
-			}
+			ProcessQueue(QueueIndex);
 		}
 	}
 
+	ProcessRefsResolvedWhileProcessing();
+	RemoveEmptyQueues();
+
 	bAlreadyProcessingRPCs = false;
 }
 
-void FRPCContainer::DropForEntity(const Worker_EntityId& EntityId)
+void FRPCContainer::ProcessRPCsWaitingOn(const FUnrealObjectRef& ObjectRef)
 {
-	for (auto& RpcMap : QueuedRPCs)
+	if (bAlreadyProcessingRPCs)
+	{
+		// Processing an RPC can resolve objects, and the queues waiting on them still need to be woken up.
+		RefsResolvedWhileProcessing.Add(ObjectRef);
+		return;
+	}
+
+	if (!QueuesWaitingOnRef.Contains(ObjectRef))
 	{
-		RpcMap.Value.Remove(EntityId);
+		return;
 	}
+
+	bAlreadyProcessingRPCs = true;
+
+	ProcessQueuesWaitingOn(ObjectRef);
+	ProcessRefsResolvedWhileProcessing();
+	RemoveEmptyQueues();
+
+	bAlreadyProcessingRPCs = false;
 }
 
-bool FRPCContainer::ObjectHasRPCsQueuedOfType(const Worker_EntityId& EntityId, ERPCType Type) const
+void FRPCContainer::SetUnresolvedRefsRetryTime(float Seconds)
 {
-	if(const FRPCMap* MapOfQueues = QueuedRPCs.Find(Type))
+	UnresolvedRefsRetryTime = Seconds;
+}
+
+void FRPCContainer::DropForEntity(const Worker_EntityId& EntityId)
+{
+	for (uint8 TypeIndex = 0; TypeIndex <= static_cast<uint8>(ERPCType::CrossServer); ++TypeIndex)
 	{
-		if(const FArrayOfParams* RPCList = MapOfQueues->Find(EntityId))
+		if (const int32* QueueIndex = QueueIndices.Find(FQueueKey(EntityId, static_cast<ERPCType>(TypeIndex))))
 		{
-			return (RPCList->Num() > 0);
+			EmptyQueue(PendingQueues[*QueueIndex]);
 		}
 	}
 
+	// While processing, empty queues are removed once processing is done, so queue indices stay valid.
+	if (!bAlreadyProcessingRPCs)
+	{
+		RemoveEmptyQueues();
+	}
+}
+
+bool FRPCContainer::ObjectHasRPCsQueuedOfType(const Worker_EntityId& EntityId, ERPCType Type) const
+{
+	if (const int32* QueueIndex = QueueIndices.Find(FQueueKey(EntityId, Type)))
+	{
+		return PendingQueues[*QueueIndex].Head != INDEX_NONE;
+	}
+
 	return false;
 }
  
@@ -201,7 +397,7 @@ void FRPCContainer::BindProcessingFunction(const FProcessRPCDelegate& Function)
 	ProcessingFunction = Function;
 }
 
-ERPCQueueProcessResult FRPCContainer::ApplyFunction(FPendingRPCParams& Params)
+ERPCQueueProcessResult FRPCContainer::ApplyFunction(FPendingRPCParams& Params, TArray<FUnrealObjectRef>& OutWaitingOnRefs)
 {
 	ensure(ProcessingFunction.IsBound());
 	FRPCErrorInfo ErrorInfo = ProcessingFunction.Execute(Params);
@@ -211,6 +407,18 @@ ERPCQueueProcessResult FRPCContainer::ApplyFunction(FPendingRPCParams& Params)
 		return ERPCQueueProcessResult::ContinueProcessing;
 	}
 
+	if (ErrorInfo.QueueProcessResult == ERPCQueueProcessResult::StopProcessing)
+	{
+		if (ErrorInfo.ErrorCode == ERPCResult::UnresolvedTargetObject)
+		{
+			OutWaitingOnRefs.Add(Params.ObjectRef);
+		}
+		else if (ErrorInfo.ErrorCode == ERPCResult::UnresolvedParameters)
+		{
+			OutWaitingOnRefs = MoveTemp(ErrorInfo.UnresolvedRefs);
+		}
+	}
+
 #if !UE_BUILD_SHIPPING
 	LogRPCError(ErrorInfo, QueueType, Params);
 #endif
@@ -0,0 +1,273 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/RPCOverflowQueue.h"
+
+#include "Utils/RPCRingBuffer.h"
+
+namespace SpatialGDK
+{
+
+RPCOverflowQueue::RPCOverflowQueue(uint32 InMaxBytes)
+	: MaxBytes(InMaxBytes)
+{
+}
+
+EOverflowEnqueueResult RPCOverflowQueue::Enqueue(EntityRPCType EntityType, RPCPayload&& Payload)
+{
+	const ERPCType Type = EntityType.Type;
+	const int32 TypeIndex = static_cast<int32>(Type);
+	const uint32 Bytes = sizeof(Node) + Payload.PayloadData.Num();
+
+	if (IsReliable(Type))
+	{
+		while (Stats.BytesHeld + Bytes > MaxBytes && DropOldestUnreliable())
+		{
+		}
+
+		if (Stats.BytesHeld + Bytes > MaxBytes)
+		{
+			Stats.NumRejected[TypeIndex]++;
+			return EOverflowEnqueueResult::QueueFull;
+		}
+	}
+	else
+	{
+		if (NodeList* List = UnreliableLists.Find(EntityType))
+		{
+			if (List->Num >= RPCRingBufferUtils::GetRingBufferCapacity(Type))
+			{
+				DropHead(*List);
+				if (List->Num == 0)
+				{
+					UnreliableLists.Remove(EntityType);
+				}
+			}
+		}
+
+		while (Stats.BytesHeld + Bytes > MaxBytes && DropOldestUnreliable())
+		{
+		}
+
+		if (Stats.BytesHeld + Bytes > MaxBytes)
+		{
+			Stats.NumDropped[TypeIndex]++;
+			return EOverflowEnqueueResult::Dropped;
+		}
+	}
+
+	const int32 NodeIndex = AllocateNode();
+	Node& NewNode = Nodes[NodeIndex];
+	NewNode.EntityId = EntityType.EntityId;
+	NewNode.Type = Type;
+	NewNode.Offset = Payload.Offset;
+	NewNode.Index = Payload.Index;
+	NewNode.PayloadData = MoveTemp(Payload.PayloadData);
+	NewNode.Trace = Payload.Trace;
+	NewNode.Bytes = Bytes;
+	NewNode.Next = INDEX_NONE;
+	NewNode.OlderUnreliable = INDEX_NONE;
+	NewNode.NewerUnreliable = INDEX_NONE;
+
+	NodeList& List = GetLists(Type).FindOrAdd(EntityType);
+	if (List.Tail != INDEX_NONE)
+	{
+		Nodes[List.Tail].Next = NodeIndex;
+	}
+	else
+	{
+		List.Head = NodeIndex;
+	}
+	List.Tail = NodeIndex;
+	List.Num++;
+
+	if (!IsReliable(Type))
+	{
+		NewNode.OlderUnreliable = NewestUnreliable;
+		if (NewestUnreliable != INDEX_NONE)
+		{
+			Nodes[NewestUnreliable].NewerUnreliable = NodeIndex;
+		}
+		else
+		{
+			OldestUnreliable = NodeIndex;
+		}
+		NewestUnreliable = NodeIndex;
+	}
+
+	Stats.QueueDepth++;
+	Stats.BytesHeld += Bytes;
+
+	return EOverflowEnqueueResult::Queued;
+}
+
+bool RPCOverflowQueue::Contains(EntityRPCType EntityType) const
+{
+	return GetLists(EntityType.Type).Contains(EntityType);
+}
+
+uint32 RPCOverflowQueue::Num(EntityRPCType EntityType) const
+{
+	const NodeList* List = GetLists(EntityType.Type).Find(EntityType);
+	return List != nullptr ? List->Num : 0;
+}
+
+void RPCOverflowQueue::Remove(EntityRPCType EntityType)
+{
+	TMap<EntityRPCType, NodeList>& Lists = GetLists(EntityType.Type);
+	NodeList* List = Lists.Find(EntityType);
+	if (List == nullptr)
+	{
+		return;
+	}
+
+	while (List->Num > 0)
+	{
+		DropHead(*List);
+	}
+	Lists.Remove(EntityType);
+}
+
+void RPCOverflowQueue::Flush(TFunctionRef<EOverflowFlushResult(EntityRPCType, RPCPayload&)> PushFunction)
+{
+	FlushLists(ReliableLists, PushFunction);
+	FlushLists(UnreliableLists, PushFunction);
+}
+
+bool RPCOverflowQueue::IsReliable(ERPCType Type)
+{
+	return Type == ERPCType::ClientReliable || Type == ERPCType::ServerReliable;
+}
+
+int32 RPCOverflowQueue::AllocateNode()
+{
+	if (FreeHead == INDEX_NONE)
+	{
+		return Nodes.AddDefaulted();
+	}
+
+	const int32 NodeIndex = FreeHead;
+	FreeHead = Nodes[NodeIndex].Next;
+	return NodeIndex;
+}
+
+void RPCOverflowQueue::FreeNode(int32 NodeIndex)
+{
+	Node& FreedNode = Nodes[NodeIndex];
+	// Release the payload so that dropped RPCs don't hold on to memory outside of MaxBytes.
+	FreedNode.PayloadData.Empty();
+	FreedNode.Next = FreeHead;
+	FreeHead = NodeIndex;
+}
+
+int32 RPCOverflowQueue::PopHead(NodeList& List)
+{
+	check(List.Head != INDEX_NONE);
+
+	const int32 NodeIndex = List.Head;
+	Node& HeadNode = Nodes[NodeIndex];
+
+	List.Head = HeadNode.Next;
+	if (List.Head == INDEX_NONE)
+	{
+		List.Tail = INDEX_NONE;
+	}
+	List.Num--;
+
+	if (!IsReliable(HeadNode.Type))
+	{
+		if (HeadNode.OlderUnreliable != INDEX_NONE)
+		{
+			Nodes[HeadNode.OlderUnreliable].NewerUnreliable = HeadNode.NewerUnreliable;
+		}
+		else
+		{
+			OldestUnreliable = HeadNode.NewerUnreliable;
+		}
+
+		if (HeadNode.NewerUnreliable != INDEX_NONE)
+		{
+			Nodes[HeadNode.NewerUnreliable].OlderUnreliable = HeadNode.OlderUnreliable;
+		}
+		else
+		{
+			NewestUnreliable = HeadNode.OlderUnreliable;
+		}
+	}
+
+	Stats.QueueDepth--;
+	Stats.BytesHeld -= HeadNode.Bytes;
+
+	return NodeIndex;
+}
+
+void RPCOverflowQueue::DropHead(NodeList& List)
+{
+	const int32 NodeIndex = PopHead(List);
+	Stats.NumDropped[static_cast<int32>(Nodes[NodeIndex].Type)]++;
+	FreeNode(NodeIndex);
+}
+
+bool RPCOverflowQueue::DropOldestUnreliable()
+{
+	if (OldestUnreliable == INDEX_NONE)
+	{
+		return false;
+	}
+
+	const Node& OldestNode = Nodes[OldestUnreliable];
+	const EntityRPCType EntityType(OldestNode.EntityId, OldestNode.Type);
+
+	// FIFOs are in age order, so the oldest unreliable RPC is always at the head of its FIFO.
+	NodeList* List = UnreliableLists.Find(EntityType);
+	check(List != nullptr && List->Head == OldestUnreliable);
+
+	DropHead(*List);
+	if (List->Num == 0)
+	{
+		UnreliableLists.Remove(EntityType);
+	}
+
+	return true;
+}
+
+void RPCOverflowQueue::FlushLists(TMap<EntityRPCType, NodeList>& Lists, TFunctionRef<EOverflowFlushResult(EntityRPCType, RPCPayload&)> PushFunction)
+{
+	for (auto It = Lists.CreateIterator(); It; ++It)
+	{
+		const EntityRPCType EntityType = It.Key();
+		NodeList& List = It.Value();
+
+		EOverflowFlushResult Result = EOverflowFlushResult::Pushed;
+		while (List.Num > 0 && Result == EOverflowFlushResult::Pushed)
+		{
+			Node& HeadNode = Nodes[List.Head];
+			RPCPayload Payload(HeadNode.Offset, HeadNode.Index, MoveTemp(HeadNode.PayloadData), HeadNode.Trace);
+
+			Result = PushFunction(EntityType, Payload);
+
+			if (Result == EOverflowFlushResult::Stop)
+			{
+				Nodes[List.Head].PayloadData = MoveTemp(Payload.PayloadData);
+			}
+			else if (Result == EOverflowFlushResult::Pushed)
+			{
+				FreeNode(PopHead(List));
+			}
+		}
+
+		if (Result == EOverflowFlushResult::DropAll)
+		{
+			while (List.Num > 0)
+			{
+				DropHead(List);
+			}
+		}
+
+		if (List.Num == 0)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+} // namespace SpatialGDK
@@ -4,13 +4,146 @@
 
 #include "SpatialGDKSettings.h"
 
+DEFINE_LOG_CATEGORY_STATIC(LogRPCRingBuffer, Log, All);
+
 namespace SpatialGDK
 {
 
+namespace
+{
+
+// Deltas are zigzag encoded so that small negative values also pack into a single byte.
+uint32 ZigZagEncode(int32 Value)
+{
+	return (static_cast<uint32>(Value) << 1) ^ static_cast<uint32>(Value >> 31);
+}
+
+int32 ZigZagDecode(uint32 Value)
+{
+	return static_cast<int32>(Value >> 1) ^ -static_cast<int32>(Value & 1);
+}
+
+constexpr int32 MaxVarIntSize = 5;
+
+int32 WriteVarInt(uint32 Value, uint8* Out)
+{
+	int32 NumBytes = 0;
+	while (Value >= 0x80)
+	{
+		Out[NumBytes++] = static_cast<uint8>(Value | 0x80);
+		Value >>= 7;
+	}
+	Out[NumBytes++] = static_cast<uint8>(Value);
+	return NumBytes;
+}
+
+int32 ReadVarInt(const uint8* Data, int32 Size, uint32& OutValue)
+{
+	OutValue = 0;
+	for (int32 i = 0; i < Size && i < MaxVarIntSize; i++)
+	{
+		OutValue |= static_cast<uint32>(Data[i] & 0x7F) << (7 * i);
+		if ((Data[i] & 0x80) == 0)
+		{
+			return i + 1;
+		}
+	}
+	return Size;
+}
+
+// RPCs after the first in a slot are each written as one bytes entry, so the schema length prefix delimits them.
+// The offset and index are written as deltas from the first RPC in the slot, since bursts are usually the same
+// RPC on the same object, followed by the payload.
+void WritePackedRPC(Schema_Object* SlotObject, const RPCPayload& Payload)
+{
+	const uint32 FirstOffset = Schema_GetUint32(SlotObject, SpatialConstants::UNREAL_RPC_PAYLOAD_OFFSET_ID);
+	const uint32 FirstIndex = Schema_GetUint32(SlotObject, SpatialConstants::UNREAL_RPC_PAYLOAD_RPC_INDEX_ID);
+
+	uint8 Header[2 * MaxVarIntSize];
+	int32 HeaderSize = WriteVarInt(ZigZagEncode(static_cast<int32>(Payload.Offset - FirstOffset)), Header);
+	HeaderSize += WriteVarInt(ZigZagEncode(static_cast<int32>(Payload.Index - FirstIndex)), Header + HeaderSize);
+
+	const uint32 NumBytes = HeaderSize + Payload.PayloadData.Num();
+	uint8* Buffer = Schema_AllocateBuffer(SlotObject, NumBytes);
+	FMemory::Memcpy(Buffer, Header, HeaderSize);
+	FMemory::Memcpy(Buffer + HeaderSize, Payload.PayloadData.GetData(), Payload.PayloadData.Num());
+	Schema_AddBytes(SlotObject, SpatialConstants::UNREAL_RPC_PAYLOAD_PACKED_RPC_PAYLOADS_ID, Buffer, NumBytes);
+}
+
+RPCPayload ReadPackedRPC(const Schema_Object* SlotObject, uint32 PackedIndex, uint32 FirstOffset, uint32 FirstIndex)
+{
+	const uint8* Data = Schema_IndexBytes(SlotObject, SpatialConstants::UNREAL_RPC_PAYLOAD_PACKED_RPC_PAYLOADS_ID, PackedIndex);
+	const int32 Size = static_cast<int32>(Schema_IndexBytesLength(SlotObject, SpatialConstants::UNREAL_RPC_PAYLOAD_PACKED_RPC_PAYLOADS_ID, PackedIndex));
+
+	uint32 OffsetDelta = 0;
+	uint32 IndexDelta = 0;
+	int32 HeaderSize = ReadVarInt(Data, Size, OffsetDelta);
+	HeaderSize += ReadVarInt(Data + HeaderSize, Size - HeaderSize, IndexDelta);
+
+	return RPCPayload(FirstOffset + ZigZagDecode(OffsetDelta), FirstIndex + ZigZagDecode(IndexDelta), TArray<uint8>(Data + HeaderSize, Size - HeaderSize));
+}
+
+void ReadPackedSlotFromSchema(Schema_Object* SlotObject, uint32 SlotIndex, RPCRingBuffer& OutBuffer)
+{
+	const uint32 Capacity = OutBuffer.RingBuffer.Num();
+	const uint64 FirstRPCId = Schema_GetUint64(SlotObject, SpatialConstants::UNREAL_RPC_PAYLOAD_PACKED_FIRST_RPC_ID_ID);
+	const uint32 NumPacked = Schema_GetBytesCount(SlotObject, SpatialConstants::UNREAL_RPC_PAYLOAD_PACKED_RPC_PAYLOADS_ID);
+
+	OutBuffer.RingBuffer[(FirstRPCId - 1) % Capacity].Emplace(SlotObject);
+
+	const uint32 FirstOffset = Schema_GetUint32(SlotObject, SpatialConstants::UNREAL_RPC_PAYLOAD_OFFSET_ID);
+	const uint32 FirstIndex = Schema_GetUint32(SlotObject, SpatialConstants::UNREAL_RPC_PAYLOAD_RPC_INDEX_ID);
+	for (uint32 PackedIndex = 0; PackedIndex < NumPacked; PackedIndex++)
+	{
+		const uint64 RPCId = FirstRPCId + 1 + PackedIndex;
+		OutBuffer.RingBuffer[(RPCId - 1) % Capacity].Emplace(ReadPackedRPC(SlotObject, PackedIndex, FirstOffset, FirstIndex));
+	}
+
+	OutBuffer.SlotLastRPCIds[SlotIndex] = FirstRPCId + NumPacked;
+}
+
+void ReadSlotFromSchema(Schema_Object* SlotObject, uint32 RingBufferIndex, const RPCRingBufferDescriptor& Descriptor, RPCRingBuffer& OutBuffer)
+{
+	const bool bSlotIsPacked = Schema_GetUint64Count(SlotObject, SpatialConstants::UNREAL_RPC_PAYLOAD_PACKED_FIRST_RPC_ID_ID) > 0;
+	if (Descriptor.IsPacked() && bSlotIsPacked)
+	{
+		ReadPackedSlotFromSchema(SlotObject, RingBufferIndex, OutBuffer);
+		return;
+	}
+
+	// An unpacked buffer only has room for one RPC per slot, so the RPCs after the first in a packed slot can't be stored.
+	if (bSlotIsPacked && Schema_GetBytesCount(SlotObject, SpatialConstants::UNREAL_RPC_PAYLOAD_PACKED_RPC_PAYLOADS_ID) > 0)
+	{
+		static bool bLoggedPackedSlotIgnored = false;
+		if (!bLoggedPackedSlotIgnored)
+		{
+			bLoggedPackedSlotIgnored = true;
+			UE_LOG(LogRPCRingBuffer, Warning, TEXT("Received a ring buffer slot with several RPCs for RPC type %s, but this worker reads one RPC per slot. "
+				"Only the first RPC in each slot is read and the rest are lost. RPC ring buffer payloads per field must match on all workers."),
+				*SpatialConstants::RPCTypeToString(OutBuffer.Type));
+		}
+	}
+
+	OutBuffer.RingBuffer[RingBufferIndex].Emplace(SlotObject);
+}
+
+} // anonymous namespace
+
 RPCRingBuffer::RPCRingBuffer(ERPCType InType)
 	: Type(InType)
 {
-	RingBuffer.SetNum(RPCRingBufferUtils::GetRingBufferSize(Type));
+	if (Type == ERPCType::Invalid)
+	{
+		RingBuffer.SetNum(RPCRingBufferUtils::GetRingBufferSize(Type));
+		return;
+	}
+
+	const RPCRingBufferDescriptor Descriptor = RPCRingBufferUtils::GetRingBufferDescriptor(Type);
+	RingBuffer.SetNum(Descriptor.GetCapacity());
+	if (Descriptor.IsPacked())
+	{
+		SlotLastRPCIds.SetNumZeroed(Descriptor.RingBufferSize);
+	}
 }
 
 namespace RPCRingBufferUtils
@@ -36,10 +169,13 @@ Worker_ComponentId GetRingBufferComponentId(ERPCType Type)
 
 RPCRingBufferDescriptor GetRingBufferDescriptor(ERPCType Type)
 {
+	const USpatialGDKSettings* Settings = GetDefault<USpatialGDKSettings>();
+	uint32 MaxRingBufferSize = Settings->MaxRPCRingBufferSize;
+
 	RPCRingBufferDescriptor Descriptor;
 	Descriptor.RingBufferSize = GetRingBufferSize(Type);
+	Descriptor.PayloadsPerSlot = Settings->GetRPCRingBufferPayloadsPerSlot(Type);
 
-	uint32 MaxRingBufferSize = GetDefault<USpatialGDKSettings>()->MaxRPCRingBufferSize;
 	// In schema, the client and server endpoints will first have a
 	//   Reliable ring buffer, starting from 1 and containing MaxRingBufferSize elements, then
 	//   Last sent reliable RPC,
@@ -71,7 +207,14 @@ RPCRingBufferDescriptor GetRingBufferDescriptor(ERPCType Type)
 
 uint32 GetRingBufferSize(ERPCType Type)
 {
-	return GetDefault<USpatialGDKSettings>()->GetRPCRingBufferSize(Type);
+	// Each element of the ring buffer needs a field in the generated schema.
+	const USpatialGDKSettings* Settings = GetDefault<USpatialGDKSettings>();
+	return FMath::Min(Settings->GetRPCRingBufferSize(Type), Settings->MaxRPCRingBufferSize);
+}
+
+uint32 GetRingBufferCapacity(ERPCType Type)
+{
+	return GetRingBufferDescriptor(Type).GetCapacity();
 }
 
 Worker_ComponentId GetAckComponentId(ERPCType Type)
@@ -122,9 +265,9 @@ bool ShouldQueueOverflowed(ERPCType Type)
 	{
 	case ERPCType::ClientReliable:
 	case ERPCType::ServerReliable:
-		return true;
 	case ERPCType::ClientUnreliable:
 	case ERPCType::ServerUnreliable:
+		return true;
 	case ERPCType::NetMulticast:
 		return false;
 	default:
@@ -142,7 +285,7 @@ void ReadBufferFromSchema(Schema_Object* SchemaObject, RPCRingBuffer& OutBuffer)
 		Schema_FieldId FieldId = Descriptor.SchemaFieldStart + RingBufferIndex;
 		if (Schema_GetObjectCount(SchemaObject, FieldId) > 0)
 		{
-			OutBuffer.RingBuffer[RingBufferIndex].Emplace(Schema_GetObject(SchemaObject, FieldId));
+			ReadSlotFromSchema(Schema_GetObject(SchemaObject, FieldId), RingBufferIndex, Descriptor, OutBuffer);
 		}
 	}
 
@@ -152,6 +295,25 @@ void ReadBufferFromSchema(Schema_Object* SchemaObject, RPCRingBuffer& OutBuffer)
 	}
 }
 
+bool ReadBufferFieldFromSchema(Schema_Object* SchemaObject, Schema_FieldId FieldId, const RPCRingBufferDescriptor& Descriptor, uint64 Tick, RPCRingBuffer& OutBuffer)
+{
+	if (FieldId == Descriptor.LastSentRPCFieldId)
+	{
+		OutBuffer.LastSentRPCId = Schema_GetUint64(SchemaObject, FieldId);
+	}
+	else if (FieldId >= Descriptor.SchemaFieldStart && FieldId < Descriptor.SchemaFieldStart + Descriptor.RingBufferSize)
+	{
+		ReadSlotFromSchema(Schema_GetObject(SchemaObject, FieldId), FieldId - Descriptor.SchemaFieldStart, Descriptor, OutBuffer);
+	}
+	else
+	{
+		return false;
+	}
+
+	OutBuffer.LastChangedTick = Tick;
+	return true;
+}
+
 void ReadAckFromSchema(const Schema_Object* SchemaObject, ERPCType Type, uint64& OutAck)
 {
 	Schema_FieldId AckFieldId = GetAckFieldId(Type);
@@ -173,6 +335,32 @@ void WriteRPCToSchema(Schema_Object* SchemaObject, ERPCType Type, uint64 RPCId,
 	Schema_AddUint64(SchemaObject, Descriptor.LastSentRPCFieldId, RPCId);
 }
 
+Schema_Object* WriteRPCToSlot(Schema_Object* SchemaObject, ERPCType Type, uint32 SlotIndex, uint64 RPCId, const RPCPayload& Payload)
+{
+	RPCRingBufferDescriptor Descriptor = GetRingBufferDescriptor(Type);
+
+	Schema_Object* SlotObject = Schema_AddObject(SchemaObject, Descriptor.GetSlotFieldId(SlotIndex));
+	Payload.WriteToSchemaObject(SlotObject);
+	Schema_AddUint64(SlotObject, SpatialConstants::UNREAL_RPC_PAYLOAD_PACKED_FIRST_RPC_ID_ID, RPCId);
+
+	Schema_ClearField(SchemaObject, Descriptor.LastSentRPCFieldId);
+	Schema_AddUint64(SchemaObject, Descriptor.LastSentRPCFieldId, RPCId);
+
+	return SlotObject;
+}
+
+void AppendRPCToSlot(Schema_Object* SchemaObject, ERPCType Type, Schema_Object* SlotObject, uint64 RPCId, const RPCPayload& Payload)
+{
+	RPCRingBufferDescriptor Descriptor = GetRingBufferDescriptor(Type);
+
+	// The ID of each packed RPC is implied by its position after the first RPC in the slot.
+	check(Schema_GetUint64(SlotObject, SpatialConstants::UNREAL_RPC_PAYLOAD_PACKED_FIRST_RPC_ID_ID) + Schema_GetBytesCount(SlotObject, SpatialConstants::UNREAL_RPC_PAYLOAD_PACKED_RPC_PAYLOADS_ID) + 1 == RPCId);
+	WritePackedRPC(SlotObject, Payload);
+
+	Schema_ClearField(SchemaObject, Descriptor.LastSentRPCFieldId);
+	Schema_AddUint64(SchemaObject, Descriptor.LastSentRPCFieldId, RPCId);
+}
+
 void WriteAckToSchema(Schema_Object* SchemaObject, ERPCType Type, uint64 Ack)
 {
 	Schema_FieldId AckFieldId = GetAckFieldId(Type);
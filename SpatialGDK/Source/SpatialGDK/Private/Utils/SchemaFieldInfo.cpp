@@ -0,0 +1,139 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/SchemaFieldInfo.h"
+
+#include "Net/RepLayout.h"
+#include "UObject/TextProperty.h"
+
+#include "Utils/RepLayoutUtils.h"
+
+namespace SpatialGDK
+{
+
+namespace
+{
+// Mirrors the order of the property casts ComponentReader and ComponentFactory used to do per field.
+ESchemaFieldType ResolveSchemaFieldType(GDK_PROPERTY(Property)*& Property)
+{
+	if (Property->IsA<GDK_PROPERTY(StructProperty)>())
+	{
+		return ESchemaFieldType::Struct;
+	}
+	if (Property->IsA<GDK_PROPERTY(BoolProperty)>())
+	{
+		return ESchemaFieldType::Bool;
+	}
+	if (Property->IsA<GDK_PROPERTY(FloatProperty)>())
+	{
+		return ESchemaFieldType::Float;
+	}
+	if (Property->IsA<GDK_PROPERTY(DoubleProperty)>())
+	{
+		return ESchemaFieldType::Double;
+	}
+	if (Property->IsA<GDK_PROPERTY(Int8Property)>())
+	{
+		return ESchemaFieldType::Int8;
+	}
+	if (Property->IsA<GDK_PROPERTY(Int16Property)>())
+	{
+		return ESchemaFieldType::Int16;
+	}
+	if (Property->IsA<GDK_PROPERTY(IntProperty)>())
+	{
+		return ESchemaFieldType::Int32;
+	}
+	if (Property->IsA<GDK_PROPERTY(Int64Property)>())
+	{
+		return ESchemaFieldType::Int64;
+	}
+	if (Property->IsA<GDK_PROPERTY(ByteProperty)>())
+	{
+		return ESchemaFieldType::Byte;
+	}
+	if (Property->IsA<GDK_PROPERTY(UInt16Property)>())
+	{
+		return ESchemaFieldType::UInt16;
+	}
+	if (Property->IsA<GDK_PROPERTY(UInt32Property)>())
+	{
+		return ESchemaFieldType::UInt32;
+	}
+	if (Property->IsA<GDK_PROPERTY(UInt64Property)>())
+	{
+		return ESchemaFieldType::UInt64;
+	}
+	if (Property->IsA<GDK_PROPERTY(ObjectPropertyBase)>())
+	{
+		return Property->IsA<GDK_PROPERTY(SoftObjectProperty)>() ? ESchemaFieldType::SoftObject : ESchemaFieldType::Object;
+	}
+	if (Property->IsA<GDK_PROPERTY(NameProperty)>())
+	{
+		return ESchemaFieldType::Name;
+	}
+	if (Property->IsA<GDK_PROPERTY(StrProperty)>())
+	{
+		return ESchemaFieldType::String;
+	}
+	if (Property->IsA<GDK_PROPERTY(TextProperty)>())
+	{
+		return ESchemaFieldType::Text;
+	}
+	if (GDK_PROPERTY(ArrayProperty)* ArrayProperty = GDK_CASTFIELD<GDK_PROPERTY(ArrayProperty)>(Property))
+	{
+		return GetFastArraySerializerProperty(ArrayProperty) != nullptr ? ESchemaFieldType::FastArray : ESchemaFieldType::Array;
+	}
+	if (GDK_PROPERTY(EnumProperty)* EnumProperty = GDK_CASTFIELD<GDK_PROPERTY(EnumProperty)>(Property))
+	{
+		if (EnumProperty->ElementSize < 4)
+		{
+			return ESchemaFieldType::SmallEnum;
+		}
+		Property = EnumProperty->GetUnderlyingProperty();
+		return ResolveSchemaFieldType(Property);
+	}
+	if (Property->IsA<GDK_PROPERTY(DelegateProperty)>() || Property->IsA<GDK_PROPERTY(MulticastDelegateProperty)>() || Property->IsA<GDK_PROPERTY(InterfaceProperty)>())
+	{
+		return ESchemaFieldType::NotSerialized;
+	}
+	if (Property->IsA<GDK_PROPERTY(MapProperty)>())
+	{
+		return ESchemaFieldType::Map;
+	}
+	if (Property->IsA<GDK_PROPERTY(SetProperty)>())
+	{
+		return ESchemaFieldType::Set;
+	}
+	return ESchemaFieldType::Unsupported;
+}
+} // anonymous namespace
+
+FSchemaFieldInfo GetSchemaFieldInfo(GDK_PROPERTY(Property)* Property)
+{
+	FSchemaFieldInfo FieldInfo;
+	FieldInfo.Property = Property;
+	FieldInfo.Type = ResolveSchemaFieldType(FieldInfo.Property);
+
+	if (FieldInfo.Type == ESchemaFieldType::Array || FieldInfo.Type == ESchemaFieldType::FastArray)
+	{
+		FieldInfo.InnerProperty = static_cast<GDK_PROPERTY(ArrayProperty)*>(FieldInfo.Property)->Inner;
+		FieldInfo.InnerType = ResolveSchemaFieldType(FieldInfo.InnerProperty);
+	}
+
+	return FieldInfo;
+}
+
+TArray<FSchemaFieldInfo> GetRepLayoutFieldInfos(const FRepLayout& RepLayout)
+{
+	TArray<FSchemaFieldInfo> FieldInfos;
+	FieldInfos.Reserve(RepLayout.BaseHandleToCmdIndex.Num());
+
+	for (const FHandleToCmdIndex& HandleToCmdIndex : RepLayout.BaseHandleToCmdIndex)
+	{
+		FieldInfos.Add(GetSchemaFieldInfo(RepLayout.Cmds[HandleToCmdIndex.CmdIndex].Property));
+	}
+
+	return FieldInfos;
+}
+
+} // namespace SpatialGDK
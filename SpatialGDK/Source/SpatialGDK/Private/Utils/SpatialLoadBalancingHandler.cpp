@@ -17,28 +17,21 @@ FSpatialLoadBalancingHandler::FSpatialLoadBalancingHandler(USpatialNetDriver* In
 
 }
 
-FSpatialLoadBalancingHandler::EvaluateActorResult FSpatialLoadBalancingHandler::EvaluateSingleActor(AActor* Actor, AActor*& OutNetOwner, VirtualWorkerId& OutWorkerId)
+bool FSpatialLoadBalancingHandler::EvaluateSingleActor(AActor* Actor, AActor*& OutNetOwner)
 {
 	const Worker_EntityId EntityId = NetDriver->PackageMap->GetEntityIdFromObject(Actor);
 	if (EntityId == SpatialConstants::INVALID_ENTITY_ID)
 	{
-		return EvaluateActorResult::None;
+		return false;
 	}
 
 	if (!Actor->HasAuthority())
 	{
-		return EvaluateActorResult::None;
+		return false;
 	}
 
 	UpdateSpatialDebugInfo(Actor, EntityId);
 
-	// If this object is in the list of actors to migrate, we have already processed its hierarchy.
-	// Remove it from the additional actors to process, and continue.
-	if (ActorsToMigrate.Contains(Actor))
-	{
-		return EvaluateActorResult::RemoveAdditional;
-	}
-
 	if (NetDriver->StaticComponentView->HasAuthority(EntityId, SpatialConstants::AUTHORITY_INTENT_COMPONENT_ID))
 	{
 		if (!NetDriver->LoadBalanceStrategy->ShouldHaveAuthority(*Actor) && !NetDriver->LockingPolicy->IsLocked(Actor))
@@ -56,22 +49,12 @@ FSpatialLoadBalancingHandler::EvaluateActorResult FSpatialLoadBalancingHandler::
 			}
 			else
 			{
-				const VirtualWorkerId NewAuthVirtualWorkerId = NetDriver->LoadBalanceStrategy->WhoShouldHaveAuthority(*NetOwner);
-				if (NewAuthVirtualWorkerId == SpatialConstants::INVALID_VIRTUAL_WORKER_ID)
-				{
-					UE_LOG(LogSpatialOSNetDriver, Error, TEXT("Load Balancing Strategy returned invalid virtual worker for actor %s"), *Actor->GetName());
-				}
-				else
-				{
-					OutNetOwner = NetOwner;
-					OutWorkerId = NewAuthVirtualWorkerId;
-					return EvaluateActorResult::Migrate;
-				}
+				OutNetOwner = NetOwner;
 			}
 		}
 	}
 
-	return EvaluateActorResult::None;
+	return true;
 }
 
 void FSpatialLoadBalancingHandler::ProcessMigrations()
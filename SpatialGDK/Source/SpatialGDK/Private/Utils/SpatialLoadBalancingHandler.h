@@ -21,31 +21,63 @@ public:
 		check(NetDriver->LoadBalanceStrategy != nullptr);
 		check(NetDriver->LockingPolicy != nullptr);
 
+		// Find the actors concerned by load balancing first, so the strategy can decide
+		// on every hierarchy that should change authority in a single batch.
+		EvaluatedActors.Reset();
+		HierarchyRootsToEvaluate.Reset();
 		for (AActor* Actor : iCtx.GetActorsBeingReplicated())
 		{
-			AActor* NetOwner;
-			VirtualWorkerId NewAuthWorkerId;
-			EvaluateActorResult Result = EvaluateSingleActor(Actor, NetOwner, NewAuthWorkerId);
-			switch (Result)
+			AActor* NetOwner = nullptr;
+			if (EvaluateSingleActor(Actor, NetOwner))
 			{
-			case EvaluateActorResult::Migrate:
-				if (CollectActorsToMigrate(iCtx, NetOwner, NetOwner->HasAuthority()))
+				const int32 DecisionIndex = NetOwner != nullptr ? HierarchyRootsToEvaluate.Add(NetOwner) : INDEX_NONE;
+				EvaluatedActors.Add(FEvaluatedActor{ Actor, NetOwner, DecisionIndex });
+			}
+		}
+
+		NewAuthWorkerIds.SetNumUninitialized(HierarchyRootsToEvaluate.Num());
+		if (HierarchyRootsToEvaluate.Num() > 0)
+		{
+			NetDriver->LoadBalanceStrategy->WhoShouldHaveAuthority(HierarchyRootsToEvaluate, NewAuthWorkerIds);
+		}
+
+		for (const FEvaluatedActor& Evaluated : EvaluatedActors)
+		{
+			AActor* Actor = Evaluated.Actor;
+
+			// If this object is in the list of actors to migrate, we have already processed its hierarchy.
+			// Remove it from the additional actors to process, and continue.
+			if (ActorsToMigrate.Contains(Actor))
+			{
+				iCtx.RemoveAdditionalActor(Actor);
+				continue;
+			}
+
+			if (Evaluated.DecisionIndex == INDEX_NONE)
+			{
+				continue;
+			}
+
+			const VirtualWorkerId NewAuthWorkerId = NewAuthWorkerIds[Evaluated.DecisionIndex];
+			if (NewAuthWorkerId == SpatialConstants::INVALID_VIRTUAL_WORKER_ID)
+			{
+				UE_LOG(LogSpatialOSNetDriver, Error, TEXT("Load Balancing Strategy returned invalid virtual worker for actor %s"), *Actor->GetName());
+				continue;
+			}
+
+			AActor* NetOwner = Evaluated.NetOwner;
+			if (CollectActorsToMigrate(iCtx, NetOwner, NetOwner->HasAuthority()))
+			{
+				for (AActor* ActorToMigrate : TempActorsToMigrate)
 				{
-					for (AActor* ActorToMigrate : TempActorsToMigrate)
+					if (ActorToMigrate != Actor)
 					{
-						if (ActorToMigrate != Actor)
-						{
-							iCtx.AddActorToReplicate(ActorToMigrate);
-						}
-						ActorsToMigrate.Add(ActorToMigrate, NewAuthWorkerId);
+						iCtx.AddActorToReplicate(ActorToMigrate);
 					}
+					ActorsToMigrate.Add(ActorToMigrate, NewAuthWorkerId);
 				}
-				TempActorsToMigrate.Empty();
-				break;
-			case EvaluateActorResult::RemoveAdditional:
-				iCtx.RemoveAdditionalActor(Actor);
-				break;
 			}
+			TempActorsToMigrate.Empty();
 		}
 	}
 
@@ -63,14 +95,18 @@ protected:
 
 	uint64 GetLatestAuthorityChangeFromHierarchy(const AActor* HierarchyActor) const;
 
-	enum class EvaluateActorResult
+	struct FEvaluatedActor
 	{
-		None,	// Actor not concerned by load balancing
-		Migrate,	// Actor should migrate
-		RemoveAdditional	// Actor is already marked as migrating.
+		AActor* Actor;
+		// Hierarchy root to migrate, or nullptr if the actor should stay on this worker.
+		AActor* NetOwner;
+		// Index of the hierarchy root in HierarchyRootsToEvaluate, or INDEX_NONE.
+		int32 DecisionIndex;
 	};
 
-	EvaluateActorResult EvaluateSingleActor(AActor* Actor, AActor*& OutNetOwner, VirtualWorkerId& OutWorkerId);
+	// Returns true if the actor is concerned by load balancing on this worker.
+	// OutNetOwner is set to the actor's hierarchy root if the hierarchy should change authority.
+	bool EvaluateSingleActor(AActor* Actor, AActor*& OutNetOwner);
 
 	template <typename ReplicationContext>
 	bool CollectActorsToMigrate(ReplicationContext& iCtx, AActor* Actor, bool bNetOwnerHasAuth)
@@ -115,4 +151,9 @@ protected:
 
 	TMap<AActor*, VirtualWorkerId> ActorsToMigrate;
 	TSet<AActor*> TempActorsToMigrate;
+
+	// Scratch storage for EvaluateActorsToMigrate.
+	TArray<FEvaluatedActor> EvaluatedActors;
+	TArray<const AActor*> HierarchyRootsToEvaluate;
+	TArray<VirtualWorkerId> NewAuthWorkerIds;
 };
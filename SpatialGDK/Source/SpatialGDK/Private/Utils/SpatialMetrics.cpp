@@ -7,10 +7,41 @@
 
 #include "Interop/Connection/SpatialWorkerConnection.h"
 #include "SpatialGDKSettings.h"
+#include "Utils/RPCContainer.h"
+#include "Utils/RPCOverflowQueue.h"
 #include "Utils/SchemaUtils.h"
 
 DEFINE_LOG_CATEGORY(LogSpatialMetrics);
 
+namespace
+{
+
+const char* GetRPCTypeMetricName(ERPCType RPCType)
+{
+	switch (RPCType)
+	{
+	case ERPCType::ClientReliable:
+		return "client_reliable";
+	case ERPCType::ClientUnreliable:
+		return "client_unreliable";
+	case ERPCType::ServerReliable:
+		return "server_reliable";
+	case ERPCType::ServerUnreliable:
+		return "server_unreliable";
+	case ERPCType::NetMulticast:
+		return "multicast";
+	case ERPCType::CrossServer:
+		return "cross_server";
+	default:
+		return "invalid";
+	}
+}
+
+const double RPCPayloadBytesUpperBounds[] = { 16, 64, 256, 1024, 4096, 16384, 65536 };
+const double DurationSecondsUpperBounds[] = { 0.0005, 0.001, 0.002, 0.005, 0.01, 0.02, 0.05, 0.1 };
+
+} // anonymous namespace
+
 void USpatialMetrics::Init(USpatialWorkerConnection* InConnection, float InNetServerMaxTickRate, bool bInIsServer)
 {
 	Connection = InConnection;
@@ -29,6 +60,13 @@ void USpatialMetrics::Init(USpatialWorkerConnection* InConnection, float InNetSe
 	UserSuppliedMetric Delegate;
 	Delegate.BindUObject(this, &USpatialMetrics::GetAverageFPS);
 	SetCustomMetric(SpatialConstants::SPATIALOS_METRICS_DYNAMIC_FPS, Delegate);
+
+	RPCsSentCounter = MetricsRegistry.RegisterCounter(TEXT("unreal_rpcs_sent"));
+	RPCPayloadBytesHistogram = MetricsRegistry.RegisterHistogram(TEXT("unreal_rpc_payload_bytes"), RPCPayloadBytesUpperBounds);
+	OpsDispatchedCounter = MetricsRegistry.RegisterCounter(TEXT("unreal_ops_dispatched"));
+	OpDispatchSecondsHistogram = MetricsRegistry.RegisterHistogram(TEXT("unreal_op_dispatch_seconds"), DurationSecondsUpperBounds);
+	ActorsReplicatedCounter = MetricsRegistry.RegisterCounter(TEXT("unreal_actors_replicated"));
+	ActorReplicationSecondsHistogram = MetricsRegistry.RegisterHistogram(TEXT("unreal_actor_replication_seconds"), DurationSecondsUpperBounds);
 }
 
 void USpatialMetrics::TickMetrics(float NetDriverTime)
@@ -55,18 +93,20 @@ void USpatialMetrics::TickMetrics(float NetDriverTime)
 
 	SpatialGDK::SpatialMetrics Metrics;
 	Metrics.Load = WorkerLoad;
+	Metrics.GaugeMetrics.Reserve(UserSuppliedMetrics.Num() + WorkerSDKGaugeMetrics.Num() + MetricsRegistry.NumReportedGauges());
+	Metrics.HistogramMetrics.Reserve(WorkerSDKHistogramMetrics.Num() + MetricsRegistry.NumReportedHistograms());
 
 	// User supplied metrics
 	TArray<FString> UnboundMetrics;
-	for (const TPair<FString, UserSuppliedMetric>& Gauge : UserSuppliedMetrics)
+	for (const TPair<FString, FUserSuppliedMetricEntry>& Gauge : UserSuppliedMetrics)
 	{
-		if (Gauge.Value.IsBound())
+		if (Gauge.Value.Delegate.IsBound())
 		{
 			SpatialGDK::GaugeMetric Metric;
 
-			Metric.Key = TCHAR_TO_UTF8(*Gauge.Key);
-			Metric.Value = Gauge.Value.Execute();
-			Metrics.GaugeMetrics.Add(Metric);
+			Metric.Key = Gauge.Value.Key;
+			Metric.Value = Gauge.Value.Delegate.Execute();
+			Metrics.GaugeMetrics.Add(MoveTemp(Metric));
 		}
 		else
 		{
@@ -86,16 +126,14 @@ void USpatialMetrics::TickMetrics(float NetDriverTime)
 		for (const TPair<FString, double>& Metric : WorkerSDKGaugeMetrics)
 		{
 			SpatialGDK::GaugeMetric SpatialMetric;
-			SpatialMetric.Key = "unreal_worker_";
-			SpatialMetric.Key += TCHAR_TO_UTF8(*Metric.Key);
+			SpatialMetric.Key = WorkerSDKMetricKeys.FindChecked(Metric.Key);
 			SpatialMetric.Value = Metric.Value;
-			Metrics.GaugeMetrics.Add(SpatialMetric);
+			Metrics.GaugeMetrics.Add(MoveTemp(SpatialMetric));
 		}
 		for (const TPair<FString, WorkerHistogramValues>& Metric : WorkerSDKHistogramMetrics)
 		{
 			SpatialGDK::HistogramMetric SpatialMetric;
-			SpatialMetric.Key = "unreal_worker_";
-			SpatialMetric.Key += TCHAR_TO_UTF8(*Metric.Key);
+			SpatialMetric.Key = WorkerSDKMetricKeys.FindChecked(Metric.Key);
 			SpatialMetric.Buckets.Reserve(Metric.Value.Buckets.Num());
 			SpatialMetric.Sum = Metric.Value.Sum;
 			for (const TPair<double, uint32>& Bucket : Metric.Value.Buckets)
@@ -105,12 +143,99 @@ void USpatialMetrics::TickMetrics(float NetDriverTime)
 				SpatialBucket.Samples = Bucket.Value;
 				SpatialMetric.Buckets.Push(SpatialBucket);
 			}
+			Metrics.HistogramMetrics.Add(MoveTemp(SpatialMetric));
 		}
 	}
 
+	MetricsRegistry.AddToReport(Metrics);
+
+	if (OverflowStats != nullptr)
+	{
+		AddRPCOverflowMetrics(Metrics);
+	}
+
+	if (OutgoingQueuedRPCStats != nullptr)
+	{
+		AddQueuedRPCMetrics(Metrics, *OutgoingQueuedRPCStats, "send");
+	}
+
+	if (IncomingQueuedRPCStats != nullptr)
+	{
+		AddQueuedRPCMetrics(Metrics, *IncomingQueuedRPCStats, "receive");
+	}
+
 	Connection->SendMetrics(Metrics);
 }
 
+void USpatialMetrics::AddRPCOverflowMetrics(SpatialGDK::SpatialMetrics& Metrics) const
+{
+	SpatialGDK::GaugeMetric QueueDepthMetric;
+	QueueDepthMetric.Key = "unreal_rpc_overflow_queue_depth";
+	QueueDepthMetric.Value = OverflowStats->QueueDepth;
+	Metrics.GaugeMetrics.Add(QueueDepthMetric);
+
+	SpatialGDK::GaugeMetric BytesHeldMetric;
+	BytesHeldMetric.Key = "unreal_rpc_overflow_bytes_held";
+	BytesHeldMetric.Value = OverflowStats->BytesHeld;
+	Metrics.GaugeMetrics.Add(BytesHeldMetric);
+
+	for (int32 TypeIndex = 0; TypeIndex < SpatialGDK::RPCOverflowStats::NumRPCTypes; TypeIndex++)
+	{
+		const char* TypeName = GetRPCTypeMetricName(static_cast<ERPCType>(TypeIndex));
+
+		if (OverflowStats->NumDropped[TypeIndex] > 0)
+		{
+			SpatialGDK::GaugeMetric DroppedMetric;
+			DroppedMetric.Key = "unreal_rpc_overflow_dropped_";
+			DroppedMetric.Key += TypeName;
+			DroppedMetric.Value = OverflowStats->NumDropped[TypeIndex];
+			Metrics.GaugeMetrics.Add(DroppedMetric);
+		}
+
+		if (OverflowStats->NumRejected[TypeIndex] > 0)
+		{
+			SpatialGDK::GaugeMetric RejectedMetric;
+			RejectedMetric.Key = "unreal_rpc_overflow_rejected_";
+			RejectedMetric.Key += TypeName;
+			RejectedMetric.Value = OverflowStats->NumRejected[TypeIndex];
+			Metrics.GaugeMetrics.Add(RejectedMetric);
+		}
+	}
+}
+
+void USpatialMetrics::AddQueuedRPCMetrics(SpatialGDK::SpatialMetrics& Metrics, const FRPCContainerStats& Stats, const char* QueueName)
+{
+	SpatialGDK::GaugeMetric QueuedRPCsMetric;
+	QueuedRPCsMetric.Key = "unreal_rpc_queued_";
+	QueuedRPCsMetric.Key += QueueName;
+	QueuedRPCsMetric.Value = Stats.NumQueuedRPCs;
+	Metrics.GaugeMetrics.Add(QueuedRPCsMetric);
+
+	SpatialGDK::GaugeMetric PendingQueuesMetric;
+	PendingQueuesMetric.Key = "unreal_rpc_pending_queues_";
+	PendingQueuesMetric.Key += QueueName;
+	PendingQueuesMetric.Value = Stats.NumPendingQueues;
+	Metrics.GaugeMetrics.Add(PendingQueuesMetric);
+
+	// Histogram buckets count every sample up to their upper bound.
+	SpatialGDK::HistogramMetric AgeMetric;
+	AgeMetric.Key = "unreal_rpc_queue_age_seconds_";
+	AgeMetric.Key += QueueName;
+	AgeMetric.Sum = Stats.AgeSumSeconds;
+	AgeMetric.Buckets.Reserve(FRPCContainerStats::NumAgeBuckets);
+	uint32 Samples = 0;
+	for (int32 Bucket = 0; Bucket < FRPCContainerStats::NumAgeBuckets; Bucket++)
+	{
+		Samples += Stats.AgeBucketCounts[Bucket];
+
+		SpatialGDK::HistogramMetricBucket SpatialBucket;
+		SpatialBucket.UpperBound = FRPCContainerStats::AgeBucketUpperBounds[Bucket];
+		SpatialBucket.Samples = Samples;
+		AgeMetric.Buckets.Push(SpatialBucket);
+	}
+	Metrics.HistogramMetrics.Add(AgeMetric);
+}
+
 // Load defined as performance relative to target frame time or just frame time based on config value.
 double USpatialMetrics::CalculateLoad() const
 {
@@ -326,6 +451,12 @@ void USpatialMetrics::OnModifySettingCommand(Schema_Object* CommandPayload)
 
 void USpatialMetrics::TrackSentRPC(UFunction* Function, ERPCType RPCType, int PayloadSize)
 {
+	if (GetDefault<USpatialGDKSettings>()->bEnableMetrics)
+	{
+		MetricsRegistry.IncrementCounter(RPCsSentCounter);
+		MetricsRegistry.Observe(RPCPayloadBytesHistogram, PayloadSize);
+	}
+
 	if (!bRPCTrackingEnabled)
 	{
 		return;
@@ -349,6 +480,18 @@ void USpatialMetrics::TrackSentRPC(UFunction* Function, ERPCType RPCType, int Pa
 	Stat.TotalPayload += PayloadSize;
 }
 
+void USpatialMetrics::RecordOpDispatch(int32 NumOps, double Seconds)
+{
+	MetricsRegistry.IncrementCounter(OpsDispatchedCounter, NumOps);
+	MetricsRegistry.Observe(OpDispatchSecondsHistogram, Seconds);
+}
+
+void USpatialMetrics::RecordActorReplication(int32 NumActors, double Seconds)
+{
+	MetricsRegistry.IncrementCounter(ActorsReplicatedCounter, NumActors);
+	MetricsRegistry.Observe(ActorReplicationSecondsHistogram, Seconds);
+}
+
 void USpatialMetrics::HandleWorkerMetrics(Worker_Op* Op)
 {
 	int32 NumGaugeMetrics = Op->op.metrics.metrics.gauge_metric_count;
@@ -363,6 +506,7 @@ void USpatialMetrics::HandleWorkerMetrics(Worker_Op* Op)
 			const Worker_GaugeMetric& WorkerMetric = Op->op.metrics.metrics.gauge_metrics[i];
 			StringTmp = WorkerMetric.key;
 			WorkerSDKGaugeMetrics.FindOrAdd(StringTmp) = WorkerMetric.value;
+			AddWorkerSDKMetricKey(StringTmp, WorkerMetric.key);
 		}
 
 		for (int32 i = 0; i < NumHistogramMetrics; i++)
@@ -370,6 +514,7 @@ void USpatialMetrics::HandleWorkerMetrics(Worker_Op* Op)
 			const Worker_HistogramMetric& WorkerMetric = Op->op.metrics.metrics.histogram_metrics[i];
 			StringTmp = WorkerMetric.key;
 			WorkerHistogramValues& HistogramMetrics = WorkerSDKHistogramMetrics.FindOrAdd(StringTmp);
+			AddWorkerSDKMetricKey(StringTmp, WorkerMetric.key);
 			HistogramMetrics.Sum = WorkerMetric.sum;
 			int32 NumBuckets = WorkerMetric.bucket_count;
 			HistogramMetrics.Buckets.SetNum(NumBuckets);
@@ -386,24 +531,34 @@ void USpatialMetrics::HandleWorkerMetrics(Worker_Op* Op)
 	}
 }
 
+void USpatialMetrics::AddWorkerSDKMetricKey(const FString& Key, const char* UTF8Key)
+{
+	if (!WorkerSDKMetricKeys.Contains(Key))
+	{
+		std::string PrefixedKey = "unreal_worker_";
+		PrefixedKey += UTF8Key;
+		WorkerSDKMetricKeys.Add(Key, MoveTemp(PrefixedKey));
+	}
+}
+
 void USpatialMetrics::SetCustomMetric(const FString& Metric, const UserSuppliedMetric& Delegate)
 {
 	UE_LOG(LogSpatialMetrics, Log, TEXT("USpatialMetrics: Adding custom metric %s (%s)"), *Metric, Delegate.GetUObject() ? *GetNameSafe(Delegate.GetUObject()) : TEXT("Not attached to UObject"));
-	if (UserSuppliedMetric* ExistingMetric = UserSuppliedMetrics.Find(Metric))
+	if (FUserSuppliedMetricEntry* ExistingMetric = UserSuppliedMetrics.Find(Metric))
 	{
-		*ExistingMetric = Delegate;
+		ExistingMetric->Delegate = Delegate;
 	}
 	else
 	{
-		UserSuppliedMetrics.Add(Metric, Delegate);
+		UserSuppliedMetrics.Add(Metric, FUserSuppliedMetricEntry{ Delegate, TCHAR_TO_UTF8(*Metric) });
 	}
 }
 
 void USpatialMetrics::RemoveCustomMetric(const FString& Metric)
 {
-	if (UserSuppliedMetric* ExistingMetric = UserSuppliedMetrics.Find(Metric))
+	if (FUserSuppliedMetricEntry* ExistingMetric = UserSuppliedMetrics.Find(Metric))
 	{
-		UE_LOG(LogSpatialMetrics, Log, TEXT("USpatialMetrics: Removing custom metric %s (%s)"), *Metric, ExistingMetric->GetUObject() ? *GetNameSafe(ExistingMetric->GetUObject()) : TEXT("Not attached to UObject"));
+		UE_LOG(LogSpatialMetrics, Log, TEXT("USpatialMetrics: Removing custom metric %s (%s)"), *Metric, ExistingMetric->Delegate.GetUObject() ? *GetNameSafe(ExistingMetric->Delegate.GetUObject()) : TEXT("Not attached to UObject"));
 		UserSuppliedMetrics.Remove(Metric);
 	}
 }
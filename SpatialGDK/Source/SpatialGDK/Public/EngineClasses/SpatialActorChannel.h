@@ -9,11 +9,13 @@
 #include "Interop/SpatialClassInfoManager.h"
 #include "Interop/SpatialStaticComponentView.h"
 #include "Runtime/Launch/Resources/Version.h"
+#include "Schema/Interest.h"
 #include "Schema/StandardLibrary.h"
 #include "Schema/RPCPayload.h"
 #include "SpatialCommonTypes.h"
 #include "SpatialGDKSettings.h"
 #include "Utils/GDKPropertyMacros.h"
+#include "Utils/PositionHierarchy.h"
 #include "Utils/RepDataUtils.h"
 #include "Utils/SpatialStatics.h"
 
@@ -192,6 +194,9 @@ public:
 		if (IsAuth && !bIsAuthServer)
 		{
 			AuthorityReceivedTimestamp = FPlatformTime::Cycles64();
+
+			// Another worker may have changed the entity's interest while this one wasn't authoritative.
+			LastSentInterest.Reset();
 		}
 		bIsAuthServer = IsAuth;
 	}
@@ -253,6 +258,10 @@ public:
 	void UpdateSpatialPositionWithFrequencyCheck();
 	void UpdateSpatialPosition();
 
+	// For batched position updates. If the actor has moved far enough, adds a position update for each entity in its
+	// hierarchy which this worker is authoritative over.
+	void GatherPositionUpdates(TArray<TPair<Worker_EntityId, FVector>>& OutPositionUpdates);
+
 	void ServerProcessOwnershipChange();
 	void ClientProcessOwnershipChange(bool bNewNetOwned);
 
@@ -276,6 +285,9 @@ private:
 
 	void RetireEntityIfAuthoritative();
 
+	// Returns whether the actor is the root of its position hierarchy and has moved far enough to send a position update,
+	// in which case LastPositionSinceUpdate is set to its position.
+	bool PrepareSpatialPositionUpdate();
 	void SendPositionUpdate(AActor* InActor, Worker_EntityId InEntityId, const FVector& NewPosition);
 
 	void InitializeHandoverShadowData(TArray<uint8>& ShadowData, UObject* Object);
@@ -292,6 +304,9 @@ public:
 
 	TMap<TWeakObjectPtr<UObject>, FSpatialObjectRepState> ObjectReferenceMap;
 
+	// The interest this worker last sent for the entity, used to skip updates that wouldn't change it.
+	TOptional<SpatialGDK::Interest> LastSentInterest;
+
 private:
 	Worker_EntityId EntityId;
 	bool bInterestDirty;
@@ -323,6 +338,9 @@ private:
 	FVector LastPositionSinceUpdate;
 	double TimeWhenPositionLastUpdated;
 
+	// The entities sent the actor's position when position updates are batched.
+	SpatialGDK::FPositionHierarchy PositionHierarchy;
+
 	uint8 FramesTillDormancyAllowed = 0;
 
 	// This is incremented in ReplicateActor. It represents how many bytes are sent per call to ReplicateActor.
@@ -21,6 +21,9 @@ public:
 
 	virtual FArchive& operator<<(struct FWeakObjectPtr& Value) override;
 
+	// Moves the written bytes out of the writer, which can't be written to afterwards. Only copies them if the buffer has a lot of slack.
+	TArray<uint8> MoveBytes();
+
 protected:
 	void SerializeObjectRef(FUnrealObjectRef& ObjectRef);
 };
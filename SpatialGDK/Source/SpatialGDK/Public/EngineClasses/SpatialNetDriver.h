@@ -11,6 +11,7 @@
 #include "Interop/SpatialRPCService.h"
 #include "Interop/SpatialSnapshotManager.h"
 #include "SpatialView/OpList/OpList.h"
+#include "Utils/ActorPriorityTable.h"
 #include "Utils/InterestFactory.h"
 
 #include "LoadBalancing/AbstractLockingPolicy.h"
@@ -258,6 +259,9 @@ private:
 	int32 ServerReplicateActors_PrepConnections(const float DeltaSeconds);
 	int32 ServerReplicateActors_PrioritizeActors(UNetConnection* Connection, const TArray<FNetViewer>& ConnectionViewers, FSpatialLoadBalancingHandler&, const TArray<FNetworkObjectInfo*> ConsiderList, const bool bCPUSaturated, FActorPriority*& OutPriorityList, FActorPriority**& OutPriorityActors);
 	void ServerReplicateActors_ProcessPrioritizedActors(UNetConnection* Connection, const TArray<FNetViewer>& ConnectionViewers, FSpatialLoadBalancingHandler&, FActorPriority** PriorityActors, const int32 FinalSortedCount, int32& OutUpdated);
+
+	// Returns true if the class is a subclass of one in DistanceOnlyRelevancyActorClasses, and not a pawn.
+	bool IsClassRelevancyDistanceOnly(UClass* Class);
 #endif
 
 	void ProcessRPC(AActor* Actor, UObject* SubObject, UFunction* Function, void* Parameters);
@@ -266,12 +270,17 @@ private:
 	void ProcessPendingDormancy();
 	void PollPendingLoads();
 
+	// Used by dynamic load balancing strategies.
+	void ReportWorkerLoad();
+	void OnLoadBalancingRegionsChanged();
+
 	// This index is incremented and assigned to every new RPC in ProcessRemoteFunction.
 	// The SpatialSender uses these indexes to retry any failed reliable RPCs
 	// in the correct order, if needed.
 	int NextRPCIndex;
 
 	float TimeWhenPositionLastUpdated;
+	float TimeWhenWorkerLoadLastReported;
 
 	// Counter for giving each connected client a unique IP address to satisfy Unreal's requirement of
 	// each client having a unique IP address in the UNetDriver::MappedClientConnections map.
@@ -284,6 +293,17 @@ private:
 	int32 ConsiderListSize = 0;
 #endif
 
+	// Used when bUseActorPriorityTable is enabled. The arrays are kept between frames to avoid reallocating them.
+	SpatialGDK::FActorPriorityTable ActorPriorityTable;
+	TArray<int32> PriorityTableRows;
+	TArray<int32> PriorityTableListIndices;
+	TArray<int32> PriorityTablePriorities;
+
+	// Used with the spatial index. Whether each class is in DistanceOnlyRelevancyActorClasses, and so can be skipped by distance.
+	TMap<TWeakObjectPtr<UClass>, bool> DistanceOnlyRelevancyClasses;
+	// The query results are only read through the index, and the array is kept between frames to avoid reallocating it.
+	TArray<Worker_EntityId> EntitiesNearViewers;
+
 #if WITH_EDITOR
 	static const int32 EDITOR_TOMBSTONED_ENTITY_TRACKING_RESERVATION_COUNT = 256;
 	TArray<Worker_EntityId> TombstonedEntities;
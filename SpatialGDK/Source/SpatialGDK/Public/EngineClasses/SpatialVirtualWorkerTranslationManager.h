@@ -16,6 +16,7 @@ DECLARE_LOG_CATEGORY_EXTERN(LogSpatialVirtualWorkerTranslationManager, Log, All)
 class SpatialVirtualWorkerTranslator;
 class SpatialOSDispatcherInterface;
 class SpatialOSWorkerInterface;
+class UAbstractLBStrategy;
 
 //
 // The Translation Manager is responsible for querying SpatialOS for all UnrealWorker worker
@@ -30,16 +31,24 @@ class SpatialOSWorkerInterface;
 // Unreal. It could be moved to an independent worker in the future in cloud deployments. It
 // lives here now for convenience and for fast iteration on local deployments.
 //
+// If the load balancing strategy is dynamic, the Translation manager also periodically queries
+// the load reported on each server worker entity, lets the strategy rebalance its regions, and
+// publishes the new regions on the Translation entity alongside the mapping.
+//
 
 class SPATIALGDK_API SpatialVirtualWorkerTranslationManager
 {
 public:
 	SpatialVirtualWorkerTranslationManager(SpatialOSDispatcherInterface* InReceiver,
 		SpatialOSWorkerInterface* InConnection,
-		SpatialVirtualWorkerTranslator* InTranslator);
+		SpatialVirtualWorkerTranslator* InTranslator,
+		UAbstractLBStrategy* InLoadBalanceStrategy = nullptr);
 
 	void SetNumberOfVirtualWorkers(const uint32 NumVirtualWorkers);
 
+	// Queries for worker load every rebalance interval once all virtual workers are assigned. Does nothing for static strategies.
+	void Tick(float CurrentTime);
+
 	// The translation manager only cares about changes to the authority of the translation mapping.
 	void AuthorityChanged(const Worker_AuthorityChangeOp& AuthChangeOp);
 
@@ -48,12 +57,15 @@ private:
 	SpatialOSWorkerInterface* Connection;
 
 	SpatialVirtualWorkerTranslator* Translator;
+	TWeakObjectPtr<UAbstractLBStrategy> LoadBalanceStrategy;
 
 	TMap<VirtualWorkerId, TPair<PhysicalWorkerName, Worker_EntityId>> VirtualToPhysicalWorkerMapping;
 	TMap<PhysicalWorkerName, VirtualWorkerId> PhysicalToVirtualWorkerMapping;
 	TQueue<VirtualWorkerId> UnassignedVirtualWorkers;
 
 	bool bWorkerEntityQueryInFlight;
+	bool bWorkerLoadQueryInFlight;
+	float TimeOfLastWorkerLoadQuery;
 
 	// Serialization and deserialization of the mapping.
 	void WriteMappingToSchema(Schema_Object* Object) const;
@@ -65,6 +77,11 @@ private:
 	void ConstructVirtualWorkerMappingFromQueryResponse(const Worker_EntityQueryResponseOp& Op);
 	void SendVirtualWorkerMappingUpdate() const;
 
+	// The following methods are used to query the Runtime for the load reported by each server worker
+	// and rebalance the regions of a dynamic load balancing strategy based on the response.
+	void QueryForWorkerLoads();
+	void WorkerLoadQueryDelegate(const Worker_EntityQueryResponseOp& Op);
+
 	void AssignWorker(const PhysicalWorkerName& WorkerId, const Worker_EntityId& ServerWorkerEntityId);
 };
 
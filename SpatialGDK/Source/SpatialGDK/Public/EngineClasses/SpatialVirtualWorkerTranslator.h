@@ -39,6 +39,9 @@ public:
 	// On receiving a version of the translation state, apply that to the internal mapping.
 	void ApplyVirtualWorkerManagerData(Schema_Object* ComponentObject);
 
+	// Called when the translation state moved the regions of a dynamic load balancing strategy.
+	FSimpleDelegate LoadBalancingRegionsChanged;
+
 private:
 	TWeakObjectPtr<UAbstractLBStrategy> LoadBalanceStrategy;
 
@@ -0,0 +1,80 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "SpatialCommonTypes.h"
+
+#include "Containers/Array.h"
+#include "Containers/Map.h"
+#include "Templates/Tuple.h"
+
+#include <improbable/c_schema.h>
+#include <improbable/c_worker.h>
+
+namespace SpatialGDK
+{
+
+// Holds outgoing component updates and merges updates to the same (entity, component) pair
+// into a single Schema_ComponentUpdate until they are released.
+// Merging is last-writer-wins for fields, appends events and unions cleared fields.
+// Updates are released in the order their (entity, component) pair was first added, so updates
+// to different components on the same entity may be reordered relative to each other within a window.
+// Not thread safe; expected to be used from the game thread only.
+class FComponentUpdateCoalescer
+{
+public:
+	FComponentUpdateCoalescer() = default;
+	~FComponentUpdateCoalescer();
+
+	// Non-copyable, non-movable. Owns the schema data of every pending update.
+	FComponentUpdateCoalescer(const FComponentUpdateCoalescer&) = delete;
+	FComponentUpdateCoalescer& operator=(const FComponentUpdateCoalescer&) = delete;
+
+	// Takes ownership of Update's schema data.
+	void AddUpdate(Worker_EntityId EntityId, const FWorkerComponentUpdate& Update);
+
+	// Invokes Callback(Worker_EntityId, FWorkerComponentUpdate&) for each pending update, passing
+	// ownership of its schema data to the callback, then empties the coalescer.
+	template <typename FunctorType>
+	void ReleaseUpdates(FunctorType&& Callback)
+	{
+		for (FPendingUpdate& Pending : PendingUpdates)
+		{
+			Callback(Pending.EntityId, Pending.Update);
+		}
+		NumReleased += PendingUpdates.Num();
+		PendingUpdates.Reset();
+		PendingIndices.Reset();
+	}
+
+	// Destroys every pending update without releasing it.
+	void Clear();
+
+	bool IsEmpty() const { return PendingUpdates.Num() == 0; }
+	int32 GetNumPending() const { return PendingUpdates.Num(); }
+
+	// Counters since the last call to ResetCounters, used to report the merge ratio.
+	// Pending updates are kept across ResetCounters, so call it only once the coalescer is empty.
+	uint32 GetNumAdded() const { return NumAdded; }
+	uint32 GetNumReleased() const { return NumReleased; }
+	// Fraction of added updates that were merged into an earlier one, in [0, 1].
+	float GetMergeRatio() const;
+	void ResetCounters();
+
+private:
+	struct FPendingUpdate
+	{
+		Worker_EntityId EntityId;
+		FWorkerComponentUpdate Update;
+	};
+
+	using FEntityComponentKey = TTuple<Worker_EntityId_Key, Worker_ComponentId>;
+
+	TArray<FPendingUpdate> PendingUpdates;
+	TMap<FEntityComponentKey, int32> PendingIndices;
+
+	uint32 NumAdded = 0;
+	uint32 NumReleased = 0;
+};
+
+} // namespace SpatialGDK
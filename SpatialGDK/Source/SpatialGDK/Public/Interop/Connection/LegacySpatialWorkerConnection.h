@@ -3,6 +3,9 @@
 #pragma once
 
 #include "Interop/Connection/SpatialWorkerConnection.h"
+#include "Interop/Connection/ComponentUpdateCoalescer.h"
+#include "Interop/Connection/OpListRing.h"
+#include "Interop/Connection/OutgoingMessageQueue.h"
 #include "Interop/Connection/OutgoingMessages.h"
 #include "Interop/Connection/SpatialOSWorkerInterface.h"
 #include "Interop/Connection/WorkerConnectionCoordinator.h"
@@ -51,9 +54,12 @@ public:
 	virtual void ProcessOutgoingMessages() override;
 	virtual void MaybeFlush() override;
 	virtual void Flush() override;
+	virtual void QueueCoalescedComponentUpdates() override;
 
 private:
 	void QueueLatestOpList();
+	void PublishLatestOpList();
+	void RecordOpListLatency(uint64 ReceivedCycles, uint64 DispatchedCycles);
 	void CacheWorkerAttributes();
 
 	// Begin FRunnable Interface
@@ -73,8 +79,23 @@ private:
 	FRunnableThread* OpsProcessingThread;
 	FThreadSafeBool KeepRunning = true;
 
-	TQueue<SpatialGDK::OpList> OpListQueue;
-	TQueue<TUniquePtr<SpatialGDK::FOutgoingMessage>> OutgoingMessagesQueue;
+	struct FReceivedOpList
+	{
+		SpatialGDK::OpList Ops;
+		uint64 ReceivedCycles;
+	};
+	TQueue<FReceivedOpList> OpListQueue;
+
+	// Used instead of OpListQueue when bUseLowLatencyOpListHandoff is enabled.
+	TUniquePtr<SpatialGDK::FOpListRing> OpListRing;
+
+	// Receive to dispatch latencies of op lists since the latency stats were last updated, in milliseconds.
+	TArray<float> OpListLatencySamplesMs;
+
+	SpatialGDK::FOutgoingMessageQueue OutgoingMessagesQueue;
+
+	// Component updates held back on the game thread when bCoalesceComponentUpdates is enabled.
+	SpatialGDK::FComponentUpdateCoalescer ComponentUpdateCoalescer;
 
 	// RequestIds per worker connection start at 0 and incrementally go up each command sent.
 	Worker_RequestId NextRequestId = 0;
@@ -0,0 +1,86 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "SpatialView/OpList/OpList.h"
+
+#include "Containers/Array.h"
+#include "Templates/Atomic.h"
+
+namespace SpatialGDK
+{
+
+/**
+ * A fixed-capacity, single-producer, single-consumer ring of op lists, used to hand op lists from the
+ * worker ops thread to the game thread without locks or allocations.
+ *
+ * The producer calls Publish for each op list it receives. The consumer calls ConsumeAll, which takes
+ * every op list published so far with a single atomic exchange and then frees their slots in one store.
+ * When the ring is full, Publish fails and the producer is expected to stop fetching op lists until
+ * the consumer catches up, so ops are never dropped.
+ */
+class SPATIALGDK_API FOpListRing
+{
+public:
+	// Capacity is rounded up to a power of two.
+	explicit FOpListRing(uint32 InCapacity);
+
+	// Not copyable or moveable.
+	FOpListRing(const FOpListRing&) = delete;
+	FOpListRing(FOpListRing&&) = delete;
+	FOpListRing& operator=(const FOpListRing&) = delete;
+	FOpListRing& operator=(FOpListRing&&) = delete;
+
+	uint32 GetCapacity() const { return Mask + 1; }
+
+	// Producer only. Returns false if the ring is full.
+	bool IsFull() const;
+
+	// Producer only. Moves Ops into the ring and makes it visible to the consumer, along with the time it was received
+	// in cycles. Returns false and leaves Ops untouched if the ring is full.
+	bool Publish(OpList& Ops, uint64 ReceivedCycles);
+
+	// Consumer only. Calls Callback(OpList&, uint64 ReceivedCycles) for each published op list in order, passing
+	// ownership of the op list to the callback. Returns the number of op lists consumed.
+	template <typename FunctorType>
+	uint32 ConsumeAll(FunctorType&& Callback)
+	{
+		const uint32 NumToConsume = NumPublished.Exchange(0);
+
+		for (uint32 i = 0; i < NumToConsume; ++i)
+		{
+			FSlot& Slot = Slots[(ReadIndex + i) & Mask];
+			Callback(Slot.Ops, Slot.ReceivedCycles);
+			Slot.Ops.Storage.Reset();
+		}
+
+		ReadIndex += NumToConsume;
+		ConsumedIndex.Store(ReadIndex);
+		return NumToConsume;
+	}
+
+private:
+	struct FSlot
+	{
+		OpList Ops;
+		uint64 ReceivedCycles;
+	};
+
+	TArray<FSlot> Slots;
+	uint32 Mask;
+
+	// Producer state. Indices increase forever and wrap around at 2^32, which the masking and unsigned
+	// subtraction handle since the capacity is a power of two.
+	uint32 WriteIndex = 0;
+
+	// Consumer state.
+	uint32 ReadIndex = 0;
+
+	// Op lists published but not yet taken by the consumer. Incremented by the producer, swapped to 0 by the consumer.
+	alignas(PLATFORM_CACHE_LINE_SIZE) TAtomic<uint32> NumPublished;
+
+	// ReadIndex as last seen by the producer, marking which slots can be reused.
+	alignas(PLATFORM_CACHE_LINE_SIZE) TAtomic<uint32> ConsumedIndex;
+};
+
+} // namespace SpatialGDK
@@ -0,0 +1,133 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "Interop/Connection/OutgoingMessages.h"
+
+#include "Containers/Array.h"
+#include "HAL/UnrealMemory.h"
+#include "Templates/Atomic.h"
+#include "Templates/UnrealTypeTraits.h"
+
+namespace SpatialGDK
+{
+
+/**
+ * A single-producer, single-consumer queue of outgoing messages.
+ *
+ * Messages are constructed in place in fixed-size, cache-line aligned slots which are grouped into chunks,
+ * so queueing a message does not allocate. Messages too large for a slot are constructed in a spill arena
+ * owned by the chunk instead. Chunks are recycled, along with their arenas, once the consumer has drained them.
+ *
+ * The producer calls Emplace followed by Publish. The consumer calls Peek followed by Pop.
+ */
+class SPATIALGDK_API FOutgoingMessageQueue
+{
+public:
+	static constexpr int32 SlotSize = 2 * PLATFORM_CACHE_LINE_SIZE;
+	static constexpr int32 SlotsPerChunk = 64;
+
+	FOutgoingMessageQueue();
+	~FOutgoingMessageQueue();
+
+	// Not copyable or moveable.
+	FOutgoingMessageQueue(const FOutgoingMessageQueue&) = delete;
+	FOutgoingMessageQueue(FOutgoingMessageQueue&&) = delete;
+	FOutgoingMessageQueue& operator=(const FOutgoingMessageQueue&) = delete;
+	FOutgoingMessageQueue& operator=(FOutgoingMessageQueue&&) = delete;
+
+	// Producer only. Constructs a message that will not be visible to the consumer until Publish is called.
+	template <typename T, typename... ArgsType>
+	T* Emplace(ArgsType&&... Args)
+	{
+		static_assert(TIsDerivedFrom<T, FOutgoingMessage>::IsDerived, "Only outgoing messages can be queued.");
+		checkf(!bHasUnpublishedMessage, TEXT("Publish must be called before emplacing another message."));
+
+		FChunk* Chunk = GetChunkForWrite();
+		void* Storage = (sizeof(T) <= SlotSize && alignof(T) <= PLATFORM_CACHE_LINE_SIZE)
+			? static_cast<void*>(Chunk->Slots[WriteIndex].Storage)
+			: Chunk->Spill.Allocate(sizeof(T), alignof(T));
+
+		T* Message = new (Storage) T(Forward<ArgsType>(Args)...);
+		Chunk->Messages[WriteIndex] = Message;
+		bHasUnpublishedMessage = true;
+		return Message;
+	}
+
+	// Producer only. Makes the last emplaced message visible to the consumer.
+	void Publish();
+
+	// Consumer only. Returns the oldest published message, or nullptr if there are none.
+	// The message is valid until Pop is called.
+	FOutgoingMessage* Peek();
+
+	// Consumer only. Destroys the message returned by the last call to Peek.
+	void Pop();
+
+private:
+	// Bump allocator for messages which do not fit in a slot.
+	class FSpillArena
+	{
+	public:
+		FSpillArena() = default;
+		~FSpillArena();
+
+		FSpillArena(const FSpillArena&) = delete;
+		FSpillArena& operator=(const FSpillArena&) = delete;
+
+		void* Allocate(SIZE_T Size, uint32 Alignment);
+		// Releases all allocations, keeping the first block for reuse.
+		void Reset();
+
+	private:
+		static constexpr SIZE_T BlockSize = 16 * 1024;
+
+		struct FBlock
+		{
+			uint8* Data;
+			SIZE_T Size;
+		};
+
+		TArray<FBlock> Blocks;
+		SIZE_T BlockOffset = 0;
+	};
+
+	struct alignas(PLATFORM_CACHE_LINE_SIZE) FSlot
+	{
+		uint8 Storage[SlotSize];
+	};
+
+	struct alignas(PLATFORM_CACHE_LINE_SIZE) FChunk
+	{
+		FSlot Slots[SlotsPerChunk];
+		FOutgoingMessage* Messages[SlotsPerChunk];
+		FSpillArena Spill;
+
+		// Written by the producer, read by the consumer. Kept on their own cache line.
+		alignas(PLATFORM_CACHE_LINE_SIZE) TAtomic<int32> NumPublished;
+		TAtomic<FChunk*> Next;
+	};
+
+	static FChunk* CreateChunk();
+	static void DestroyChunk(FChunk* Chunk);
+
+	FChunk* GetChunkForWrite();
+	void RecycleChunk(FChunk* Chunk);
+
+	// Producer state.
+	FChunk* WriteChunk;
+	int32 WriteIndex = 0;
+	bool bHasUnpublishedMessage = false;
+
+	// Keeps producer and consumer state on separate cache lines.
+	uint8 Padding[PLATFORM_CACHE_LINE_SIZE];
+
+	// Consumer state.
+	FChunk* ReadChunk;
+	int32 ReadIndex = 0;
+
+	// A drained chunk handed back from the consumer to the producer for reuse.
+	TAtomic<FChunk*> SpareChunk;
+};
+
+} // namespace SpatialGDK
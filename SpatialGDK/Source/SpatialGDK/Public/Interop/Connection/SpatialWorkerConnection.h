@@ -30,6 +30,9 @@ public:
 	virtual void MaybeFlush() PURE_VIRTUAL(USpatialWorkerConnection::MaybeFlush, return;);
 	virtual void Flush() PURE_VIRTUAL(USpatialWorkerConnection::Flush, return;);
 
+	// Moves any component updates held back for coalescing onto the outgoing queue.
+	virtual void QueueCoalescedComponentUpdates() {}
+
 	DECLARE_MULTICAST_DELEGATE_OneParam(FOnEnqueueMessage, const SpatialGDK::FOutgoingMessage*);
 	FOnEnqueueMessage OnEnqueueMessage;
 
@@ -0,0 +1,38 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+namespace SpatialGDK
+{
+
+/**
+ * Collects component update ops and hands them out grouped by entity, keeping the order of the ops of each entity.
+ *
+ * Ops are grouped with a stable LSD radix sort on the entity ID, one byte per pass. Passes over bytes which are the
+ * same for every entity ID are skipped, so a tick of ops usually only takes two or three passes.
+ *
+ * The grouper only stores pointers, so the ops must outlive the call to Flush.
+ */
+class SPATIALGDK_API FEntityOpGrouper
+{
+public:
+	using FEntityOps = TArrayView<const Worker_ComponentUpdateOp* const>;
+
+	void Add(const Worker_ComponentUpdateOp& Op) { Ops.Add(&Op); }
+	bool IsEmpty() const { return Ops.Num() == 0; }
+
+	// Calls Callback once per entity, in ascending entity ID order, then removes all ops.
+	void Flush(TFunctionRef<void(Worker_EntityId, FEntityOps)> Callback);
+
+private:
+	void SortByEntityId();
+
+	TArray<const Worker_ComponentUpdateOp*> Ops;
+	TArray<const Worker_ComponentUpdateOp*> Scratch;
+};
+
+} // namespace SpatialGDK
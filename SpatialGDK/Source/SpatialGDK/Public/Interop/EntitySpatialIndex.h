@@ -0,0 +1,76 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Schema/Interest.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+namespace SpatialGDK
+{
+
+/**
+ * A uniform grid over the positions of the entities in the view, for finding the entities in a region without visiting every entity.
+ *
+ * Positions and query shapes are in SpatialOS coordinates, and the query shapes are the sphere, cylinder and box interest
+ * constraints from Schema/Interest.h. Cells are square columns in the X-Z plane, so cylinders are infinitely tall along Y
+ * as they are in SpatialOS queries.
+ *
+ * Each query takes a batch of shapes and returns every entity inside any of them exactly once, in no particular order.
+ */
+class SPATIALGDK_API FEntitySpatialIndex
+{
+public:
+	explicit FEntitySpatialIndex(double InCellSize);
+
+	// Adds the entity, or moves it if it is already in the index.
+	void SetEntityPosition(Worker_EntityId EntityId, const Coordinates& Position);
+	void RemoveEntity(Worker_EntityId EntityId);
+
+	bool Contains(Worker_EntityId EntityId) const { return EntityToEntryIndex.Contains(EntityId); }
+	int32 Num() const { return Entries.Num(); }
+
+	void QuerySpheres(TArrayView<const SphereConstraint> Spheres, TArray<Worker_EntityId>& OutEntityIds) const;
+	void QueryCylinders(TArrayView<const CylinderConstraint> Cylinders, TArray<Worker_EntityId>& OutEntityIds) const;
+	void QueryBoxes(TArrayView<const BoxConstraint> Boxes, TArray<Worker_EntityId>& OutEntityIds) const;
+
+	// Returns true if the entity is in the index but wasn't returned by the latest query, so callers can test many entities
+	// against a query's results without copying them into a set. Entities missing from the index return false. Only meaningful
+	// until the index changes, as entities added or moved since the query weren't part of it.
+	bool IsOutsideLastQuery(Worker_EntityId EntityId) const;
+
+private:
+	struct FEntry
+	{
+		Worker_EntityId EntityId;
+		Coordinates Position;
+		FIntPoint Cell;
+		int32 IndexInCell;
+		// The last query that returned the entity, so entities in several shapes of a batch are only returned once.
+		mutable uint32 QueryStamp;
+	};
+
+	FIntPoint GetCell(double X, double Z) const;
+
+	void AddToCell(int32 EntryIndex);
+	void RemoveFromCell(int32 EntryIndex);
+
+	// Starts a query, returning a stamp that no entry has yet.
+	uint32 BeginQuery() const;
+
+	// Calls Visit with each entry in the cells overlapping the X-Z bounds, which are inclusive.
+	template <typename VisitorType>
+	void ForEachEntryInBounds(double MinX, double MinZ, double MaxX, double MaxZ, VisitorType&& Visit) const;
+
+	double CellSize;
+
+	TArray<FEntry> Entries;
+	TMap<Worker_EntityId_Key, int32> EntityToEntryIndex;
+	TMap<FIntPoint, TArray<int32>> Cells;
+
+	mutable uint32 LastQueryStamp;
+};
+
+} // namespace SpatialGDK
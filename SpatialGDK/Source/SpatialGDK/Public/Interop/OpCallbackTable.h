@@ -0,0 +1,107 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "SpatialConstants.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+namespace SpatialGDK
+{
+
+/**
+ * Stores user callbacks for ops on external schema components, and routes ops to them.
+ *
+ * Callbacks for each op type are stored contiguously, sorted by component ID and then by registration order.
+ * A dense table indexed by component ID and op type holds the range of callbacks for each pair, so routing an op
+ * is an array lookup followed by calling each callback in the range directly.
+ *
+ * Adding and removing callbacks rebuilds the table for that op type, so it is much slower than routing.
+ * Callbacks must not add or remove callbacks while an op is being routed.
+ */
+class SPATIALGDK_API FOpCallbackTable
+{
+public:
+	using FCallbackId = uint32;
+
+	FOpCallbackTable();
+
+	static bool IsExternalSchemaComponent(Worker_ComponentId ComponentId)
+	{
+		// Unsigned wrap-around also rejects component IDs below the range.
+		return ComponentId - SpatialConstants::MIN_EXTERNAL_SCHEMA_ID <= NumComponentIds - 1;
+	}
+
+	// ComponentId must be in the range MIN_EXTERNAL_SCHEMA_ID - MAX_EXTERNAL_SCHEMA_ID.
+	void Add(FCallbackId Id, Worker_ComponentId ComponentId, const TFunction<void(const Worker_AddComponentOp&)>& Callback);
+	void Add(FCallbackId Id, Worker_ComponentId ComponentId, const TFunction<void(const Worker_RemoveComponentOp&)>& Callback);
+	void Add(FCallbackId Id, Worker_ComponentId ComponentId, const TFunction<void(const Worker_AuthorityChangeOp&)>& Callback);
+	void Add(FCallbackId Id, Worker_ComponentId ComponentId, const TFunction<void(const Worker_ComponentUpdateOp&)>& Callback);
+	void Add(FCallbackId Id, Worker_ComponentId ComponentId, const TFunction<void(const Worker_CommandRequestOp&)>& Callback);
+	void Add(FCallbackId Id, Worker_ComponentId ComponentId, const TFunction<void(const Worker_CommandResponseOp&)>& Callback);
+
+	// Returns false if no callback was registered with Id.
+	bool Remove(FCallbackId Id);
+
+	// Calls the callbacks registered for the op's type and ComponentId, which must be the op's external schema component.
+	void Dispatch(Worker_ComponentId ComponentId, const Worker_Op& Op) const;
+
+private:
+	static constexpr uint32 NumComponentIds = SpatialConstants::MAX_EXTERNAL_SCHEMA_ID - SpatialConstants::MIN_EXTERNAL_SCHEMA_ID + 1;
+
+	enum ERoutedOpType : uint8
+	{
+		AddComponent,
+		RemoveComponent,
+		AuthorityChange,
+		ComponentUpdate,
+		CommandRequest,
+		CommandResponse,
+		NumRoutedOpTypes
+	};
+
+	struct FCallbackRange
+	{
+		uint32 Begin;
+		uint32 End;
+	};
+
+	template <typename OpDataType>
+	struct TCallbackList
+	{
+		TArray<TFunction<void(const OpDataType&)>> Callbacks;
+		TArray<FCallbackId> Ids;
+		TArray<Worker_ComponentId> ComponentIds;
+	};
+
+	template <typename OpDataType>
+	void AddToList(TCallbackList<OpDataType>& List, ERoutedOpType OpType, FCallbackId Id, Worker_ComponentId ComponentId, const TFunction<void(const OpDataType&)>& Callback);
+
+	template <typename OpDataType>
+	void RemoveFromList(TCallbackList<OpDataType>& List, ERoutedOpType OpType, FCallbackId Id);
+
+	template <typename OpDataType>
+	void RunCallbacks(const TCallbackList<OpDataType>& List, ERoutedOpType OpType, uint32 ComponentIndex, const OpDataType& Op) const;
+
+	// Rewrites the ranges of OpType from the sorted component IDs of its callbacks.
+	void RebuildRanges(ERoutedOpType OpType, const TArray<Worker_ComponentId>& SortedComponentIds);
+
+	FCallbackRange& GetRange(uint32 ComponentIndex, ERoutedOpType OpType) { return Ranges[ComponentIndex * NumRoutedOpTypes + OpType]; }
+	const FCallbackRange& GetRange(uint32 ComponentIndex, ERoutedOpType OpType) const { return Ranges[ComponentIndex * NumRoutedOpTypes + OpType]; }
+
+	TCallbackList<Worker_AddComponentOp> AddComponentCallbacks;
+	TCallbackList<Worker_RemoveComponentOp> RemoveComponentCallbacks;
+	TCallbackList<Worker_AuthorityChangeOp> AuthorityChangeCallbacks;
+	TCallbackList<Worker_ComponentUpdateOp> ComponentUpdateCallbacks;
+	TCallbackList<Worker_CommandRequestOp> CommandRequestCallbacks;
+	TCallbackList<Worker_CommandResponseOp> CommandResponseCallbacks;
+
+	// NumComponentIds * NumRoutedOpTypes ranges, with the op types of each component next to each other.
+	TArray<FCallbackRange> Ranges;
+
+	TMap<FCallbackId, ERoutedOpType> CallbackIdToOpType;
+};
+
+} // namespace SpatialGDK
@@ -5,7 +5,9 @@
 #include "CoreMinimal.h"
 
 #include "Utils/GDKPropertyMacros.h"
+#include "Utils/HandoverLayout.h"
 #include "Utils/SchemaDatabase.h"
+#include "Utils/SchemaFieldInfo.h"
 
 #include <WorkerSDK/improbable/c_worker.h>
 
@@ -44,6 +46,7 @@ struct FHandoverPropertyInfo
 	int32 Offset;
 	int32 ArrayIdx;
 	GDK_PROPERTY(Property)* Property;
+	SpatialGDK::FSchemaFieldInfo FieldInfo;
 };
 
 struct FInterestPropertyInfo
@@ -63,8 +66,12 @@ struct FClassInfo
 	TArray<UFunction*> RPCs;
 	TMap<UFunction*, FRPCInfo> RPCInfoMap;
 	TArray<FHandoverPropertyInfo> HandoverProperties;
+	SpatialGDK::FHandoverLayout HandoverLayout;
 	TArray<FInterestPropertyInfo> InterestProperties;
 
+	// How each replicated property is read from and written to schema, indexed by rep handle - 1.
+	TArray<SpatialGDK::FSchemaFieldInfo> RepFieldInfos;
+
 	// For Actors and default Subobjects belonging to Actors
 	Worker_ComponentId SchemaComponents[ESchemaComponentType::SCHEMA_Count] = {};
 
@@ -4,6 +4,8 @@
 
 #include "CoreMinimal.h"
 
+#include "Interop/EntityOpGrouper.h"
+#include "Interop/OpCallbackTable.h"
 #include "Schema/Component.h"
 #include "Schema/StandardLibrary.h"
 #include "Schema/UnrealMetadata.h"
@@ -24,7 +26,7 @@ class USpatialWorkerFlags;
 class SPATIALGDK_API SpatialDispatcher
 {
 public:
-	using FCallbackId = uint32;
+	using FCallbackId = SpatialGDK::FOpCallbackTable::FCallbackId;
 
 	void Init(USpatialReceiver* InReceiver, USpatialStaticComponentView* InStaticComponentView, USpatialMetrics* InSpatialMetrics, USpatialWorkerFlags* InSpatialWorkerFlags);
 	void ProcessOps(const SpatialGDK::OpList& Ops);
@@ -46,24 +48,13 @@ public:
 	bool RemoveOpCallback(FCallbackId Id);
 
 private:
-	struct UserOpCallbackData
-	{
-		FCallbackId Id;
-		TFunction<void(const Worker_Op*)> Callback;
-	};
+	void ProcessExternalSchemaOp(Worker_ComponentId ComponentId, const Worker_Op* Op);
 
-	struct CallbackIdData
-	{
-		Worker_ComponentId ComponentId;
-		Worker_OpType OpType;
-	};
+	// Applies the component updates collected since the last op of another type, one entity at a time.
+	void FlushComponentUpdates();
 
-	using OpTypeToCallbacksMap = TMap<Worker_OpType, TArray<UserOpCallbackData>>;
-
-	bool IsExternalSchemaOp(Worker_Op* Op) const;
-	void ProcessExternalSchemaOp(Worker_Op* Op);
-	FCallbackId AddGenericOpCallback(Worker_ComponentId ComponentId, Worker_OpType OpType, const TFunction<void(const Worker_Op*)>& Callback);
-	void RunCallbacks(Worker_ComponentId ComponentId, const Worker_Op* Op);
+	// Moves the ops to skip which belong to Ops from OpsToSkip into OpsToSkipInList, by index. Returns false if there are none.
+	bool TakeOpsToSkip(const SpatialGDK::OpList& Ops);
 
 	TWeakObjectPtr<USpatialReceiver> Receiver;
 	TWeakObjectPtr<USpatialStaticComponentView> StaticComponentView;
@@ -74,10 +65,15 @@ private:
 
 	// This index is incremented and returned every time an AddOpCallback function is called.
 	// CallbackIds enable you to deregister callbacks using the RemoveOpCallback function. 
-	// RunCallbacks is called by the SpatialDispatcher and executes all user registered 
+	// The callback table is used by the SpatialDispatcher to execute all user registered
 	// callbacks for the matching component ID and network operation type.
 	FCallbackId NextCallbackId;
-	TMap<Worker_ComponentId, OpTypeToCallbacksMap> ComponentOpTypeToCallbacksMap;
-	TMap<FCallbackId, CallbackIdData> CallbackIdToDataMap;
+	SpatialGDK::FOpCallbackTable Callbacks;
+
+	// Component updates waiting to be applied, when bBatchComponentUpdatesByEntity is enabled.
+	SpatialGDK::FEntityOpGrouper ComponentUpdatesByEntity;
+
 	TArray<const Worker_Op*> OpsToSkip;
+	// Set for each index of the op list being processed that holds an op to skip.
+	TBitArray<> OpsToSkipInList;
 };
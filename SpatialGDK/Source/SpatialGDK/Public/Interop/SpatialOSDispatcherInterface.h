@@ -30,6 +30,9 @@ public:
 	virtual void DropQueuedRemoveComponentOpsForEntity(Worker_EntityId EntityId) PURE_VIRTUAL(SpatialOSDispatcherInterface::DropQueuedRemoveComponentOpsForEntity, return;);
 	virtual void OnAuthorityChange(const Worker_AuthorityChangeOp& Op) PURE_VIRTUAL(SpatialOSDispatcherInterface::OnAuthorityChange, return;);
 	virtual void OnComponentUpdate(const Worker_ComponentUpdateOp& Op) PURE_VIRTUAL(SpatialOSDispatcherInterface::OnComponentUpdate, return;);
+	// Ops are the component updates for EntityId in the order they were received. Each is applied to the static
+	// component view just before it is handled, so handlers see the view as it was after their own update.
+	virtual void OnEntityComponentUpdates(Worker_EntityId EntityId, TArrayView<const Worker_ComponentUpdateOp* const> Ops) PURE_VIRTUAL(SpatialOSDispatcherInterface::OnEntityComponentUpdates, return;);
 	virtual void OnEntityQueryResponse(const Worker_EntityQueryResponseOp& Op) PURE_VIRTUAL(SpatialOSDispatcherInterface::OnEntityQueryResponse, return;);
 	virtual bool OnExtractIncomingRPC(Worker_EntityId EntityId, ERPCType RPCType, const SpatialGDK::RPCPayload& Payload) PURE_VIRTUAL(SpatialOSDispatcherInterface::OnExtractIncomingRPC, return false;);
 	virtual void OnCommandRequest(const Worker_CommandRequestOp& Op) PURE_VIRTUAL(SpatialOSDispatcherInterface::OnCommandRequest, return;);
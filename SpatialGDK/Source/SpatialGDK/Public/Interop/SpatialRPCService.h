@@ -6,6 +6,8 @@
 
 #include "Schema/RPCPayload.h"
 #include "SpatialView/EntityComponentId.h"
+#include "Utils/EntityRPCType.h"
+#include "Utils/RPCOverflowQueue.h"
 #include "Utils/RPCRingBuffer.h"
 
 #include <WorkerSDK/improbable/c_schema.h>
@@ -22,33 +24,14 @@ DECLARE_DELEGATE_RetVal_ThreeParams(bool, ExtractRPCDelegate, Worker_EntityId, E
 namespace SpatialGDK
 {
 
-struct EntityRPCType
-{
-	EntityRPCType(Worker_EntityId EntityId, ERPCType Type)
-		: EntityId(EntityId)
-		, Type(Type)
-	{}
-
-	Worker_EntityId EntityId;
-	ERPCType Type;
-
-	friend bool operator==(const EntityRPCType& Lhs, const EntityRPCType& Rhs)
-	{
-		return Lhs.EntityId == Rhs.EntityId && Lhs.Type == Rhs.Type;
-	}
-
-	friend uint32 GetTypeHash(EntityRPCType Value)
-	{
-		return HashCombine(::GetTypeHash(static_cast<int64>(Value.EntityId)), ::GetTypeHash(static_cast<uint32>(Value.Type)));
-	}
-};
-
 enum class EPushRPCResult : uint8
 {
 	Success,
 
 	QueueOverflowed,
 	DropOverflowed,
+	// A reliable RPC overflowed while the overflow queue was full, and wasn't queued.
+	OverflowQueueFull,
 	HasAckAuthority,
 	NoRingBufferAuthority,
 	EntityBeingCreated
@@ -74,6 +57,14 @@ public:
 	// stops retrieving RPCs.
 	void ExtractRPCsForEntity(Worker_EntityId EntityId, Worker_ComponentId ComponentId);
 
+	// Called after an update to the component has been applied to the view. Only extracts from the ring buffers the update
+	// changed, and from buffers whose RPCs were not all extracted before.
+	void ExtractRPCsForUpdatedComponent(Worker_EntityId EntityId, Worker_ComponentId ComponentId);
+
+	// Called instead when an update to the component is applied to the view but not extracted from, so its ring buffers are
+	// extracted from on the next update to the component, even if that update doesn't change them.
+	void SkipExtractingRPCsForUpdatedComponent(Worker_EntityId EntityId, Worker_ComponentId ComponentId);
+
 	// Will also store acked IDs locally.
 	void IncrementAckedRPCID(Worker_EntityId EntityId, ERPCType Type);
 
@@ -83,6 +74,8 @@ public:
 	void OnEndpointAuthorityGained(Worker_EntityId EntityId, Worker_ComponentId ComponentId);
 	void OnEndpointAuthorityLost(Worker_EntityId EntityId, Worker_ComponentId ComponentId);
 
+	const RPCOverflowStats& GetOverflowStats() const { return OverflowQueue.GetStats(); }
+
 private:
 	// For now, we should drop overflowed RPCs when entity crosses the boundary.
 	// When locking works as intended, we should re-evaluate how this will work (drop after some time?).
@@ -91,8 +84,13 @@ private:
 	EPushRPCResult PushRPCInternal(Worker_EntityId EntityId, ERPCType Type, RPCPayload&& Payload, bool bCreatedEntity);
 
 	void ExtractRPCsForType(Worker_EntityId EntityId, ERPCType Type);
+	void ExtractRPCsIfChanged(Worker_EntityId EntityId, const RPCRingBuffer& Buffer, uint64 UpdateTick);
+
+	EPushRPCResult AddOverflowedRPC(EntityRPCType EntityType, RPCPayload&& Payload);
 
-	void AddOverflowedRPC(EntityRPCType EntityType, RPCPayload&& Payload);
+	// Returns false if the RPC doesn't fit in the ring buffer.
+	bool WritePackedRPC(EntityRPCType EntityType, const RPCRingBufferDescriptor& Descriptor, Schema_Object* EndpointObject, uint64 RPCId, uint64 LastAckedRPCId, const RPCPayload& Payload);
+	void InitPackedRingBufferState(EntityRPCType EntityType, const RPCRingBuffer& Buffer);
 
 	uint64 GetAckFromView(Worker_EntityId EntityId, ERPCType Type);
 	const RPCRingBuffer& GetBufferFromView(Worker_EntityId EntityId, ERPCType Type);
@@ -108,6 +106,8 @@ private:
 	// This is local, not written into schema.
 	TMap<Worker_EntityId_Key, uint64> LastSeenMulticastRPCIds;
 	TMap<EntityRPCType, uint64> LastSeenRPCIds;
+	// Buffers where the extract callback stopped extraction before the last sent RPC.
+	TSet<EntityRPCType> PartiallyExtractedBuffers;
 
 	// Stored here for things we have authority over.
 	TMap<EntityRPCType, uint64> LastAckedRPCIds;
@@ -116,7 +116,25 @@ private:
 	TMap<EntityComponentId, Schema_ComponentData*> PendingRPCsOnEntityCreation;
 
 	TMap<EntityComponentId, Schema_ComponentUpdate*> PendingComponentUpdatesToSend;
-	TMap<EntityRPCType, TArray<RPCPayload>> OverflowedRPCs;
+	RPCOverflowQueue OverflowQueue;
+
+	// Stored for ring buffers we have authority over that pack several RPCs into each slot.
+	struct PackedRingBufferState
+	{
+		// Slots are written in order, each holding the RPCs pushed before the next update is sent.
+		uint32 NextSlot = 0;
+		TArray<uint64> SlotLastRPCIds;
+
+		// The slot last written to, which RPCs can be appended to until the update or data holding it is sent.
+		Schema_Object* OpenSlotObject = nullptr;
+		Schema_Object* OpenSlotEndpointObject = nullptr;
+		uint32 OpenSlotGeneration = 0;
+		uint32 NumRPCsInOpenSlot = 0;
+	};
+	TMap<EntityRPCType, PackedRingBufferState> PackedRingBufferStates;
+
+	// Incremented whenever pending schema objects are handed out, so open slots are not appended to after they are sent.
+	uint32 PendingSchemaObjectGeneration = 0;
 
 #if TRACE_LIB_ACTIVE
 	void ProcessResultToLatencyTrace(const EPushRPCResult Result, const TraceKey Trace);
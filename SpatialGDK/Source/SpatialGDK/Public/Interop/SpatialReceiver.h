@@ -70,6 +70,7 @@ public:
 	virtual void OnAuthorityChange(const Worker_AuthorityChangeOp& Op) override;
 
 	virtual void OnComponentUpdate(const Worker_ComponentUpdateOp& Op) override;
+	virtual void OnEntityComponentUpdates(Worker_EntityId EntityId, TArrayView<const Worker_ComponentUpdateOp* const> Ops) override;
 
 	// This gets bound to a delegate in SpatialRPCService and is called for each RPC extracted when calling SpatialRPCService::ExtractRPCsForEntity.
 	virtual bool OnExtractIncomingRPC(Worker_EntityId EntityId, ERPCType RPCType, const SpatialGDK::RPCPayload& Payload) override;
@@ -117,6 +118,7 @@ private:
 	AActor* CreateActor(SpatialGDK::UnrealMetadata* UnrealMetadata, SpatialGDK::SpawnData* SpawnData, SpatialGDK::NetOwningClientWorker* NetOwningClientWorkerData);
 
 	USpatialActorChannel* GetOrRecreateChannelForDomantActor(AActor* Actor, Worker_EntityId EntityID);
+	USpatialActorChannel* GetChannelForComponentUpdate(Worker_EntityId EntityId, Worker_ComponentId ComponentId);
 	void ProcessRemoveComponent(const Worker_RemoveComponentOp& Op);
 
 	static FTransform GetRelativeSpawnTransform(UClass* ActorClass, FTransform SpawnTransform);
@@ -135,6 +137,7 @@ private:
 	void AttachDynamicSubobject(AActor* Actor, Worker_EntityId EntityId, const FClassInfo& Info);
 
 	void ApplyComponentUpdate(const Worker_ComponentUpdate& ComponentUpdate, UObject& TargetObject, USpatialActorChannel& Channel, bool bIsHandover);
+	bool IsTearOffUpdate(const Worker_ComponentUpdate& ComponentUpdate, const UObject& TargetObject) const;
 
 	FRPCErrorInfo ApplyRPCInternal(UObject* TargetObject, UFunction* Function, const FPendingRPCParams& PendingRPCParams);
 
@@ -226,6 +229,9 @@ private:
 	// Helper struct to manage FSpatialObjectRepState update cycle.
 	struct RepStateUpdateHelper;
 
+	// Helper struct to apply several updates to one object as a single replication update.
+	struct DeferredObjectUpdate;
+
 	// Map from references to replicated objects to properties using these references.
 	// Useful to manage entities going in and out of interest, in order to recover references to actors.
 	FObjectToRepStateMap ObjectRefToRepStateMap;
@@ -10,6 +10,7 @@
 #include "Interop/SpatialRPCService.h"
 #include "Schema/RPCPayload.h"
 #include "TimerManager.h"
+#include "Utils/ParallelComponentSerializer.h"
 #include "Utils/RepDataUtils.h"
 #include "Utils/RPCContainer.h"
 
@@ -71,6 +72,13 @@ public:
 
 	// Actor Updates
 	void SendComponentUpdates(UObject* Object, const FClassInfo& Info, USpatialActorChannel* Channel, const FRepChangeState* RepChanges, const FHandoverChangeState* HandoverChanges, uint32& OutBytesWritten);
+
+	// While deferring, SendComponentUpdates records changelists that can be serialized off the game thread instead of
+	// serializing them immediately, and reports no bytes written for them. FlushDeferredComponentUpdates serializes them
+	// in parallel, sends the results and returns the bytes written. Anything else sent for an entity first sends its deferred updates.
+	void BeginDeferringComponentUpdates();
+	uint32 FlushDeferredComponentUpdates();
+	int32 GetNumDeferredComponentUpdates() const { return ParallelSerializer.GetNumDeferred(); }
 	void SendPositionUpdate(Worker_EntityId EntityId, const FVector& Location);
 	void SendAuthorityIntentUpdate(const AActor& Actor, VirtualWorkerId NewAuthoritativeVirtualWorkerId);
 	void SetAclWriteAuthority(const SpatialLoadBalanceEnforcer::AclWriteAuthorityRequest& Request);
@@ -124,12 +132,18 @@ public:
 	void CreateServerWorkerEntity();
 	void RetryServerWorkerEntityCreation(Worker_EntityId EntityId, int AttemptCounte);
 	void UpdateServerWorkerEntityInterestAndPosition();
+	void SendServerWorkerLoadUpdate(double Load, uint32 AuthoritativeActorCount);
 
 	void ClearPendingRPCs(const Worker_EntityId EntityId);
 
+	const FRPCContainer& GetRPCContainer() const { return OutgoingRPCs; }
+
 	bool ValidateOrExit_IsSupportedClass(const FString& PathName);
 
 private:
+	void SendOrQueueComponentUpdate(Worker_EntityId EntityId, FWorkerComponentUpdate& Update);
+	void FlushDeferredComponentUpdatesForEntity(Worker_EntityId EntityId);
+
 	// Create a copy of an array of components. Deep copies all Schema_ComponentData.
 	static TArray<FWorkerComponentData> CopyEntityComponentData(const TArray<FWorkerComponentData>& EntityComponents);
 	// Create a copy of an array of components. Deep copies all Schema_ComponentData.
@@ -189,4 +203,8 @@ private:
 	FUpdatesQueuedUntilAuthority UpdatesQueuedUntilAuthorityMap;
 
 	FChannelsToUpdatePosition ChannelsToUpdatePosition;
+	TArray<TPair<Worker_EntityId, FVector>> PendingPositionUpdates;
+
+	SpatialGDK::FParallelComponentSerializer ParallelSerializer;
+	bool bDeferringComponentUpdates = false;
 };
@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "Interop/EntitySpatialIndex.h"
 #include "Schema/Component.h"
 #include "Schema/StandardLibrary.h"
 #include "SpatialConstants.h"
@@ -23,6 +24,10 @@ class SPATIALGDK_API USpatialStaticComponentView : public UObject
 public:
 	bool HasAuthority(Worker_EntityId EntityId, Worker_ComponentId ComponentId) const;
 
+	// Changes whenever authority over any of the entity's components changes, so callers can cache the results of authority
+	// checks and revalidate them with one comparison. Zero for entities without any authority changes in the view.
+	uint64 GetAuthorityGeneration(Worker_EntityId EntityId) const;
+
 	template <typename T>
 	T* GetComponentData(Worker_EntityId EntityId) const
 	{
@@ -47,9 +52,27 @@ public:
 
 	void GetEntityIds(TArray<Worker_EntityId_Key>& OutEntityIds) const { EntityComponentMap.GetKeys(OutEntityIds); }
 
+	// Returns the index of entity positions, or nullptr if bEnableEntitySpatialIndex is disabled.
+	const SpatialGDK::FEntitySpatialIndex* GetSpatialIndex() const { return SpatialIndex.Get(); }
+
+	// Position updates this worker sends aren't looped back to it, so they are reported here to keep the spatial index current.
+	void OnLocalPositionUpdate(Worker_EntityId EntityId, const SpatialGDK::Coordinates& Coords);
+
 private:
-	Worker_Authority GetAuthority(Worker_EntityId EntityId, Worker_ComponentId ComponentId) const;
+	// Authority over the well-known SpatialOS and GDK components is kept in a bitset, with a sparse fallback for the rest.
+	struct FEntityAuthority
+	{
+		uint64 WellKnownComponentBits = 0;
+		TArray<Worker_ComponentId> OtherAuthoritativeComponents;
+		uint64 Generation = 0;
+	};
+
+	SpatialGDK::FEntitySpatialIndex* GetOrCreateSpatialIndex();
 
-	TMap<Worker_EntityId_Key, TMap<Worker_ComponentId, Worker_Authority>> EntityComponentAuthorityMap;
+	TMap<Worker_EntityId_Key, FEntityAuthority> EntityAuthorityMap;
+	// Generations are unique across entities, so an entity which is removed and added again never reuses a generation.
+	uint64 LastAuthorityGeneration = 0;
 	TMap<Worker_EntityId_Key, TMap<Worker_ComponentId, TUniquePtr<SpatialGDK::Component>>> EntityComponentMap;
+
+	TUniquePtr<SpatialGDK::FEntitySpatialIndex> SpatialIndex;
 };
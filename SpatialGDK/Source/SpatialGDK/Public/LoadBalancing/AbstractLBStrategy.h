@@ -11,6 +11,13 @@
 
 #include "AbstractLBStrategy.generated.h"
 
+/** Load reported by a server worker through its ServerWorker component. */
+struct FWorkerLoadReport
+{
+	double Load = 0.0;
+	uint32 AuthoritativeActorCount = 0;
+};
+
 /**
  * This class can be used to define a load balancing strategy.
  * At runtime, all unreal workers will:
@@ -45,6 +52,12 @@ public:
 	virtual bool ShouldHaveAuthority(const AActor& Actor) const { return false; }
 	virtual VirtualWorkerId WhoShouldHaveAuthority(const AActor& Actor) const PURE_VIRTUAL(UAbstractLBStrategy::WhoShouldHaveAuthority, return SpatialConstants::INVALID_VIRTUAL_WORKER_ID;)
 
+	/**
+	* Batched version of WhoShouldHaveAuthority. Writes the virtual worker for Actors[i] to OutVirtualWorkerIds[i].
+	* The default implementation calls WhoShouldHaveAuthority for each actor; strategies can override it to evaluate all actors in one pass.
+	*/
+	virtual void WhoShouldHaveAuthority(TArrayView<const AActor*> Actors, TArrayView<VirtualWorkerId> OutVirtualWorkerIds) const;
+
 	/**
 	* Get the query constraints required by this worker based on the load balancing strategy used.
 	*/
@@ -65,6 +78,19 @@ public:
 	virtual uint32 GetMinimumRequiredWorkers() const PURE_VIRTUAL(UAbstractLBStrategy::GetMinimumRequiredWorkers, return 0;)
 	virtual void SetVirtualWorkerIds(const VirtualWorkerId& FirstVirtualWorkerId, const VirtualWorkerId& LastVirtualWorkerId) PURE_VIRTUAL(UAbstractLBStrategy::SetVirtualWorkerIds, return;)
 
+	/**
+	* Dynamic strategies move their regions at runtime based on the load reported by each virtual worker.
+	* The worker authoritative over the virtual worker translation gathers load reports every GetRebalanceInterval seconds
+	* and calls UpdateRegionsFromLoad. If that returns true, the regions are written with WriteRegionsToSchema and published
+	* through the translation component, and every worker applies them with ApplyRegionsFromSchema.
+	*/
+	virtual bool IsDynamic() const { return false; }
+	virtual float GetRebalanceInterval() const { return 0.f; }
+	virtual bool UpdateRegionsFromLoad(const TMap<VirtualWorkerId, FWorkerLoadReport>& LoadReports) { return false; }
+	virtual void WriteRegionsToSchema(Schema_Object* Object) const {}
+	/** Returns true if Object contained regions for this strategy and they were applied. */
+	virtual bool ApplyRegionsFromSchema(Schema_Object* Object) { return false; }
+
 protected:
 
 	VirtualWorkerId LocalVirtualWorkerId;
@@ -0,0 +1,143 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "LoadBalancing/AbstractLBStrategy.h"
+
+#include "CoreMinimal.h"
+#include "Math/Box2D.h"
+#include "Math/Vector2D.h"
+
+#include "AdaptiveLBStrategy.generated.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogAdaptiveLBStrategy, Log, All)
+
+/**
+ * A load balancing strategy that divides the world between NumWorkers workers with a k-d tree,
+ * and moves the split planes of the tree at runtime so that each worker simulates a similar load.
+ *
+ * The shape of the tree is fixed in Init: each node splits its workers in half along the longer
+ * side of its region, so four workers start as four quadrants. Only the split positions change.
+ *
+ * Every RebalanceInterval seconds, the worker authoritative over the virtual worker translation
+ * passes the load reported by each worker to UpdateRegionsFromLoad. If the most loaded worker is
+ * more than ImbalanceThreshold times the mean load, every split is moved towards the position that
+ * would balance the load on both sides, assuming load is spread evenly within each current region.
+ * The new split positions are published through the virtual worker translation component so that
+ * all workers agree on who should have authority.
+ *
+ * Given a Point, for each Region:
+ * Point is inside Region iff Min(Region) <= Point < Max(Region)
+ *
+ * Intended Usage: Create a data-only blueprint subclass and change
+ * the NumWorkers, WorldWidth, WorldHeight and rebalancing settings.
+ */
+UCLASS(Blueprintable, HideDropdown)
+class SPATIALGDK_API UAdaptiveLBStrategy : public UAbstractLBStrategy
+{
+	GENERATED_BODY()
+
+public:
+	UAdaptiveLBStrategy();
+
+/* UAbstractLBStrategy Interface */
+	virtual void Init() override;
+
+	virtual void SetLocalVirtualWorkerId(VirtualWorkerId InLocalVirtualWorkerId) override;
+	virtual TSet<VirtualWorkerId> GetVirtualWorkerIds() const override;
+
+	virtual bool ShouldHaveAuthority(const AActor& Actor) const override;
+	using UAbstractLBStrategy::WhoShouldHaveAuthority;
+	virtual VirtualWorkerId WhoShouldHaveAuthority(const AActor& Actor) const override;
+
+	virtual SpatialGDK::QueryConstraint GetWorkerInterestQueryConstraint() const override;
+
+	virtual bool RequiresHandoverData() const override { return NumWorkers > 1; }
+
+	virtual FVector GetWorkerEntityPosition() const override;
+
+	virtual uint32 GetMinimumRequiredWorkers() const override;
+	virtual void SetVirtualWorkerIds(const VirtualWorkerId& FirstVirtualWorkerId, const VirtualWorkerId& LastVirtualWorkerId) override;
+
+	virtual bool IsDynamic() const override { return NumWorkers > 1; }
+	virtual float GetRebalanceInterval() const override { return RebalanceInterval; }
+	virtual bool UpdateRegionsFromLoad(const TMap<VirtualWorkerId, FWorkerLoadReport>& LoadReports) override;
+	virtual void WriteRegionsToSchema(Schema_Object* Object) const override;
+	virtual bool ApplyRegionsFromSchema(Schema_Object* Object) override;
+/* End UAbstractLBStrategy Interface */
+
+	// Returns the virtual worker whose region contains Location, or INVALID_VIRTUAL_WORKER_ID if it is outside the world.
+	VirtualWorkerId GetVirtualWorkerForLocation(const FVector2D& Location) const;
+
+	// Returns the current region of VirtualWorker, or an empty box if this strategy doesn't manage it.
+	FBox2D GetRegionForVirtualWorker(VirtualWorkerId VirtualWorker) const;
+
+protected:
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "1"), Category = "Adaptive Load Balancing")
+	uint32 NumWorkers;
+
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "1"), Category = "Adaptive Load Balancing")
+	float WorldWidth;
+
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "1"), Category = "Adaptive Load Balancing")
+	float WorldHeight;
+
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "0"), Category = "Adaptive Load Balancing")
+	float InterestBorder;
+
+	/** Seconds between load measurements used to rebalance the regions. */
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "0.1"), Category = "Adaptive Load Balancing")
+	float RebalanceInterval;
+
+	/** Regions are only rebalanced when the most loaded worker exceeds the mean load by this factor. */
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "1"), Category = "Adaptive Load Balancing")
+	float ImbalanceThreshold;
+
+	/** Fraction of the distance to its balanced position that a split moves at each rebalance. Lower values move regions more smoothly. */
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "0.01", ClampMax = "1"), Category = "Adaptive Load Balancing")
+	float RebalanceRate;
+
+	/** Smallest size, in cm, that a region can shrink to along a split axis. */
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "0"), Category = "Adaptive Load Balancing")
+	float MinRegionSize;
+
+	/** How much the number of authoritative actors contributes to a worker's load, relative to the load reported by USpatialMetrics. */
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "0", ClampMax = "1"), Category = "Adaptive Load Balancing")
+	float ActorCountLoadWeight;
+
+private:
+	// Internal nodes hold a split plane; leaf nodes hold one region, in the same order as VirtualWorkerIds.
+	struct FNode
+	{
+		int32 Children[2];
+		int32 NumLeaves;
+		// Index into SplitPositions for internal nodes, into Regions for leaves.
+		int32 Index;
+		// 0 splits along x, 1 along y.
+		int32 Axis;
+
+		bool IsLeaf() const { return Children[0] == INDEX_NONE; }
+	};
+
+	TArray<VirtualWorkerId> VirtualWorkerIds;
+
+	// Nodes in depth-first order; the root is Nodes[0].
+	TArray<FNode> Nodes;
+	TArray<float> SplitPositions;
+	TArray<FBox2D> Regions;
+
+	int32 LocalRegionIndex;
+	bool bIsStrategyUsedOnLocalWorker;
+
+	FBox2D GetWorldBounds() const;
+
+	int32 BuildNode(const FBox2D& Region, int32 NumLeavesInNode, int32& NextLeafIndex);
+	void UpdateRegions(int32 NodeIndex, const FBox2D& Region);
+	void RebalanceNode(int32 NodeIndex, const FBox2D& Region, const TArray<FBox2D>& LoadRegions, const TArray<float>& LoadDensities, float& OutMaxSplitMovement);
+
+	// Returns the index into Regions of the region containing Location, or INDEX_NONE if it is outside the world.
+	int32 FindRegionIndex(const FVector2D& Location) const;
+
+	static bool IsInside(const FBox2D& Box, const FVector2D& Location);
+	static float GetLoadInBox(const FBox2D& Box, const TArray<FBox2D>& LoadRegions, const TArray<float>& LoadDensities);
+};
@@ -23,6 +23,10 @@ DECLARE_LOG_CATEGORY_EXTERN(LogGridBasedLBStrategy, Log, All)
  * Given a Point, for each Cell:
  * Point is inside Cell iff Min(Cell) <= Point < Max(Cell)
  *
+ * Rows and columns are evenly sized unless RowWeights or ColumnWeights are set.
+ * The cell containing a point is found from the row and column boundaries
+ * directly, rather than by testing every cell.
+ *
  * Intended Usage: Create a data-only blueprint subclass and change
  * the Cols, Rows, WorldWidth, WorldHeight.
  */
@@ -44,6 +48,7 @@ public:
 
 	virtual bool ShouldHaveAuthority(const AActor& Actor) const override;
 	virtual VirtualWorkerId WhoShouldHaveAuthority(const AActor& Actor) const override;
+	virtual void WhoShouldHaveAuthority(TArrayView<const AActor*> Actors, TArrayView<VirtualWorkerId> OutVirtualWorkerIds) const override;
 
 	virtual SpatialGDK::QueryConstraint GetWorkerInterestQueryConstraint() const override;
 
@@ -73,6 +78,14 @@ protected:
 	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "0"), Category = "Grid Based Load Balancing")
 	float InterestBorder;
 
+	/** Optional relative height of each row. Ignored unless it has exactly Rows entries, all positive. */
+	UPROPERTY(EditDefaultsOnly, Category = "Grid Based Load Balancing")
+	TArray<float> RowWeights;
+
+	/** Optional relative width of each column. Ignored unless it has exactly Cols entries, all positive. */
+	UPROPERTY(EditDefaultsOnly, Category = "Grid Based Load Balancing")
+	TArray<float> ColumnWeights;
+
 private:
 	TArray<VirtualWorkerId> VirtualWorkerIds;
 
@@ -80,7 +93,20 @@ private:
 	uint32 LocalCellId;
 	bool bIsStrategyUsedOnLocalWorker;
 
+	// Cell boundaries along each axis. Rows split the x-axis and columns split the y-axis,
+	// and the cell for (Row, Col) is WorkerCells[Col * Rows + Row].
+	TArray<float> XBoundaries;
+	TArray<float> YBoundaries;
+	bool bIsUniformX;
+	bool bIsUniformY;
+
 	static bool IsInside(const FBox2D& Box, const FVector2D& Location);
+
+	static TArray<float> ComputeBoundaries(float Min, float Length, uint32 NumDivisions, const TArray<float>& Weights, bool& bOutIsUniform);
+	static int32 FindInterval(const TArray<float>& Boundaries, bool bIsUniform, float Value);
+
+	// Returns the index into WorkerCells of the cell containing Location, or INDEX_NONE if it is outside the grid.
+	int32 FindCellIndex(const FVector2D& Location) const;
 };
 
 UCLASS(Blueprintable)
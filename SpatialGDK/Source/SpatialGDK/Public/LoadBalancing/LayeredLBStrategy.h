@@ -42,6 +42,7 @@ public:
 	virtual TSet<VirtualWorkerId> GetVirtualWorkerIds() const override;
 
 	virtual bool ShouldHaveAuthority(const AActor& Actor) const override;
+	using UAbstractLBStrategy::WhoShouldHaveAuthority;
 	virtual VirtualWorkerId WhoShouldHaveAuthority(const AActor& Actor) const override;
 
 	virtual SpatialGDK::QueryConstraint GetWorkerInterestQueryConstraint() const override;
@@ -52,6 +53,12 @@ public:
 
 	virtual uint32 GetMinimumRequiredWorkers() const override;
 	virtual void SetVirtualWorkerIds(const VirtualWorkerId& FirstVirtualWorkerId, const VirtualWorkerId& LastVirtualWorkerId) override;
+
+	virtual bool IsDynamic() const override;
+	virtual float GetRebalanceInterval() const override;
+	virtual bool UpdateRegionsFromLoad(const TMap<VirtualWorkerId, FWorkerLoadReport>& LoadReports) override;
+	virtual void WriteRegionsToSchema(Schema_Object* Object) const override;
+	virtual bool ApplyRegionsFromSchema(Schema_Object* Object) override;
 	/* End UAbstractLBStrategy Interface */
 
 	// This is provided to support the offloading interface in SpatialStatics. It should be removed once users
@@ -25,6 +25,9 @@ struct ClientEndpoint : Component
 	uint64 ReliableRPCAck = 0;
 	uint64 UnreliableRPCAck = 0;
 
+	// Incremented for each update applied, which sets the LastChangedTick of the buffers it changes.
+	uint64 UpdateTick = 0;
+
 private:
 	void ReadFromSchema(Schema_Object* SchemaObject);
 };
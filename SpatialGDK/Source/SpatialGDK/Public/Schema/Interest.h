@@ -13,33 +13,63 @@ struct SphereConstraint
 {
 	Coordinates Center;
 	double Radius;
+
+	bool operator==(const SphereConstraint& Other) const
+	{
+		return Center == Other.Center && Radius == Other.Radius;
+	}
 };
 
 struct CylinderConstraint
 {
 	Coordinates Center;
 	double Radius;
+
+	bool operator==(const CylinderConstraint& Other) const
+	{
+		return Center == Other.Center && Radius == Other.Radius;
+	}
 };
 
 struct BoxConstraint
 {
 	Coordinates Center;
 	EdgeLength EdgeLength;
+
+	bool operator==(const BoxConstraint& Other) const
+	{
+		return Center == Other.Center && EdgeLength == Other.EdgeLength;
+	}
 };
 
 struct RelativeSphereConstraint
 {
 	double Radius;
+
+	bool operator==(const RelativeSphereConstraint& Other) const
+	{
+		return Radius == Other.Radius;
+	}
 };
 
 struct RelativeCylinderConstraint
 {
 	double Radius;
+
+	bool operator==(const RelativeCylinderConstraint& Other) const
+	{
+		return Radius == Other.Radius;
+	}
 };
 
 struct RelativeBoxConstraint
 {
 	EdgeLength EdgeLength;
+
+	bool operator==(const RelativeBoxConstraint& Other) const
+	{
+		return EdgeLength == Other.EdgeLength;
+	}
 };
 
 struct QueryConstraint
@@ -104,8 +134,97 @@ struct QueryConstraint
 
 		return false;
 	}
+
+	bool operator==(const QueryConstraint& Other) const
+	{
+		return SphereConstraint == Other.SphereConstraint
+			&& CylinderConstraint == Other.CylinderConstraint
+			&& BoxConstraint == Other.BoxConstraint
+			&& RelativeSphereConstraint == Other.RelativeSphereConstraint
+			&& RelativeCylinderConstraint == Other.RelativeCylinderConstraint
+			&& RelativeBoxConstraint == Other.RelativeBoxConstraint
+			&& EntityIdConstraint == Other.EntityIdConstraint
+			&& ComponentConstraint == Other.ComponentConstraint
+			&& AndConstraint == Other.AndConstraint
+			&& OrConstraint == Other.OrConstraint;
+	}
+
+	bool operator!=(const QueryConstraint& Other) const
+	{
+		return !(*this == Other);
+	}
 };
 
+// Hashes the whole constraint tree, so equal constraints can share cached state.
+inline uint32 GetTypeHash(const QueryConstraint& Constraint)
+{
+	uint32 Hash = 0;
+
+	auto CombineCoordinates = [&Hash](const Coordinates& Coords)
+	{
+		Hash = HashCombine(Hash, ::GetTypeHash(Coords.X));
+		Hash = HashCombine(Hash, ::GetTypeHash(Coords.Y));
+		Hash = HashCombine(Hash, ::GetTypeHash(Coords.Z));
+	};
+
+	// Each option is tagged with its field number, so different constraints with equal values don't hash the same.
+	if (Constraint.SphereConstraint.IsSet())
+	{
+		Hash = HashCombine(Hash, 1);
+		CombineCoordinates(Constraint.SphereConstraint->Center);
+		Hash = HashCombine(Hash, ::GetTypeHash(Constraint.SphereConstraint->Radius));
+	}
+	if (Constraint.CylinderConstraint.IsSet())
+	{
+		Hash = HashCombine(Hash, 2);
+		CombineCoordinates(Constraint.CylinderConstraint->Center);
+		Hash = HashCombine(Hash, ::GetTypeHash(Constraint.CylinderConstraint->Radius));
+	}
+	if (Constraint.BoxConstraint.IsSet())
+	{
+		Hash = HashCombine(Hash, 3);
+		CombineCoordinates(Constraint.BoxConstraint->Center);
+		CombineCoordinates(Constraint.BoxConstraint->EdgeLength);
+	}
+	if (Constraint.RelativeSphereConstraint.IsSet())
+	{
+		Hash = HashCombine(Hash, 4);
+		Hash = HashCombine(Hash, ::GetTypeHash(Constraint.RelativeSphereConstraint->Radius));
+	}
+	if (Constraint.RelativeCylinderConstraint.IsSet())
+	{
+		Hash = HashCombine(Hash, 5);
+		Hash = HashCombine(Hash, ::GetTypeHash(Constraint.RelativeCylinderConstraint->Radius));
+	}
+	if (Constraint.RelativeBoxConstraint.IsSet())
+	{
+		Hash = HashCombine(Hash, 6);
+		CombineCoordinates(Constraint.RelativeBoxConstraint->EdgeLength);
+	}
+	if (Constraint.EntityIdConstraint.IsSet())
+	{
+		Hash = HashCombine(Hash, 7);
+		Hash = HashCombine(Hash, ::GetTypeHash(*Constraint.EntityIdConstraint));
+	}
+	if (Constraint.ComponentConstraint.IsSet())
+	{
+		Hash = HashCombine(Hash, 8);
+		Hash = HashCombine(Hash, ::GetTypeHash(*Constraint.ComponentConstraint));
+	}
+	for (const QueryConstraint& AndConstraintEntry : Constraint.AndConstraint)
+	{
+		Hash = HashCombine(Hash, 9);
+		Hash = HashCombine(Hash, GetTypeHash(AndConstraintEntry));
+	}
+	for (const QueryConstraint& OrConstraintEntry : Constraint.OrConstraint)
+	{
+		Hash = HashCombine(Hash, 10);
+		Hash = HashCombine(Hash, GetTypeHash(OrConstraintEntry));
+	}
+
+	return Hash;
+}
+
 struct Query
 {
 	QueryConstraint Constraint;
@@ -130,6 +249,14 @@ struct Query
 	// If multiple queries match the same Entity-Component then the highest of all frequencies is
 	// used.
 	TSchemaOption<float> Frequency;
+
+	bool operator==(const Query& Other) const
+	{
+		return Constraint == Other.Constraint
+			&& FullSnapshotResult == Other.FullSnapshotResult
+			&& ResultComponentIds == Other.ResultComponentIds
+			&& Frequency == Other.Frequency;
+	}
 };
 
 // Constraints are typically linked to a corresponding frequency in the GDK use case, but without the result set yet.
@@ -148,6 +275,11 @@ using FrequencyConstraints = TArray<FrequencyConstraint>;
 struct ComponentInterest
 {
 	TArray<Query> Queries;
+
+	bool operator==(const ComponentInterest& Other) const
+	{
+		return Queries == Other.Queries;
+	}
 };
 
 inline void AddQueryConstraintToQuerySchema(Schema_Object* QueryObject, Schema_FieldId Id, const QueryConstraint& Constraint)
@@ -436,6 +568,16 @@ struct Interest : Component
 		return ComponentInterestMap.Num() == 0;
 	}
 
+	bool operator==(const Interest& Other) const
+	{
+		return ComponentInterestMap.OrderIndependentCompareEqual(Other.ComponentInterestMap);
+	}
+
+	bool operator!=(const Interest& Other) const
+	{
+		return !(*this == Other);
+	}
+
 	void ApplyComponentUpdate(const Worker_ComponentUpdate& Update)
 	{
 		Schema_Object* ComponentObject = Schema_GetComponentUpdateFields(Update.schema_type);
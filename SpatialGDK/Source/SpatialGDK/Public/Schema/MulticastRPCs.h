@@ -23,6 +23,9 @@ struct MulticastRPCs : Component
 	RPCRingBuffer MulticastRPCBuffer;
 	uint32 InitiallyPresentMulticastRPCsCount = 0;
 
+	// Incremented for each update applied, which sets the LastChangedTick of the buffer if it changes it.
+	uint64 UpdateTick = 0;
+
 private:
 	void ReadFromSchema(Schema_Object* SchemaObject);
 };
@@ -155,12 +155,15 @@ const Schema_FieldId UNREAL_OBJECT_REF_PATH_ID							= 3;
 const Schema_FieldId UNREAL_OBJECT_REF_NO_LOAD_ON_CLIENT_ID				= 4;
 const Schema_FieldId UNREAL_OBJECT_REF_OUTER_ID							= 5;
 const Schema_FieldId UNREAL_OBJECT_REF_USE_CLASS_PATH_TO_LOAD_ID		= 6;
+const Schema_FieldId UNREAL_OBJECT_REF_INTERNED_PATH_ID					= 7;
 
 // UnrealRPCPayload Field IDs
 const Schema_FieldId UNREAL_RPC_PAYLOAD_OFFSET_ID						= 1;
 const Schema_FieldId UNREAL_RPC_PAYLOAD_RPC_INDEX_ID					= 2;
 const Schema_FieldId UNREAL_RPC_PAYLOAD_RPC_PAYLOAD_ID					= 3;
 const Schema_FieldId UNREAL_RPC_PAYLOAD_TRACE_ID						= 4;
+const Schema_FieldId UNREAL_RPC_PAYLOAD_PACKED_FIRST_RPC_ID_ID			= 5;
+const Schema_FieldId UNREAL_RPC_PAYLOAD_PACKED_RPC_PAYLOADS_ID			= 6;
 
 const Schema_FieldId UNREAL_RPC_TRACE_ID								= 1;
 const Schema_FieldId UNREAL_RPC_SPAN_ID									= 2;
@@ -180,6 +183,9 @@ const Schema_FieldId VIRTUAL_WORKER_TRANSLATION_MAPPING_ID				= 1;
 const Schema_FieldId MAPPING_VIRTUAL_WORKER_ID							= 1;
 const Schema_FieldId MAPPING_PHYSICAL_WORKER_NAME						= 2;
 const Schema_FieldId MAPPING_SERVER_WORKER_ENTITY_ID					= 3;
+const Schema_FieldId VIRTUAL_WORKER_TRANSLATION_LOAD_BALANCING_REGIONS_ID	= 2;
+const Schema_FieldId LOAD_BALANCING_REGIONS_FIRST_VIRTUAL_WORKER_ID		= 1;
+const Schema_FieldId LOAD_BALANCING_REGIONS_SPLIT_POSITIONS_ID			= 2;
 const PhysicalWorkerName TRANSLATOR_UNSET_PHYSICAL_NAME = FString("UnsetWorkerName");
 
 // WorkerEntity Field IDs.
@@ -196,6 +202,8 @@ const Schema_FieldId SPATIAL_DEBUGGING_IS_LOCKED                         = 5;
 // ServerWorker Field IDs.
 const Schema_FieldId SERVER_WORKER_NAME_ID								 = 1;
 const Schema_FieldId SERVER_WORKER_READY_TO_BEGIN_PLAY_ID				 = 2;
+const Schema_FieldId SERVER_WORKER_LOAD_ID								 = 3;
+const Schema_FieldId SERVER_WORKER_AUTHORITATIVE_ACTOR_COUNT_ID			 = 4;
 const Schema_FieldId SERVER_WORKER_FORWARD_SPAWN_REQUEST_COMMAND_ID		 = 1;
 
 // SpawnPlayerRequest type IDs.
@@ -12,6 +12,7 @@
 
 DECLARE_LOG_CATEGORY_EXTERN(LogSpatialGDKSettings, Log, All);
 
+class AActor;
 class ASpatialDebugger;
 
 /**
@@ -223,6 +224,24 @@ public:
 	UPROPERTY(Config)
 	bool bRunSpatialWorkerConnectionOnGameThread;
 
+	/**
+	 * EXPERIMENTAL: The worker ops thread blocks waiting for ops instead of polling at the SpatialOS Network Update Rate, and hands
+	 * them to the game thread through a lock-free ring. Lowers the latency of incoming ops at the cost of keeping the ops thread busier.
+	 */
+	UPROPERTY(Config)
+	bool bUseLowLatencyOpListHandoff;
+
+	/**
+	 * How long the worker ops thread blocks waiting for ops when bUseLowLatencyOpListHandoff is enabled. Outgoing messages are sent
+	 * between waits, so with bWorkerFlushAfterOutgoingNetworkOp a flush can wait up to this long before the messages are sent.
+	 */
+	UPROPERTY(Config, meta = (ClampMin = "1"))
+	uint32 OpListHandoffTimeoutMs;
+
+	/** Number of op lists the worker ops thread can hand off before the game thread takes them, when bUseLowLatencyOpListHandoff is enabled. */
+	UPROPERTY(Config, meta = (ClampMin = "1"))
+	uint32 OpListHandoffCapacity;
+
 	/** RPC ring buffers is enabled when either the matching setting is set, or load balancing is enabled */
 	bool UseRPCRingBuffer() const;
 
@@ -246,6 +265,8 @@ private:
 public:
 	uint32 GetRPCRingBufferSize(ERPCType RPCType) const;
 
+	uint32 GetRPCRingBufferPayloadsPerSlot(ERPCType RPCType) const;
+
 	float GetSecondsBeforeWarning(const ERPCResult Result) const;
 
 	bool ShouldRPCTypeAllowUnresolvedParameters(const ERPCType Type) const;
@@ -254,6 +275,18 @@ public:
 	UPROPERTY(EditAnywhere, Config, Category = "Replication", meta = (DisplayName = "Max RPC Ring Buffer Size"))
 	uint32 MaxRPCRingBufferSize;
 
+	/** The number of RPCs that can be packed into one ring buffer field. Values above 1 let a ring buffer hold more RPCs than MaxRPCRingBufferSize without regenerating schema. Must match on all workers. */
+	UPROPERTY(EditAnywhere, Config, Category = "Replication", meta = (DisplayName = "Default RPC Ring Buffer Payloads Per Field", ClampMin = "1"))
+	uint32 DefaultRPCRingBufferPayloadsPerSlot;
+
+	/** Overrides default number of RPCs packed into one ring buffer field. */
+	UPROPERTY(EditAnywhere, Config, Category = "Replication", meta = (DisplayName = "RPC Ring Buffer Payloads Per Field Map"))
+	TMap<ERPCType, uint32> RPCRingBufferPayloadsPerSlotMap;
+
+	/** Maximum memory, in bytes, held by RPCs waiting for space in their ring buffer. Unreliable RPCs are dropped oldest first to stay under it, and reliable RPCs are retried later when it is reached. */
+	UPROPERTY(EditAnywhere, Config, Category = "Replication", meta = (DisplayName = "RPC Overflow Queue Max Bytes"))
+	uint32 RPCOverflowQueueMaxBytes;
+
 	/** Only valid on Tcp connections - indicates if we should enable TCP_NODELAY - see c_worker.h */
 	UPROPERTY(Config)
 	bool bTcpNoDelay;
@@ -270,6 +303,101 @@ public:
 	UPROPERTY(Config)
 	bool bWorkerFlushAfterOutgoingNetworkOp;
 
+	/**
+	 * Merge component updates sent to the same entity and component during a tick into a single update before
+	 * they are passed to the worker connection. Reduces the number of outgoing messages, but updates to different
+	 * components on the same entity are no longer guaranteed to be sent in the order they were made.
+	 */
+	UPROPERTY(Config)
+	bool bCoalesceComponentUpdates;
+
+	/**
+	 * Serialize component updates for replicated actors on the task graph. Changelists are still built on the game thread,
+	 * then serialized in parallel and sent in a deterministic order once all actors have been processed. Changelists that
+	 * contain object references, fast arrays or most structs are always serialized on the game thread.
+	 */
+	UPROPERTY(Config)
+	bool bEnableParallelComponentSerialization;
+
+	/** Minimum number of objects each parallel serialization task processes. Smaller batches are serialized on the game thread. */
+	UPROPERTY(Config)
+	int32 ParallelComponentSerializationMinObjectsPerTask;
+
+	/**
+	 * EXPERIMENTAL: Consecutive component updates in each op list are grouped by entity before they are applied, so each
+	 * object gets one replication update and one round of RepNotifies per group. Updates to an entity keep their order,
+	 * but updates to different entities are applied in entity ID order.
+	 */
+	UPROPERTY(Config)
+	bool bBatchComponentUpdatesByEntity;
+
+	/**
+	 * EXPERIMENTAL: Remember the interest last sent for each actor this worker is authoritative over, and don't send
+	 * interest updates that wouldn't change it, such as those caused by ownership or possession changes that leave
+	 * the queries the same.
+	 */
+	UPROPERTY(Config)
+	bool bSkipUnchangedInterestUpdates;
+
+	/**
+	 * EXPERIMENTAL: Keep a uniform grid of the SpatialOS positions of entities in the view, which can be queried through
+	 * USpatialStaticComponentView::GetSpatialIndex. When "Only Replicate Net Relevant Actors" is also enabled, servers use it
+	 * to skip the relevancy checks of actors that are too far from every viewer to be relevant by distance.
+	 */
+	UPROPERTY(Config)
+	bool bEnableEntitySpatialIndex;
+
+	/** Width of each spatial index cell, in SpatialOS units. Cells should be around the size of a typical query radius. */
+	UPROPERTY(Config)
+	float EntitySpatialIndexCellSize;
+
+	/**
+	 * Distance, in centimeters, added to net cull distances when finding actors near viewers with the spatial index. Entity
+	 * positions are only updated as often as Position updates are sent, so this must cover how far an actor can move between them.
+	 */
+	UPROPERTY(Config)
+	float EntitySpatialIndexRelevancyMargin;
+
+	/**
+	 * Radius, in centimeters and before the margin is added, of the spatial index query for actors near viewers. Actors with
+	 * a larger net cull distance are never skipped, and are checked for relevancy as usual.
+	 */
+	UPROPERTY(Config)
+	float EntitySpatialIndexMaxRelevancyQueryDistance;
+
+	/**
+	 * Actor classes, and their subclasses, whose relevancy only depends on the checks AActor::IsNetRelevantFor makes, so
+	 * they can be skipped when the spatial index finds them further than their net cull distance from every viewer. Classes
+	 * overriding IsNetRelevantFor must not be added. Pawns are never skipped, as APawn overrides it.
+	 */
+	UPROPERTY(Config)
+	TArray<TSoftClassPtr<AActor>> DistanceOnlyRelevancyActorClasses;
+
+	/**
+	 * EXPERIMENTAL: Keep the state read when prioritizing actors for replication in a persistent table, and compute priorities
+	 * in one pass over it instead of calling AActor::GetNetPriority for every actor and viewer. Overrides of GetNetPriority are
+	 * not called, except for actors using their owner's relevancy, and in low bandwidth mode.
+	 */
+	UPROPERTY(Config)
+	bool bUseActorPriorityTable;
+
+	/**
+	 * EXPERIMENTAL: Process queued incoming RPCs waiting on unresolved object references when those references are resolved,
+	 * instead of retrying every queued RPC whenever any object is resolved. Waiting RPCs are only retried periodically once
+	 * they have been queued for longer than QueuedIncomingRPCWaitTime.
+	 */
+	UPROPERTY(Config)
+	bool bResolveQueuedRPCsOnObjectResolution;
+
+	/**
+	 * EXPERIMENTAL: Send the paths of stably named objects in object refs as IDs into a table of paths seeded from the schema
+	 * database, instead of as strings. Paths not in the table are still sent as strings. IDs received in component data are
+	 * resolved regardless of this setting, but RPC payloads and other net serialized data are only written in the interned
+	 * format while it is enabled, so every worker must use the same setting.
+	 */
+	UPROPERTY(Config)
+	bool bInternObjectRefPaths;
+
 	/** Do async loading for new classes when checking out entities. */
 	UPROPERTY(Config)
 	bool bAsyncLoadNewClassesOnEntityCheckout;
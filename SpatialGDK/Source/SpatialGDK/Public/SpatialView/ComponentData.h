@@ -25,6 +25,8 @@ struct ComponentDataDeleter
 using OwningComponentDataPtr = TUniquePtr<Schema_ComponentData, ComponentDataDeleter>;
 
 // An RAII wrapper for component data.
+// May also be created as a non-owning view of component data owned elsewhere, for example by an op list.
+// A view is converted to an owning copy the first time it is mutated or released.
 class ComponentData
 {
 public:
@@ -37,23 +39,31 @@ public:
 
 	// Moveable, not copyable.
 	ComponentData(const ComponentData&) = delete;
-	ComponentData(ComponentData&&) = default;
+	ComponentData(ComponentData&& Other);
 	ComponentData& operator=(const ComponentData&) = delete;
-	ComponentData& operator=(ComponentData&&) = default;
+	ComponentData& operator=(ComponentData&& Other);
 
 	static ComponentData CreateCopy(const Schema_ComponentData* Data, Worker_ComponentId Id);
+	// Creates a non-owning view of the component data.
+	// The caller must ensure Data outlives the returned object or any view it is moved into.
+	static ComponentData CreateView(Schema_ComponentData* Data, Worker_ComponentId Id);
 
 	// Creates a copy of the component data.
 	ComponentData DeepCopy() const;
 	// Releases ownership of the component data.
+	// If this is a view, a copy of the viewed data is returned.
 	Schema_ComponentData* Release() &&;
 
 	// Appends the fields from the provided update.
 	// Returns true if the update was successfully applied and false otherwise.
 	// This will cause the size of the component data to increase.
 	// To resize use DeepCopy to create a new data object with the serialized size of the data.
+	// If this is a view, the viewed data is copied before the update is applied.
 	bool ApplyUpdate(const ComponentUpdate& Update);
 
+	// Returns true if this object owns its underlying data, false if it is a view.
+	bool IsOwning() const;
+
 	Schema_Object* GetFields() const;
 
 	Schema_ComponentData* GetUnderlying() const;
@@ -62,8 +72,15 @@ public:
 	Worker_ComponentId GetComponentId() const;
 
 private:
+	explicit ComponentData(Schema_ComponentData* ViewedData, Worker_ComponentId Id);
+
+	// Replaces a view with an owning copy of the viewed data.
+	void MakeOwning();
+
 	Worker_ComponentId ComponentId;
 	OwningComponentDataPtr Data;
+	// Points to the owned data or, for a view, the data owned elsewhere.
+	Schema_ComponentData* Underlying;
 };
 
 } // namespace SpatialGDK
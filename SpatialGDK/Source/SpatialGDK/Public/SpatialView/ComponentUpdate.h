@@ -23,6 +23,8 @@ struct ComponentUpdateDeleter
 using OwningComponentUpdatePtr = TUniquePtr<Schema_ComponentUpdate, ComponentUpdateDeleter>;
 
 // An RAII wrapper for component updates.
+// May also be created as a non-owning view of an update owned elsewhere, for example by an op list.
+// A view is converted to an owning copy the first time it is mutated or released.
 class ComponentUpdate
 {
 public:
@@ -35,20 +37,28 @@ public:
 
 	// Moveable, not copyable.
 	ComponentUpdate(const ComponentUpdate&) = delete;
-	ComponentUpdate(ComponentUpdate&&) = default;
+	ComponentUpdate(ComponentUpdate&& Other);
 	ComponentUpdate& operator=(const ComponentUpdate&) = delete;
-	ComponentUpdate& operator=(ComponentUpdate&&) = default;
+	ComponentUpdate& operator=(ComponentUpdate&& Other);
 
 	static ComponentUpdate CreateCopy(const Schema_ComponentUpdate* Update, Worker_ComponentId Id);
+	// Creates a non-owning view of the component update.
+	// The caller must ensure Update outlives the returned object or any view it is moved into.
+	static ComponentUpdate CreateView(Schema_ComponentUpdate* Update, Worker_ComponentId Id);
 
 	// Creates a copy of the component update.
 	ComponentUpdate DeepCopy() const;
 	// Releases ownership of the component update.
+	// If this is a view, a copy of the viewed update is returned.
 	Schema_ComponentUpdate* Release() &&;
 
 	// Appends the fields and events from other to the update.
+	// If this is a view, the viewed update is copied before merging.
 	bool Merge(ComponentUpdate Update);
 
+	// Returns true if this object owns its underlying update, false if it is a view.
+	bool IsOwning() const;
+
 	Schema_Object* GetFields() const;
 	Schema_Object* GetEvents() const;
 
@@ -58,8 +68,15 @@ public:
 	Worker_ComponentId GetComponentId() const;
 
 private:
+	explicit ComponentUpdate(Schema_ComponentUpdate* ViewedUpdate, Worker_ComponentId Id);
+
+	// Replaces a view with an owning copy of the viewed update.
+	void MakeOwning();
+
 	Worker_ComponentId ComponentId;
 	OwningComponentUpdatePtr Update;
+	// Points to the owned update or, for a view, the update owned elsewhere.
+	Schema_ComponentUpdate* Underlying;
 };
 
 } // namespace SpatialGDK
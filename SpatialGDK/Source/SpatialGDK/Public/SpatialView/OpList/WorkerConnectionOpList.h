@@ -29,9 +29,9 @@ struct WorkerConnectionOpListData : OpListData
 	}
 };
 
-inline OpList GetOpListFromConnection(Worker_Connection* Connection)
+inline OpList GetOpListFromConnection(Worker_Connection* Connection, uint32 TimeoutMillis = 0)
 {
-	Worker_OpList* Ops = Worker_Connection_GetOpList(Connection, 0);
+	Worker_OpList* Ops = Worker_Connection_GetOpList(Connection, TimeoutMillis);
 	return {Ops->ops, Ops->op_count, MakeUnique<WorkerConnectionOpListData>(Ops)};
 }
 
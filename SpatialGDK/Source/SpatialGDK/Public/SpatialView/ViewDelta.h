@@ -54,6 +54,8 @@ private:
 	EntityPresenceRecord EntityPresenceChanges;
 	EntityComponentRecord EntityComponentChanges;
 
+	// Component data and updates recorded in this delta are views into these op lists
+	// so they must be kept alive for the lifetime of the delta.
 	TArray<OpList> OpLists;
 
 	uint8 ConnectionStatus = 0;
@@ -0,0 +1,70 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+class UActorChannel;
+struct FNetViewer;
+
+namespace SpatialGDK
+{
+
+/**
+ * Persistent structure-of-arrays table of the actor state read when prioritizing actors for replication.
+ *
+ * Each replicated actor has one row, which keeps its index until the actor is removed. Rows are refreshed from their actor
+ * once per frame while the actor is being considered for replication, after which filtering and prioritization are passes
+ * over contiguous columns instead of calls through each actor.
+ *
+ * Priorities are computed with the formula of AActor::GetNetPriority. Rows for actors which defer to their owner's priority
+ * are flagged so the caller can fall back to the engine.
+ */
+class SPATIALGDK_API FActorPriorityTable
+{
+public:
+	enum ERowFlags : uint8
+	{
+		// The actor is hidden or has no root component, so its location doesn't affect its priority.
+		NoLocation = 1 << 0,
+		// The actor has an open actor channel, so its priority grows with the time since it was last replicated.
+		HasChannel = 1 << 1,
+		// The actor uses its owner's priority, which this table can't compute.
+		UsesOwnerPriority = 1 << 2
+	};
+
+	// Returns the actor's row, adding one if it has none.
+	int32 FindOrAddRow(AActor* Actor);
+	void RemoveRow(const AActor* Actor);
+
+	// Adds a row which isn't looked up by actor. Used to fill the table with synthetic data.
+	int32 AddUnmappedRow();
+
+	int32 Num() const { return Flags.Num(); }
+
+	// Copies the actor's current state into its row.
+	void UpdateRow(int32 Row, const AActor* Actor, const UActorChannel* Channel);
+
+	void SetRow(int32 Row, const FVector& Location, float NetPriority, double LastUpdateTime, const AActor* Instigator, uint8 RowFlags);
+
+	uint8 GetFlags(int32 Row) const { return Flags[Row]; }
+
+	// Computes the priority of each row as FActorPriority would, taking the highest priority over all viewers.
+	// Rows must not be flagged UsesOwnerPriority.
+	void ComputePriorities(TArrayView<const int32> Rows, TArrayView<const FNetViewer> Viewers, double ElapsedTime, float SpawnPrioritySeconds, TArray<int32>& OutPriorities) const;
+
+private:
+	TArray<const AActor*> Actors;
+	TArray<float> LocationX;
+	TArray<float> LocationY;
+	TArray<float> LocationZ;
+	TArray<float> NetPriorities;
+	TArray<double> LastUpdateTimes;
+	TArray<const AActor*> Instigators;
+	TArray<uint8> Flags;
+
+	TMap<const AActor*, int32> ActorToRow;
+};
+
+} // namespace SpatialGDK
@@ -6,6 +6,7 @@
 #include "Schema/Interest.h"
 #include "Utils/GDKPropertyMacros.h"
 #include "Utils/RepDataUtils.h"
+#include "Utils/SchemaFieldInfo.h"
 
 #include <WorkerSDK/improbable/c_schema.h>
 #include <WorkerSDK/improbable/c_worker.h>
@@ -33,21 +34,29 @@ public:
 	TArray<FWorkerComponentData> CreateComponentDatas(UObject* Object, const FClassInfo& Info, const FRepChangeState& RepChangeState, const FHandoverChangeState& HandoverChangeState, uint32& OutBytesWritten);
 	TArray<FWorkerComponentUpdate> CreateComponentUpdates(UObject* Object, const FClassInfo& Info, Worker_EntityId EntityId, const FRepChangeState* RepChangeState, const FHandoverChangeState* HandoverChangeState, uint32& OutBytesWritten);
 
+	// Creates updates for changed properties from a copy of their values, held at the same offsets as in an object of the class.
+	// The changes must not include fast arrays, and interest and latency traces are not handled.
+	TArray<FWorkerComponentUpdate> CreateComponentUpdatesFromSnapshot(const uint8* Snapshot, const FClassInfo& Info, const FRepChangeState* RepChangeState, const FHandoverChangeState* HandoverChangeState, uint32& OutBytesWritten);
+
 	FWorkerComponentData CreateHandoverComponentData(Worker_ComponentId ComponentId, UObject* Object, const FClassInfo& Info, const FHandoverChangeState& Changes, uint32& OutBytesWritten);
 
 	static FWorkerComponentData CreateEmptyComponentData(Worker_ComponentId ComponentId);
 
 private:
-	FWorkerComponentData CreateComponentData(Worker_ComponentId ComponentId, UObject* Object, const FRepChangeState& Changes, ESchemaComponentType PropertyGroup, uint32& OutBytesWritten);
-	FWorkerComponentUpdate CreateComponentUpdate(Worker_ComponentId ComponentId, UObject* Object, const FRepChangeState& Changes, ESchemaComponentType PropertyGroup, uint32& OutBytesWritten);
+	FWorkerComponentData CreateComponentData(Worker_ComponentId ComponentId, UObject* Object, const FClassInfo& Info, const FRepChangeState& Changes, ESchemaComponentType PropertyGroup, uint32& OutBytesWritten);
+	// Property values are read from ObjectData. Object is only used for latency traces and fast arrays, and is null for snapshots.
+	void AddPropertyComponentUpdates(UObject* Object, const uint8* ObjectData, const FClassInfo& Info, const FRepChangeState* RepChangeState, const FHandoverChangeState* HandoverChangeState, uint32& OutBytesWritten, TArray<FWorkerComponentUpdate>& OutUpdates);
+
+	FWorkerComponentUpdate CreateComponentUpdate(Worker_ComponentId ComponentId, UObject* Object, const uint8* ObjectData, const FClassInfo& Info, const FRepChangeState& Changes, ESchemaComponentType PropertyGroup, uint32& OutBytesWritten);
 
-	uint32 FillSchemaObject(Schema_Object* ComponentObject, UObject* Object, const FRepChangeState& Changes, ESchemaComponentType PropertyGroup, bool bIsInitialData, TraceKey* OutLatencyTraceId, TArray<Schema_FieldId>* ClearedIds = nullptr);
+	uint32 FillSchemaObject(Schema_Object* ComponentObject, UObject* Object, const uint8* ObjectData, const FClassInfo& Info, const FRepChangeState& Changes, ESchemaComponentType PropertyGroup, bool bIsInitialData, TraceKey* OutLatencyTraceId, TArray<Schema_FieldId>* ClearedIds = nullptr);
 
-	FWorkerComponentUpdate CreateHandoverComponentUpdate(Worker_ComponentId ComponentId, UObject* Object, const FClassInfo& Info, const FHandoverChangeState& Changes, uint32& OutBytesWritten);
+	FWorkerComponentUpdate CreateHandoverComponentUpdate(Worker_ComponentId ComponentId, UObject* Object, const uint8* ObjectData, const FClassInfo& Info, const FHandoverChangeState& Changes, uint32& OutBytesWritten);
 
-	uint32 FillHandoverSchemaObject(Schema_Object* ComponentObject, UObject* Object, const FClassInfo& Info, const FHandoverChangeState& Changes, bool bIsInitialData, TraceKey* OutLatencyTraceId, TArray<Schema_FieldId>* ClearedIds = nullptr);
+	uint32 FillHandoverSchemaObject(Schema_Object* ComponentObject, UObject* Object, const uint8* ObjectData, const FClassInfo& Info, const FHandoverChangeState& Changes, bool bIsInitialData, TraceKey* OutLatencyTraceId, TArray<Schema_FieldId>* ClearedIds = nullptr);
 
-	void AddProperty(Schema_Object* Object, Schema_FieldId FieldId, GDK_PROPERTY(Property)* Property, const uint8* Data, TArray<Schema_FieldId>* ClearedIds);
+	void AddProperty(Schema_Object* Object, Schema_FieldId FieldId, const FSchemaFieldInfo& FieldInfo, const uint8* Data, TArray<Schema_FieldId>* ClearedIds);
+	void AddValue(Schema_Object* Object, Schema_FieldId FieldId, ESchemaFieldType Type, GDK_PROPERTY(Property)* Property, const uint8* Data);
 
 	USpatialNetDriver* NetDriver;
 	USpatialPackageMapClient* PackageMap;
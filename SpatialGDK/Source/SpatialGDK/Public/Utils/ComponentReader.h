@@ -5,6 +5,7 @@
 #include "EngineClasses/SpatialNetBitReader.h"
 #include "Interop/SpatialReceiver.h"
 #include "Utils/GDKPropertyMacros.h"
+#include "Utils/SchemaFieldInfo.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogSpatialComponentReader, All, All);
 
@@ -19,20 +20,39 @@ public:
 	void ApplyComponentData(const Worker_ComponentData& ComponentData, UObject& Object, USpatialActorChannel& Channel, bool bIsHandover, bool& bOutReferencesChanged);
 	void ApplyComponentUpdate(const Worker_ComponentUpdate& ComponentUpdate, UObject& Object, USpatialActorChannel& Channel, bool bIsHandover, bool& bOutReferencesChanged);
 
+	// Between these calls, updates applied to Object share one PreReceiveSpatialUpdate / PostReceiveSpatialUpdate pair,
+	// and RepNotifies are collected and called once by EndDeferredUpdates with the values from before the first update.
+	void BeginDeferredUpdates();
+	void EndDeferredUpdates(UObject& Object, USpatialActorChannel& Channel);
+
 private:
+	FObjectReplicator* PreReceive(UObject& Object, USpatialActorChannel& Channel);
+	void PostReceive(UObject& Object, USpatialActorChannel& Channel, FObjectReplicator& Replicator, TArray<GDK_PROPERTY(Property)*>& RepNotifies);
+
+	// Returns false if the shadow value of the command was already stored during the current deferred updates.
+	bool ShouldStoreShadowValue(int32 CmdIndex, int32 NumCmds);
+
 	void ApplySchemaObject(Schema_Object* ComponentObject, UObject& Object, USpatialActorChannel& Channel, bool bIsInitialData, const TArray<Schema_FieldId>& UpdatedIds, Worker_ComponentId ComponentId, bool& bOutReferencesChanged);
 	void ApplyHandoverSchemaObject(Schema_Object* ComponentObject, UObject& Object, USpatialActorChannel& Channel, bool bIsInitialData, const TArray<Schema_FieldId>& UpdatedIds, Worker_ComponentId ComponentId, bool& bOutReferencesChanged);
 
-	void ApplyProperty(Schema_Object* Object, Schema_FieldId FieldId, FObjectReferencesMap& InObjectReferencesMap, uint32 Index, GDK_PROPERTY(Property)* Property, uint8* Data, int32 Offset, int32 CmdIndex, int32 ParentIndex, bool& bOutReferencesChanged);
-	void ApplyArray(Schema_Object* Object, Schema_FieldId FieldId, FObjectReferencesMap& InObjectReferencesMap, GDK_PROPERTY(ArrayProperty)* Property, uint8* Data, int32 Offset, int32 CmdIndex, int32 ParentIndex, bool& bOutReferencesChanged);
+	void ApplyProperty(Schema_Object* Object, Schema_FieldId FieldId, FObjectReferencesMap& InObjectReferencesMap, uint32 Index, ESchemaFieldType Type, GDK_PROPERTY(Property)* Property, uint8* Data, int32 Offset, int32 CmdIndex, int32 ParentIndex, bool& bOutReferencesChanged);
+	void ApplyArray(Schema_Object* Object, Schema_FieldId FieldId, FObjectReferencesMap& InObjectReferencesMap, GDK_PROPERTY(ArrayProperty)* Property, const FSchemaFieldInfo& FieldInfo, uint8* Data, int32 Offset, int32 CmdIndex, int32 ParentIndex, bool& bOutReferencesChanged);
 
-	uint32 GetPropertyCount(const Schema_Object* Object, Schema_FieldId Id, GDK_PROPERTY(Property)* Property);
+	uint32 GetPropertyCount(const Schema_Object* Object, Schema_FieldId Id, ESchemaFieldType Type);
 
 private:
 	class USpatialPackageMapClient* PackageMap;
 	class USpatialNetDriver* NetDriver;
 	class USpatialClassInfoManager* ClassInfoManager;
 	FObjectReferencesMap& RootObjectReferencesMap;
+
+	// Reused between updates applied by this reader, to avoid allocating a field ID list for each one.
+	TArray<Schema_FieldId> UpdatedIds;
+
+	bool bDeferPostReceive = false;
+	FObjectReplicator* DeferredReplicator = nullptr;
+	TArray<GDK_PROPERTY(Property)*> DeferredRepNotifies;
+	TBitArray<> DeferredStoredShadowCmds;
 };
 
 } // namespace SpatialGDK
@@ -0,0 +1,34 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "SpatialConstants.h"
+#include "Templates/TypeHash.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+namespace SpatialGDK
+{
+
+struct EntityRPCType
+{
+	EntityRPCType(Worker_EntityId EntityId, ERPCType Type)
+		: EntityId(EntityId)
+		, Type(Type)
+	{}
+
+	Worker_EntityId EntityId;
+	ERPCType Type;
+
+	friend bool operator==(const EntityRPCType& Lhs, const EntityRPCType& Rhs)
+	{
+		return Lhs.EntityId == Rhs.EntityId && Lhs.Type == Rhs.Type;
+	}
+
+	friend uint32 GetTypeHash(EntityRPCType Value)
+	{
+		return HashCombine(::GetTypeHash(static_cast<int64>(Value.EntityId)), ::GetTypeHash(static_cast<uint32>(Value.Type)));
+	}
+};
+
+} // namespace SpatialGDK
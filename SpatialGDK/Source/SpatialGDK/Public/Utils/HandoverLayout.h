@@ -0,0 +1,53 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Utils/GDKPropertyMacros.h"
+#include "Utils/RepDataUtils.h"
+
+struct FHandoverPropertyInfo;
+
+namespace SpatialGDK
+{
+
+/**
+ * How the handover properties of a class are laid out in objects and in their handover shadow data, computed once per class.
+ *
+ * Consecutive properties which can be compared as memory, and which are adjacent both in the object and in the shadow data,
+ * are grouped into runs. Finding changes compares each run with one memcmp, and only looks at its individual properties if
+ * the run changed. Other properties are compared with Identical.
+ */
+class SPATIALGDK_API FHandoverLayout
+{
+public:
+	void Init(TArrayView<const FHandoverPropertyInfo> HandoverProperties);
+
+	int32 GetShadowDataSize() const { return ShadowDataSize; }
+	int32 GetShadowOffset(int32 PropertyIndex) const { return ShadowOffsets[PropertyIndex]; }
+
+	// Finds the handover properties which differ from the shadow data, in handle order, and copies them into the shadow data.
+	// With bAllChanged, every property is treated as changed.
+	void GetChanges(TArrayView<const FHandoverPropertyInfo> HandoverProperties, uint8* ShadowData, const uint8* Object, bool bAllChanged, FHandoverChangeState& OutChanged) const;
+
+	// Whether values of the property are identical exactly when their memory is, apart from floating point zeros and NaNs.
+	static bool IsBitwiseComparable(const GDK_PROPERTY(Property)* Property);
+
+private:
+	struct FSegment
+	{
+		int32 ObjectOffset;
+		int32 ShadowOffset;
+		int32 Size;
+		int32 FirstProperty;
+		int32 NumProperties;
+		bool bBitwise;
+	};
+
+	TArray<FSegment> Segments;
+	TArray<int32> ShadowOffsets;
+	int32 ShadowDataSize = 0;
+};
+
+} // namespace SpatialGDK
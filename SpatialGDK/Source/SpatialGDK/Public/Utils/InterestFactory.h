@@ -39,6 +39,14 @@ DECLARE_LOG_CATEGORY_EXTERN(LogInterestFactory, Log, All);
 namespace SpatialGDK
 {
 
+struct FNetCullDistanceQueries
+{
+	// Queries added to the client authority component.
+	TArray<Query> ClientQueries;
+	// Queries added to the position component when client queries are enabled on servers.
+	TArray<Query> ServerQueries;
+};
+
 class SPATIALGDK_API InterestFactory
 {
 public:
@@ -47,6 +55,10 @@ public:
 	Worker_ComponentData CreateInterestData(AActor* InActor, const FClassInfo& InInfo, const Worker_EntityId InEntityId) const;
 	Worker_ComponentUpdate CreateInterestUpdate(AActor* InActor, const FClassInfo& InInfo, const Worker_EntityId InEntityId) const;
 
+	// Creates an interest update for the actor unless its interest is the same as LastSentInterest, in which case it returns false.
+	// When bSkipUnchangedInterestUpdates is set, LastSentInterest is set to the interest of each update created.
+	bool CreateInterestUpdateIfChanged(AActor* InActor, const FClassInfo& InInfo, const Worker_EntityId InEntityId, TOptional<Interest>& LastSentInterest, Worker_ComponentUpdate& OutUpdate) const;
+
 	Interest CreateServerWorkerInterest(const UAbstractLBStrategy* LBStrategy);
 
 private:
@@ -79,6 +91,10 @@ private:
 
 	void AddNetCullDistanceQueries(Interest& OutInterest, const QueryConstraint& LevelConstraint) const;
 
+	// Returns the net cull distance queries conjoined with LevelConstraint, building them the first time each level constraint is seen.
+	// The reference is only valid until the next call.
+	const FNetCullDistanceQueries& GetNetCullDistanceQueries(const QueryConstraint& LevelConstraint) const;
+
 	void AddComponentQueryPairToInterestComponent(Interest& OutInterest, const Worker_ComponentId ComponentId, const Query& QueryToAdd) const;
 
 	// System Defined Constraints
@@ -98,6 +114,14 @@ private:
 	// It is built once per net driver initialization.
 	FrequencyConstraints ClientCheckoutRadiusConstraint;
 
+	// The always relevant constraint doesn't depend on the actor, so it is also built once.
+	QueryConstraint AlwaysRelevantConstraint;
+
+	// Clients with the same loaded levels share a level constraint, and so the same net cull distance queries.
+	// Level constraints change as clients stream levels, so the cache is emptied when it reaches MaxCachedNetCullDistanceQueries.
+	static constexpr int32 MaxCachedNetCullDistanceQueries = 64;
+	mutable TMap<QueryConstraint, FNetCullDistanceQueries> NetCullDistanceQueriesCache;
+
 	// Cache the result types of queries.
 	SchemaResultType ClientNonAuthInterestResultType;
 	SchemaResultType ClientAuthInterestResultType;
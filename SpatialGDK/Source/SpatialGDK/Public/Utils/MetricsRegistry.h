@@ -0,0 +1,93 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Templates/Atomic.h"
+
+#include <string>
+
+namespace SpatialGDK
+{
+struct SpatialMetrics;
+
+// Handles are returned when metrics are registered, and are only valid for the registry which returned them.
+struct FGaugeHandle
+{
+	int32 Index = INDEX_NONE;
+	bool IsValid() const { return Index != INDEX_NONE; }
+};
+
+struct FCounterHandle
+{
+	int32 Index = INDEX_NONE;
+	bool IsValid() const { return Index != INDEX_NONE; }
+};
+
+struct FHistogramHandle
+{
+	int32 Index = INDEX_NONE;
+	bool IsValid() const { return Index != INDEX_NONE; }
+};
+
+/**
+ * Metrics which are registered up front and then updated through handles, so recording a value never looks up a key,
+ * converts a string or allocates.
+ *
+ * Registering is not thread safe and must be done before the metric is used. Updates are atomic and can be made from any thread.
+ * Keys are converted to UTF-8 once, when registered.
+ */
+class SPATIALGDK_API FMetricsRegistry
+{
+public:
+	FGaugeHandle RegisterGauge(const FString& Key);
+	FCounterHandle RegisterCounter(const FString& Key);
+	// Upper bounds must be ascending. A bucket without an upper bound is added for samples above the last one.
+	FHistogramHandle RegisterHistogram(const FString& Key, TArrayView<const double> UpperBounds);
+
+	void SetGauge(FGaugeHandle Handle, double Value);
+	void IncrementCounter(FCounterHandle Handle, int64 Amount = 1);
+	void Observe(FHistogramHandle Handle, double Value);
+
+	double GetGauge(FGaugeHandle Handle) const;
+	int64 GetCounter(FCounterHandle Handle) const;
+	double GetHistogramSum(FHistogramHandle Handle) const;
+	// Number of samples in each bucket, not cumulative, including the bucket without an upper bound.
+	TArray<uint32> GetHistogramBucketCounts(FHistogramHandle Handle) const;
+
+	// Number of gauge and histogram metrics added to a report. Counters are reported as gauges.
+	int32 NumReportedGauges() const { return Gauges.Num() + Counters.Num(); }
+	int32 NumReportedHistograms() const { return Histograms.Num(); }
+
+	// Adds every metric to the report. Counters are reported as gauges of their total, and histogram buckets are cumulative.
+	// Samples recorded while this runs may be counted in a histogram's buckets but not in its sum until the next report.
+	void AddToReport(SpatialMetrics& Metrics) const;
+
+private:
+	struct FGauge
+	{
+		std::string Key;
+		TAtomic<uint64> ValueBits;
+	};
+
+	struct FCounter
+	{
+		std::string Key;
+		TAtomic<int64> Value;
+	};
+
+	struct FHistogram
+	{
+		std::string Key;
+		TArray<double> UpperBounds;
+		TUniquePtr<TAtomic<uint32>[]> BucketCounts;
+		TAtomic<uint64> SumBits;
+	};
+
+	TIndirectArray<FGauge> Gauges;
+	TIndirectArray<FCounter> Counters;
+	TIndirectArray<FHistogram> Histograms;
+};
+
+} // namespace SpatialGDK
@@ -0,0 +1,60 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class USchemaDatabase;
+
+namespace SpatialGDK
+{
+
+/**
+ * Table of interned object ref paths, so refs to stably named objects can be sent as a compact ID instead of a string.
+ *
+ * Object ref paths are single segments of an object's outer chain: a package name, or the name of an object within its outer.
+ * The table is seeded with the segments of every class and level path in the schema database, sorted, so each worker running
+ * with the same schema assigns the same IDs. Paths not in the table are still sent as strings.
+ */
+class SPATIALGDK_API FObjectRefPathTable
+{
+public:
+	static constexpr uint32 InvalidPathId = MAX_uint32;
+
+	// The table shared by all net drivers in the process, which all load the same schema database.
+	static FObjectRefPathTable& Get();
+
+	// Rebuilds the table from the schema database. Written refs only use IDs if bInternWrittenPaths is set. IDs in refs
+	// received through schema are always resolved, but refs in net serialized payloads only have room for an ID if it is set.
+	void Init(const USchemaDatabase& SchemaDatabase, bool bInternWrittenPaths);
+	void Init(TArray<FString> SourcePaths, bool bInternWrittenPaths);
+
+	bool ShouldInternWrittenPaths() const { return bInternWrittenPaths; }
+
+	uint32 Num() const { return Paths.Num(); }
+
+	// Returns InvalidPathId if the path isn't in the table.
+	uint32 FindPathId(const FString& Path) const;
+
+	bool IsValidPathId(uint32 PathId) const { return PathId < static_cast<uint32>(Paths.Num()); }
+	const FString& GetPath(uint32 PathId) const { return Paths[PathId]; }
+	FName GetPathName(uint32 PathId) const { return PathNames[PathId]; }
+
+	// Splits a full object path such as /Game/Package.Object:Subobject into the segments used by object refs.
+	static void SplitIntoSegments(const FString& FullPath, TArray<FString>& OutSegments);
+
+private:
+	struct FCaseSensitivePathKeyFuncs : TDefaultMapKeyFuncs<FString, uint32, false>
+	{
+		static bool Matches(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+		static uint32 GetKeyHash(const FString& Key) { return FCrc::StrCrc32(*Key); }
+	};
+
+	TArray<FString> Paths;
+	TArray<FName> PathNames;
+	TMap<FString, uint32, FDefaultSetAllocator, FCaseSensitivePathKeyFuncs> PathToId;
+
+	bool bInternWrittenPaths = false;
+};
+
+} // namespace SpatialGDK
@@ -0,0 +1,121 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "Interop/SpatialClassInfoManager.h"
+#include "SpatialCommonTypes.h"
+#include "Utils/GDKPropertyMacros.h"
+#include "Utils/RepDataUtils.h"
+
+#include "Containers/Array.h"
+#include "Containers/Map.h"
+#include "Templates/Function.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+#include <WorkerSDK/improbable/c_worker.h>
+
+DECLARE_LOG_CATEGORY_EXTERN(LogParallelComponentSerializer, Log, All);
+
+class USpatialNetDriver;
+
+namespace SpatialGDK
+{
+class ComponentFactory;
+
+// Splits component update creation for replicated objects into two phases.
+// During actor replication, changelists that are safe to serialize off the game thread are recorded with TryDefer,
+// together with a copy of the changed property values. Flush then serializes every deferred changelist from those
+// copies with ComponentFactory on the task graph, each worker writing to its own output buffer, and hands the
+// resulting updates back on the game thread in the order they were deferred.
+//
+// Anything else sent for an entity must go out after its deferred updates, so senders call FlushEntity first.
+//
+// A changelist can be deferred only if every changed property serializes without touching shared state:
+// object references (package map), fast arrays, generic structs (shared rep layouts) and latency-traced
+// objects are always serialized on the game thread.
+class SPATIALGDK_API FParallelComponentSerializer
+{
+public:
+	using FSendUpdateFunction = TFunctionRef<void(Worker_EntityId, FWorkerComponentUpdate&)>;
+
+	void Init(USpatialNetDriver* InNetDriver, int32 InMinObjectsPerTask);
+
+	// Called on the game thread. Returns true if the changelists were deferred, in which case nothing was serialized yet
+	// and the object can change before the flush without affecting what is sent.
+	bool TryDefer(UObject* Object, const FClassInfo& Info, Worker_EntityId EntityId, const FRepChangeState* RepChanges, const FHandoverChangeState* HandoverChanges, bool bInterestDirty);
+
+	// Serializes the changelists deferred for one entity on the game thread and sends their updates, in the order they were deferred.
+	// Returns the number of bytes written, which are also included in the next Flush.
+	uint32 FlushEntity(Worker_EntityId EntityId, FSendUpdateFunction SendUpdate);
+
+	// Serializes all deferred changelists and calls SendUpdate for each resulting update, in the order the objects were deferred.
+	// Returns the number of bytes written since the last Flush, including updates already sent by FlushEntity.
+	uint32 Flush(FSendUpdateFunction SendUpdate);
+
+	// Number of changelists deferred since the last Flush, including those already sent by FlushEntity.
+	int32 GetNumDeferred() const { return Deferred.Num(); }
+
+	// Bytes of property values copied for the changelists deferred since the last Flush.
+	int32 GetNumSnapshotBytes() const { return SnapshotMemory.Num(); }
+
+private:
+	// Snapshots are laid out like objects, so classes needing a larger alignment are never deferred.
+	static constexpr uint32 SnapshotAlignment = 16;
+
+	struct FDeferredObject
+	{
+		TWeakObjectPtr<UObject> Object;
+		const FClassInfo* Info;
+		Worker_EntityId EntityId;
+		FRepLayout* RepLayout;
+		TArray<uint16> RepChanged;
+		FHandoverChangeState HandoverChanged;
+		// Only the span of the object covering the changed properties is copied, to SnapshotOffset in SnapshotMemory.
+		// SnapshotBase is the object offset the span starts at, so values keep their offsets relative to each other.
+		int32 SnapshotOffset;
+		int32 SnapshotBase;
+		TArray<GDK_PROPERTY(Property)*, TInlineAllocator<8>> SnapshotProperties;
+		bool bHasRepChanges;
+		bool bHasHandoverChanges;
+		bool bInterestDirty;
+		bool bSent;
+	};
+
+	// Updates produced by one task, for a contiguous range of deferred objects.
+	struct FOutputBuffer
+	{
+		TArray<FWorkerComponentUpdate> Updates;
+		TArray<int32> NumUpdatesPerObject;
+		uint32 BytesWritten = 0;
+	};
+
+	bool CanSerializeOffGameThread(const FRepChangeState& RepChanges);
+	bool CanSerializeOffGameThread(const FClassInfo& Info, const FHandoverChangeState& HandoverChanges);
+	bool IsPropertySafe(GDK_PROPERTY(Property)* Property);
+	bool ComputeIsPropertySafe(GDK_PROPERTY(Property)* Property) const;
+
+	void Snapshot(UObject* Object, FDeferredObject& Entry);
+	// Returns where the object would start if the snapshot were a copy of the whole object, for reading properties at their offsets.
+	uint8* GetSnapshotContainer(const FDeferredObject& Entry) const;
+	void SerializeEntry(ComponentFactory& UpdateFactory, const FDeferredObject& Entry, FOutputBuffer& OutBuffer) const;
+	void SerializeRange(int32 StartIndex, int32 EndIndex, FOutputBuffer& OutBuffer) const;
+	void SendInterestUpdate(const FDeferredObject& Entry, FSendUpdateFunction SendUpdate) const;
+	void ReleaseSnapshots();
+
+	USpatialNetDriver* NetDriver = nullptr;
+	int32 MinObjectsPerTask = 1;
+
+	TArray<FDeferredObject> Deferred;
+	TArray<FOutputBuffer> OutputBuffers;
+	TArray<uint8, TAlignedHeapAllocator<SnapshotAlignment>> SnapshotMemory;
+
+	// Indices into Deferred of the changelists not yet sent, per entity.
+	TMap<Worker_EntityId_Key, TArray<int32, TInlineAllocator<2>>> UnsentByEntity;
+	uint32 EntityFlushBytesWritten = 0;
+
+	// Only accessed on the game thread.
+	TMap<const GDK_PROPERTY(Property)*, bool> PropertySafetyCache;
+	TArray<const UScriptStruct*> SafeNetSerializeStructs;
+};
+
+} // namespace SpatialGDK
@@ -0,0 +1,54 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Function.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+class AActor;
+class USpatialStaticComponentView;
+
+namespace SpatialGDK
+{
+
+/**
+ * The entities whose position follows an actor at the root of an ownership hierarchy, flattened and cached for batched
+ * position updates.
+ *
+ * The hierarchy is the root, its children recursively, and for player controllers the possessed pawn's hierarchy. The entity
+ * list is only rebuilt when the actors in the hierarchy change, when authority over one of their entities changes, or when
+ * one of the actors gets an entity.
+ */
+class SPATIALGDK_API FPositionHierarchy
+{
+public:
+	struct FEntity
+	{
+		Worker_EntityId EntityId;
+		bool bAuthoritative;
+		// The entity's authority generation in the view when bAuthoritative was checked.
+		uint64 AuthorityGeneration;
+	};
+
+	// Returns the actor's entity ID, or SpatialConstants::INVALID_ENTITY_ID if it doesn't have one yet.
+	using FGetEntityId = TFunctionRef<Worker_EntityId(const AActor*)>;
+
+	// Returns whether the entity list had to be rebuilt.
+	bool Update(AActor& Root, FGetEntityId GetEntityId, const USpatialStaticComponentView& StaticComponentView);
+
+	const TArray<FEntity>& GetEntities() const { return Entities; }
+
+private:
+	static AActor* GetPawnOutsideHierarchy(AActor& Root);
+
+	bool MatchesActors(AActor& Actor, int32& Index) const;
+	bool MatchesEntities(FGetEntityId GetEntityId, const USpatialStaticComponentView& StaticComponentView) const;
+	void AddActors(AActor& Actor);
+
+	TArray<TWeakObjectPtr<AActor>> Actors;
+	TArray<FEntity> Entities;
+};
+
+} // namespace SpatialGDK
@@ -70,6 +70,9 @@ struct FRPCErrorInfo
 	TWeakObjectPtr<UFunction> Function = nullptr;
 	ERPCResult ErrorCode = ERPCResult::Unknown;
 	ERPCQueueProcessResult QueueProcessResult = ERPCQueueProcessResult::StopProcessing;
+
+	// Object refs in the RPC's parameters which couldn't be resolved, when that is why it couldn't be processed.
+	TArray<FUnrealObjectRef> UnresolvedRefs;
 };
 
 struct SPATIALGDK_API FPendingRPCParams
@@ -91,6 +94,24 @@ struct SPATIALGDK_API FPendingRPCParams
 	ERPCType Type;
 };
 
+struct SPATIALGDK_API FRPCContainerStats
+{
+	static constexpr int32 NumAgeBuckets = 7;
+
+	// Upper bounds, in seconds, of the queue age histogram buckets. The last bucket has no upper bound.
+	static const double AgeBucketUpperBounds[NumAgeBuckets];
+
+	uint32 NumQueuedRPCs = 0;
+	// Each entity has a queue for each RPC type it has RPCs queued of.
+	uint32 NumPendingQueues = 0;
+
+	// How long RPCs that were queued waited before being processed or dropped. Counts are not cumulative across buckets.
+	uint32 AgeBucketCounts[NumAgeBuckets] = {};
+	double AgeSumSeconds = 0.0;
+
+	void RecordAge(double AgeSeconds);
+};
+
 class SPATIALGDK_API FRPCContainer
 {
 public:
@@ -106,18 +127,69 @@ public:
 	void BindProcessingFunction(const FProcessRPCDelegate& Function);
 	void ProcessOrQueueRPC(const FUnrealObjectRef& InTargetObjectRef, ERPCType InType, SpatialGDK::RPCPayload&& InPayload);
 	void ProcessRPCs();
+
+	// Processes the queues whose next RPC is waiting on the object ref, now that it has been resolved.
+	void ProcessRPCsWaitingOn(const FUnrealObjectRef& ObjectRef);
+
+	// Queues whose next RPC is waiting on unresolved object refs are skipped by ProcessRPCs until one of the refs is resolved,
+	// or the RPC has been queued for longer than the retry time. Waiting queues are not skipped when the time is negative.
+	void SetUnresolvedRefsRetryTime(float Seconds);
+
 	void DropForEntity(const Worker_EntityId& EntityId);
 
 	bool ObjectHasRPCsQueuedOfType(const Worker_EntityId& EntityId, ERPCType Type) const;
 
+	const FRPCContainerStats& GetStats() const { return Stats; }
+
 private:
-	using FArrayOfParams = TArray<FPendingRPCParams>;
-	using FRPCMap = TMap<Worker_EntityId_Key, FArrayOfParams>;
-	using RPCContainerType = TMap<ERPCType, FRPCMap>;
+	// Queued RPCs are pooled, and each queue links its RPCs in order through Next.
+	// Pool slots are reused, so the sequence number tells apart RPCs queued in the same slot.
+	struct FQueuedRPC
+	{
+		FPendingRPCParams Params;
+		int32 Next;
+		uint64 Sequence;
+	};
+
+	struct FRPCQueue
+	{
+		Worker_EntityId EntityId;
+		ERPCType Type;
+		int32 Head;
+		int32 Tail;
+		// The object refs the RPC at the head of the queue is waiting on.
+		TArray<FUnrealObjectRef> WaitingOnRefs;
+	};
+
+	using FQueueKey = TPair<Worker_EntityId_Key, ERPCType>;
+
+	void Enqueue(FPendingRPCParams&& Params, TArray<FUnrealObjectRef>&& WaitingOnRefs);
+	void ProcessQueue(int32 QueueIndex);
+	void PopQueuedRPC(FRPCQueue& Queue);
+	void EmptyQueue(FRPCQueue& Queue);
+	void RemoveEmptyQueues();
+	void SetWaitingOnRefs(FRPCQueue& Queue, TArray<FUnrealObjectRef>&& Refs);
+	bool IsWaitingOnRefs(const FRPCQueue& Queue, const FDateTime& Now) const;
+	void ProcessQueuesWaitingOn(const FUnrealObjectRef& ObjectRef);
+	void ProcessRefsResolvedWhileProcessing();
+
+	ERPCQueueProcessResult ApplyFunction(FPendingRPCParams& Params, TArray<FUnrealObjectRef>& OutWaitingOnRefs);
+
+	TSparseArray<FQueuedRPC> RPCPool;
+	uint64 NextRPCSequence = 0;
+
+	// Only queues with pending RPCs are kept, so processing doesn't visit entities without RPCs to process.
+	TArray<FRPCQueue> PendingQueues;
+	TMap<FQueueKey, int32> QueueIndices;
+
+	// The queues waiting on each unresolved object ref, so resolving a ref only processes the queues that depend on it.
+	TMap<FUnrealObjectRef, TArray<FQueueKey>> QueuesWaitingOnRef;
+	// Refs resolved while already processing, which are processed once the current processing is done.
+	TArray<FUnrealObjectRef> RefsResolvedWhileProcessing;
+	float UnresolvedRefsRetryTime = -1.0f;
+
+	FRPCContainerStats Stats;
 
-	void ProcessRPCs(FArrayOfParams& RPCList);
-	ERPCQueueProcessResult ApplyFunction(FPendingRPCParams& Params);
-	RPCContainerType QueuedRPCs;
 	FProcessRPCDelegate ProcessingFunction;
 	bool bAlreadyProcessingRPCs = false;
 
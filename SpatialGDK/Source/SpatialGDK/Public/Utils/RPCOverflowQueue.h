@@ -0,0 +1,134 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Schema/RPCPayload.h"
+#include "SpatialConstants.h"
+#include "Utils/EntityRPCType.h"
+
+namespace SpatialGDK
+{
+
+struct RPCOverflowStats
+{
+	static constexpr int32 NumRPCTypes = static_cast<int32>(ERPCType::CrossServer) + 1;
+
+	uint32 QueueDepth = 0;
+	uint32 BytesHeld = 0;
+
+	// Indexed by ERPCType. Unreliable RPCs are dropped oldest first, and any queued RPC is dropped when authority is lost.
+	uint32 NumDropped[NumRPCTypes] = {};
+
+	// Reliable RPCs that were not queued because the queue was full, and were left with the caller to retry.
+	uint32 NumRejected[NumRPCTypes] = {};
+};
+
+enum class EOverflowEnqueueResult : uint8
+{
+	Queued,
+
+	// Only for unreliable RPCs, when older unreliable RPCs can't make room for this one.
+	Dropped,
+
+	// Only for reliable RPCs. The caller should hold on to the RPC and try again later.
+	QueueFull
+};
+
+enum class EOverflowFlushResult : uint8
+{
+	Pushed,
+
+	// Keeps this and the remaining RPCs of the same entity and type queued.
+	Stop,
+
+	// Drops this and the remaining RPCs of the same entity and type.
+	DropAll
+};
+
+// Holds RPCs that didn't fit in their ring buffer, in a FIFO per entity and RPC type.
+//
+// Queued RPCs live in a shared pool of nodes linked into their FIFO, so queuing and flushing don't allocate once
+// the pool has grown. The total size of queued payloads is capped at MaxBytes:
+// - Unreliable RPCs are dropped oldest first, across all entities, to make room for newer RPCs. A single FIFO
+//   never holds more unreliable RPCs than fit in its ring buffer, since older ones would be stale by the time they are sent.
+// - Reliable RPCs are never dropped to make room. When the queue is full, unreliable RPCs are dropped for them,
+//   and if that isn't enough the RPC is rejected so that the caller applies back-pressure.
+// Reliable FIFOs are flushed before unreliable ones.
+class SPATIALGDK_API RPCOverflowQueue
+{
+public:
+	explicit RPCOverflowQueue(uint32 InMaxBytes);
+
+	EOverflowEnqueueResult Enqueue(EntityRPCType EntityType, RPCPayload&& Payload);
+
+	bool Contains(EntityRPCType EntityType) const;
+	uint32 Num(EntityRPCType EntityType) const;
+
+	// Drops all RPCs queued for the entity and type.
+	void Remove(EntityRPCType EntityType);
+
+	// Calls PushFunction on each queued RPC in order, reliable FIFOs first, until it returns something other than Pushed for that FIFO.
+	void Flush(TFunctionRef<EOverflowFlushResult(EntityRPCType, RPCPayload&)> PushFunction);
+
+	const RPCOverflowStats& GetStats() const { return Stats; }
+
+private:
+	struct Node
+	{
+		Worker_EntityId EntityId;
+		ERPCType Type;
+		uint32 Offset;
+		uint32 Index;
+		TArray<uint8> PayloadData;
+		TraceKey Trace;
+
+		// Counted towards MaxBytes.
+		uint32 Bytes;
+
+		// Next node in the FIFO, or in the free list.
+		int32 Next;
+
+		// Unreliable nodes are also linked from oldest to newest across all FIFOs.
+		int32 OlderUnreliable;
+		int32 NewerUnreliable;
+	};
+
+	struct NodeList
+	{
+		int32 Head = INDEX_NONE;
+		int32 Tail = INDEX_NONE;
+		uint32 Num = 0;
+	};
+
+	static bool IsReliable(ERPCType Type);
+
+	int32 AllocateNode();
+	void FreeNode(int32 NodeIndex);
+
+	// Unlinks the head of the FIFO and returns its index, without freeing it.
+	int32 PopHead(NodeList& List);
+	void DropHead(NodeList& List);
+	bool DropOldestUnreliable();
+
+	void FlushLists(TMap<EntityRPCType, NodeList>& Lists, TFunctionRef<EOverflowFlushResult(EntityRPCType, RPCPayload&)> PushFunction);
+
+	TMap<EntityRPCType, NodeList>& GetLists(ERPCType Type) { return IsReliable(Type) ? ReliableLists : UnreliableLists; }
+	const TMap<EntityRPCType, NodeList>& GetLists(ERPCType Type) const { return IsReliable(Type) ? ReliableLists : UnreliableLists; }
+
+	uint32 MaxBytes;
+
+	TArray<Node> Nodes;
+	int32 FreeHead = INDEX_NONE;
+
+	TMap<EntityRPCType, NodeList> ReliableLists;
+	TMap<EntityRPCType, NodeList> UnreliableLists;
+
+	int32 OldestUnreliable = INDEX_NONE;
+	int32 NewestUnreliable = INDEX_NONE;
+
+	RPCOverflowStats Stats;
+};
+
+} // namespace SpatialGDK
@@ -21,9 +21,21 @@ struct RPCRingBuffer
 		return RingBuffer[(RPCId - 1) % RingBuffer.Num()];
 	}
 
+	// Ticks count the updates applied to the component holding the buffer.
+	bool HasChangedSince(uint64 Tick) const
+	{
+		return LastChangedTick > Tick;
+	}
+
 	ERPCType Type;
+	// Indexed by RPC ID, so it holds GetRingBufferCapacity elements rather than one per schema field.
 	TArray<TOptional<RPCPayload>> RingBuffer;
 	uint64 LastSentRPCId = 0;
+
+	// Only used when several RPCs are packed into each schema field: the ID of the last RPC in each field.
+	TArray<uint64> SlotLastRPCIds;
+
+	uint64 LastChangedTick = 0;
 };
 
 struct RPCRingBufferDescriptor
@@ -38,7 +50,25 @@ struct RPCRingBufferDescriptor
 		return SchemaFieldStart + GetRingBufferElementIndex(RPCId);
 	}
 
+	Schema_FieldId GetSlotFieldId(uint32 SlotIndex) const
+	{
+		return SchemaFieldStart + SlotIndex;
+	}
+
+	bool IsPacked() const
+	{
+		return PayloadsPerSlot > 1;
+	}
+
+	// The number of RPCs that can be in flight at once.
+	uint32 GetCapacity() const
+	{
+		return RingBufferSize * PayloadsPerSlot;
+	}
+
+	// Number of schema fields (slots) used, at most MaxRPCRingBufferSize.
 	uint32 RingBufferSize;
+	uint32 PayloadsPerSlot;
 	Schema_FieldId SchemaFieldStart;
 	Schema_FieldId LastSentRPCFieldId;
 };
@@ -49,6 +79,7 @@ namespace RPCRingBufferUtils
 Worker_ComponentId GetRingBufferComponentId(ERPCType Type);
 RPCRingBufferDescriptor GetRingBufferDescriptor(ERPCType Type);
 uint32 GetRingBufferSize(ERPCType Type);
+uint32 GetRingBufferCapacity(ERPCType Type);
 
 Worker_ComponentId GetAckComponentId(ERPCType Type);
 Schema_FieldId GetAckFieldId(ERPCType Type);
@@ -58,9 +89,18 @@ Schema_FieldId GetInitiallyPresentMulticastRPCsCountFieldId();
 bool ShouldQueueOverflowed(ERPCType Type);
 
 void ReadBufferFromSchema(Schema_Object* SchemaObject, RPCRingBuffer& OutBuffer);
+
+// Reads a single field of a component update if it is one of the buffer's slots or its last sent ID, so updates only decode
+// the fields they contain. Returns whether the field was the buffer's, in which case the buffer's LastChangedTick is set to Tick.
+bool ReadBufferFieldFromSchema(Schema_Object* SchemaObject, Schema_FieldId FieldId, const RPCRingBufferDescriptor& Descriptor, uint64 Tick, RPCRingBuffer& OutBuffer);
 void ReadAckFromSchema(const Schema_Object* SchemaObject, ERPCType Type, uint64& OutAck);
 
 void WriteRPCToSchema(Schema_Object* SchemaObject, ERPCType Type, uint64 RPCId, const RPCPayload& Payload);
+
+// Used when the ring buffer is packed. Starts a new slot holding the RPC with ID RPCId, and returns the slot object
+// so that the RPCs following it can be appended with AppendRPCToSlot.
+Schema_Object* WriteRPCToSlot(Schema_Object* SchemaObject, ERPCType Type, uint32 SlotIndex, uint64 RPCId, const RPCPayload& Payload);
+void AppendRPCToSlot(Schema_Object* SchemaObject, ERPCType Type, Schema_Object* SlotObject, uint64 RPCId, const RPCPayload& Payload);
 void WriteAckToSchema(Schema_Object* SchemaObject, ERPCType Type, uint64 Ack);
 
 void MoveLastSentIdToInitiallyPresentCount(Schema_Object* SchemaObject, uint64 LastSentId);
@@ -0,0 +1,62 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Utils/GDKPropertyMacros.h"
+
+class FRepLayout;
+
+namespace SpatialGDK
+{
+
+// How a property is stored in schema. Computed once per property, so reading and writing
+// a field switches on this instead of trying a chain of property casts.
+enum class ESchemaFieldType : uint8
+{
+	Unsupported,
+	// Delegates and interfaces can be set to replicate, but aren't sent across the network.
+	NotSerialized,
+	Map,
+	Set,
+	Struct,
+	Bool,
+	Float,
+	Double,
+	Int8,
+	Int16,
+	Int32,
+	Int64,
+	Byte,
+	UInt16,
+	UInt32,
+	UInt64,
+	// Enums with an underlying type smaller than 4 bytes, stored as a uint32.
+	SmallEnum,
+	Object,
+	SoftObject,
+	Name,
+	String,
+	Text,
+	Array,
+	FastArray
+};
+
+struct FSchemaFieldInfo
+{
+	// The property to read or write. Enums stored as their underlying type are resolved to the underlying property.
+	GDK_PROPERTY(Property)* Property = nullptr;
+	ESchemaFieldType Type = ESchemaFieldType::Unsupported;
+
+	// Only for arrays, the element property, resolved the same way.
+	GDK_PROPERTY(Property)* InnerProperty = nullptr;
+	ESchemaFieldType InnerType = ESchemaFieldType::Unsupported;
+};
+
+SPATIALGDK_API FSchemaFieldInfo GetSchemaFieldInfo(GDK_PROPERTY(Property)* Property);
+
+// Returns the field info of each replicated property, indexed by rep handle - 1, which is also the schema field ID - 1.
+SPATIALGDK_API TArray<FSchemaFieldInfo> GetRepLayoutFieldInfos(const FRepLayout& RepLayout);
+
+} // namespace SpatialGDK
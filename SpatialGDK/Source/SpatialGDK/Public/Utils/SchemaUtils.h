@@ -7,6 +7,7 @@
 
 #include "Schema/UnrealObjectRef.h"
 #include "SpatialConstants.h"
+#include "Utils/ObjectRefPathTable.h"
 
 #include <WorkerSDK/improbable/c_schema.h>
 #include <WorkerSDK/improbable/c_worker.h>
@@ -16,21 +17,32 @@ using StringToEntityMap = TMap<FString, Worker_EntityId>;
 namespace SpatialGDK
 {
 
+// Strings are converted straight into the schema buffer and out of it, rather than through a temporary conversion buffer.
 inline void AddStringToSchema(Schema_Object* Object, Schema_FieldId Id, const FString& Value)
 {
-	FTCHARToUTF8 CStrConversion(*Value);
-	uint32 StringLength = CStrConversion.Length();
+	const int32 SourceLength = Value.Len();
+	const int32 StringLength = FTCHARToUTF8_Convert::ConvertedLength(*Value, SourceLength);
 	uint8* StringBuffer = Schema_AllocateBuffer(Object, sizeof(char) * StringLength);
-	FMemory::Memcpy(StringBuffer, CStrConversion.Get(), sizeof(char) * StringLength);
+	ANSICHAR* ConvertedBuffer = reinterpret_cast<ANSICHAR*>(StringBuffer);
+	FTCHARToUTF8_Convert::Convert(ConvertedBuffer, StringLength, *Value, SourceLength);
 	Schema_AddBytes(Object, Id, StringBuffer, sizeof(char) * StringLength);
 }
 
 inline FString IndexStringFromSchema(const Schema_Object* Object, Schema_FieldId Id, uint32 Index)
 {
-	int32 StringLength = (int32)Schema_IndexBytesLength(Object, Id, Index);
-	const uint8_t* Bytes = Schema_IndexBytes(Object, Id, Index);
-	FUTF8ToTCHAR FStringConversion(reinterpret_cast<const ANSICHAR*>(Bytes), StringLength);
-	return FString(FStringConversion.Length(), FStringConversion.Get());
+	const int32 StringLength = (int32)Schema_IndexBytesLength(Object, Id, Index);
+	const ANSICHAR* Bytes = reinterpret_cast<const ANSICHAR*>(Schema_IndexBytes(Object, Id, Index));
+
+	FString Value;
+	if (StringLength > 0)
+	{
+		const int32 ConvertedLength = FUTF8ToTCHAR_Convert::ConvertedLength(Bytes, StringLength);
+		TArray<TCHAR>& CharArray = Value.GetCharArray();
+		CharArray.SetNumUninitialized(ConvertedLength + 1);
+		FUTF8ToTCHAR_Convert::Convert(CharArray.GetData(), ConvertedLength, Bytes, StringLength);
+		CharArray[ConvertedLength] = TEXT('\0');
+	}
+	return Value;
 }
 
 inline FString GetStringFromSchema(const Schema_Object* Object, Schema_FieldId Id)
@@ -122,7 +134,16 @@ inline void AddObjectRefToSchema(Schema_Object* Object, Schema_FieldId Id, const
 	Schema_AddUint32(ObjectRefObject, UNREAL_OBJECT_REF_OFFSET_ID, ObjectRef.Offset);
 	if (ObjectRef.Path)
 	{
-		AddStringToSchema(ObjectRefObject, UNREAL_OBJECT_REF_PATH_ID, *ObjectRef.Path);
+		const FObjectRefPathTable& PathTable = FObjectRefPathTable::Get();
+		const uint32 PathId = PathTable.ShouldInternWrittenPaths() ? PathTable.FindPathId(*ObjectRef.Path) : FObjectRefPathTable::InvalidPathId;
+		if (PathId != FObjectRefPathTable::InvalidPathId)
+		{
+			Schema_AddUint32(ObjectRefObject, UNREAL_OBJECT_REF_INTERNED_PATH_ID, PathId);
+		}
+		else
+		{
+			AddStringToSchema(ObjectRefObject, UNREAL_OBJECT_REF_PATH_ID, *ObjectRef.Path);
+		}
 		Schema_AddBool(ObjectRefObject, UNREAL_OBJECT_REF_NO_LOAD_ON_CLIENT_ID, ObjectRef.bNoLoadOnClient);
 	}
 	if (ObjectRef.Outer)
@@ -151,6 +172,15 @@ inline FUnrealObjectRef IndexObjectRefFromSchema(Schema_Object* Object, Schema_F
 	{
 		ObjectRef.Path = GetStringFromSchema(ObjectRefObject, UNREAL_OBJECT_REF_PATH_ID);
 	}
+	else if (Schema_GetUint32Count(ObjectRefObject, UNREAL_OBJECT_REF_INTERNED_PATH_ID) > 0)
+	{
+		const FObjectRefPathTable& PathTable = FObjectRefPathTable::Get();
+		const uint32 PathId = Schema_GetUint32(ObjectRefObject, UNREAL_OBJECT_REF_INTERNED_PATH_ID);
+		if (ensureMsgf(PathTable.IsValidPathId(PathId), TEXT("Received object ref with interned path %u, but only %u paths are interned. Check that all workers use the same schema."), PathId, PathTable.Num()))
+		{
+			ObjectRef.Path = PathTable.GetPath(PathId);
+		}
+	}
 	if (Schema_GetBoolCount(ObjectRefObject, UNREAL_OBJECT_REF_NO_LOAD_ON_CLIENT_ID) > 0)
 	{
 		ObjectRef.bNoLoadOnClient = GetBoolFromSchema(ObjectRefObject, UNREAL_OBJECT_REF_NO_LOAD_ON_CLIENT_ID);
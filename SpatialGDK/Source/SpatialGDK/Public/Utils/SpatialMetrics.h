@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 
 #include "SpatialConstants.h"
+#include "Utils/MetricsRegistry.h"
 
 #include <WorkerSDK/improbable/c_schema.h>
 #include <WorkerSDK/improbable/c_worker.h>
@@ -12,6 +13,13 @@
 #include "SpatialMetrics.generated.h"
 
 class USpatialWorkerConnection;
+struct FRPCContainerStats;
+
+namespace SpatialGDK
+{
+struct RPCOverflowStats;
+struct SpatialMetrics;
+} // namespace SpatialGDK
 
 DECLARE_LOG_CATEGORY_EXTERN(LogSpatialMetrics, Log, All);
 
@@ -46,6 +54,14 @@ public:
 
 	void TrackSentRPC(UFunction* Function, ERPCType RPCType, int PayloadSize);
 
+	// Records how long processing an op list took. Can be called from any thread.
+	void RecordOpDispatch(int32 NumOps, double Seconds);
+	// Records how long replicating actors took in a tick. Can be called from any thread.
+	void RecordActorReplication(int32 NumActors, double Seconds);
+
+	// Metrics registered here are reported with the other metrics. Register them on the game thread before using their handles.
+	SpatialGDK::FMetricsRegistry& GetMetricsRegistry() { return MetricsRegistry; }
+
 	void HandleWorkerMetrics(Worker_Op* Op);
 
 	// The user can bind their own delegate to handle worker metrics.
@@ -66,11 +82,34 @@ public:
 	void SetWorkerLoadDelegate(const UserSuppliedMetric& Delegate) { WorkerLoadDelegate = Delegate; }
 	void SetCustomMetric(const FString& Metric, const UserSuppliedMetric& Delegate);
 	void RemoveCustomMetric(const FString& Metric);
+
+	// Reports the depth, size and drops of the RPC overflow queue with the other metrics. The stats must outlive this object.
+	void SetRPCOverflowStats(const SpatialGDK::RPCOverflowStats* InStats) { OverflowStats = InStats; }
+
+	// Reports the number of queued RPCs and how long they waited in the queues with the other metrics. The stats must outlive this object.
+	void SetQueuedRPCStats(const FRPCContainerStats* InOutgoingStats, const FRPCContainerStats* InIncomingStats)
+	{
+		OutgoingQueuedRPCStats = InOutgoingStats;
+		IncomingQueuedRPCStats = InIncomingStats;
+	}
 private:
+	void AddRPCOverflowMetrics(SpatialGDK::SpatialMetrics& Metrics) const;
+	static void AddQueuedRPCMetrics(SpatialGDK::SpatialMetrics& Metrics, const FRPCContainerStats& Stats, const char* QueueName);
+	void AddWorkerSDKMetricKey(const FString& Key, const char* UTF8Key);
 
 	// Worker SDK metrics
 	WorkerGaugeMetric WorkerSDKGaugeMetrics;
 	WorkerHistogramMetrics WorkerSDKHistogramMetrics;
+	// UTF-8 keys the worker SDK metrics are reported with, by worker SDK key.
+	TMap<FString, std::string> WorkerSDKMetricKeys;
+
+	SpatialGDK::FMetricsRegistry MetricsRegistry;
+	SpatialGDK::FCounterHandle RPCsSentCounter;
+	SpatialGDK::FHistogramHandle RPCPayloadBytesHistogram;
+	SpatialGDK::FCounterHandle OpsDispatchedCounter;
+	SpatialGDK::FHistogramHandle OpDispatchSecondsHistogram;
+	SpatialGDK::FCounterHandle ActorsReplicatedCounter;
+	SpatialGDK::FHistogramHandle ActorReplicationSecondsHistogram;
 
 	UPROPERTY()
 	USpatialWorkerConnection* Connection;
@@ -87,7 +126,16 @@ private:
 	double WorkerLoad;
 	UserSuppliedMetric WorkerLoadDelegate;
 
-	TMap<FString, UserSuppliedMetric> UserSuppliedMetrics;
+	struct FUserSuppliedMetricEntry
+	{
+		UserSuppliedMetric Delegate;
+		std::string Key;
+	};
+	TMap<FString, FUserSuppliedMetricEntry> UserSuppliedMetrics;
+
+	const SpatialGDK::RPCOverflowStats* OverflowStats = nullptr;
+	const FRPCContainerStats* OutgoingQueuedRPCStats = nullptr;
+	const FRPCContainerStats* IncomingQueuedRPCStats = nullptr;
 
 	// RPC tracking is activated with "SpatialStartRPCMetrics" and stopped with "SpatialStopRPCMetrics"
 	// console command. It will record every sent RPC as well as the size of its payload, and then display
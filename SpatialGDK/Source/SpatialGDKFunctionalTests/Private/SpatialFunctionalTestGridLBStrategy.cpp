@@ -33,3 +33,9 @@ VirtualWorkerId USpatialFunctionalTestGridLBStrategy::WhoShouldHaveAuthority(con
 	}
 	return Super::WhoShouldHaveAuthority(Actor);
 }
+
+void USpatialFunctionalTestGridLBStrategy::WhoShouldHaveAuthority(TArrayView<const AActor*> Actors, TArrayView<VirtualWorkerId> OutVirtualWorkerIds) const
+{
+	// Delegations are per actor, so don't use the grid's batched lookup.
+	UAbstractLBStrategy::WhoShouldHaveAuthority(Actors, OutVirtualWorkerIds);
+}
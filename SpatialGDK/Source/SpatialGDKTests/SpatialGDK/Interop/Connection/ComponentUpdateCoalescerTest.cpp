@@ -0,0 +1,212 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Interop/Connection/ComponentUpdateCoalescer.h"
+
+#include <improbable/c_schema.h>
+
+#define COMPONENTUPDATECOALESCER_TEST(TestName) \
+	GDK_TEST(Core, FComponentUpdateCoalescer, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+const Worker_EntityId TestEntityId = 1;
+const Worker_EntityId OtherTestEntityId = 2;
+const Worker_ComponentId TestComponentId = 1000;
+const Worker_ComponentId OtherTestComponentId = 1001;
+const Schema_FieldId TestFieldId = 1;
+const Schema_FieldId OtherTestFieldId = 2;
+const Schema_FieldId TestEventId = 1;
+
+FWorkerComponentUpdate CreateFieldUpdate(Worker_ComponentId ComponentId, Schema_FieldId FieldId, uint32 Value)
+{
+	FWorkerComponentUpdate Update = {};
+	Update.component_id = ComponentId;
+	Update.schema_type = Schema_CreateComponentUpdate();
+	Schema_AddUint32(Schema_GetComponentUpdateFields(Update.schema_type), FieldId, Value);
+	return Update;
+}
+
+FWorkerComponentUpdate CreateEventUpdate(Worker_ComponentId ComponentId, uint32 Value)
+{
+	FWorkerComponentUpdate Update = {};
+	Update.component_id = ComponentId;
+	Update.schema_type = Schema_CreateComponentUpdate();
+	Schema_Object* Event = Schema_AddObject(Schema_GetComponentUpdateEvents(Update.schema_type), TestEventId);
+	Schema_AddUint32(Event, TestFieldId, Value);
+	return Update;
+}
+
+struct FReleasedUpdate
+{
+	Worker_EntityId EntityId;
+	FWorkerComponentUpdate Update;
+};
+
+TArray<FReleasedUpdate> ReleaseAll(FComponentUpdateCoalescer& Coalescer)
+{
+	TArray<FReleasedUpdate> Released;
+	Coalescer.ReleaseUpdates([&Released](Worker_EntityId EntityId, FWorkerComponentUpdate& Update)
+	{
+		Released.Add(FReleasedUpdate{ EntityId, Update });
+	});
+	return Released;
+}
+
+void DestroyAll(TArray<FReleasedUpdate>& Released)
+{
+	for (FReleasedUpdate& Entry : Released)
+	{
+		Schema_DestroyComponentUpdate(Entry.Update.schema_type);
+	}
+}
+} // anonymous namespace
+
+COMPONENTUPDATECOALESCER_TEST(GIVEN_two_updates_to_the_same_field_WHEN_released_THEN_one_update_with_the_last_value)
+{
+	// GIVEN
+	FComponentUpdateCoalescer Coalescer;
+	Coalescer.AddUpdate(TestEntityId, CreateFieldUpdate(TestComponentId, TestFieldId, 1));
+	Coalescer.AddUpdate(TestEntityId, CreateFieldUpdate(TestComponentId, TestFieldId, 2));
+
+	// WHEN
+	TArray<FReleasedUpdate> Released = ReleaseAll(Coalescer);
+
+	// THEN
+	TestEqual(TEXT("Updates were merged"), Released.Num(), 1);
+	if (Released.Num() == 1)
+	{
+		Schema_Object* Fields = Schema_GetComponentUpdateFields(Released[0].Update.schema_type);
+		TestEqual(TEXT("Field holds a single value"), Schema_GetUint32Count(Fields, TestFieldId), 1u);
+		TestEqual(TEXT("Last written value wins"), Schema_GetUint32(Fields, TestFieldId), 2u);
+	}
+	TestTrue(TEXT("Coalescer is empty after release"), Coalescer.IsEmpty());
+
+	DestroyAll(Released);
+	return true;
+}
+
+COMPONENTUPDATECOALESCER_TEST(GIVEN_updates_to_different_fields_WHEN_released_THEN_both_fields_present)
+{
+	// GIVEN
+	FComponentUpdateCoalescer Coalescer;
+	Coalescer.AddUpdate(TestEntityId, CreateFieldUpdate(TestComponentId, TestFieldId, 1));
+	Coalescer.AddUpdate(TestEntityId, CreateFieldUpdate(TestComponentId, OtherTestFieldId, 2));
+
+	// WHEN
+	TArray<FReleasedUpdate> Released = ReleaseAll(Coalescer);
+
+	// THEN
+	TestEqual(TEXT("Updates were merged"), Released.Num(), 1);
+	if (Released.Num() == 1)
+	{
+		Schema_Object* Fields = Schema_GetComponentUpdateFields(Released[0].Update.schema_type);
+		TestEqual(TEXT("First field kept"), Schema_GetUint32(Fields, TestFieldId), 1u);
+		TestEqual(TEXT("Second field added"), Schema_GetUint32(Fields, OtherTestFieldId), 2u);
+	}
+
+	DestroyAll(Released);
+	return true;
+}
+
+COMPONENTUPDATECOALESCER_TEST(GIVEN_two_updates_with_events_WHEN_released_THEN_events_are_appended_in_order)
+{
+	// GIVEN
+	FComponentUpdateCoalescer Coalescer;
+	Coalescer.AddUpdate(TestEntityId, CreateEventUpdate(TestComponentId, 1));
+	Coalescer.AddUpdate(TestEntityId, CreateEventUpdate(TestComponentId, 2));
+
+	// WHEN
+	TArray<FReleasedUpdate> Released = ReleaseAll(Coalescer);
+
+	// THEN
+	TestEqual(TEXT("Updates were merged"), Released.Num(), 1);
+	if (Released.Num() == 1)
+	{
+		Schema_Object* Events = Schema_GetComponentUpdateEvents(Released[0].Update.schema_type);
+		TestEqual(TEXT("Both events present"), Schema_GetObjectCount(Events, TestEventId), 2u);
+		TestEqual(TEXT("First event kept its position"), Schema_GetUint32(Schema_IndexObject(Events, TestEventId, 0), TestFieldId), 1u);
+		TestEqual(TEXT("Second event appended"), Schema_GetUint32(Schema_IndexObject(Events, TestEventId, 1), TestFieldId), 2u);
+	}
+
+	DestroyAll(Released);
+	return true;
+}
+
+COMPONENTUPDATECOALESCER_TEST(GIVEN_update_with_cleared_field_WHEN_merged_THEN_cleared_field_is_kept)
+{
+	// GIVEN
+	FComponentUpdateCoalescer Coalescer;
+	FWorkerComponentUpdate ClearUpdate = CreateFieldUpdate(TestComponentId, TestFieldId, 1);
+	Schema_AddComponentUpdateClearedField(ClearUpdate.schema_type, OtherTestFieldId);
+	Coalescer.AddUpdate(TestEntityId, ClearUpdate);
+	Coalescer.AddUpdate(TestEntityId, CreateFieldUpdate(TestComponentId, TestFieldId, 2));
+
+	// WHEN
+	TArray<FReleasedUpdate> Released = ReleaseAll(Coalescer);
+
+	// THEN
+	TestEqual(TEXT("Updates were merged"), Released.Num(), 1);
+	if (Released.Num() == 1)
+	{
+		Schema_ComponentUpdate* Update = Released[0].Update.schema_type;
+		TestEqual(TEXT("Cleared field survives the merge"), Schema_GetComponentUpdateClearedFieldCount(Update), 1u);
+		TestEqual(TEXT("Cleared field id is preserved"), Schema_IndexComponentUpdateClearedField(Update, 0), OtherTestFieldId);
+	}
+
+	DestroyAll(Released);
+	return true;
+}
+
+COMPONENTUPDATECOALESCER_TEST(GIVEN_updates_to_different_entities_and_components_WHEN_released_THEN_not_merged_and_in_first_seen_order)
+{
+	// GIVEN
+	FComponentUpdateCoalescer Coalescer;
+	Coalescer.AddUpdate(TestEntityId, CreateFieldUpdate(TestComponentId, TestFieldId, 1));
+	Coalescer.AddUpdate(OtherTestEntityId, CreateFieldUpdate(TestComponentId, TestFieldId, 2));
+	Coalescer.AddUpdate(TestEntityId, CreateFieldUpdate(OtherTestComponentId, TestFieldId, 3));
+	Coalescer.AddUpdate(OtherTestEntityId, CreateFieldUpdate(TestComponentId, TestFieldId, 4));
+
+	// WHEN
+	TArray<FReleasedUpdate> Released = ReleaseAll(Coalescer);
+
+	// THEN
+	TestEqual(TEXT("Only the repeated pair was merged"), Released.Num(), 3);
+	if (Released.Num() == 3)
+	{
+		TestTrue(TEXT("First pair released first"), Released[0].EntityId == TestEntityId && Released[0].Update.component_id == TestComponentId);
+		TestTrue(TEXT("Second pair released second"), Released[1].EntityId == OtherTestEntityId && Released[1].Update.component_id == TestComponentId);
+		TestTrue(TEXT("Third pair released third"), Released[2].EntityId == TestEntityId && Released[2].Update.component_id == OtherTestComponentId);
+		TestEqual(TEXT("Merged update holds the last value"), Schema_GetUint32(Schema_GetComponentUpdateFields(Released[1].Update.schema_type), TestFieldId), 4u);
+	}
+
+	DestroyAll(Released);
+	return true;
+}
+
+COMPONENTUPDATECOALESCER_TEST(GIVEN_merged_updates_WHEN_released_THEN_merge_ratio_reflects_merged_fraction)
+{
+	// GIVEN
+	FComponentUpdateCoalescer Coalescer;
+	for (uint32 i = 0; i < 4; ++i)
+	{
+		Coalescer.AddUpdate(TestEntityId, CreateFieldUpdate(TestComponentId, TestFieldId, i));
+	}
+
+	// WHEN
+	TArray<FReleasedUpdate> Released = ReleaseAll(Coalescer);
+
+	// THEN
+	TestEqual(TEXT("Four updates were added"), Coalescer.GetNumAdded(), 4u);
+	TestEqual(TEXT("One update was released"), Coalescer.GetNumReleased(), 1u);
+	TestEqual(TEXT("Three quarters of the updates were merged away"), Coalescer.GetMergeRatio(), 0.75f);
+
+	Coalescer.ResetCounters();
+	TestEqual(TEXT("Merge ratio is zero after reset"), Coalescer.GetMergeRatio(), 0.0f);
+
+	DestroyAll(Released);
+	return true;
+}
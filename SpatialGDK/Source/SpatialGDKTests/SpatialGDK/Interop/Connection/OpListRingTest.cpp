@@ -0,0 +1,172 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Interop/Connection/OpListRing.h"
+
+#include "Async/Async.h"
+
+#define OPLISTRING_TEST(TestName) \
+	GDK_TEST(Core, FOpListRing, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+// Counts destructions, so tests can check who owns an op list.
+struct FCountingOpListData : OpListData
+{
+	explicit FCountingOpListData(int32* InDestroyedCount)
+		: DestroyedCount(InDestroyedCount)
+	{
+	}
+
+	virtual ~FCountingOpListData()
+	{
+		++(*DestroyedCount);
+	}
+
+	int32* DestroyedCount;
+};
+
+// The op count is used to identify op lists.
+OpList MakeOpList(uint32 Id, int32* DestroyedCount = nullptr)
+{
+	TUniquePtr<OpListData> Storage;
+	if (DestroyedCount != nullptr)
+	{
+		Storage = MakeUnique<FCountingOpListData>(DestroyedCount);
+	}
+	return { nullptr, Id, MoveTemp(Storage) };
+}
+
+TArray<uint32> ConsumeIds(FOpListRing& Ring)
+{
+	TArray<uint32> Ids;
+	Ring.ConsumeAll([&Ids](OpList& Ops, uint64)
+	{
+		Ids.Add(Ops.Count);
+	});
+	return Ids;
+}
+} // anonymous namespace
+
+OPLISTRING_TEST(GIVEN_capacity_not_a_power_of_two_WHEN_created_THEN_capacity_is_rounded_up)
+{
+	FOpListRing Ring(5);
+
+	TestEqual(TEXT("Capacity is rounded up to a power of two"), Ring.GetCapacity(), 8u);
+
+	return true;
+}
+
+OPLISTRING_TEST(GIVEN_published_op_lists_WHEN_consumed_THEN_op_lists_returned_in_order_with_receive_times)
+{
+	// GIVEN
+	FOpListRing Ring(4);
+	for (uint32 i = 1; i <= 3; ++i)
+	{
+		OpList Ops = MakeOpList(i);
+		Ring.Publish(Ops, 100 * i);
+	}
+
+	// WHEN
+	TArray<uint32> Ids;
+	bool bReceiveTimesMatch = true;
+	const uint32 NumConsumed = Ring.ConsumeAll([&Ids, &bReceiveTimesMatch](OpList& Ops, uint64 ReceivedCycles)
+	{
+		Ids.Add(Ops.Count);
+		bReceiveTimesMatch &= ReceivedCycles == 100 * Ops.Count;
+	});
+
+	// THEN
+	TestEqual(TEXT("All op lists are consumed"), NumConsumed, 3u);
+	TestTrue(TEXT("Op lists are consumed in order"), Ids == TArray<uint32>({ 1, 2, 3 }));
+	TestTrue(TEXT("Receive times are kept with their op list"), bReceiveTimesMatch);
+	TestEqual(TEXT("Nothing is left to consume"), ConsumeIds(Ring).Num(), 0);
+
+	return true;
+}
+
+OPLISTRING_TEST(GIVEN_full_ring_WHEN_published_THEN_publish_fails_and_op_list_is_kept_until_consumer_catches_up)
+{
+	// GIVEN
+	FOpListRing Ring(2);
+	for (uint32 i = 1; i <= 2; ++i)
+	{
+		OpList Ops = MakeOpList(i);
+		Ring.Publish(Ops, 0);
+	}
+
+	// WHEN
+	int32 DestroyedCount = 0;
+	OpList Rejected = MakeOpList(3, &DestroyedCount);
+	const bool bPublishedWhenFull = Ring.Publish(Rejected, 0);
+
+	// THEN
+	TestTrue(TEXT("Ring is full"), Ring.IsFull());
+	TestFalse(TEXT("Publishing to a full ring fails"), bPublishedWhenFull);
+	TestTrue(TEXT("Rejected op list is left with the producer"), Rejected.Storage.IsValid() && DestroyedCount == 0);
+
+	ConsumeIds(Ring);
+	TestFalse(TEXT("Ring has room once consumed"), Ring.IsFull());
+	TestTrue(TEXT("Op list can be published once the consumer has caught up"), Ring.Publish(Rejected, 0));
+	TestTrue(TEXT("Op list published after wrapping around is consumed"), ConsumeIds(Ring) == TArray<uint32>({ 3 }));
+
+	return true;
+}
+
+OPLISTRING_TEST(GIVEN_consumed_op_list_WHEN_callback_does_not_take_ownership_THEN_op_list_is_destroyed)
+{
+	// GIVEN
+	FOpListRing Ring(2);
+	int32 DestroyedCount = 0;
+	OpList Ops = MakeOpList(1, &DestroyedCount);
+	Ring.Publish(Ops, 0);
+
+	// WHEN
+	ConsumeIds(Ring);
+
+	// THEN
+	TestEqual(TEXT("Op list storage is destroyed once consumed"), DestroyedCount, 1);
+
+	return true;
+}
+
+OPLISTRING_TEST(GIVEN_producer_thread_WHEN_op_lists_are_consumed_concurrently_THEN_all_op_lists_arrive_in_order)
+{
+	// GIVEN
+	const uint32 NumOpLists = 20000;
+	FOpListRing Ring(16);
+
+	// WHEN
+	TFuture<void> Producer = Async(EAsyncExecution::Thread, [&Ring, NumOpLists]()
+	{
+		for (uint32 i = 1; i <= NumOpLists; ++i)
+		{
+			OpList Ops = MakeOpList(i);
+			while (!Ring.Publish(Ops, 0))
+			{
+				FPlatformProcess::Yield();
+			}
+		}
+	});
+
+	uint32 NextExpectedId = 1;
+	bool bInOrder = true;
+	while (NextExpectedId <= NumOpLists)
+	{
+		Ring.ConsumeAll([&NextExpectedId, &bInOrder](OpList& Ops, uint64)
+		{
+			bInOrder &= Ops.Count == NextExpectedId;
+			++NextExpectedId;
+		});
+	}
+	Producer.Wait();
+
+	// THEN
+	TestTrue(TEXT("Op lists are consumed in the order they were published"), bInOrder);
+	TestEqual(TEXT("Every op list is consumed exactly once"), NextExpectedId, NumOpLists + 1);
+
+	return true;
+}
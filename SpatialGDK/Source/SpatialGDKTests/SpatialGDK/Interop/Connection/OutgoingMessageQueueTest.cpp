@@ -0,0 +1,248 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Interop/Connection/OutgoingMessageQueue.h"
+
+#include "Async/Async.h"
+#include "Containers/Queue.h"
+#include "HAL/PlatformTime.h"
+
+#define OUTGOINGMESSAGEQUEUE_TEST(TestName) \
+	GDK_TEST(Core, FOutgoingMessageQueue, TestName)
+
+#define OUTGOINGMESSAGEQUEUE_BENCHMARK(TestName) \
+	GDK_SLOW_TEST(Core, FOutgoingMessageQueue, TestName)
+
+DEFINE_LOG_CATEGORY_STATIC(LogOutgoingMessageQueueTest, Log, All);
+
+using namespace SpatialGDK;
+
+namespace
+{
+// Larger than a slot, so it is constructed in the spill arena. Counts destructions.
+struct FLargeTestMessage : FOutgoingMessage
+{
+	FLargeTestMessage(int32 InValue, int32* InDestroyedCount)
+		: FOutgoingMessage(EOutgoingMessageType::LogMessage)
+		, Value(InValue)
+		, DestroyedCount(InDestroyedCount)
+	{
+		FMemory::Memset(Payload, static_cast<uint8>(InValue), sizeof(Payload));
+	}
+
+	virtual ~FLargeTestMessage()
+	{
+		++(*DestroyedCount);
+	}
+
+	int32 Value;
+	int32* DestroyedCount;
+	uint8 Payload[4 * FOutgoingMessageQueue::SlotSize];
+};
+
+void EnqueueDeleteEntityRequest(FOutgoingMessageQueue& Queue, Worker_EntityId EntityId)
+{
+	Queue.Emplace<FDeleteEntityRequest>(EntityId);
+	Queue.Publish();
+}
+} // anonymous namespace
+
+OUTGOINGMESSAGEQUEUE_TEST(GIVEN_empty_queue_WHEN_peeked_THEN_no_message_returned)
+{
+	FOutgoingMessageQueue Queue;
+
+	TestTrue(TEXT("Empty queue has no messages"), Queue.Peek() == nullptr);
+
+	return true;
+}
+
+OUTGOINGMESSAGEQUEUE_TEST(GIVEN_queue_with_unpublished_message_WHEN_published_THEN_message_becomes_visible)
+{
+	// GIVEN
+	FOutgoingMessageQueue Queue;
+	Queue.Emplace<FDeleteEntityRequest>(1);
+	const bool bVisibleBeforePublish = Queue.Peek() != nullptr;
+
+	// WHEN
+	Queue.Publish();
+
+	// THEN
+	TestFalse(TEXT("Message is not visible before it is published"), bVisibleBeforePublish);
+	TestTrue(TEXT("Message is visible after it is published"), Queue.Peek() != nullptr);
+
+	return true;
+}
+
+OUTGOINGMESSAGEQUEUE_TEST(GIVEN_more_messages_than_fit_in_a_chunk_WHEN_drained_THEN_messages_returned_in_order)
+{
+	// GIVEN
+	const int32 NumMessages = FOutgoingMessageQueue::SlotsPerChunk * 3 + 5;
+	FOutgoingMessageQueue Queue;
+	for (int32 i = 0; i < NumMessages; ++i)
+	{
+		EnqueueDeleteEntityRequest(Queue, i);
+	}
+
+	// WHEN
+	TArray<Worker_EntityId> Received;
+	while (FOutgoingMessage* Message = Queue.Peek())
+	{
+		TestTrue(TEXT("Message has expected type"), Message->Type == EOutgoingMessageType::DeleteEntityRequest);
+		Received.Add(static_cast<FDeleteEntityRequest*>(Message)->EntityId);
+		Queue.Pop();
+	}
+
+	// THEN
+	bool bInOrder = Received.Num() == NumMessages;
+	for (int32 i = 0; bInOrder && i < NumMessages; ++i)
+	{
+		bInOrder = Received[i] == i;
+	}
+	TestTrue(TEXT("All messages were received in order"), bInOrder);
+
+	return true;
+}
+
+OUTGOINGMESSAGEQUEUE_TEST(GIVEN_messages_larger_than_a_slot_WHEN_drained_THEN_messages_are_intact_and_destroyed)
+{
+	// GIVEN
+	const int32 NumMessages = FOutgoingMessageQueue::SlotsPerChunk * 2;
+	int32 DestroyedCount = 0;
+	FOutgoingMessageQueue Queue;
+	for (int32 i = 0; i < NumMessages; ++i)
+	{
+		Queue.Emplace<FLargeTestMessage>(i, &DestroyedCount);
+		Queue.Publish();
+	}
+
+	// WHEN
+	bool bIntact = true;
+	int32 Expected = 0;
+	while (FOutgoingMessage* Message = Queue.Peek())
+	{
+		const FLargeTestMessage* LargeMessage = static_cast<FLargeTestMessage*>(Message);
+		bIntact &= LargeMessage->Value == Expected;
+		bIntact &= LargeMessage->Payload[sizeof(LargeMessage->Payload) - 1] == static_cast<uint8>(Expected);
+		++Expected;
+		Queue.Pop();
+	}
+
+	// THEN
+	TestTrue(TEXT("Spilled messages were received intact"), bIntact && Expected == NumMessages);
+	TestEqual(TEXT("All spilled messages were destroyed"), DestroyedCount, NumMessages);
+
+	return true;
+}
+
+OUTGOINGMESSAGEQUEUE_TEST(GIVEN_queue_with_messages_WHEN_queue_destroyed_THEN_all_messages_destroyed)
+{
+	int32 DestroyedCount = 0;
+	{
+		FOutgoingMessageQueue Queue;
+		for (int32 i = 0; i < 10; ++i)
+		{
+			Queue.Emplace<FLargeTestMessage>(i, &DestroyedCount);
+			Queue.Publish();
+		}
+		Queue.Emplace<FLargeTestMessage>(10, &DestroyedCount);
+	}
+
+	TestEqual(TEXT("Published and unpublished messages were destroyed"), DestroyedCount, 11);
+
+	return true;
+}
+
+OUTGOINGMESSAGEQUEUE_TEST(GIVEN_producer_on_another_thread_WHEN_consumer_drains_THEN_messages_returned_in_order)
+{
+	// GIVEN
+	const int32 NumMessages = 100000;
+	FOutgoingMessageQueue Queue;
+
+	// WHEN
+	TFuture<void> Producer = Async(EAsyncExecution::Thread, [&Queue, NumMessages]
+	{
+		for (int32 i = 0; i < NumMessages; ++i)
+		{
+			EnqueueDeleteEntityRequest(Queue, i);
+		}
+	});
+
+	int32 Expected = 0;
+	bool bInOrder = true;
+	const double StartTime = FPlatformTime::Seconds();
+	while (Expected < NumMessages && FPlatformTime::Seconds() - StartTime < 10.0)
+	{
+		if (FOutgoingMessage* Message = Queue.Peek())
+		{
+			bInOrder &= static_cast<FDeleteEntityRequest*>(Message)->EntityId == Expected;
+			++Expected;
+			Queue.Pop();
+		}
+	}
+	Producer.Wait();
+
+	// THEN
+	TestEqual(TEXT("All messages were received"), Expected, NumMessages);
+	TestTrue(TEXT("Messages were received in order"), bInOrder);
+
+	return true;
+}
+
+OUTGOINGMESSAGEQUEUE_BENCHMARK(GIVEN_many_component_updates_WHEN_enqueued_and_dequeued_THEN_report_throughput_against_TQueue)
+{
+	const int32 NumTicks = 1000;
+	const int32 MessagesPerTick = 1000;
+	const int32 NumMessages = NumTicks * MessagesPerTick;
+
+	FWorkerComponentUpdate Update = {};
+	Update.component_id = 1;
+
+	// Baseline: heap allocated messages in a TQueue, as used before FOutgoingMessageQueue.
+	double BaselineSeconds;
+	{
+		TQueue<TUniquePtr<FOutgoingMessage>> BaselineQueue;
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Tick = 0; Tick < NumTicks; ++Tick)
+		{
+			for (int32 i = 0; i < MessagesPerTick; ++i)
+			{
+				BaselineQueue.Enqueue(MakeUnique<FComponentUpdate>(i, Update));
+			}
+			TUniquePtr<FOutgoingMessage> Message;
+			while (BaselineQueue.Dequeue(Message))
+			{
+				Message.Reset();
+			}
+		}
+		BaselineSeconds = FPlatformTime::Seconds() - StartTime;
+	}
+
+	double QueueSeconds;
+	int32 Dequeued = 0;
+	{
+		FOutgoingMessageQueue Queue;
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Tick = 0; Tick < NumTicks; ++Tick)
+		{
+			for (int32 i = 0; i < MessagesPerTick; ++i)
+			{
+				Queue.Emplace<FComponentUpdate>(i, Update);
+				Queue.Publish();
+			}
+			while (Queue.Peek() != nullptr)
+			{
+				Queue.Pop();
+				++Dequeued;
+			}
+		}
+		QueueSeconds = FPlatformTime::Seconds() - StartTime;
+	}
+
+	TestEqual(TEXT("All messages were dequeued"), Dequeued, NumMessages);
+
+	UE_LOG(LogOutgoingMessageQueueTest, Display, TEXT("TQueue<TUniquePtr<FOutgoingMessage>>: %.1f ns/message. FOutgoingMessageQueue: %.1f ns/message (%.2fx)."),
+		BaselineSeconds * 1e9 / NumMessages, QueueSeconds * 1e9 / NumMessages, BaselineSeconds / FMath::Max(QueueSeconds, SMALL_NUMBER));
+
+	return true;
+}
@@ -0,0 +1,150 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Interop/EntityOpGrouper.h"
+
+#define ENTITYOPGROUPER_TEST(TestName) \
+	GDK_TEST(Core, FEntityOpGrouper, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+// The component ID is used to identify ops.
+Worker_ComponentUpdateOp MakeUpdateOp(Worker_EntityId EntityId, Worker_ComponentId Id)
+{
+	Worker_ComponentUpdateOp Op = {};
+	Op.entity_id = EntityId;
+	Op.update.component_id = Id;
+	return Op;
+}
+
+struct FEntityGroup
+{
+	Worker_EntityId EntityId;
+	TArray<Worker_ComponentId> Ids;
+};
+
+TArray<FEntityGroup> FlushGroups(FEntityOpGrouper& Grouper)
+{
+	TArray<FEntityGroup> Groups;
+	Grouper.Flush([&Groups](Worker_EntityId EntityId, FEntityOpGrouper::FEntityOps Ops)
+	{
+		FEntityGroup& Group = Groups.AddDefaulted_GetRef();
+		Group.EntityId = EntityId;
+		for (const Worker_ComponentUpdateOp* Op : Ops)
+		{
+			Group.Ids.Add(Op->update.component_id);
+		}
+	});
+	return Groups;
+}
+} // anonymous namespace
+
+ENTITYOPGROUPER_TEST(GIVEN_interleaved_ops_WHEN_flushed_THEN_ops_are_grouped_by_entity_in_received_order)
+{
+	// GIVEN
+	const TArray<Worker_ComponentUpdateOp> Ops = {
+		MakeUpdateOp(3, 1),
+		MakeUpdateOp(1, 2),
+		MakeUpdateOp(3, 3),
+		MakeUpdateOp(2, 4),
+		MakeUpdateOp(1, 5),
+		MakeUpdateOp(3, 6)
+	};
+	FEntityOpGrouper Grouper;
+	for (const Worker_ComponentUpdateOp& Op : Ops)
+	{
+		Grouper.Add(Op);
+	}
+
+	// WHEN
+	const TArray<FEntityGroup> Groups = FlushGroups(Grouper);
+
+	// THEN
+	TestEqual(TEXT("There is one group per entity"), Groups.Num(), 3);
+	TestTrue(TEXT("Groups are in entity ID order"), Groups[0].EntityId == 1 && Groups[1].EntityId == 2 && Groups[2].EntityId == 3);
+	TestTrue(TEXT("Entity 1 ops keep their order"), Groups[0].Ids == TArray<Worker_ComponentId>({ 2, 5 }));
+	TestTrue(TEXT("Entity 2 ops keep their order"), Groups[1].Ids == TArray<Worker_ComponentId>({ 4 }));
+	TestTrue(TEXT("Entity 3 ops keep their order"), Groups[2].Ids == TArray<Worker_ComponentId>({ 1, 3, 6 }));
+	TestTrue(TEXT("Grouper is empty once flushed"), Grouper.IsEmpty());
+
+	return true;
+}
+
+ENTITYOPGROUPER_TEST(GIVEN_entity_ids_differing_in_high_bytes_WHEN_flushed_THEN_ops_are_sorted_by_full_entity_id)
+{
+	// GIVEN
+	const Worker_EntityId HighEntityId = (Worker_EntityId(1) << 40) + 7;
+	const Worker_EntityId MidEntityId = (Worker_EntityId(1) << 16) + 7;
+	const Worker_EntityId LowEntityId = 7;
+	const TArray<Worker_ComponentUpdateOp> Ops = {
+		MakeUpdateOp(HighEntityId, 1),
+		MakeUpdateOp(LowEntityId, 2),
+		MakeUpdateOp(MidEntityId, 3),
+		MakeUpdateOp(HighEntityId, 4),
+		MakeUpdateOp(LowEntityId, 5)
+	};
+	FEntityOpGrouper Grouper;
+	for (const Worker_ComponentUpdateOp& Op : Ops)
+	{
+		Grouper.Add(Op);
+	}
+
+	// WHEN
+	const TArray<FEntityGroup> Groups = FlushGroups(Grouper);
+
+	// THEN
+	TestEqual(TEXT("There is one group per entity"), Groups.Num(), 3);
+	TestTrue(TEXT("Groups are in entity ID order"), Groups[0].EntityId == LowEntityId && Groups[1].EntityId == MidEntityId && Groups[2].EntityId == HighEntityId);
+	TestTrue(TEXT("Low entity ops keep their order"), Groups[0].Ids == TArray<Worker_ComponentId>({ 2, 5 }));
+	TestTrue(TEXT("High entity ops keep their order"), Groups[2].Ids == TArray<Worker_ComponentId>({ 1, 4 }));
+
+	return true;
+}
+
+ENTITYOPGROUPER_TEST(GIVEN_many_ops_WHEN_flushed_THEN_every_op_is_returned_once_grouped_and_in_order)
+{
+	// GIVEN
+	const int32 NumOps = 10000;
+	FRandomStream Random(42);
+	TArray<Worker_ComponentUpdateOp> Ops;
+	Ops.Reserve(NumOps);
+	for (int32 i = 0; i < NumOps; ++i)
+	{
+		Ops.Add(MakeUpdateOp(Random.RandRange(1, 500), i));
+	}
+	FEntityOpGrouper Grouper;
+	for (const Worker_ComponentUpdateOp& Op : Ops)
+	{
+		Grouper.Add(Op);
+	}
+
+	// WHEN
+	const TArray<FEntityGroup> Groups = FlushGroups(Grouper);
+
+	// THEN
+	int32 NumReturned = 0;
+	bool bEntitiesAscending = true;
+	bool bOpsInOrder = true;
+	bool bOpsInGroupEntity = true;
+	for (int32 GroupIndex = 0; GroupIndex < Groups.Num(); ++GroupIndex)
+	{
+		const FEntityGroup& Group = Groups[GroupIndex];
+		bEntitiesAscending &= GroupIndex == 0 || Groups[GroupIndex - 1].EntityId < Group.EntityId;
+		for (int32 i = 0; i < Group.Ids.Num(); ++i)
+		{
+			bOpsInOrder &= i == 0 || Group.Ids[i - 1] < Group.Ids[i];
+			bOpsInGroupEntity &= Ops[Group.Ids[i]].entity_id == Group.EntityId;
+		}
+		NumReturned += Group.Ids.Num();
+	}
+
+	TestEqual(TEXT("Every op is returned once"), NumReturned, NumOps);
+	TestTrue(TEXT("Each entity has a single group, in entity ID order"), bEntitiesAscending);
+	TestTrue(TEXT("Ops are returned with their entity"), bOpsInGroupEntity);
+	TestTrue(TEXT("Ops within an entity keep the order they were added in"), bOpsInOrder);
+
+	return true;
+}
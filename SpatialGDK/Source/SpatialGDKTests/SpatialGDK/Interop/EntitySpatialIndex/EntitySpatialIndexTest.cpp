@@ -0,0 +1,305 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Interop/EntitySpatialIndex.h"
+
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "UObject/Class.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+#define ENTITYSPATIALINDEX_TEST(TestName) \
+	GDK_TEST(Core, FEntitySpatialIndex, TestName)
+
+#define ENTITYSPATIALINDEX_BENCHMARK(TestName) \
+	GDK_SLOW_TEST(Core, FEntitySpatialIndex, TestName)
+
+DEFINE_LOG_CATEGORY_STATIC(LogEntitySpatialIndexTest, Log, All);
+
+using namespace SpatialGDK;
+
+namespace
+{
+const double TestCellSize = 10.0;
+
+bool ContainsExactly(TArray<Worker_EntityId> EntityIds, TArray<Worker_EntityId> ExpectedEntityIds)
+{
+	EntityIds.Sort();
+	ExpectedEntityIds.Sort();
+	return EntityIds == ExpectedEntityIds;
+}
+
+// Stands in for an actor: heap allocated, with its relevancy checked through a virtual call as AActor::IsNetRelevantFor is.
+class FSyntheticActor
+{
+public:
+	virtual ~FSyntheticActor() = default;
+
+	virtual bool IsNetRelevantFor(const FVector& SrcLocation) const
+	{
+		if (bAlwaysRelevant || Owner != nullptr)
+		{
+			return true;
+		}
+		return FVector::DistSquared(SrcLocation, Location) < NetCullDistanceSquared;
+	}
+
+	Worker_EntityId EntityId;
+	UClass* Class;
+	FVector Location;
+	float NetCullDistanceSquared;
+	bool bAlwaysRelevant = false;
+	const FSyntheticActor* Owner = nullptr;
+	// Padding for the rest of the actor state, so actors don't share cache lines as they wouldn't in a real world.
+	uint8 OtherState[512];
+};
+} // anonymous namespace
+
+ENTITYSPATIALINDEX_TEST(GIVEN_entities_WHEN_sphere_queried_THEN_entities_inside_sphere_returned)
+{
+	// GIVEN
+	FEntitySpatialIndex Index(TestCellSize);
+	Index.SetEntityPosition(1, Coordinates{ 0.0, 0.0, 0.0 });
+	Index.SetEntityPosition(2, Coordinates{ 14.0, 0.0, 0.0 });
+	Index.SetEntityPosition(3, Coordinates{ 10.0, 10.0, 10.0 });
+	Index.SetEntityPosition(4, Coordinates{ 0.0, 16.0, 0.0 });
+	Index.SetEntityPosition(5, Coordinates{ -100.0, 0.0, -100.0 });
+
+	// WHEN
+	const SphereConstraint Sphere{ Coordinates{ 0.0, 0.0, 0.0 }, 15.0 };
+	TArray<Worker_EntityId> EntityIds;
+	Index.QuerySpheres(MakeArrayView(&Sphere, 1), EntityIds);
+
+	// THEN
+	TestTrue(TEXT("Only entities within the radius in all three axes are returned"), ContainsExactly(EntityIds, { 1, 2 }));
+
+	return true;
+}
+
+ENTITYSPATIALINDEX_TEST(GIVEN_entities_WHEN_cylinder_queried_THEN_height_is_ignored)
+{
+	// GIVEN
+	FEntitySpatialIndex Index(TestCellSize);
+	Index.SetEntityPosition(1, Coordinates{ 0.0, 1000.0, 0.0 });
+	Index.SetEntityPosition(2, Coordinates{ 3.0, -1000.0, 4.0 });
+	Index.SetEntityPosition(3, Coordinates{ 6.0, 0.0, 0.0 });
+
+	// WHEN
+	const CylinderConstraint Cylinder{ Coordinates{ 0.0, 0.0, 0.0 }, 5.0 };
+	TArray<Worker_EntityId> EntityIds;
+	Index.QueryCylinders(MakeArrayView(&Cylinder, 1), EntityIds);
+
+	// THEN
+	TestTrue(TEXT("Entities within the radius in X and Z are returned at any height"), ContainsExactly(EntityIds, { 1, 2 }));
+
+	return true;
+}
+
+ENTITYSPATIALINDEX_TEST(GIVEN_entities_WHEN_box_queried_THEN_entities_inside_box_returned)
+{
+	// GIVEN
+	FEntitySpatialIndex Index(TestCellSize);
+	Index.SetEntityPosition(1, Coordinates{ 19.0, 0.0, -4.0 });
+	Index.SetEntityPosition(2, Coordinates{ 21.0, 0.0, 0.0 });
+	Index.SetEntityPosition(3, Coordinates{ 0.0, 3.0, 0.0 });
+	Index.SetEntityPosition(4, Coordinates{ 0.0, 0.0, 6.0 });
+
+	// WHEN
+	const BoxConstraint Box{ Coordinates{ 0.0, 0.0, 0.0 }, EdgeLength{ 40.0, 4.0, 10.0 } };
+	TArray<Worker_EntityId> EntityIds;
+	Index.QueryBoxes(MakeArrayView(&Box, 1), EntityIds);
+
+	// THEN
+	TestTrue(TEXT("Only entities within half the edge length on each axis are returned"), ContainsExactly(EntityIds, { 1 }));
+
+	return true;
+}
+
+ENTITYSPATIALINDEX_TEST(GIVEN_overlapping_shapes_WHEN_queried_in_one_batch_THEN_each_entity_returned_once)
+{
+	// GIVEN
+	FEntitySpatialIndex Index(TestCellSize);
+	Index.SetEntityPosition(1, Coordinates{ 0.0, 0.0, 0.0 });
+	Index.SetEntityPosition(2, Coordinates{ 5.0, 0.0, 0.0 });
+	Index.SetEntityPosition(3, Coordinates{ 50.0, 0.0, 0.0 });
+
+	// WHEN
+	const TArray<SphereConstraint> Spheres = {
+		SphereConstraint{ Coordinates{ 0.0, 0.0, 0.0 }, 6.0 },
+		SphereConstraint{ Coordinates{ 5.0, 0.0, 0.0 }, 6.0 },
+		SphereConstraint{ Coordinates{ 50.0, 0.0, 0.0 }, 1.0 }
+	};
+	TArray<Worker_EntityId> FirstEntityIds;
+	Index.QuerySpheres(Spheres, FirstEntityIds);
+	TArray<Worker_EntityId> SecondEntityIds;
+	Index.QuerySpheres(Spheres, SecondEntityIds);
+
+	// THEN
+	TestTrue(TEXT("Entities in several shapes are returned once"), ContainsExactly(FirstEntityIds, { 1, 2, 3 }));
+	TestTrue(TEXT("Later queries return the same entities"), ContainsExactly(SecondEntityIds, { 1, 2, 3 }));
+
+	return true;
+}
+
+ENTITYSPATIALINDEX_TEST(GIVEN_queried_index_WHEN_checking_entities_THEN_only_indexed_entities_the_query_missed_are_outside_it)
+{
+	// GIVEN
+	FEntitySpatialIndex Index(TestCellSize);
+	Index.SetEntityPosition(1, Coordinates{ 0.0, 0.0, 0.0 });
+	Index.SetEntityPosition(2, Coordinates{ 100.0, 0.0, 0.0 });
+	const bool bOutsideBeforeQuery = Index.IsOutsideLastQuery(2);
+
+	// WHEN
+	const SphereConstraint Sphere{ Coordinates{ 0.0, 0.0, 0.0 }, 5.0 };
+	TArray<Worker_EntityId> EntityIds;
+	Index.QuerySpheres(MakeArrayView(&Sphere, 1), EntityIds);
+
+	// THEN
+	TestFalse(TEXT("Entities are not outside a query before one is made"), bOutsideBeforeQuery);
+	TestFalse(TEXT("Entity returned by the query is not outside it"), Index.IsOutsideLastQuery(1));
+	TestTrue(TEXT("Entity the query missed is outside it"), Index.IsOutsideLastQuery(2));
+	TestFalse(TEXT("Entity missing from the index is not outside it"), Index.IsOutsideLastQuery(3));
+
+	return true;
+}
+
+ENTITYSPATIALINDEX_TEST(GIVEN_entities_WHEN_moved_and_removed_THEN_queries_reflect_latest_positions)
+{
+	// GIVEN
+	FEntitySpatialIndex Index(TestCellSize);
+	for (Worker_EntityId EntityId = 1; EntityId <= 4; ++EntityId)
+	{
+		Index.SetEntityPosition(EntityId, Coordinates{ 1.0, 0.0, 1.0 });
+	}
+
+	// WHEN
+	Index.SetEntityPosition(2, Coordinates{ 100.0, 0.0, 100.0 });
+	Index.RemoveEntity(1);
+	Index.RemoveEntity(5);
+	Index.SetEntityPosition(4, Coordinates{ 2.0, 0.0, 2.0 });
+
+	// THEN
+	const CylinderConstraint Origin{ Coordinates{ 0.0, 0.0, 0.0 }, 5.0 };
+	TArray<Worker_EntityId> NearOrigin;
+	Index.QueryCylinders(MakeArrayView(&Origin, 1), NearOrigin);
+
+	const CylinderConstraint Moved{ Coordinates{ 100.0, 0.0, 100.0 }, 5.0 };
+	TArray<Worker_EntityId> NearMoved;
+	Index.QueryCylinders(MakeArrayView(&Moved, 1), NearMoved);
+
+	TestEqual(TEXT("Removed entities are no longer counted"), Index.Num(), 3);
+	TestFalse(TEXT("Removed entity is no longer contained"), Index.Contains(1));
+	TestTrue(TEXT("Entities left in the cell are still found"), ContainsExactly(NearOrigin, { 3, 4 }));
+	TestTrue(TEXT("Moved entity is found at its new position"), ContainsExactly(NearMoved, { 2 }));
+
+
+	return true;
+}
+
+ENTITYSPATIALINDEX_BENCHMARK(GIVEN_synthetic_actors_WHEN_relevancy_filtered_by_query_THEN_report_throughput_against_virtual_calls)
+{
+	const int32 NumFrames = 20;
+	const float NetCullDistance = 15000.f;
+	// Matches the default EntitySpatialIndexRelevancyMargin.
+	const float Margin = 1000.f;
+
+	TArray<FVector> ViewLocations;
+	TArray<SphereConstraint> Spheres;
+	for (int32 i = 0; i < 4; ++i)
+	{
+		ViewLocations.Add(FVector(i * 40000.f, 0.f, 0.f));
+		Spheres.Add(SphereConstraint{ Coordinates::FromFVector(ViewLocations.Last()), (NetCullDistance + Margin) * 0.01 });
+	}
+
+	for (const int32 NumActors : { 10000, 50000, 100000 })
+	{
+		FRandomStream Random(NumActors);
+
+		// Actors are allocated separately and considered in a shuffled order, as they would be from the network object list.
+		// All of them are of an opted-in class, and spread over a world much larger than the viewers' net cull distances.
+		FEntitySpatialIndex Index(50.0);
+		TArray<TUniquePtr<FSyntheticActor>> Actors;
+		TArray<FSyntheticActor*> ConsiderList;
+		for (int32 i = 0; i < NumActors; ++i)
+		{
+			TUniquePtr<FSyntheticActor> Actor = MakeUnique<FSyntheticActor>();
+			Actor->EntityId = i + 1;
+			Actor->Class = UObject::StaticClass();
+			Actor->Location = FVector(Random.FRandRange(-200000.f, 320000.f), Random.FRandRange(-200000.f, 200000.f), 0.f);
+			Actor->NetCullDistanceSquared = FMath::Square(NetCullDistance);
+			Index.SetEntityPosition(Actor->EntityId, Coordinates::FromFVector(Actor->Location));
+			ConsiderList.Add(Actor.Get());
+			Actors.Add(MoveTemp(Actor));
+		}
+		for (int32 i = ConsiderList.Num() - 1; i > 0; --i)
+		{
+			ConsiderList.Swap(i, Random.RandRange(0, i));
+		}
+
+		TMap<TWeakObjectPtr<UClass>, bool> DistanceOnlyClasses;
+		DistanceOnlyClasses.Add(UObject::StaticClass(), true);
+
+		// Baseline: each actor's relevancy is checked through a virtual call for every viewer until one finds it relevant.
+		int32 BaselineRelevant = 0;
+		double BaselineSeconds;
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+			{
+				BaselineRelevant = 0;
+				for (const FSyntheticActor* Actor : ConsiderList)
+				{
+					for (const FVector& ViewLocation : ViewLocations)
+					{
+						if (Actor->IsNetRelevantFor(ViewLocation))
+						{
+							BaselineRelevant++;
+							break;
+						}
+					}
+				}
+			}
+			BaselineSeconds = FPlatformTime::Seconds() - StartTime;
+		}
+
+		// Index: one query per frame, then actors of opted-in classes that it missed are skipped, as the net driver does.
+		TArray<Worker_EntityId> EntitiesNearViewers;
+		int32 IndexRelevant = 0;
+		double IndexSeconds;
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+			{
+				IndexRelevant = 0;
+				EntitiesNearViewers.Reset();
+				Index.QuerySpheres(Spheres, EntitiesNearViewers);
+				for (const FSyntheticActor* Actor : ConsiderList)
+				{
+					if (!Actor->bAlwaysRelevant && Actor->Owner == nullptr && DistanceOnlyClasses.FindRef(Actor->Class)
+						&& Index.IsOutsideLastQuery(Actor->EntityId))
+					{
+						continue;
+					}
+
+					for (const FVector& ViewLocation : ViewLocations)
+					{
+						if (Actor->IsNetRelevantFor(ViewLocation))
+						{
+							IndexRelevant++;
+							break;
+						}
+					}
+				}
+			}
+			IndexSeconds = FPlatformTime::Seconds() - StartTime;
+		}
+
+		TestEqual(FString::Printf(TEXT("Relevant actors found with the index match the virtual calls for %d actors"), NumActors), IndexRelevant, BaselineRelevant);
+
+		UE_LOG(LogEntitySpatialIndexTest, Display, TEXT("%d actors, %d viewers, %d relevant. Virtual calls: %.2f ms/frame. Spatial index: %.2f ms/frame (%.2fx)."),
+			NumActors, ViewLocations.Num(), BaselineRelevant, BaselineSeconds * 1e3 / NumFrames, IndexSeconds * 1e3 / NumFrames, BaselineSeconds / FMath::Max(IndexSeconds, SMALL_NUMBER));
+	}
+
+	return true;
+}
@@ -0,0 +1,242 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Interop/OpCallbackTable.h"
+#include "SpatialView/OpList/OpList.h"
+#include "Utils/OpUtils.h"
+
+#include "HAL/PlatformTime.h"
+
+#define OPCALLBACKTABLE_TEST(TestName) \
+	GDK_TEST(Core, FOpCallbackTable, TestName)
+
+#define OPCALLBACKTABLE_BENCHMARK(TestName) \
+	GDK_SLOW_TEST(Core, FOpCallbackTable, TestName)
+
+DEFINE_LOG_CATEGORY_STATIC(LogOpCallbackTableTest, Log, All);
+
+using namespace SpatialGDK;
+
+namespace
+{
+const Worker_ComponentId TestComponentId = SpatialConstants::MIN_EXTERNAL_SCHEMA_ID + 1;
+const Worker_ComponentId OtherTestComponentId = SpatialConstants::MIN_EXTERNAL_SCHEMA_ID + 2;
+
+Worker_Op MakeComponentUpdateOp(Worker_EntityId EntityId, Worker_ComponentId ComponentId)
+{
+	Worker_Op Op = {};
+	Op.op_type = WORKER_OP_TYPE_COMPONENT_UPDATE;
+	Op.op.component_update.entity_id = EntityId;
+	Op.op.component_update.update.component_id = ComponentId;
+	return Op;
+}
+
+Worker_Op MakeAddComponentOp(Worker_EntityId EntityId, Worker_ComponentId ComponentId)
+{
+	Worker_Op Op = {};
+	Op.op_type = WORKER_OP_TYPE_ADD_COMPONENT;
+	Op.op.add_component.entity_id = EntityId;
+	Op.op.add_component.data.component_id = ComponentId;
+	return Op;
+}
+
+TFunction<void(const Worker_ComponentUpdateOp&)> RecordUpdate(TArray<int32>& Calls, int32 CallbackIndex)
+{
+	return [&Calls, CallbackIndex](const Worker_ComponentUpdateOp&)
+	{
+		Calls.Add(CallbackIndex);
+	};
+}
+} // anonymous namespace
+
+OPCALLBACKTABLE_TEST(GIVEN_component_ids_WHEN_checked_THEN_only_external_schema_ids_are_routed)
+{
+	TestTrue(TEXT("Minimum external schema ID is routed"), FOpCallbackTable::IsExternalSchemaComponent(SpatialConstants::MIN_EXTERNAL_SCHEMA_ID));
+	TestTrue(TEXT("Maximum external schema ID is routed"), FOpCallbackTable::IsExternalSchemaComponent(SpatialConstants::MAX_EXTERNAL_SCHEMA_ID));
+	TestFalse(TEXT("Invalid component ID is not routed"), FOpCallbackTable::IsExternalSchemaComponent(SpatialConstants::INVALID_COMPONENT_ID));
+	TestFalse(TEXT("ID below the range is not routed"), FOpCallbackTable::IsExternalSchemaComponent(SpatialConstants::MIN_EXTERNAL_SCHEMA_ID - 1));
+	TestFalse(TEXT("ID above the range is not routed"), FOpCallbackTable::IsExternalSchemaComponent(SpatialConstants::MAX_EXTERNAL_SCHEMA_ID + 1));
+
+	return true;
+}
+
+OPCALLBACKTABLE_TEST(GIVEN_callbacks_for_several_components_and_op_types_WHEN_op_dispatched_THEN_only_matching_callbacks_run)
+{
+	// GIVEN
+	FOpCallbackTable Table;
+	TArray<int32> Calls;
+	int32 NumAddComponentCalls = 0;
+	Table.Add(1, TestComponentId, RecordUpdate(Calls, 1));
+	Table.Add(2, OtherTestComponentId, RecordUpdate(Calls, 2));
+	Table.Add(3, TestComponentId, TFunction<void(const Worker_AddComponentOp&)>([&NumAddComponentCalls](const Worker_AddComponentOp&)
+	{
+		++NumAddComponentCalls;
+	}));
+
+	// WHEN
+	const Worker_Op Op = MakeComponentUpdateOp(1, TestComponentId);
+	Table.Dispatch(TestComponentId, Op);
+
+	// THEN
+	TestTrue(TEXT("Only the callback for the op's component and type runs"), Calls == TArray<int32>({ 1 }));
+	TestEqual(TEXT("Callbacks for other op types do not run"), NumAddComponentCalls, 0);
+
+	const Worker_Op AddOp = MakeAddComponentOp(1, TestComponentId);
+	Table.Dispatch(TestComponentId, AddOp);
+	TestEqual(TEXT("Callback for add component ops runs"), NumAddComponentCalls, 1);
+
+	return true;
+}
+
+OPCALLBACKTABLE_TEST(GIVEN_several_callbacks_for_a_component_WHEN_op_dispatched_THEN_callbacks_run_in_registration_order)
+{
+	// GIVEN
+	FOpCallbackTable Table;
+	TArray<int32> Calls;
+	Table.Add(1, OtherTestComponentId, RecordUpdate(Calls, 1));
+	Table.Add(2, TestComponentId, RecordUpdate(Calls, 2));
+	Table.Add(3, OtherTestComponentId, RecordUpdate(Calls, 3));
+	Table.Add(4, TestComponentId, RecordUpdate(Calls, 4));
+
+	// WHEN
+	const Worker_Op Op = MakeComponentUpdateOp(1, OtherTestComponentId);
+	Table.Dispatch(OtherTestComponentId, Op);
+
+	// THEN
+	TestTrue(TEXT("Callbacks run in the order they were added"), Calls == TArray<int32>({ 1, 3 }));
+
+	return true;
+}
+
+OPCALLBACKTABLE_TEST(GIVEN_removed_callback_WHEN_op_dispatched_THEN_removed_callback_does_not_run)
+{
+	// GIVEN
+	FOpCallbackTable Table;
+	TArray<int32> Calls;
+	Table.Add(1, TestComponentId, RecordUpdate(Calls, 1));
+	Table.Add(2, TestComponentId, RecordUpdate(Calls, 2));
+	Table.Add(3, OtherTestComponentId, RecordUpdate(Calls, 3));
+
+	// WHEN
+	const bool bRemoved = Table.Remove(1);
+	const bool bRemovedTwice = Table.Remove(1);
+	const Worker_Op Op = MakeComponentUpdateOp(1, TestComponentId);
+	Table.Dispatch(TestComponentId, Op);
+	const Worker_Op OtherOp = MakeComponentUpdateOp(1, OtherTestComponentId);
+	Table.Dispatch(OtherTestComponentId, OtherOp);
+
+	// THEN
+	TestTrue(TEXT("Registered callback is removed"), bRemoved);
+	TestFalse(TEXT("Removing an unknown callback fails"), bRemovedTwice);
+	TestTrue(TEXT("Remaining callbacks still run"), Calls == TArray<int32>({ 2, 3 }));
+
+	return true;
+}
+
+OPCALLBACKTABLE_BENCHMARK(GIVEN_synthetic_op_lists_WHEN_dispatched_THEN_report_throughput_against_nested_maps)
+{
+	const int32 NumComponents = 200;
+	const int32 NumOpLists = 200;
+	const int32 OpsPerList = 5000;
+
+	// Ops cycle through component update, add component and authority change ops on external schema components.
+	TArray<Worker_Op> OpStorage;
+	OpStorage.SetNumZeroed(OpsPerList);
+	for (int32 i = 0; i < OpsPerList; ++i)
+	{
+		const Worker_ComponentId ComponentId = SpatialConstants::MIN_EXTERNAL_SCHEMA_ID + (i * 7) % NumComponents;
+		Worker_Op& Op = OpStorage[i];
+		switch (i % 3)
+		{
+		case 0:
+			Op = MakeComponentUpdateOp(i, ComponentId);
+			break;
+		case 1:
+			Op = MakeAddComponentOp(i, ComponentId);
+			break;
+		default:
+			Op.op_type = WORKER_OP_TYPE_AUTHORITY_CHANGE;
+			Op.op.authority_change.entity_id = i;
+			Op.op.authority_change.component_id = ComponentId;
+			break;
+		}
+	}
+	const OpList Ops = { OpStorage.GetData(), static_cast<uint32>(OpStorage.Num()), nullptr };
+
+	int64 BaselineCalls = 0;
+	int64 TableCalls = 0;
+
+	// Baseline: callbacks wrapped in a generic TFunction and found through nested maps, as used before FOpCallbackTable.
+	double BaselineSeconds;
+	{
+		TMap<Worker_ComponentId, TMap<Worker_OpType, TArray<TFunction<void(const Worker_Op*)>>>> Callbacks;
+		for (int32 i = 0; i < NumComponents; ++i)
+		{
+			const Worker_ComponentId ComponentId = SpatialConstants::MIN_EXTERNAL_SCHEMA_ID + i;
+			TFunction<void(const Worker_ComponentUpdateOp&)> OnUpdate = [&BaselineCalls](const Worker_ComponentUpdateOp& Op) { BaselineCalls += Op.entity_id; };
+			TFunction<void(const Worker_AddComponentOp&)> OnAdd = [&BaselineCalls](const Worker_AddComponentOp& Op) { BaselineCalls += Op.entity_id; };
+			TFunction<void(const Worker_AuthorityChangeOp&)> OnAuthority = [&BaselineCalls](const Worker_AuthorityChangeOp& Op) { BaselineCalls += Op.entity_id; };
+			Callbacks.FindOrAdd(ComponentId).FindOrAdd(WORKER_OP_TYPE_COMPONENT_UPDATE).Add([OnUpdate](const Worker_Op* Op) { OnUpdate(Op->op.component_update); });
+			Callbacks.FindOrAdd(ComponentId).FindOrAdd(WORKER_OP_TYPE_ADD_COMPONENT).Add([OnAdd](const Worker_Op* Op) { OnAdd(Op->op.add_component); });
+			Callbacks.FindOrAdd(ComponentId).FindOrAdd(WORKER_OP_TYPE_AUTHORITY_CHANGE).Add([OnAuthority](const Worker_Op* Op) { OnAuthority(Op->op.authority_change); });
+		}
+
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 List = 0; List < NumOpLists; ++List)
+		{
+			for (uint32 i = 0; i < Ops.Count; ++i)
+			{
+				const Worker_Op* Op = &Ops.Ops[i];
+				const Worker_ComponentId ComponentId = GetComponentId(Op);
+				if (TMap<Worker_OpType, TArray<TFunction<void(const Worker_Op*)>>>* OpTypeCallbacks = Callbacks.Find(ComponentId))
+				{
+					if (TArray<TFunction<void(const Worker_Op*)>>* ComponentCallbacks = OpTypeCallbacks->Find(static_cast<Worker_OpType>(Op->op_type)))
+					{
+						for (TFunction<void(const Worker_Op*)> Callback : *ComponentCallbacks)
+						{
+							Callback(Op);
+						}
+					}
+				}
+			}
+		}
+		BaselineSeconds = FPlatformTime::Seconds() - StartTime;
+	}
+
+	double TableSeconds;
+	{
+		FOpCallbackTable Table;
+		FOpCallbackTable::FCallbackId NextId = 0;
+		for (int32 i = 0; i < NumComponents; ++i)
+		{
+			const Worker_ComponentId ComponentId = SpatialConstants::MIN_EXTERNAL_SCHEMA_ID + i;
+			Table.Add(NextId++, ComponentId, TFunction<void(const Worker_ComponentUpdateOp&)>([&TableCalls](const Worker_ComponentUpdateOp& Op) { TableCalls += Op.entity_id; }));
+			Table.Add(NextId++, ComponentId, TFunction<void(const Worker_AddComponentOp&)>([&TableCalls](const Worker_AddComponentOp& Op) { TableCalls += Op.entity_id; }));
+			Table.Add(NextId++, ComponentId, TFunction<void(const Worker_AuthorityChangeOp&)>([&TableCalls](const Worker_AuthorityChangeOp& Op) { TableCalls += Op.entity_id; }));
+		}
+
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 List = 0; List < NumOpLists; ++List)
+		{
+			for (uint32 i = 0; i < Ops.Count; ++i)
+			{
+				const Worker_Op& Op = Ops.Ops[i];
+				const Worker_ComponentId ComponentId = GetComponentId(&Op);
+				if (FOpCallbackTable::IsExternalSchemaComponent(ComponentId))
+				{
+					Table.Dispatch(ComponentId, Op);
+				}
+			}
+		}
+		TableSeconds = FPlatformTime::Seconds() - StartTime;
+	}
+
+	const double NumOps = static_cast<double>(NumOpLists) * OpsPerList;
+	UE_LOG(LogOpCallbackTableTest, Display, TEXT("Dispatched %.0f ops. Nested maps: %.2f Mops/s. FOpCallbackTable: %.2f Mops/s (%.2fx)."),
+		NumOps, NumOps / BaselineSeconds / 1e6, NumOps / TableSeconds / 1e6, BaselineSeconds / TableSeconds);
+
+	TestEqual(TEXT("Both dispatchers run the same callbacks"), TableCalls, BaselineCalls);
+
+	return true;
+}
@@ -33,6 +33,9 @@ void SpatialOSDispatcherSpy::OnAuthorityChange(const Worker_AuthorityChangeOp& O
 void SpatialOSDispatcherSpy::OnComponentUpdate(const Worker_ComponentUpdateOp& Op)
 {}
 
+void SpatialOSDispatcherSpy::OnEntityComponentUpdates(Worker_EntityId EntityId, TArrayView<const Worker_ComponentUpdateOp* const> Ops)
+{}
+
 // This gets bound to a delegate in SpatialRPCService and is called for each RPC extracted when calling SpatialRPCService::ExtractRPCsForEntity.
 bool SpatialOSDispatcherSpy::OnExtractIncomingRPC(Worker_EntityId EntityId, ERPCType RPCType, const SpatialGDK::RPCPayload& Payload)
 {
@@ -28,6 +28,7 @@ public:
 	virtual void OnAuthorityChange(const Worker_AuthorityChangeOp& Op) override;
 
 	virtual void OnComponentUpdate(const Worker_ComponentUpdateOp& Op) override;
+	virtual void OnEntityComponentUpdates(Worker_EntityId EntityId, TArrayView<const Worker_ComponentUpdateOp* const> Ops) override;
 
 	// This gets bound to a delegate in SpatialRPCService and is called for each RPC extracted when calling SpatialRPCService::ExtractRPCsForEntity.
 	virtual bool OnExtractIncomingRPC(Worker_EntityId EntityId, ERPCType RPCType, const SpatialGDK::RPCPayload& Payload) override;
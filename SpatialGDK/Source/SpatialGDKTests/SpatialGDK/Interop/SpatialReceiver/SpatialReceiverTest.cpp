@@ -0,0 +1,97 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "EngineClasses/SpatialLoadBalanceEnforcer.h"
+#include "EngineClasses/SpatialNetDriver.h"
+#include "EngineClasses/SpatialVirtualWorkerTranslator.h"
+#include "Interop/SpatialReceiver.h"
+#include "Interop/SpatialStaticComponentView.h"
+#include "Schema/AuthorityIntent.h"
+#include "SpatialGDKTests/SpatialGDK/LoadBalancing/AbstractLBStrategy/LBStrategyStub.h"
+#include "Tests/TestingComponentViewHelpers.h"
+#include "Tests/TestingSchemaHelpers.h"
+
+#include "CoreMinimal.h"
+#include "TimerManager.h"
+
+#define SPATIALRECEIVER_TEST(TestName) \
+	GDK_TEST(Core, USpatialReceiver, TestName)
+
+namespace
+{
+
+const PhysicalWorkerName ThisWorker = TEXT("ThisWorker");
+const PhysicalWorkerName OtherWorker = TEXT("OtherWorker");
+
+constexpr VirtualWorkerId ThisVirtualWorker = 1;
+constexpr VirtualWorkerId OtherVirtualWorker = 2;
+
+constexpr Worker_EntityId EntityId = 1;
+
+TUniquePtr<SpatialVirtualWorkerTranslator> CreateVirtualWorkerTranslator()
+{
+	ULBStrategyStub* LoadBalanceStrategy = NewObject<ULBStrategyStub>();
+	TUniquePtr<SpatialVirtualWorkerTranslator> VirtualWorkerTranslator = MakeUnique<SpatialVirtualWorkerTranslator>(LoadBalanceStrategy, ThisWorker);
+
+	Schema_Object* DataObject = TestingSchemaHelpers::CreateTranslationComponentDataFields();
+	TestingSchemaHelpers::AddTranslationComponentDataMapping(DataObject, ThisVirtualWorker, ThisWorker);
+	TestingSchemaHelpers::AddTranslationComponentDataMapping(DataObject, OtherVirtualWorker, OtherWorker);
+	VirtualWorkerTranslator->ApplyVirtualWorkerManagerData(DataObject);
+
+	return VirtualWorkerTranslator;
+}
+
+// An entity this worker is authoritative over, which the load balance enforcer can enforce.
+void AddEnforceableEntity(USpatialStaticComponentView& StaticComponentView)
+{
+	TestingComponentViewHelpers::AddEntityComponentToStaticComponentView(StaticComponentView, EntityId, SpatialConstants::AUTHORITY_INTENT_COMPONENT_ID, WORKER_AUTHORITY_AUTHORITATIVE);
+	TestingComponentViewHelpers::AddEntityComponentToStaticComponentView(StaticComponentView, EntityId, SpatialConstants::ENTITY_ACL_COMPONENT_ID, WORKER_AUTHORITY_AUTHORITATIVE);
+	TestingComponentViewHelpers::AddEntityComponentToStaticComponentView(StaticComponentView, EntityId, SpatialConstants::COMPONENT_PRESENCE_COMPONENT_ID, WORKER_AUTHORITY_AUTHORITATIVE);
+	TestingComponentViewHelpers::AddEntityComponentToStaticComponentView(StaticComponentView, EntityId, SpatialConstants::NET_OWNING_CLIENT_WORKER_COMPONENT_ID, WORKER_AUTHORITY_AUTHORITATIVE);
+
+	StaticComponentView.GetComponentData<SpatialGDK::AuthorityIntent>(EntityId)->VirtualWorkerId = ThisVirtualWorker;
+}
+
+Worker_ComponentUpdateOp CreateAuthorityIntentUpdateOp(VirtualWorkerId NewVirtualWorkerId)
+{
+	Worker_ComponentUpdateOp UpdateOp;
+	UpdateOp.entity_id = EntityId;
+	UpdateOp.update = SpatialGDK::AuthorityIntent::CreateAuthorityIntentUpdate(NewVirtualWorkerId);
+	return UpdateOp;
+}
+
+} // anonymous namespace
+
+SPATIALRECEIVER_TEST(GIVEN_several_updates_for_an_entity_WHEN_handled_together_THEN_each_handler_sees_the_view_after_its_own_update)
+{
+	// GIVEN
+	TUniquePtr<SpatialVirtualWorkerTranslator> VirtualWorkerTranslator = CreateVirtualWorkerTranslator();
+
+	USpatialNetDriver* NetDriver = NewObject<USpatialNetDriver>();
+	NetDriver->StaticComponentView = NewObject<USpatialStaticComponentView>();
+	NetDriver->LoadBalanceEnforcer = MakeUnique<SpatialLoadBalanceEnforcer>(ThisWorker, NetDriver->StaticComponentView, VirtualWorkerTranslator.Get());
+	AddEnforceableEntity(*NetDriver->StaticComponentView);
+
+	FTimerManager TimerManager;
+	USpatialReceiver* Receiver = NewObject<USpatialReceiver>();
+	Receiver->Init(NetDriver, &TimerManager, nullptr);
+
+	// The intent moves to another worker and straight back. The enforcer only queues an ACL assignment for the first
+	// update if it sees the intent from that update, rather than the final one.
+	Worker_ComponentUpdateOp MoveAway = CreateAuthorityIntentUpdateOp(OtherVirtualWorker);
+	Worker_ComponentUpdateOp MoveBack = CreateAuthorityIntentUpdateOp(ThisVirtualWorker);
+	const Worker_ComponentUpdateOp* Ops[] = { &MoveAway, &MoveBack };
+
+	// WHEN
+	Receiver->OnEntityComponentUpdates(EntityId, Ops);
+
+	// THEN
+	TestTrue("The enforcer saw the intent from the first update", NetDriver->LoadBalanceEnforcer->AclAssignmentRequestIsQueued(EntityId));
+	TestEqual("The view holds the intent from the last update", NetDriver->StaticComponentView->GetComponentData<SpatialGDK::AuthorityIntent>(EntityId)->VirtualWorkerId, ThisVirtualWorker);
+
+	Schema_DestroyComponentUpdate(MoveAway.update.schema_type);
+	Schema_DestroyComponentUpdate(MoveBack.update.schema_type);
+
+	return true;
+}
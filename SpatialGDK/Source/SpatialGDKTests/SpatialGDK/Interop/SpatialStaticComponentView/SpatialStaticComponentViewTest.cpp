@@ -0,0 +1,73 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Interop/SpatialStaticComponentView.h"
+#include "SpatialConstants.h"
+
+#define SPATIALSTATICCOMPONENTVIEW_TEST(TestName) \
+	GDK_TEST(Core, USpatialStaticComponentView, TestName)
+
+namespace
+{
+const Worker_EntityId TestEntityId = 1;
+const Worker_ComponentId TestGeneratedComponentId = SpatialConstants::STARTING_GENERATED_COMPONENT_ID + 5;
+
+void SetAuthority(USpatialStaticComponentView& StaticComponentView, Worker_EntityId EntityId, Worker_ComponentId ComponentId, Worker_Authority Authority)
+{
+	Worker_AuthorityChangeOp AuthorityChangeOp;
+	AuthorityChangeOp.entity_id = EntityId;
+	AuthorityChangeOp.component_id = ComponentId;
+	AuthorityChangeOp.authority = Authority;
+	StaticComponentView.OnAuthorityChange(AuthorityChangeOp);
+}
+} // anonymous namespace
+
+SPATIALSTATICCOMPONENTVIEW_TEST(GIVEN_authority_changes_WHEN_authority_checked_THEN_only_authoritative_components_have_authority)
+{
+	// GIVEN
+	USpatialStaticComponentView* StaticComponentView = NewObject<USpatialStaticComponentView>();
+	SetAuthority(*StaticComponentView, TestEntityId, SpatialConstants::POSITION_COMPONENT_ID, WORKER_AUTHORITY_AUTHORITATIVE);
+	SetAuthority(*StaticComponentView, TestEntityId, SpatialConstants::NET_OWNING_CLIENT_WORKER_COMPONENT_ID, WORKER_AUTHORITY_AUTHORITATIVE);
+	SetAuthority(*StaticComponentView, TestEntityId, SpatialConstants::SPAWN_DATA_COMPONENT_ID, WORKER_AUTHORITY_AUTHORITATIVE);
+	SetAuthority(*StaticComponentView, TestEntityId, TestGeneratedComponentId, WORKER_AUTHORITY_AUTHORITATIVE);
+
+	// WHEN
+	SetAuthority(*StaticComponentView, TestEntityId, SpatialConstants::SPAWN_DATA_COMPONENT_ID, WORKER_AUTHORITY_AUTHORITY_LOSS_IMMINENT);
+	SetAuthority(*StaticComponentView, TestEntityId, SpatialConstants::NET_OWNING_CLIENT_WORKER_COMPONENT_ID, WORKER_AUTHORITY_NOT_AUTHORITATIVE);
+
+	// THEN
+	TestTrue("Has authority over SpatialOS component", StaticComponentView->HasAuthority(TestEntityId, SpatialConstants::POSITION_COMPONENT_ID));
+	TestTrue("Has authority over generated component", StaticComponentView->HasAuthority(TestEntityId, TestGeneratedComponentId));
+	TestFalse("Has authority over component losing authority", StaticComponentView->HasAuthority(TestEntityId, SpatialConstants::SPAWN_DATA_COMPONENT_ID));
+	TestFalse("Has authority over component which lost authority", StaticComponentView->HasAuthority(TestEntityId, SpatialConstants::NET_OWNING_CLIENT_WORKER_COMPONENT_ID));
+	TestFalse("Has authority over component without authority changes", StaticComponentView->HasAuthority(TestEntityId, SpatialConstants::ENTITY_ACL_COMPONENT_ID));
+	TestFalse("Has authority over other entity", StaticComponentView->HasAuthority(TestEntityId + 1, SpatialConstants::POSITION_COMPONENT_ID));
+
+	return true;
+}
+
+SPATIALSTATICCOMPONENTVIEW_TEST(GIVEN_cached_authority_generation_WHEN_authority_changes_or_entity_is_removed_THEN_generation_changes)
+{
+	// GIVEN
+	USpatialStaticComponentView* StaticComponentView = NewObject<USpatialStaticComponentView>();
+	const uint64 InitialGeneration = StaticComponentView->GetAuthorityGeneration(TestEntityId);
+	SetAuthority(*StaticComponentView, TestEntityId, SpatialConstants::POSITION_COMPONENT_ID, WORKER_AUTHORITY_AUTHORITATIVE);
+	const uint64 AuthoritativeGeneration = StaticComponentView->GetAuthorityGeneration(TestEntityId);
+
+	// WHEN
+	SetAuthority(*StaticComponentView, TestEntityId + 1, SpatialConstants::POSITION_COMPONENT_ID, WORKER_AUTHORITY_AUTHORITATIVE);
+	const uint64 GenerationAfterOtherEntityChange = StaticComponentView->GetAuthorityGeneration(TestEntityId);
+	StaticComponentView->OnRemoveEntity(TestEntityId);
+	const uint64 RemovedGeneration = StaticComponentView->GetAuthorityGeneration(TestEntityId);
+	SetAuthority(*StaticComponentView, TestEntityId, SpatialConstants::POSITION_COMPONENT_ID, WORKER_AUTHORITY_AUTHORITATIVE);
+	const uint64 ReaddedGeneration = StaticComponentView->GetAuthorityGeneration(TestEntityId);
+
+	// THEN
+	TestNotEqual("Generation changes on authority change", AuthoritativeGeneration, InitialGeneration);
+	TestEqual("Generation is unchanged by other entities", GenerationAfterOtherEntityChange, AuthoritativeGeneration);
+	TestNotEqual("Generation changes on entity removal", RemovedGeneration, AuthoritativeGeneration);
+	TestNotEqual("Generation isn't reused when entity is added again", ReaddedGeneration, AuthoritativeGeneration);
+
+	return true;
+}
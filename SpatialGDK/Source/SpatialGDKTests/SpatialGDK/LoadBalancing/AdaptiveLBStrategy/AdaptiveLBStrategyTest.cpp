@@ -0,0 +1,242 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "LoadBalancing/AdaptiveLBStrategy.h"
+#include "TestAdaptiveLBStrategy.h"
+
+#include "CoreMinimal.h"
+#include "Math/RandomStream.h"
+#include "Tests/TestDefinitions.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+
+#define ADAPTIVELBSTRATEGY_TEST(TestName) \
+	GDK_TEST(Core, UAdaptiveLBStrategy, TestName)
+
+namespace
+{
+
+UAdaptiveLBStrategy* CreateStrategy(uint32 NumWorkers, float WorldWidth, float WorldHeight, float ImbalanceThreshold = 1.2f, float RebalanceRate = 0.5f, float MinRegionSize = 0.0f)
+{
+	UAdaptiveLBStrategy* Strat = UTestAdaptiveLBStrategy::Create(NumWorkers, WorldWidth, WorldHeight, ImbalanceThreshold, RebalanceRate, MinRegionSize);
+	Strat->Init();
+	Strat->SetVirtualWorkerIds(1, Strat->GetMinimumRequiredWorkers());
+	Strat->SetLocalVirtualWorkerId(1);
+	return Strat;
+}
+
+TMap<VirtualWorkerId, FWorkerLoadReport> CreateLoadReports(const TArray<uint32>& ActorCounts)
+{
+	TMap<VirtualWorkerId, FWorkerLoadReport> LoadReports;
+	for (int32 i = 0; i < ActorCounts.Num(); i++)
+	{
+		FWorkerLoadReport& Report = LoadReports.Add(i + 1);
+		Report.Load = 1.0;
+		Report.AuthoritativeActorCount = ActorCounts[i];
+	}
+	return LoadReports;
+}
+
+// Uses the number of actors in each region as its load, and returns the ratio between the peak and mean load.
+float CountActorsPerWorker(const UAdaptiveLBStrategy* Strat, const TArray<FVector2D>& ActorPositions, TMap<VirtualWorkerId, FWorkerLoadReport>& OutLoadReports)
+{
+	OutLoadReports.Reset();
+	for (VirtualWorkerId VirtualWorker = 1; VirtualWorker <= Strat->GetMinimumRequiredWorkers(); VirtualWorker++)
+	{
+		OutLoadReports.Add(VirtualWorker);
+	}
+
+	uint32 PeakActorCount = 0;
+	for (const FVector2D& Position : ActorPositions)
+	{
+		FWorkerLoadReport& Report = OutLoadReports[Strat->GetVirtualWorkerForLocation(Position)];
+		Report.AuthoritativeActorCount++;
+		PeakActorCount = FMath::Max(PeakActorCount, Report.AuthoritativeActorCount);
+	}
+
+	const float MeanActorCount = static_cast<float>(ActorPositions.Num()) / Strat->GetMinimumRequiredWorkers();
+	return PeakActorCount / MeanActorCount;
+}
+
+bool RegionsMatch(const FBox2D& A, const FBox2D& B)
+{
+	return A.Min == B.Min && A.Max == B.Max;
+}
+
+} // anonymous namespace
+
+ADAPTIVELBSTRATEGY_TEST(GIVEN_four_workers_WHEN_initialised_THEN_world_is_split_into_quadrants)
+{
+	// GIVEN
+	UAdaptiveLBStrategy* Strat = CreateStrategy(4, 10000.f, 10000.f);
+
+	// THEN
+	TestTrue("Worker 1 has the -x -y quadrant", RegionsMatch(Strat->GetRegionForVirtualWorker(1), FBox2D(FVector2D(-5000.f, -5000.f), FVector2D(0.f, 0.f))));
+	TestTrue("Worker 2 has the -x +y quadrant", RegionsMatch(Strat->GetRegionForVirtualWorker(2), FBox2D(FVector2D(-5000.f, 0.f), FVector2D(0.f, 5000.f))));
+	TestTrue("Worker 3 has the +x -y quadrant", RegionsMatch(Strat->GetRegionForVirtualWorker(3), FBox2D(FVector2D(0.f, -5000.f), FVector2D(5000.f, 0.f))));
+	TestTrue("Worker 4 has the +x +y quadrant", RegionsMatch(Strat->GetRegionForVirtualWorker(4), FBox2D(FVector2D(0.f, 0.f), FVector2D(5000.f, 5000.f))));
+
+	TestEqual("Origin belongs to the +x +y quadrant", Strat->GetVirtualWorkerForLocation(FVector2D(0.f, 0.f)), 4u);
+	TestEqual("Locations outside the world have no worker", Strat->GetVirtualWorkerForLocation(FVector2D(5000.f, 0.f)), SpatialConstants::INVALID_VIRTUAL_WORKER_ID);
+
+	return true;
+}
+
+ADAPTIVELBSTRATEGY_TEST(GIVEN_balanced_load_WHEN_update_regions_from_load_THEN_regions_do_not_change)
+{
+	// GIVEN
+	UAdaptiveLBStrategy* Strat = CreateStrategy(4, 10000.f, 10000.f, 1.2f);
+	const FBox2D RegionBefore = Strat->GetRegionForVirtualWorker(1);
+
+	// WHEN
+	const bool bRegionsChanged = Strat->UpdateRegionsFromLoad(CreateLoadReports({ 10, 11, 9, 11 }));
+
+	// THEN
+	TestFalse("Load below the imbalance threshold does not move the regions", bRegionsChanged);
+	TestTrue("Region is unchanged", RegionsMatch(Strat->GetRegionForVirtualWorker(1), RegionBefore));
+
+	return true;
+}
+
+ADAPTIVELBSTRATEGY_TEST(GIVEN_a_worker_has_not_reported_load_WHEN_update_regions_from_load_THEN_regions_do_not_change)
+{
+	// GIVEN
+	UAdaptiveLBStrategy* Strat = CreateStrategy(4, 10000.f, 10000.f);
+	TMap<VirtualWorkerId, FWorkerLoadReport> LoadReports = CreateLoadReports({ 100, 10, 10, 10 });
+	LoadReports.Remove(4);
+
+	// WHEN
+	const bool bRegionsChanged = Strat->UpdateRegionsFromLoad(LoadReports);
+
+	// THEN
+	TestFalse("Regions are only rebalanced once every worker has reported", bRegionsChanged);
+
+	return true;
+}
+
+ADAPTIVELBSTRATEGY_TEST(GIVEN_an_overloaded_worker_WHEN_update_regions_from_load_THEN_its_region_shrinks_and_regions_cover_the_world)
+{
+	// GIVEN
+	UAdaptiveLBStrategy* Strat = CreateStrategy(4, 10000.f, 10000.f, 1.2f, 1.0f, 500.f);
+	const float AreaBefore = Strat->GetRegionForVirtualWorker(1).GetArea();
+
+	// WHEN
+	const bool bRegionsChanged = Strat->UpdateRegionsFromLoad(CreateLoadReports({ 100, 10, 10, 10 }));
+
+	// THEN
+	TestTrue("Regions were rebalanced", bRegionsChanged);
+	TestTrue("Overloaded worker's region shrank", Strat->GetRegionForVirtualWorker(1).GetArea() < AreaBefore);
+
+	float TotalArea = 0.f;
+	for (VirtualWorkerId VirtualWorker = 1; VirtualWorker <= 4; VirtualWorker++)
+	{
+		const FBox2D Region = Strat->GetRegionForVirtualWorker(VirtualWorker);
+		TestTrue(FString::Printf(TEXT("Region of worker %d respects the minimum region size"), VirtualWorker), Region.GetSize().X >= 500.f - KINDA_SMALL_NUMBER && Region.GetSize().Y >= 500.f - KINDA_SMALL_NUMBER);
+		TestEqual(FString::Printf(TEXT("Centre of worker %d's region belongs to it"), VirtualWorker), Strat->GetVirtualWorkerForLocation(Region.GetCenter()), VirtualWorker);
+		TotalArea += Region.GetArea();
+	}
+	TestEqual("Regions still cover the world", TotalArea, 10000.f * 10000.f, 1.e4f);
+
+	return true;
+}
+
+ADAPTIVELBSTRATEGY_TEST(GIVEN_regions_written_to_schema_WHEN_applied_by_another_worker_THEN_both_agree_on_regions)
+{
+	// GIVEN
+	UAdaptiveLBStrategy* AuthoritativeStrat = CreateStrategy(4, 10000.f, 10000.f);
+	AuthoritativeStrat->UpdateRegionsFromLoad(CreateLoadReports({ 100, 10, 10, 10 }));
+
+	UAdaptiveLBStrategy* OtherStrat = CreateStrategy(4, 10000.f, 10000.f);
+
+	UAdaptiveLBStrategy* StratForOtherLayer = UTestAdaptiveLBStrategy::Create(4, 10000.f, 10000.f);
+	StratForOtherLayer->Init();
+	StratForOtherLayer->SetVirtualWorkerIds(5, 8);
+
+	Schema_ComponentData* Data = Schema_CreateComponentData();
+	Schema_Object* ComponentObject = Schema_GetComponentDataFields(Data);
+	AuthoritativeStrat->WriteRegionsToSchema(ComponentObject);
+
+	// WHEN
+	const bool bApplied = OtherStrat->ApplyRegionsFromSchema(ComponentObject);
+	const bool bAppliedToOtherLayer = StratForOtherLayer->ApplyRegionsFromSchema(ComponentObject);
+
+	// THEN
+	TestTrue("Regions were applied", bApplied);
+	TestFalse("Regions for a different set of virtual workers were ignored", bAppliedToOtherLayer);
+	for (VirtualWorkerId VirtualWorker = 1; VirtualWorker <= 4; VirtualWorker++)
+	{
+		TestTrue(FString::Printf(TEXT("Workers agree on the region of worker %d"), VirtualWorker),
+			RegionsMatch(OtherStrat->GetRegionForVirtualWorker(VirtualWorker), AuthoritativeStrat->GetRegionForVirtualWorker(VirtualWorker)));
+	}
+
+	Schema_DestroyComponentData(Data);
+	return true;
+}
+
+ADAPTIVELBSTRATEGY_TEST(GIVEN_actor_trace_clustering_in_one_region_WHEN_replayed_with_periodic_rebalancing_THEN_load_is_more_even_than_static_regions)
+{
+	// GIVEN
+	// A trace of 400 actors spread over the world, three quarters of which walk into a hotspot over the first half of the trace.
+	const int32 NumActors = 400;
+	const int32 NumFrames = 120;
+	const int32 FramesPerRebalance = 10;
+	const int32 NumSettledFrames = 40;
+	const FVector2D Hotspot(2500.f, -2500.f);
+
+	FRandomStream RandomStream(1234);
+	TArray<FVector2D> StartPositions;
+	TArray<FVector2D> EndPositions;
+	for (int32 i = 0; i < NumActors; i++)
+	{
+		const FVector2D StartPosition(RandomStream.FRandRange(-5000.f, 4999.f), RandomStream.FRandRange(-5000.f, 4999.f));
+		StartPositions.Add(StartPosition);
+		EndPositions.Add(i % 4 != 0 ? Hotspot + FVector2D(RandomStream.FRandRange(-1000.f, 1000.f), RandomStream.FRandRange(-1000.f, 1000.f)) : StartPosition);
+	}
+
+	TArray<TArray<FVector2D>> Trace;
+	Trace.SetNum(NumFrames);
+	for (int32 Frame = 0; Frame < NumFrames; Frame++)
+	{
+		const float Alpha = FMath::Min(1.f, static_cast<float>(Frame) / (NumFrames / 2));
+		for (int32 i = 0; i < NumActors; i++)
+		{
+			Trace[Frame].Add(FMath::Lerp(StartPositions[i], EndPositions[i], Alpha));
+		}
+	}
+
+	UAdaptiveLBStrategy* AdaptiveStrat = CreateStrategy(4, 10000.f, 10000.f, 1.1f, 0.5f, 500.f);
+	UAdaptiveLBStrategy* StaticStrat = CreateStrategy(4, 10000.f, 10000.f);
+
+	// WHEN
+	float AdaptivePeakRatio = 0.f;
+	float StaticPeakRatio = 0.f;
+	float AdaptiveSettledRatio = 0.f;
+	float StaticSettledRatio = 0.f;
+	TMap<VirtualWorkerId, FWorkerLoadReport> LoadReports;
+	for (int32 Frame = 0; Frame < NumFrames; Frame++)
+	{
+		const float StaticRatio = CountActorsPerWorker(StaticStrat, Trace[Frame], LoadReports);
+		const float AdaptiveRatio = CountActorsPerWorker(AdaptiveStrat, Trace[Frame], LoadReports);
+		if (Frame % FramesPerRebalance == 0)
+		{
+			AdaptiveStrat->UpdateRegionsFromLoad(LoadReports);
+		}
+
+		AdaptivePeakRatio = FMath::Max(AdaptivePeakRatio, AdaptiveRatio);
+		StaticPeakRatio = FMath::Max(StaticPeakRatio, StaticRatio);
+		if (Frame >= NumFrames - NumSettledFrames)
+		{
+			AdaptiveSettledRatio += AdaptiveRatio / NumSettledFrames;
+			StaticSettledRatio += StaticRatio / NumSettledFrames;
+		}
+	}
+
+	// THEN
+	AddInfo(FString::Printf(TEXT("Peak/mean load ratio across workers. Adaptive: %.2f peak, %.2f settled. Static: %.2f peak, %.2f settled."),
+		AdaptivePeakRatio, AdaptiveSettledRatio, StaticPeakRatio, StaticSettledRatio));
+
+	TestTrue("Adaptive regions have a lower peak load than static regions", AdaptivePeakRatio < StaticPeakRatio);
+	TestTrue("Adaptive regions settle to at most half the imbalance of static regions", AdaptiveSettledRatio < 0.5f * StaticSettledRatio);
+	TestTrue("Adaptive regions settle close to an even load", AdaptiveSettledRatio < 1.5f);
+
+	return true;
+}
@@ -0,0 +1,19 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "TestAdaptiveLBStrategy.h"
+
+UAdaptiveLBStrategy* UTestAdaptiveLBStrategy::Create(uint32 InNumWorkers, float InWorldWidth, float InWorldHeight, float InImbalanceThreshold, float InRebalanceRate, float InMinRegionSize)
+{
+	UTestAdaptiveLBStrategy* Strat = NewObject<UTestAdaptiveLBStrategy>();
+
+	Strat->NumWorkers = InNumWorkers;
+
+	Strat->WorldWidth = InWorldWidth;
+	Strat->WorldHeight = InWorldHeight;
+
+	Strat->ImbalanceThreshold = InImbalanceThreshold;
+	Strat->RebalanceRate = InRebalanceRate;
+	Strat->MinRegionSize = InMinRegionSize;
+
+	return Strat;
+}
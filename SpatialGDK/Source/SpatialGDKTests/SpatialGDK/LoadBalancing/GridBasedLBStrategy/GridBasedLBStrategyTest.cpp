@@ -172,6 +172,29 @@ bool FCheckVirtualWorkersMatch::Update()
 	return true;
 }
 
+DEFINE_LATENT_AUTOMATION_COMMAND_TWO_PARAMETER(FCheckBatchedWhoShouldHaveAuthorityMatches, FAutomationTestBase*, Test, TArray<FName>, Handles);
+bool FCheckBatchedWhoShouldHaveAuthorityMatches::Update()
+{
+	TArray<const AActor*> Actors;
+	for (const FName& Handle : Handles)
+	{
+		Actors.Add(TestActors[Handle]);
+	}
+
+	TArray<VirtualWorkerId> BatchedVirtualWorkerIds;
+	BatchedVirtualWorkerIds.SetNumUninitialized(Actors.Num());
+	Strat->WhoShouldHaveAuthority(Actors, BatchedVirtualWorkerIds);
+
+	for (int i = 0; i < Actors.Num(); i++)
+	{
+		const uint32 Expected = Strat->WhoShouldHaveAuthority(*Actors[i]);
+		Test->TestEqual(FString::Printf(TEXT("Batched Who Should Have Authority for %s. Actual: %d, Expected: %d"), *Handles[i].ToString(), BatchedVirtualWorkerIds[i], Expected),
+			BatchedVirtualWorkerIds[i], Expected);
+	}
+
+	return true;
+}
+
 GRIDBASEDLBSTRATEGY_TEST(GIVEN_2_rows_3_cols_WHEN_get_minimum_required_workers_is_called_THEN_it_returns_6)
 {
 	CreateStrategy(2, 3, 10000.f, 10000.f, 1);
@@ -260,6 +283,35 @@ GRIDBASEDLBSTRATEGY_TEST(GIVEN_more_than_one_column_WHEN_requires_handover_data_
 	return true;
 }
 
+GRIDBASEDLBSTRATEGY_TEST(GIVEN_weighted_rows_and_columns_WHEN_get_worker_entity_position_THEN_returns_centre_of_weighted_cell)
+{
+	// Rows split x into [-2000, -1000) and [-1000, 2000). Columns split y into [-2000, 1000) and [1000, 2000).
+	Strat = UTestGridBasedLBStrategy::Create(2, 2, 4000.f, 4000.f, 0.f, { 1.f, 3.f }, { 3.f, 1.f });
+	Strat->Init();
+	Strat->SetVirtualWorkerIds(1, Strat->GetMinimumRequiredWorkers());
+	Strat->SetLocalVirtualWorkerId(1);
+
+	TestEqual("Worker entity position is the centre of the first weighted cell", Strat->GetWorkerEntityPosition(), FVector{ -1500.0f, -500.0f, 0.0f });
+
+	Strat->SetLocalVirtualWorkerId(4);
+
+	TestEqual("Worker entity position is the centre of the last weighted cell", Strat->GetWorkerEntityPosition(), FVector{ 500.0f, 1500.0f, 0.0f });
+
+	return true;
+}
+
+GRIDBASEDLBSTRATEGY_TEST(GIVEN_weights_not_matching_rows_WHEN_get_worker_entity_position_THEN_cells_are_evenly_sized)
+{
+	Strat = UTestGridBasedLBStrategy::Create(2, 2, 10000.f, 10000.f, 0.f, { 1.f, 2.f, 3.f }, {});
+	Strat->Init();
+	Strat->SetVirtualWorkerIds(1, Strat->GetMinimumRequiredWorkers());
+	Strat->SetLocalVirtualWorkerId(4);
+
+	TestEqual("Worker entity position is as expected", Strat->GetWorkerEntityPosition(), FVector{ 2500.0f, 2500.0f, 0.0f });
+
+	return true;
+}
+
 }  // anonymous namespace
 
 GRIDBASEDLBSTRATEGY_TEST(GIVEN_a_single_cell_and_valid_local_id_WHEN_should_relinquish_called_THEN_returns_false)
@@ -346,3 +398,25 @@ GRIDBASEDLBSTRATEGY_TEST(GIVEN_two_cells_WHEN_actor_in_one_cell_THEN_strategy_re
 	return true;
 }
 
+GRIDBASEDLBSTRATEGY_TEST(GIVEN_actors_across_a_large_grid_WHEN_batched_who_should_have_authority_called_THEN_matches_single_actor_results)
+{
+	AutomationOpenMap("/Engine/Maps/Entry");
+
+	ADD_LATENT_AUTOMATION_COMMAND(FCreateStrategy(16, 16, 10000.f, 10000.f, 1));
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForWorld());
+	ADD_LATENT_AUTOMATION_COMMAND(FSpawnActorAtLocation("Actor1", FVector(-4900.f, -4900.f, 0.f)));
+	ADD_LATENT_AUTOMATION_COMMAND(FSpawnActorAtLocation("Actor2", FVector(0.f, 0.f, 0.f)));
+	ADD_LATENT_AUTOMATION_COMMAND(FSpawnActorAtLocation("Actor3", FVector(625.f, -625.f, 0.f)));
+	ADD_LATENT_AUTOMATION_COMMAND(FSpawnActorAtLocation("Actor4", FVector(4999.f, 1.f, 0.f)));
+	ADD_LATENT_AUTOMATION_COMMAND(FSpawnActorAtLocation("Actor5", FVector(-1250.f, 3750.f, 0.f)));
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForActor("Actor1"));
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForActor("Actor2"));
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForActor("Actor3"));
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForActor("Actor4"));
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForActor("Actor5"));
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckBatchedWhoShouldHaveAuthorityMatches(this, { "Actor1", "Actor2", "Actor3", "Actor4", "Actor5" }));
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckVirtualWorkersDiffer(this, { "Actor1", "Actor2", "Actor3", "Actor4", "Actor5" }));
+	ADD_LATENT_AUTOMATION_COMMAND(FCleanup());
+
+	return true;
+}
@@ -16,3 +16,13 @@ UGridBasedLBStrategy* UTestGridBasedLBStrategy::Create(uint32 InRows, uint32 InC
 
 	return Strat;
 }
+
+UGridBasedLBStrategy* UTestGridBasedLBStrategy::Create(uint32 InRows, uint32 InCols, float WorldWidth, float WorldHeight, float InterestBorder, const TArray<float>& InRowWeights, const TArray<float>& InColumnWeights)
+{
+	UTestGridBasedLBStrategy* Strat = static_cast<UTestGridBasedLBStrategy*>(Create(InRows, InCols, WorldWidth, WorldHeight, InterestBorder));
+
+	Strat->RowWeights = InRowWeights;
+	Strat->ColumnWeights = InColumnWeights;
+
+	return Strat;
+}
@@ -0,0 +1,107 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Schema/Interest.h"
+
+#define INTEREST_TEST(TestName) \
+	GDK_TEST(Core, Interest, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+QueryConstraint MakeComponentConstraint(Worker_ComponentId ComponentId)
+{
+	QueryConstraint Constraint;
+	Constraint.ComponentConstraint = ComponentId;
+	return Constraint;
+}
+
+QueryConstraint MakeRadiusAndLevelConstraint(double Radius, Worker_ComponentId LevelComponentId)
+{
+	QueryConstraint RadiusConstraint;
+	RadiusConstraint.RelativeCylinderConstraint = RelativeCylinderConstraint{ Radius };
+
+	QueryConstraint Constraint;
+	Constraint.AndConstraint.Add(RadiusConstraint);
+	Constraint.AndConstraint.Add(MakeComponentConstraint(LevelComponentId));
+	return Constraint;
+}
+
+Interest MakeInterest(Worker_ComponentId LevelComponentId, float Frequency)
+{
+	Query NewQuery;
+	NewQuery.Constraint = MakeRadiusAndLevelConstraint(100.0, LevelComponentId);
+	NewQuery.ResultComponentIds = { SpatialConstants::POSITION_COMPONENT_ID, SpatialConstants::INTEREST_COMPONENT_ID };
+	NewQuery.Frequency = Frequency;
+
+	Query SelfQuery;
+	SelfQuery.Constraint.EntityIdConstraint = 1;
+	SelfQuery.FullSnapshotResult = true;
+
+	Interest NewInterest;
+	NewInterest.ComponentInterestMap.Add(SpatialConstants::POSITION_COMPONENT_ID).Queries.Add(SelfQuery);
+	NewInterest.ComponentInterestMap.Add(SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID).Queries.Add(NewQuery);
+	return NewInterest;
+}
+} // anonymous namespace
+
+INTEREST_TEST(GIVEN_separately_built_equal_constraints_WHEN_compared_THEN_they_are_equal_and_hash_the_same)
+{
+	// GIVEN
+	const QueryConstraint First = MakeRadiusAndLevelConstraint(100.0, 10000);
+	const QueryConstraint Second = MakeRadiusAndLevelConstraint(100.0, 10000);
+
+	// WHEN
+	const bool bEqual = First == Second;
+
+	// THEN
+	TestTrue(TEXT("Constraints are equal"), bEqual);
+	TestEqual(TEXT("Constraints hash the same"), GetTypeHash(First), GetTypeHash(Second));
+
+	return true;
+}
+
+INTEREST_TEST(GIVEN_constraints_differing_in_a_nested_value_WHEN_compared_THEN_they_are_not_equal)
+{
+	// GIVEN
+	const QueryConstraint Constraint = MakeRadiusAndLevelConstraint(100.0, 10000);
+	const QueryConstraint DifferentRadius = MakeRadiusAndLevelConstraint(200.0, 10000);
+	const QueryConstraint DifferentLevel = MakeRadiusAndLevelConstraint(100.0, 10001);
+
+	// WHEN
+	TMap<QueryConstraint, int32> ConstraintCache;
+	ConstraintCache.Add(Constraint, 1);
+	ConstraintCache.Add(DifferentRadius, 2);
+	ConstraintCache.Add(DifferentLevel, 3);
+
+	// THEN
+	TestTrue(TEXT("Constraints with different radii are not equal"), Constraint != DifferentRadius);
+	TestTrue(TEXT("Constraints with different levels are not equal"), Constraint != DifferentLevel);
+	TestEqual(TEXT("Each constraint has its own cache entry"), ConstraintCache.Num(), 3);
+	TestEqual(TEXT("An equal constraint finds the cached entry"), ConstraintCache.FindRef(MakeRadiusAndLevelConstraint(200.0, 10000)), 2);
+
+	return true;
+}
+
+INTEREST_TEST(GIVEN_interests_built_in_a_different_order_WHEN_compared_THEN_only_query_changes_make_them_different)
+{
+	// GIVEN
+	const Interest Original = MakeInterest(10000, 10.f);
+
+	Interest Reordered;
+	Reordered.ComponentInterestMap.Add(SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID, Original.ComponentInterestMap[SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID]);
+	Reordered.ComponentInterestMap.Add(SpatialConstants::POSITION_COMPONENT_ID, Original.ComponentInterestMap[SpatialConstants::POSITION_COMPONENT_ID]);
+
+	// WHEN
+	const Interest DifferentFrequency = MakeInterest(10000, 5.f);
+	const Interest DifferentLevel = MakeInterest(10001, 10.f);
+
+	// THEN
+	TestTrue(TEXT("Component interest order doesn't matter"), Original == Reordered);
+	TestTrue(TEXT("A different query frequency is a change"), Original != DifferentFrequency);
+	TestTrue(TEXT("A different level constraint is a change"), Original != DifferentLevel);
+
+	return true;
+}
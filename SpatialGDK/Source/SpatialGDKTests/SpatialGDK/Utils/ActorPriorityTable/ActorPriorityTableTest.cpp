@@ -0,0 +1,228 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/ActorPriorityTable.h"
+
+#include "GameFramework/WorldSettings.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+
+#define ACTORPRIORITYTABLE_TEST(TestName) \
+	GDK_TEST(Core, FActorPriorityTable, TestName)
+
+#define ACTORPRIORITYTABLE_BENCHMARK(TestName) \
+	GDK_SLOW_TEST(Core, FActorPriorityTable, TestName)
+
+DEFINE_LOG_CATEGORY_STATIC(LogActorPriorityTableTest, Log, All);
+
+using namespace SpatialGDK;
+
+namespace
+{
+const double TestElapsedTime = 10.0;
+const float TestSpawnPrioritySeconds = 1.0f;
+
+FNetViewer MakeViewer(const FVector& Location, const FVector& Direction)
+{
+	FNetViewer Viewer;
+	Viewer.ViewLocation = Location;
+	Viewer.ViewDir = Direction;
+	return Viewer;
+}
+
+int32 ToPriority(float NetPriority, float Time)
+{
+	return FMath::RoundToInt(65536.0f * NetPriority * Time);
+}
+
+// Stands in for an actor: heap allocated, with its priority computed through a virtual call as AActor::GetNetPriority is.
+class FSyntheticActor
+{
+public:
+	virtual ~FSyntheticActor() = default;
+
+	virtual float GetNetPriority(const FVector& ViewPos, const FVector& ViewDir, float Time) const
+	{
+		const FVector Dir = Location - ViewPos;
+		const float DistSq = Dir.SizeSquared();
+		if ((ViewDir | Dir) < 0.f)
+		{
+			if (DistSq > 2000.f * 2000.f)
+			{
+				Time *= 0.2f;
+			}
+			else if (DistSq > 500.f * 500.f)
+			{
+				Time *= 0.4f;
+			}
+		}
+		else if (DistSq < 8000.f * 8000.f && FMath::Square(ViewDir | Dir) > 0.5f * DistSq)
+		{
+			Time *= 2.f;
+		}
+		else if (DistSq > 3162.f * 3162.f)
+		{
+			Time *= 0.4f;
+		}
+		return NetPriority * Time;
+	}
+
+	FVector Location;
+	float NetPriority;
+	double LastUpdateTime;
+	// Padding for the rest of the actor state, so actors don't share cache lines as they wouldn't in a real world.
+	uint8 OtherState[512];
+};
+} // anonymous namespace
+
+ACTORPRIORITYTABLE_TEST(GIVEN_rows_around_viewer_WHEN_priorities_computed_THEN_priority_scaled_by_distance_and_direction)
+{
+	// GIVEN
+	FActorPriorityTable Table;
+	const uint8 Flags = FActorPriorityTable::HasChannel;
+	const int32 InFront = Table.AddUnmappedRow();
+	Table.SetRow(InFront, FVector(1000.f, 0.f, 0.f), 1.0f, 8.0, nullptr, Flags);
+	const int32 FarBehind = Table.AddUnmappedRow();
+	Table.SetRow(FarBehind, FVector(-3000.f, 0.f, 0.f), 1.0f, 8.0, nullptr, Flags);
+	const int32 NearBehind = Table.AddUnmappedRow();
+	Table.SetRow(NearBehind, FVector(-1000.f, 0.f, 0.f), 1.0f, 8.0, nullptr, Flags);
+	const int32 FarToTheSide = Table.AddUnmappedRow();
+	Table.SetRow(FarToTheSide, FVector(0.f, 5000.f, 0.f), 1.0f, 8.0, nullptr, Flags);
+	const int32 Hidden = Table.AddUnmappedRow();
+	Table.SetRow(Hidden, FVector(-3000.f, 0.f, 0.f), 1.0f, 8.0, nullptr, Flags | FActorPriorityTable::NoLocation);
+	const int32 NoChannel = Table.AddUnmappedRow();
+	Table.SetRow(NoChannel, FVector(0.f, 0.f, 100.f), 3.0f, 0.0, nullptr, 0);
+
+	const TArray<FNetViewer> Viewers = { MakeViewer(FVector::ZeroVector, FVector(1.f, 0.f, 0.f)) };
+
+	// WHEN
+	const TArray<int32> Rows = { InFront, FarBehind, NearBehind, FarToTheSide, Hidden, NoChannel };
+	TArray<int32> Priorities;
+	Table.ComputePriorities(Rows, Viewers, TestElapsedTime, TestSpawnPrioritySeconds, Priorities);
+
+	// THEN
+	TestEqual(TEXT("Actor looked at has double priority"), Priorities[0], ToPriority(1.0f, 4.0f));
+	TestEqual(TEXT("Actor far behind has a fifth of its priority"), Priorities[1], ToPriority(1.0f, 0.4f));
+	TestEqual(TEXT("Actor near behind has two fifths of its priority"), Priorities[2], ToPriority(1.0f, 0.8f));
+	TestEqual(TEXT("Actor far to the side has two fifths of its priority"), Priorities[3], ToPriority(1.0f, 0.8f));
+	TestEqual(TEXT("Hidden actor ignores its location"), Priorities[4], ToPriority(1.0f, 2.0f));
+	TestEqual(TEXT("Actor without a channel uses the spawn priority time"), Priorities[5], ToPriority(3.0f, TestSpawnPrioritySeconds));
+
+	return true;
+}
+
+ACTORPRIORITYTABLE_TEST(GIVEN_several_viewers_WHEN_priorities_computed_THEN_highest_priority_is_used)
+{
+	// GIVEN
+	FActorPriorityTable Table;
+	const int32 Row = Table.AddUnmappedRow();
+	Table.SetRow(Row, FVector(-3000.f, 0.f, 0.f), 1.0f, 8.0, nullptr, FActorPriorityTable::HasChannel);
+
+	const TArray<FNetViewer> Viewers = {
+		MakeViewer(FVector::ZeroVector, FVector(1.f, 0.f, 0.f)),
+		MakeViewer(FVector::ZeroVector, FVector(-1.f, 0.f, 0.f))
+	};
+
+	// WHEN
+	const TArray<int32> Rows = { Row };
+	TArray<int32> Priorities;
+	Table.ComputePriorities(Rows, Viewers, TestElapsedTime, TestSpawnPrioritySeconds, Priorities);
+
+	// THEN
+	TestEqual(TEXT("Priority is that of the viewer looking at the actor"), Priorities[0], ToPriority(1.0f, 4.0f));
+
+	return true;
+}
+
+ACTORPRIORITYTABLE_BENCHMARK(GIVEN_synthetic_actors_WHEN_prioritized_THEN_report_throughput_against_virtual_calls)
+{
+	const int32 NumFrames = 20;
+	const double FrameTime = 1.0 / 30.0;
+
+	TArray<FNetViewer> Viewers;
+	for (int32 i = 0; i < 4; ++i)
+	{
+		Viewers.Add(MakeViewer(FVector(i * 10000.f, 0.f, 0.f), FVector(0.f, 1.f, 0.f)));
+	}
+
+	for (const int32 NumActors : { 10000, 50000, 100000 })
+	{
+		FRandomStream Random(NumActors);
+
+		// Actors are allocated separately and considered in a shuffled order, as they would be from the network object list.
+		TArray<TUniquePtr<FSyntheticActor>> Actors;
+		TArray<FSyntheticActor*> ConsiderList;
+		for (int32 i = 0; i < NumActors; ++i)
+		{
+			TUniquePtr<FSyntheticActor> Actor = MakeUnique<FSyntheticActor>();
+			Actor->Location = FVector(Random.FRandRange(-5000.f, 35000.f), Random.FRandRange(-20000.f, 20000.f), 0.f);
+			Actor->NetPriority = Random.FRandRange(1.0f, 3.0f);
+			Actor->LastUpdateTime = -Random.FRand();
+			ConsiderList.Add(Actor.Get());
+			Actors.Add(MoveTemp(Actor));
+		}
+		for (int32 i = ConsiderList.Num() - 1; i > 0; --i)
+		{
+			ConsiderList.Swap(i, Random.RandRange(0, i));
+		}
+
+		// Baseline: each actor's priority is computed through a virtual call for every viewer, as FActorPriority does.
+		TArray<int32> BaselinePriorities;
+		double BaselineSeconds;
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+			{
+				const double ElapsedTime = Frame * FrameTime;
+				BaselinePriorities.Reset();
+				for (const FSyntheticActor* Actor : ConsiderList)
+				{
+					const float Time = static_cast<float>(ElapsedTime - Actor->LastUpdateTime);
+					int32 Priority = 0;
+					for (const FNetViewer& Viewer : Viewers)
+					{
+						Priority = FMath::Max<int32>(Priority, FMath::RoundToInt(65536.0f * Actor->GetNetPriority(Viewer.ViewLocation, Viewer.ViewDir, Time)));
+					}
+					BaselinePriorities.Add(Priority);
+				}
+			}
+			BaselineSeconds = FPlatformTime::Seconds() - StartTime;
+		}
+
+		// Table: each actor is read once per frame to refresh its row, then priorities are computed over the columns.
+		FActorPriorityTable Table;
+		TMap<const FSyntheticActor*, int32> ActorToRow;
+		for (const FSyntheticActor* Actor : ConsiderList)
+		{
+			ActorToRow.Add(Actor, Table.AddUnmappedRow());
+		}
+
+		TArray<int32> Rows;
+		TArray<int32> TablePriorities;
+		double TableSeconds;
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+			{
+				const double ElapsedTime = Frame * FrameTime;
+				Rows.Reset();
+				for (const FSyntheticActor* Actor : ConsiderList)
+				{
+					const int32 Row = ActorToRow.FindChecked(Actor);
+					Table.SetRow(Row, Actor->Location, Actor->NetPriority, Actor->LastUpdateTime, nullptr, FActorPriorityTable::HasChannel);
+					Rows.Add(Row);
+				}
+				Table.ComputePriorities(Rows, Viewers, ElapsedTime, TestSpawnPrioritySeconds, TablePriorities);
+			}
+			TableSeconds = FPlatformTime::Seconds() - StartTime;
+		}
+
+		TestTrue(FString::Printf(TEXT("Table priorities match the virtual calls for %d actors"), NumActors), TablePriorities == BaselinePriorities);
+
+		UE_LOG(LogActorPriorityTableTest, Display, TEXT("%d actors, %d viewers. Virtual calls: %.2f ms/frame. FActorPriorityTable: %.2f ms/frame (%.2fx)."),
+			NumActors, Viewers.Num(), BaselineSeconds * 1e3 / NumFrames, TableSeconds * 1e3 / NumFrames, BaselineSeconds / FMath::Max(TableSeconds, SMALL_NUMBER));
+	}
+
+	return true;
+}
@@ -0,0 +1,265 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "HandoverObjectStub.h"
+#include "Interop/SpatialClassInfoManager.h"
+#include "Utils/HandoverLayout.h"
+
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+
+#define HANDOVERLAYOUT_TEST(TestName) \
+	GDK_TEST(Core, FHandoverLayout, TestName)
+
+#define HANDOVERLAYOUT_BENCHMARK(TestName) \
+	GDK_SLOW_TEST(Core, FHandoverLayout, TestName)
+
+DEFINE_LOG_CATEGORY_STATIC(LogHandoverLayoutTest, Log, All);
+
+using namespace SpatialGDK;
+
+namespace
+{
+// Built as USpatialClassInfoManager builds them.
+TArray<FHandoverPropertyInfo> GetHandoverProperties(UClass* Class)
+{
+	TArray<FHandoverPropertyInfo> HandoverProperties;
+	for (TFieldIterator<GDK_PROPERTY(Property)> PropertyIt(Class); PropertyIt; ++PropertyIt)
+	{
+		GDK_PROPERTY(Property)* Property = *PropertyIt;
+		if (Property->PropertyFlags & CPF_Handover)
+		{
+			for (int32 ArrayIdx = 0; ArrayIdx < PropertyIt->ArrayDim; ++ArrayIdx)
+			{
+				FHandoverPropertyInfo HandoverInfo;
+				HandoverInfo.Handle = HandoverProperties.Num() + 1;
+				HandoverInfo.Offset = Property->GetOffset_ForGC() + Property->ElementSize * ArrayIdx;
+				HandoverInfo.ArrayIdx = ArrayIdx;
+				HandoverInfo.Property = Property;
+				HandoverProperties.Add(HandoverInfo);
+			}
+		}
+	}
+	return HandoverProperties;
+}
+
+class FShadowData
+{
+public:
+	FShadowData(const TArray<FHandoverPropertyInfo>& InHandoverProperties, const FHandoverLayout& InLayout)
+		: HandoverProperties(InHandoverProperties)
+		, Layout(InLayout)
+	{
+		Data.AddZeroed(Layout.GetShadowDataSize());
+		for (int32 i = 0; i < HandoverProperties.Num(); ++i)
+		{
+			if (HandoverProperties[i].ArrayIdx == 0)
+			{
+				HandoverProperties[i].Property->InitializeValue(GetValue(i));
+			}
+		}
+	}
+
+	~FShadowData()
+	{
+		for (int32 i = 0; i < HandoverProperties.Num(); ++i)
+		{
+			if (HandoverProperties[i].ArrayIdx == 0)
+			{
+				HandoverProperties[i].Property->DestroyValue(GetValue(i));
+			}
+		}
+	}
+
+	uint8* GetData() { return Data.GetData(); }
+	uint8* GetValue(int32 PropertyIndex) { return Data.GetData() + Layout.GetShadowOffset(PropertyIndex); }
+
+private:
+	const TArray<FHandoverPropertyInfo>& HandoverProperties;
+	const FHandoverLayout& Layout;
+	TArray<uint8> Data;
+};
+
+// The comparison USpatialActorChannel::GetHandoverChangeList did before handover layouts.
+void GetChangesWithIdentical(const TArray<FHandoverPropertyInfo>& HandoverProperties, uint8* ShadowData, const uint8* Object, bool bAllChanged, FHandoverChangeState& OutChanged)
+{
+	uint32 ShadowDataOffset = 0;
+	for (const FHandoverPropertyInfo& PropertyInfo : HandoverProperties)
+	{
+		ShadowDataOffset = Align(ShadowDataOffset, PropertyInfo.Property->GetMinAlignment());
+
+		const uint8* Data = Object + PropertyInfo.Offset;
+		uint8* StoredData = ShadowData + ShadowDataOffset;
+		if (bAllChanged || !PropertyInfo.Property->Identical(StoredData, Data))
+		{
+			OutChanged.Add(PropertyInfo.Handle);
+			PropertyInfo.Property->CopySingleValue(StoredData, Data);
+		}
+		ShadowDataOffset += PropertyInfo.Property->ElementSize;
+	}
+}
+
+void MutateRandomProperty(FRandomStream& Random, UHandoverObjectStub& Object)
+{
+	switch (Random.RandRange(0, 12))
+	{
+	case 0: Object.Health = Random.RandRange(0, 100); break;
+	case 1: Object.Stamina = Random.FRandRange(0.f, 1.f); break;
+	case 2: Object.TargetLocation[Random.RandRange(0, 2)] = Random.FRandRange(-1000.f, 1000.f); break;
+	case 3: Object.Ammo[Random.RandRange(0, 2)] = Random.RandRange(0, 30); break;
+	case 4: Object.bIsBitfieldFlag = !Object.bIsBitfieldFlag; break;
+	case 5: Object.bIsNativeFlag = !Object.bIsNativeFlag; break;
+	case 6: Object.State = static_cast<EHandoverStubEnum>(Random.RandRange(0, 2)); break;
+	case 7: Object.Label = FString::Printf(TEXT("Label%d"), Random.RandRange(0, 3)); break;
+	case 8: Object.Padded.Large = Random.RandRange(0, 3); break;
+	case 9: Object.Score = Random.FRandRange(0.f, 1000.f); break;
+	case 10: Object.Timestamp = Random.RandRange(0, 1000000); break;
+	case 11: Object.Inventory.Add(Random.RandRange(0, 10)); break;
+	default: Object.Facing.Yaw = Random.FRandRange(-180.f, 180.f); break;
+	}
+}
+} // anonymous namespace
+
+HANDOVERLAYOUT_TEST(GIVEN_handover_properties_WHEN_classified_THEN_only_properties_identical_as_memory_are_bitwise_comparable)
+{
+	// GIVEN
+	UClass* Class = UHandoverObjectStub::StaticClass();
+	auto IsBitwiseComparable = [Class](const TCHAR* PropertyName)
+	{
+		return FHandoverLayout::IsBitwiseComparable(Class->FindPropertyByName(PropertyName));
+	};
+
+	// WHEN
+	// THEN
+	TestTrue("Integers are bitwise comparable", IsBitwiseComparable(TEXT("Health")));
+	TestTrue("Floats are bitwise comparable", IsBitwiseComparable(TEXT("Stamina")));
+	TestTrue("Static arrays of integers are bitwise comparable", IsBitwiseComparable(TEXT("Ammo")));
+	TestTrue("Native bools are bitwise comparable", IsBitwiseComparable(TEXT("bIsNativeFlag")));
+	TestTrue("Enums are bitwise comparable", IsBitwiseComparable(TEXT("State")));
+	TestFalse("Bitfield bools are not bitwise comparable", IsBitwiseComparable(TEXT("bIsBitfieldFlag")));
+	TestFalse("Strings are not bitwise comparable", IsBitwiseComparable(TEXT("Label")));
+	TestFalse("Structs with padding are not bitwise comparable", IsBitwiseComparable(TEXT("Padded")));
+	TestFalse("Dynamic arrays are not bitwise comparable", IsBitwiseComparable(TEXT("Inventory")));
+
+	return true;
+}
+
+HANDOVERLAYOUT_TEST(GIVEN_randomly_mutated_objects_WHEN_changes_found_with_layout_THEN_they_match_comparing_with_identical)
+{
+	// GIVEN
+	const TArray<FHandoverPropertyInfo> HandoverProperties = GetHandoverProperties(UHandoverObjectStub::StaticClass());
+	FHandoverLayout Layout;
+	Layout.Init(HandoverProperties);
+
+	FRandomStream Random(42);
+	UHandoverObjectStub* Object = NewObject<UHandoverObjectStub>();
+	FShadowData LayoutShadowData(HandoverProperties, Layout);
+	FShadowData IdenticalShadowData(HandoverProperties, Layout);
+
+	// WHEN
+	for (int32 Tick = 0; Tick < 200; ++Tick)
+	{
+		const bool bAllChanged = Tick == 0;
+		const int32 NumMutations = Random.RandRange(0, 3);
+		for (int32 i = 0; i < NumMutations; ++i)
+		{
+			MutateRandomProperty(Random, *Object);
+		}
+
+		FHandoverChangeState LayoutChanges;
+		Layout.GetChanges(HandoverProperties, LayoutShadowData.GetData(), reinterpret_cast<const uint8*>(Object), bAllChanged, LayoutChanges);
+		FHandoverChangeState IdenticalChanges;
+		GetChangesWithIdentical(HandoverProperties, IdenticalShadowData.GetData(), reinterpret_cast<const uint8*>(Object), bAllChanged, IdenticalChanges);
+
+		// THEN
+		const bool bChangesMatch = LayoutChanges == IdenticalChanges;
+		TestTrue(FString::Printf(TEXT("Changed handles match on tick %d"), Tick), bChangesMatch);
+		if (!bChangesMatch)
+		{
+			break;
+		}
+	}
+
+	for (int32 i = 0; i < HandoverProperties.Num(); ++i)
+	{
+		TestTrue(FString::Printf(TEXT("Shadow data of handle %d matches"), HandoverProperties[i].Handle),
+			HandoverProperties[i].Property->Identical(LayoutShadowData.GetValue(i), IdenticalShadowData.GetValue(i)));
+	}
+
+	return true;
+}
+
+HANDOVERLAYOUT_BENCHMARK(GIVEN_objects_mostly_unchanged_between_ticks_WHEN_changes_found_THEN_report_throughput_against_identical)
+{
+	const int32 NumObjects = 10000;
+	const int32 NumTicks = 100;
+
+	const TArray<FHandoverPropertyInfo> HandoverProperties = GetHandoverProperties(UHandoverObjectStub::StaticClass());
+	FHandoverLayout Layout;
+	Layout.Init(HandoverProperties);
+
+	FRandomStream Random(NumObjects);
+	TArray<UHandoverObjectStub*> Objects;
+	TArray<TUniquePtr<FShadowData>> LayoutShadowData;
+	TArray<TUniquePtr<FShadowData>> IdenticalShadowData;
+	for (int32 i = 0; i < NumObjects; ++i)
+	{
+		UHandoverObjectStub* Object = NewObject<UHandoverObjectStub>();
+		Object->AddToRoot();
+		Objects.Add(Object);
+		LayoutShadowData.Add(MakeUnique<FShadowData>(HandoverProperties, Layout));
+		IdenticalShadowData.Add(MakeUnique<FShadowData>(HandoverProperties, Layout));
+	}
+
+	double LayoutSeconds = 0.0;
+	double IdenticalSeconds = 0.0;
+	int32 NumMismatches = 0;
+	TArray<FHandoverChangeState> LayoutChanges;
+	TArray<FHandoverChangeState> IdenticalChanges;
+	LayoutChanges.SetNum(NumObjects);
+	IdenticalChanges.SetNum(NumObjects);
+	for (int32 Tick = 0; Tick < NumTicks; ++Tick)
+	{
+		// A few percent of objects change some of their handover state each tick.
+		for (int32 i = 0; i < NumObjects / 50; ++i)
+		{
+			MutateRandomProperty(Random, *Objects[Random.RandRange(0, NumObjects - 1)]);
+		}
+
+		const bool bAllChanged = Tick == 0;
+
+		double StartTime = FPlatformTime::Seconds();
+		for (int32 i = 0; i < NumObjects; ++i)
+		{
+			LayoutChanges[i].Reset();
+			Layout.GetChanges(HandoverProperties, LayoutShadowData[i]->GetData(), reinterpret_cast<const uint8*>(Objects[i]), bAllChanged, LayoutChanges[i]);
+		}
+		LayoutSeconds += FPlatformTime::Seconds() - StartTime;
+
+		StartTime = FPlatformTime::Seconds();
+		for (int32 i = 0; i < NumObjects; ++i)
+		{
+			IdenticalChanges[i].Reset();
+			GetChangesWithIdentical(HandoverProperties, IdenticalShadowData[i]->GetData(), reinterpret_cast<const uint8*>(Objects[i]), bAllChanged, IdenticalChanges[i]);
+		}
+		IdenticalSeconds += FPlatformTime::Seconds() - StartTime;
+
+		for (int32 i = 0; i < NumObjects; ++i)
+		{
+			NumMismatches += LayoutChanges[i] == IdenticalChanges[i] ? 0 : 1;
+		}
+	}
+
+	TestEqual("Changed handles match comparing with Identical", NumMismatches, 0);
+
+	UE_LOG(LogHandoverLayoutTest, Display, TEXT("%d objects, %d handover properties, %d ticks. Identical: %.2f ms/tick. FHandoverLayout: %.2f ms/tick (%.2fx)."),
+		NumObjects, HandoverProperties.Num(), NumTicks, IdenticalSeconds * 1e3 / NumTicks, LayoutSeconds * 1e3 / NumTicks, IdenticalSeconds / FMath::Max(LayoutSeconds, SMALL_NUMBER));
+
+	for (UHandoverObjectStub* Object : Objects)
+	{
+		Object->RemoveFromRoot();
+	}
+
+	return true;
+}
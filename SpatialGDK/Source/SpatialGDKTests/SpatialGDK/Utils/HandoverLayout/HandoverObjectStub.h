@@ -0,0 +1,75 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "HandoverObjectStub.generated.h"
+
+UENUM()
+enum class EHandoverStubEnum : uint8
+{
+	First,
+	Second,
+	Third
+};
+
+// Members with padding between them, so it can't be compared as memory.
+USTRUCT()
+struct FHandoverPaddedStruct
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	uint8 Small = 0;
+
+	UPROPERTY()
+	int32 Large = 0;
+};
+
+// Handover properties of the kinds found on gameplay classes, with runs of properties which can be compared as memory
+// broken up by ones which can't.
+UCLASS()
+class UHandoverObjectStub : public UObject
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY(Handover)
+	int32 Health;
+
+	UPROPERTY(Handover)
+	float Stamina;
+
+	UPROPERTY(Handover)
+	FVector TargetLocation;
+
+	UPROPERTY(Handover)
+	int32 Ammo[3];
+
+	UPROPERTY(Handover)
+	uint8 bIsBitfieldFlag : 1;
+
+	UPROPERTY(Handover)
+	bool bIsNativeFlag;
+
+	UPROPERTY(Handover)
+	EHandoverStubEnum State;
+
+	UPROPERTY(Handover)
+	FString Label;
+
+	UPROPERTY(Handover)
+	FHandoverPaddedStruct Padded;
+
+	UPROPERTY(Handover)
+	double Score;
+
+	UPROPERTY(Handover)
+	int64 Timestamp;
+
+	UPROPERTY(Handover)
+	TArray<int32> Inventory;
+
+	UPROPERTY(Handover)
+	FRotator Facing;
+};
@@ -0,0 +1,117 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Interop/Connection/OutgoingMessages.h"
+#include "Utils/MetricsRegistry.h"
+
+#include "Async/ParallelFor.h"
+
+#define METRICSREGISTRY_TEST(TestName) \
+	GDK_TEST(Core, FMetricsRegistry, TestName)
+
+using namespace SpatialGDK;
+
+METRICSREGISTRY_TEST(GIVEN_gauges_and_counters_WHEN_updated_THEN_they_are_reported_as_gauges_with_their_keys)
+{
+	// GIVEN
+	FMetricsRegistry Registry;
+	const FGaugeHandle Gauge = Registry.RegisterGauge(TEXT("unreal_test_gauge"));
+	const FCounterHandle Counter = Registry.RegisterCounter(TEXT("unreal_test_counter"));
+
+	// WHEN
+	Registry.SetGauge(Gauge, 1.5);
+	Registry.SetGauge(Gauge, 2.5);
+	Registry.IncrementCounter(Counter);
+	Registry.IncrementCounter(Counter, 4);
+
+	SpatialMetrics Metrics;
+	Registry.AddToReport(Metrics);
+
+	// THEN
+	TestEqual("Gauge holds the last value", Registry.GetGauge(Gauge), 2.5);
+	TestEqual("Counter holds the total", Registry.GetCounter(Counter), static_cast<int64>(5));
+	TestEqual("Gauges and counters are reported as gauges", Metrics.GaugeMetrics.Num(), 2);
+	TestEqual("No histograms are reported", Metrics.HistogramMetrics.Num(), 0);
+	if (Metrics.GaugeMetrics.Num() == 2)
+	{
+		TestTrue("Gauge is reported with its key", Metrics.GaugeMetrics[0].Key == "unreal_test_gauge");
+		TestEqual("Gauge is reported with its value", Metrics.GaugeMetrics[0].Value, 2.5);
+		TestTrue("Counter is reported with its key", Metrics.GaugeMetrics[1].Key == "unreal_test_counter");
+		TestEqual("Counter is reported with its total", Metrics.GaugeMetrics[1].Value, 5.0);
+	}
+
+	return true;
+}
+
+METRICSREGISTRY_TEST(GIVEN_histogram_WHEN_samples_observed_THEN_cumulative_buckets_and_sum_are_reported)
+{
+	// GIVEN
+	FMetricsRegistry Registry;
+	const double UpperBounds[] = { 1.0, 10.0 };
+	const FHistogramHandle Histogram = Registry.RegisterHistogram(TEXT("unreal_test_histogram"), UpperBounds);
+
+	// WHEN
+	Registry.Observe(Histogram, 0.5);
+	Registry.Observe(Histogram, 1.0);
+	Registry.Observe(Histogram, 5.0);
+	Registry.Observe(Histogram, 100.0);
+
+	SpatialMetrics Metrics;
+	Registry.AddToReport(Metrics);
+
+	// THEN
+	const TArray<uint32> ExpectedBucketCounts = { 2, 1, 1 };
+	TestTrue("Samples are counted in the first bucket they fit in", Registry.GetHistogramBucketCounts(Histogram) == ExpectedBucketCounts);
+	TestEqual("Sum of samples is recorded", Registry.GetHistogramSum(Histogram), 106.5);
+
+	TestEqual("Histogram is reported", Metrics.HistogramMetrics.Num(), 1);
+	if (Metrics.HistogramMetrics.Num() == 1)
+	{
+		const HistogramMetric& Metric = Metrics.HistogramMetrics[0];
+		TestTrue("Histogram is reported with its key", Metric.Key == "unreal_test_histogram");
+		TestEqual("Histogram is reported with its sum", Metric.Sum, 106.5);
+		TestEqual("A bucket without an upper bound is added", Metric.Buckets.Num(), 3);
+		if (Metric.Buckets.Num() == 3)
+		{
+			TestEqual("First bucket has its upper bound", Metric.Buckets[0].UpperBound, 1.0);
+			TestEqual("First bucket counts samples up to its upper bound", Metric.Buckets[0].Samples, static_cast<uint32>(2));
+			TestEqual("Second bucket counts samples up to its upper bound", Metric.Buckets[1].Samples, static_cast<uint32>(3));
+			TestEqual("Last bucket has no upper bound", Metric.Buckets[2].UpperBound, TNumericLimits<double>::Max());
+			TestEqual("Last bucket counts every sample", Metric.Buckets[2].Samples, static_cast<uint32>(4));
+		}
+	}
+
+	return true;
+}
+
+METRICSREGISTRY_TEST(GIVEN_metrics_WHEN_updated_from_many_threads_THEN_no_updates_are_lost)
+{
+	// GIVEN
+	FMetricsRegistry Registry;
+	const FCounterHandle Counter = Registry.RegisterCounter(TEXT("unreal_test_counter"));
+	const double UpperBounds[] = { 1.0 };
+	const FHistogramHandle Histogram = Registry.RegisterHistogram(TEXT("unreal_test_histogram"), UpperBounds);
+
+	const int32 NumTasks = 16;
+	const int32 UpdatesPerTask = 10000;
+
+	// WHEN
+	ParallelFor(NumTasks, [&Registry, Counter, Histogram, UpdatesPerTask](int32 Task)
+	{
+		for (int32 i = 0; i < UpdatesPerTask; i++)
+		{
+			Registry.IncrementCounter(Counter);
+			Registry.Observe(Histogram, (i % 2) == 0 ? 0.5 : 2.0);
+		}
+	});
+
+	// THEN
+	const uint32 HalfOfUpdates = NumTasks * UpdatesPerTask / 2;
+	const TArray<uint32> ExpectedBucketCounts = { HalfOfUpdates, HalfOfUpdates };
+	TestEqual("Every increment is counted", Registry.GetCounter(Counter), static_cast<int64>(NumTasks * UpdatesPerTask));
+	TestTrue("Every sample is counted in its bucket", Registry.GetHistogramBucketCounts(Histogram) == ExpectedBucketCounts);
+	TestEqual("Every sample is added to the sum", Registry.GetHistogramSum(Histogram), HalfOfUpdates * 2.5);
+
+	return true;
+}
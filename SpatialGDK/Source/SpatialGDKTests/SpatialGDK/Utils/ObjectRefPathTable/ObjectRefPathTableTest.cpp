@@ -0,0 +1,147 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "SpatialConstants.h"
+#include "Utils/ObjectRefPathTable.h"
+#include "Utils/SchemaUtils.h"
+
+#include "Algo/Reverse.h"
+
+#define OBJECTREFPATHTABLE_TEST(TestName) \
+	GDK_TEST(Core, FObjectRefPathTable, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+const TArray<FString> TestSourcePaths = {
+	TEXT("/Game/Characters/BP_Character.BP_Character_C"),
+	TEXT("/Game/Maps/Arena"),
+	TEXT("/Game/Maps/Arena.Arena:PersistentLevel"),
+	TEXT("/Script/Engine.StaticMeshComponent")
+};
+
+// Restores the shared table when a test which replaces it is done.
+class FScopedSharedTable
+{
+public:
+	FScopedSharedTable(const TArray<FString>& SourcePaths, bool bInternWrittenPaths)
+		: PreviousTable(FObjectRefPathTable::Get())
+	{
+		FObjectRefPathTable::Get().Init(SourcePaths, bInternWrittenPaths);
+	}
+
+	~FScopedSharedTable()
+	{
+		FObjectRefPathTable::Get() = PreviousTable;
+	}
+
+private:
+	FObjectRefPathTable PreviousTable;
+};
+
+FUnrealObjectRef MakeStablyNamedRef(const FString& Path, const FUnrealObjectRef* Outer = nullptr)
+{
+	FUnrealObjectRef ObjectRef(0, 0);
+	ObjectRef.Path = Path;
+	if (Outer != nullptr)
+	{
+		ObjectRef.Outer = *Outer;
+	}
+	return ObjectRef;
+}
+
+FUnrealObjectRef WriteAndReadObjectRef(const FUnrealObjectRef& ObjectRef, bool& bOutPathWasInterned)
+{
+	Schema_ComponentData* Data = Schema_CreateComponentData();
+	Schema_Object* ComponentObject = Schema_GetComponentDataFields(Data);
+
+	AddObjectRefToSchema(ComponentObject, 1, ObjectRef);
+	const FUnrealObjectRef ReadObjectRef = GetObjectRefFromSchema(ComponentObject, 1);
+
+	Schema_Object* ObjectRefObject = Schema_GetObject(ComponentObject, 1);
+	bOutPathWasInterned = Schema_GetUint32Count(ObjectRefObject, SpatialConstants::UNREAL_OBJECT_REF_INTERNED_PATH_ID) > 0
+		&& Schema_GetBytesCount(ObjectRefObject, SpatialConstants::UNREAL_OBJECT_REF_PATH_ID) == 0;
+
+	Schema_DestroyComponentData(Data);
+	return ReadObjectRef;
+}
+} // anonymous namespace
+
+OBJECTREFPATHTABLE_TEST(GIVEN_source_paths_in_any_order_WHEN_table_initialized_THEN_same_ids_are_assigned_to_each_segment)
+{
+	// GIVEN
+	TArray<FString> ReversedSourcePaths = TestSourcePaths;
+	Algo::Reverse(ReversedSourcePaths);
+
+	// WHEN
+	FObjectRefPathTable Table;
+	Table.Init(TestSourcePaths, true);
+	FObjectRefPathTable ReversedTable;
+	ReversedTable.Init(ReversedSourcePaths, true);
+
+	// THEN
+	const TArray<FString> ExpectedSegments = {
+		TEXT("/Game/Characters/BP_Character"), TEXT("BP_Character_C"), TEXT("/Game/Maps/Arena"), TEXT("Arena"),
+		TEXT("PersistentLevel"), TEXT("/Script/Engine"), TEXT("StaticMeshComponent")
+	};
+	TestEqual("Duplicate segments are interned once", Table.Num(), static_cast<uint32>(ExpectedSegments.Num()));
+	for (const FString& Segment : ExpectedSegments)
+	{
+		const uint32 PathId = Table.FindPathId(Segment);
+		TestTrue(FString::Printf(TEXT("%s is interned"), *Segment), Table.IsValidPathId(PathId));
+		TestEqual(FString::Printf(TEXT("%s has the same ID regardless of source order"), *Segment), PathId, ReversedTable.FindPathId(Segment));
+		TestEqual(FString::Printf(TEXT("%s is resolved from its ID"), *Segment), Table.GetPath(PathId), Segment);
+		TestEqual(FString::Printf(TEXT("%s has a name"), *Segment), Table.GetPathName(PathId), FName(*Segment));
+	}
+	TestEqual("Full paths are not interned", Table.FindPathId(TestSourcePaths[0]), FObjectRefPathTable::InvalidPathId);
+	TestEqual("Paths are matched case sensitively", Table.FindPathId(TEXT("persistentlevel")), FObjectRefPathTable::InvalidPathId);
+
+	return true;
+}
+
+OBJECTREFPATHTABLE_TEST(GIVEN_interning_enabled_WHEN_object_ref_written_to_schema_THEN_interned_paths_are_sent_as_ids_and_read_back)
+{
+	// GIVEN
+	FScopedSharedTable SharedTable(TestSourcePaths, true);
+
+	FUnrealObjectRef PackageRef = MakeStablyNamedRef(TEXT("/Game/Maps/Arena"));
+	PackageRef.bNoLoadOnClient = true;
+	const FUnrealObjectRef LevelRef = MakeStablyNamedRef(TEXT("PersistentLevel"), &PackageRef);
+	const FUnrealObjectRef UnknownRef = MakeStablyNamedRef(TEXT("NotInSchema"), &LevelRef);
+
+	// WHEN
+	bool bPackagePathInterned = false;
+	const FUnrealObjectRef ReadPackageRef = WriteAndReadObjectRef(PackageRef, bPackagePathInterned);
+	bool bUnknownPathInterned = true;
+	const FUnrealObjectRef ReadUnknownRef = WriteAndReadObjectRef(UnknownRef, bUnknownPathInterned);
+
+	// THEN
+	TestTrue("Interned path was sent as an ID", bPackagePathInterned);
+	TestTrue("Object ref with interned path was read back", ReadPackageRef == PackageRef);
+	TestTrue("No load on client was read back", ReadPackageRef.bNoLoadOnClient);
+	TestFalse("Path not in the table was sent as a string", bUnknownPathInterned);
+	TestTrue("Object ref with interned outers was read back", ReadUnknownRef == UnknownRef);
+
+	return true;
+}
+
+OBJECTREFPATHTABLE_TEST(GIVEN_interning_disabled_WHEN_object_ref_written_to_schema_THEN_paths_are_sent_as_strings)
+{
+	// GIVEN
+	FScopedSharedTable SharedTable(TestSourcePaths, false);
+
+	const FUnrealObjectRef PackageRef = MakeStablyNamedRef(TEXT("/Game/Maps/Arena"));
+	const FUnrealObjectRef LevelRef = MakeStablyNamedRef(TEXT("PersistentLevel"), &PackageRef);
+
+	// WHEN
+	bool bPathInterned = true;
+	const FUnrealObjectRef ReadLevelRef = WriteAndReadObjectRef(LevelRef, bPathInterned);
+
+	// THEN
+	TestFalse("Path was sent as a string", bPathInterned);
+	TestTrue("Object ref was read back", ReadLevelRef == LevelRef);
+
+	return true;
+}
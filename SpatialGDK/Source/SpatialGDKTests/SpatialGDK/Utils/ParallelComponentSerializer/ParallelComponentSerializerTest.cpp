@@ -0,0 +1,282 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Interop/SpatialClassInfoManager.h"
+#include "SpatialGDKTests/SpatialGDK/Utils/HandoverLayout/HandoverObjectStub.h"
+#include "Utils/ComponentFactory.h"
+#include "Utils/ParallelComponentSerializer.h"
+#include "Utils/SchemaFieldInfo.h"
+#include "Utils/SchemaUtils.h"
+
+#define PARALLELCOMPONENTSERIALIZER_TEST(TestName) \
+	GDK_TEST(Core, FParallelComponentSerializer, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+const Worker_ComponentId HandoverComponentId = 10000;
+
+// Built as USpatialClassInfoManager builds it, with only a handover component.
+FClassInfo CreateStubClassInfo()
+{
+	FClassInfo Info;
+	Info.Class = UHandoverObjectStub::StaticClass();
+	Info.SchemaComponents[SCHEMA_Handover] = HandoverComponentId;
+
+	for (TFieldIterator<GDK_PROPERTY(Property)> PropertyIt(Info.Class.Get()); PropertyIt; ++PropertyIt)
+	{
+		GDK_PROPERTY(Property)* Property = *PropertyIt;
+		if (Property->PropertyFlags & CPF_Handover)
+		{
+			for (int32 ArrayIdx = 0; ArrayIdx < PropertyIt->ArrayDim; ++ArrayIdx)
+			{
+				FHandoverPropertyInfo HandoverInfo;
+				HandoverInfo.Handle = Info.HandoverProperties.Num() + 1;
+				HandoverInfo.Offset = Property->GetOffset_ForGC() + Property->ElementSize * ArrayIdx;
+				HandoverInfo.ArrayIdx = ArrayIdx;
+				HandoverInfo.Property = Property;
+				HandoverInfo.FieldInfo = GetSchemaFieldInfo(Property);
+				Info.HandoverProperties.Add(HandoverInfo);
+			}
+		}
+	}
+
+	return Info;
+}
+
+uint16 GetHandle(const FClassInfo& Info, const FName& PropertyName)
+{
+	for (const FHandoverPropertyInfo& PropertyInfo : Info.HandoverProperties)
+	{
+		if (PropertyInfo.Property->GetFName() == PropertyName)
+		{
+			return PropertyInfo.Handle;
+		}
+	}
+	check(false);
+	return 0;
+}
+
+// Properties which can be serialized off the game thread.
+FHandoverChangeState GetSafeChanges(const FClassInfo& Info)
+{
+	return {
+		GetHandle(Info, GET_MEMBER_NAME_CHECKED(UHandoverObjectStub, Health)),
+		GetHandle(Info, GET_MEMBER_NAME_CHECKED(UHandoverObjectStub, Label)),
+		GetHandle(Info, GET_MEMBER_NAME_CHECKED(UHandoverObjectStub, Score)),
+		GetHandle(Info, GET_MEMBER_NAME_CHECKED(UHandoverObjectStub, Inventory))
+	};
+}
+
+UHandoverObjectStub* CreateStub(int32 Health)
+{
+	UHandoverObjectStub* Stub = NewObject<UHandoverObjectStub>();
+	Stub->Health = Health;
+	Stub->Label = FString::Printf(TEXT("Stub %d"), Health);
+	Stub->Score = Health * 0.5;
+	Stub->Inventory = { Health, Health + 1, Health + 2 };
+	return Stub;
+}
+
+struct FSentUpdate
+{
+	Worker_EntityId EntityId;
+	FWorkerComponentUpdate Update;
+};
+
+// Owns the updates passed to the send function.
+struct FSentUpdates
+{
+	~FSentUpdates()
+	{
+		for (FSentUpdate& Sent : Updates)
+		{
+			Schema_DestroyComponentUpdate(Sent.Update.schema_type);
+		}
+	}
+
+	auto GetSendFunction()
+	{
+		return [this](Worker_EntityId EntityId, FWorkerComponentUpdate& Update)
+		{
+			Updates.Add(FSentUpdate{ EntityId, Update });
+		};
+	}
+
+	TArray<FSentUpdate> Updates;
+};
+} // anonymous namespace
+
+PARALLELCOMPONENTSERIALIZER_TEST(GIVEN_deferred_changes_WHEN_object_changes_before_flush_THEN_values_at_deferral_are_sent)
+{
+	// GIVEN
+	const FClassInfo Info = CreateStubClassInfo();
+	const FHandoverChangeState Changes = GetSafeChanges(Info);
+	UHandoverObjectStub* Stub = CreateStub(10);
+
+	FParallelComponentSerializer Serializer;
+	Serializer.Init(nullptr, 1);
+	const bool bDeferred = Serializer.TryDefer(Stub, Info, 1, nullptr, &Changes, false);
+
+	// WHEN
+	Stub->Health = 20;
+	Stub->Label = TEXT("Changed");
+	Stub->Inventory.Empty();
+
+	FSentUpdates Sent;
+	auto SendUpdate = Sent.GetSendFunction();
+	Serializer.Flush(SendUpdate);
+
+	// THEN
+	TestTrue("Changes to safe properties are deferred", bDeferred);
+	TestEqual("One update is sent", Sent.Updates.Num(), 1);
+	if (Sent.Updates.Num() == 1)
+	{
+		Schema_Object* Fields = Schema_GetComponentUpdateFields(Sent.Updates[0].Update.schema_type);
+		TestEqual("Health at deferral is sent", Schema_GetInt32(Fields, GetHandle(Info, GET_MEMBER_NAME_CHECKED(UHandoverObjectStub, Health))), 10);
+		TestEqual("Label at deferral is sent", GetStringFromSchema(Fields, GetHandle(Info, GET_MEMBER_NAME_CHECKED(UHandoverObjectStub, Label))), FString(TEXT("Stub 10")));
+		TestEqual("Inventory at deferral is sent", static_cast<int32>(Schema_GetInt32Count(Fields, GetHandle(Info, GET_MEMBER_NAME_CHECKED(UHandoverObjectStub, Inventory)))), 3);
+	}
+
+	return true;
+}
+
+PARALLELCOMPONENTSERIALIZER_TEST(GIVEN_one_changed_property_WHEN_deferred_THEN_only_the_span_around_it_is_copied_and_its_value_is_sent)
+{
+	// GIVEN
+	const FClassInfo Info = CreateStubClassInfo();
+	const uint16 InventoryHandle = GetHandle(Info, GET_MEMBER_NAME_CHECKED(UHandoverObjectStub, Inventory));
+	const FHandoverChangeState Changes = { InventoryHandle };
+	UHandoverObjectStub* Stub = CreateStub(10);
+
+	FParallelComponentSerializer Serializer;
+	Serializer.Init(nullptr, 1);
+
+	// WHEN
+	Serializer.TryDefer(Stub, Info, 1, nullptr, &Changes, false);
+	const int32 SnapshotBytes = Serializer.GetNumSnapshotBytes();
+	Stub->Inventory.Empty();
+
+	FSentUpdates Sent;
+	auto SendUpdate = Sent.GetSendFunction();
+	Serializer.Flush(SendUpdate);
+
+	// THEN
+	TestTrue("Snapshot is smaller than the object", SnapshotBytes < UHandoverObjectStub::StaticClass()->GetPropertiesSize());
+	TestTrue("Snapshot holds the changed property", SnapshotBytes >= static_cast<int32>(sizeof(TArray<int32>)));
+	TestEqual("One update is sent", Sent.Updates.Num(), 1);
+	if (Sent.Updates.Num() == 1)
+	{
+		Schema_Object* Fields = Schema_GetComponentUpdateFields(Sent.Updates[0].Update.schema_type);
+		TestEqual("Inventory at deferral is sent", static_cast<int32>(Schema_GetInt32Count(Fields, InventoryHandle)), 3);
+		TestEqual("Health is not sent", static_cast<int32>(Schema_GetInt32Count(Fields, GetHandle(Info, GET_MEMBER_NAME_CHECKED(UHandoverObjectStub, Health)))), 0);
+	}
+
+	return true;
+}
+
+PARALLELCOMPONENTSERIALIZER_TEST(GIVEN_deferred_changes_WHEN_flushed_THEN_bytes_written_match_serializing_on_the_game_thread)
+{
+	// GIVEN
+	const FClassInfo Info = CreateStubClassInfo();
+	const FHandoverChangeState Changes = GetSafeChanges(Info);
+	UHandoverObjectStub* Stub = CreateStub(10);
+
+	uint32 ExpectedBytesWritten = 0;
+	ComponentFactory UpdateFactory(false, nullptr, nullptr);
+	TArray<FWorkerComponentUpdate> ExpectedUpdates = UpdateFactory.CreateComponentUpdates(Stub, Info, 1, nullptr, &Changes, ExpectedBytesWritten);
+	for (FWorkerComponentUpdate& Update : ExpectedUpdates)
+	{
+		Schema_DestroyComponentUpdate(Update.schema_type);
+	}
+
+	FParallelComponentSerializer Serializer;
+	Serializer.Init(nullptr, 1);
+	Serializer.TryDefer(Stub, Info, 1, nullptr, &Changes, false);
+	Serializer.TryDefer(Stub, Info, 2, nullptr, &Changes, false);
+
+	// WHEN
+	FSentUpdates Sent;
+	auto SendUpdate = Sent.GetSendFunction();
+	const uint32 EntityBytesWritten = Serializer.FlushEntity(1, SendUpdate);
+	const uint32 BytesWritten = Serializer.Flush(SendUpdate);
+
+	// THEN
+	TestTrue("Changes write some bytes", ExpectedBytesWritten > 0);
+	TestEqual("Flushing an entity returns the bytes written for it", EntityBytesWritten, ExpectedBytesWritten);
+	TestEqual("Flush returns the bytes written for every deferred changelist, including flushed entities", BytesWritten, ExpectedBytesWritten * 2);
+	TestEqual("Nothing is left deferred", Serializer.GetNumDeferred(), 0);
+
+	return true;
+}
+
+PARALLELCOMPONENTSERIALIZER_TEST(GIVEN_deferred_changes_for_several_entities_WHEN_one_entity_is_flushed_THEN_it_is_sent_first_and_only_once)
+{
+	// GIVEN
+	const FClassInfo Info = CreateStubClassInfo();
+	const FHandoverChangeState Changes = GetSafeChanges(Info);
+	UHandoverObjectStub* Stub = CreateStub(10);
+
+	FParallelComponentSerializer Serializer;
+	Serializer.Init(nullptr, 1);
+	Serializer.TryDefer(Stub, Info, 1, nullptr, &Changes, false);
+	Serializer.TryDefer(Stub, Info, 2, nullptr, &Changes, false);
+	Serializer.TryDefer(Stub, Info, 3, nullptr, &Changes, false);
+
+	// WHEN
+	FSentUpdates Sent;
+	auto SendUpdate = Sent.GetSendFunction();
+	Serializer.FlushEntity(2, SendUpdate);
+	const int32 NumSentByEntityFlush = Sent.Updates.Num();
+	Serializer.FlushEntity(2, SendUpdate);
+	Serializer.Flush(SendUpdate);
+
+	// THEN
+	TestEqual("Flushing an entity sends its update immediately", NumSentByEntityFlush, 1);
+	TestEqual("Every entity's update is sent once", Sent.Updates.Num(), 3);
+	if (Sent.Updates.Num() == 3)
+	{
+		TestEqual("Flushed entity is sent first", Sent.Updates[0].EntityId, static_cast<Worker_EntityId>(2));
+		TestEqual("Remaining entities are sent in deferral order", Sent.Updates[1].EntityId, static_cast<Worker_EntityId>(1));
+		TestEqual("Remaining entities are sent in deferral order", Sent.Updates[2].EntityId, static_cast<Worker_EntityId>(3));
+	}
+
+	return true;
+}
+
+PARALLELCOMPONENTSERIALIZER_TEST(GIVEN_many_deferred_changes_WHEN_flushed_in_parallel_THEN_updates_are_sent_in_deferral_order)
+{
+	// GIVEN
+	const FClassInfo Info = CreateStubClassInfo();
+	const FHandoverChangeState Changes = GetSafeChanges(Info);
+	const int32 NumObjects = 256;
+
+	TArray<UHandoverObjectStub*> Stubs;
+	FParallelComponentSerializer Serializer;
+	Serializer.Init(nullptr, 1);
+	for (int32 i = 0; i < NumObjects; i++)
+	{
+		Stubs.Add(CreateStub(i));
+		Serializer.TryDefer(Stubs[i], Info, i + 1, nullptr, &Changes, false);
+	}
+
+	// WHEN
+	FSentUpdates Sent;
+	auto SendUpdate = Sent.GetSendFunction();
+	Serializer.Flush(SendUpdate);
+
+	// THEN
+	TestEqual("Every object's update is sent", Sent.Updates.Num(), NumObjects);
+	bool bInOrder = true;
+	for (int32 i = 0; i < Sent.Updates.Num(); i++)
+	{
+		Schema_Object* Fields = Schema_GetComponentUpdateFields(Sent.Updates[i].Update.schema_type);
+		bInOrder &= Sent.Updates[i].EntityId == i + 1;
+		bInOrder &= Schema_GetInt32(Fields, GetHandle(Info, GET_MEMBER_NAME_CHECKED(UHandoverObjectStub, Health))) == i;
+	}
+	TestTrue("Updates are sent in deferral order with their own object's values", bInOrder);
+
+	return true;
+}
@@ -0,0 +1,233 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Interop/SpatialStaticComponentView.h"
+#include "Schema/StandardLibrary.h"
+#include "SpatialConstants.h"
+#include "Tests/TestingComponentViewHelpers.h"
+#include "Utils/PositionHierarchy.h"
+
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+
+#define POSITIONHIERARCHY_TEST(TestName) \
+	GDK_TEST(Core, FPositionHierarchy, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+
+// Stands in for the package map, which assigns entity IDs to actors.
+class FTestEntityIds
+{
+public:
+	void Set(const AActor* Actor, Worker_EntityId EntityId) { EntityIds.Add(Actor, EntityId); }
+
+	Worker_EntityId operator()(const AActor* Actor) const
+	{
+		const Worker_EntityId* EntityId = EntityIds.Find(Actor);
+		return EntityId != nullptr ? *EntityId : SpatialConstants::INVALID_ENTITY_ID;
+	}
+
+private:
+	TMap<const AActor*, Worker_EntityId> EntityIds;
+};
+
+void AddPositionEntity(USpatialStaticComponentView& StaticComponentView, Worker_EntityId EntityId, Worker_Authority Authority)
+{
+	Position EntityPosition(Coordinates{ 0.0, 0.0, 0.0 });
+	TestingComponentViewHelpers::AddEntityComponentToStaticComponentView(StaticComponentView, EntityId, SpatialConstants::POSITION_COMPONENT_ID,
+		EntityPosition.CreatePositionData().schema_type, Authority);
+}
+
+void SetPositionAuthority(USpatialStaticComponentView& StaticComponentView, Worker_EntityId EntityId, Worker_Authority Authority)
+{
+	Worker_AuthorityChangeOp AuthorityChangeOp;
+	AuthorityChangeOp.entity_id = EntityId;
+	AuthorityChangeOp.component_id = SpatialConstants::POSITION_COMPONENT_ID;
+	AuthorityChangeOp.authority = Authority;
+	StaticComponentView.OnAuthorityChange(AuthorityChangeOp);
+}
+
+bool ContainsEntityOnce(const FPositionHierarchy& Hierarchy, Worker_EntityId EntityId)
+{
+	int32 Count = 0;
+	for (const FPositionHierarchy::FEntity& Entity : Hierarchy.GetEntities())
+	{
+		if (Entity.EntityId == EntityId)
+		{
+			Count++;
+		}
+	}
+	return Count == 1;
+}
+
+} // anonymous namespace
+
+POSITIONHIERARCHY_TEST(GIVEN_updated_hierarchy_WHEN_nothing_changes_THEN_entities_are_not_rebuilt)
+{
+	// GIVEN
+	USpatialStaticComponentView* StaticComponentView = NewObject<USpatialStaticComponentView>();
+	FTestEntityIds EntityIds;
+
+	AActor* Root = NewObject<AActor>();
+	AActor* Child = NewObject<AActor>();
+	Child->SetOwner(Root);
+	EntityIds.Set(Root, 1);
+	EntityIds.Set(Child, 2);
+	AddPositionEntity(*StaticComponentView, 1, WORKER_AUTHORITY_AUTHORITATIVE);
+	AddPositionEntity(*StaticComponentView, 2, WORKER_AUTHORITY_AUTHORITATIVE);
+
+	FPositionHierarchy Hierarchy;
+	const bool bFirstUpdateRebuilt = Hierarchy.Update(*Root, EntityIds, *StaticComponentView);
+
+	// WHEN
+	const bool bSecondUpdateRebuilt = Hierarchy.Update(*Root, EntityIds, *StaticComponentView);
+
+	// THEN
+	TestTrue("First update builds the entities", bFirstUpdateRebuilt);
+	TestFalse("Update without changes rebuilds the entities", bSecondUpdateRebuilt);
+	TestEqual("Entities in the hierarchy", Hierarchy.GetEntities().Num(), 2);
+	TestTrue("Root is included", ContainsEntityOnce(Hierarchy, 1));
+	TestTrue("Child is included", ContainsEntityOnce(Hierarchy, 2));
+
+	return true;
+}
+
+POSITIONHIERARCHY_TEST(GIVEN_updated_hierarchy_WHEN_child_attached_and_detached_THEN_entities_are_rebuilt)
+{
+	// GIVEN
+	USpatialStaticComponentView* StaticComponentView = NewObject<USpatialStaticComponentView>();
+	FTestEntityIds EntityIds;
+
+	AActor* Root = NewObject<AActor>();
+	AActor* Child = NewObject<AActor>();
+	EntityIds.Set(Root, 1);
+	EntityIds.Set(Child, 2);
+	AddPositionEntity(*StaticComponentView, 1, WORKER_AUTHORITY_AUTHORITATIVE);
+	AddPositionEntity(*StaticComponentView, 2, WORKER_AUTHORITY_AUTHORITATIVE);
+
+	FPositionHierarchy Hierarchy;
+	Hierarchy.Update(*Root, EntityIds, *StaticComponentView);
+
+	// WHEN
+	Child->SetOwner(Root);
+	const bool bAttachRebuilt = Hierarchy.Update(*Root, EntityIds, *StaticComponentView);
+	const int32 NumEntitiesAfterAttach = Hierarchy.GetEntities().Num();
+
+	Child->SetOwner(nullptr);
+	const bool bDetachRebuilt = Hierarchy.Update(*Root, EntityIds, *StaticComponentView);
+
+	// THEN
+	TestTrue("Attaching a child rebuilds the entities", bAttachRebuilt);
+	TestEqual("Entities after attaching", NumEntitiesAfterAttach, 2);
+	TestTrue("Detaching a child rebuilds the entities", bDetachRebuilt);
+	TestEqual("Entities after detaching", Hierarchy.GetEntities().Num(), 1);
+	TestTrue("Root is still included", ContainsEntityOnce(Hierarchy, 1));
+
+	return true;
+}
+
+POSITIONHIERARCHY_TEST(GIVEN_updated_hierarchy_WHEN_authority_over_an_entity_changes_THEN_only_changes_in_the_hierarchy_rebuild_it)
+{
+	// GIVEN
+	USpatialStaticComponentView* StaticComponentView = NewObject<USpatialStaticComponentView>();
+	FTestEntityIds EntityIds;
+
+	AActor* Root = NewObject<AActor>();
+	AActor* Child = NewObject<AActor>();
+	Child->SetOwner(Root);
+	EntityIds.Set(Root, 1);
+	EntityIds.Set(Child, 2);
+	AddPositionEntity(*StaticComponentView, 1, WORKER_AUTHORITY_AUTHORITATIVE);
+	AddPositionEntity(*StaticComponentView, 2, WORKER_AUTHORITY_AUTHORITATIVE);
+	AddPositionEntity(*StaticComponentView, 3, WORKER_AUTHORITY_AUTHORITATIVE);
+
+	FPositionHierarchy Hierarchy;
+	Hierarchy.Update(*Root, EntityIds, *StaticComponentView);
+
+	// WHEN
+	SetPositionAuthority(*StaticComponentView, 3, WORKER_AUTHORITY_NOT_AUTHORITATIVE);
+	const bool bOtherEntityRebuilt = Hierarchy.Update(*Root, EntityIds, *StaticComponentView);
+
+	SetPositionAuthority(*StaticComponentView, 2, WORKER_AUTHORITY_NOT_AUTHORITATIVE);
+	const bool bChildEntityRebuilt = Hierarchy.Update(*Root, EntityIds, *StaticComponentView);
+
+	// THEN
+	TestFalse("Authority change outside the hierarchy rebuilds the entities", bOtherEntityRebuilt);
+	TestTrue("Authority change in the hierarchy rebuilds the entities", bChildEntityRebuilt);
+	TestEqual("Entities in the hierarchy", Hierarchy.GetEntities().Num(), 2);
+	if (Hierarchy.GetEntities().Num() == 2)
+	{
+		TestTrue("Root is authoritative", Hierarchy.GetEntities()[0].bAuthoritative);
+		TestFalse("Child is authoritative", Hierarchy.GetEntities()[1].bAuthoritative);
+	}
+
+	return true;
+}
+
+POSITIONHIERARCHY_TEST(GIVEN_updated_hierarchy_with_actor_without_entity_WHEN_its_entity_is_created_THEN_entities_are_rebuilt)
+{
+	// GIVEN
+	USpatialStaticComponentView* StaticComponentView = NewObject<USpatialStaticComponentView>();
+	FTestEntityIds EntityIds;
+
+	AActor* Root = NewObject<AActor>();
+	AActor* Child = NewObject<AActor>();
+	Child->SetOwner(Root);
+	EntityIds.Set(Root, 1);
+	AddPositionEntity(*StaticComponentView, 1, WORKER_AUTHORITY_AUTHORITATIVE);
+
+	FPositionHierarchy Hierarchy;
+	Hierarchy.Update(*Root, EntityIds, *StaticComponentView);
+	const bool bChildAuthoritativeBeforeCreation = Hierarchy.GetEntities().Num() == 2 && Hierarchy.GetEntities()[1].bAuthoritative;
+
+	// WHEN
+	EntityIds.Set(Child, 2);
+	AddPositionEntity(*StaticComponentView, 2, WORKER_AUTHORITY_AUTHORITATIVE);
+	const bool bCreationRebuilt = Hierarchy.Update(*Root, EntityIds, *StaticComponentView);
+
+	// THEN
+	TestFalse("Actor without an entity is authoritative", bChildAuthoritativeBeforeCreation);
+	TestTrue("Creating the entity rebuilds the entities", bCreationRebuilt);
+	TestTrue("Created entity is included", ContainsEntityOnce(Hierarchy, 2));
+	if (Hierarchy.GetEntities().Num() == 2)
+	{
+		TestTrue("Created entity is authoritative", Hierarchy.GetEntities()[1].bAuthoritative);
+	}
+
+	return true;
+}
+
+POSITIONHIERARCHY_TEST(GIVEN_player_controller_possessing_pawn_WHEN_updated_THEN_pawn_is_included_once_whether_or_not_it_is_owned)
+{
+	// GIVEN
+	USpatialStaticComponentView* StaticComponentView = NewObject<USpatialStaticComponentView>();
+	FTestEntityIds EntityIds;
+
+	APlayerController* PlayerController = NewObject<APlayerController>();
+	APawn* Pawn = NewObject<APawn>();
+	PlayerController->SetPawn(Pawn);
+	EntityIds.Set(PlayerController, 1);
+	EntityIds.Set(Pawn, 2);
+	AddPositionEntity(*StaticComponentView, 1, WORKER_AUTHORITY_AUTHORITATIVE);
+	AddPositionEntity(*StaticComponentView, 2, WORKER_AUTHORITY_AUTHORITATIVE);
+
+	FPositionHierarchy Hierarchy;
+
+	// WHEN
+	Hierarchy.Update(*PlayerController, EntityIds, *StaticComponentView);
+	const bool bUnownedPawnIncludedOnce = ContainsEntityOnce(Hierarchy, 2);
+
+	Pawn->SetOwner(PlayerController);
+	Hierarchy.Update(*PlayerController, EntityIds, *StaticComponentView);
+
+	// THEN
+	TestTrue("Possessed pawn not owned by the controller is included once", bUnownedPawnIncludedOnce);
+	TestTrue("Possessed pawn owned by the controller is included once", ContainsEntityOnce(Hierarchy, 2));
+	TestEqual("Entities in the hierarchy", Hierarchy.GetEntities().Num(), 2);
+
+	return true;
+}
@@ -215,3 +215,166 @@ RPCCONTAINER_TEST(GIVEN_a_container_with_one_value_WHEN_processing_after_RPCQueu
     return true;
 }
 
+
+RPCCONTAINER_TEST(GIVEN_a_container_with_values_queued_for_two_objects_WHEN_dropped_for_one_THEN_only_its_values_are_dropped)
+{
+    UObjectStub* TargetObject = NewObject<UObjectStub>();
+    UObjectStub* OtherTargetObject = NewObject<UObjectStub>();
+    FPendingRPCParams ParamsReliable = CreateMockParameters(TargetObject, AnySchemaComponentType);
+    FPendingRPCParams ParamsUnreliable = CreateMockParameters(TargetObject, AnyOtherSchemaComponentType);
+    FPendingRPCParams OtherParams = CreateMockParameters(OtherTargetObject, AnySchemaComponentType);
+
+    FRPCContainer RPCs(ERPCQueueType::Send);
+    RPCs.BindProcessingFunction(FProcessRPCDelegate::CreateUObject(TargetObject, &UObjectStub::ProcessRPC));
+
+    RPCs.ProcessOrQueueRPC(ParamsReliable.ObjectRef, ParamsReliable.Type, MoveTemp(ParamsReliable.Payload));
+    RPCs.ProcessOrQueueRPC(ParamsUnreliable.ObjectRef, ParamsUnreliable.Type, MoveTemp(ParamsUnreliable.Payload));
+    RPCs.ProcessOrQueueRPC(OtherParams.ObjectRef, OtherParams.Type, MoveTemp(OtherParams.Payload));
+
+    RPCs.DropForEntity(ParamsReliable.ObjectRef.Entity);
+
+    TestFalse("Has queued RPCs", RPCs.ObjectHasRPCsQueuedOfType(ParamsReliable.ObjectRef.Entity, AnySchemaComponentType));
+    TestFalse("Has queued RPCs", RPCs.ObjectHasRPCsQueuedOfType(ParamsUnreliable.ObjectRef.Entity, AnyOtherSchemaComponentType));
+    TestTrue("Other object has queued RPCs", RPCs.ObjectHasRPCsQueuedOfType(OtherParams.ObjectRef.Entity, AnySchemaComponentType));
+    TestEqual("Queued RPCs", RPCs.GetStats().NumQueuedRPCs, 1u);
+    TestEqual("Pending queues", RPCs.GetStats().NumPendingQueues, 1u);
+
+    return true;
+}
+
+RPCCONTAINER_TEST(GIVEN_a_container_with_queued_values_WHEN_they_are_processed_THEN_their_queue_ages_are_recorded)
+{
+    UObjectDummy* TargetObject = NewObject<UObjectDummy>();
+    FPendingRPCParams Params1 = CreateMockParameters(TargetObject, AnySchemaComponentType);
+    FPendingRPCParams Params2 = CreateMockParameters(TargetObject, AnySchemaComponentType);
+
+    bool bCanProcess = false;
+    FRPCContainer RPCs(ERPCQueueType::Send);
+    RPCs.BindProcessingFunction(FProcessRPCDelegate::CreateLambda([&bCanProcess](const FPendingRPCParams&)
+    {
+        return FRPCErrorInfo{ nullptr, nullptr, bCanProcess ? ERPCResult::Success : ERPCResult::UnresolvedParameters };
+    }));
+
+    RPCs.ProcessOrQueueRPC(Params1.ObjectRef, Params1.Type, MoveTemp(Params1.Payload));
+    RPCs.ProcessOrQueueRPC(Params2.ObjectRef, Params2.Type, MoveTemp(Params2.Payload));
+    TestEqual("Queued RPCs", RPCs.GetStats().NumQueuedRPCs, 2u);
+
+    bCanProcess = true;
+    RPCs.ProcessRPCs();
+
+    uint32 NumRecordedAges = 0;
+    for (uint32 Count : RPCs.GetStats().AgeBucketCounts)
+    {
+        NumRecordedAges += Count;
+    }
+
+    TestFalse("Has queued RPCs", RPCs.ObjectHasRPCsQueuedOfType(Params1.ObjectRef.Entity, AnySchemaComponentType));
+    TestEqual("Queued RPCs", RPCs.GetStats().NumQueuedRPCs, 0u);
+    TestEqual("Pending queues", RPCs.GetStats().NumPendingQueues, 0u);
+    TestEqual("Queue ages recorded", NumRecordedAges, 2u);
+
+    return true;
+}
+
+RPCCONTAINER_TEST(GIVEN_a_container_processing_a_queued_value_WHEN_the_value_drops_its_queue_and_queues_another_THEN_the_new_value_stays_queued)
+{
+    UObjectDummy* TargetObject = NewObject<UObjectDummy>();
+    FPendingRPCParams Params = CreateMockParameters(TargetObject, AnySchemaComponentType);
+    FPendingRPCParams NewParams = CreateMockParameters(TargetObject, AnySchemaComponentType);
+
+    bool bQueueNewValue = false;
+    FRPCContainer RPCs(ERPCQueueType::Send);
+    RPCs.BindProcessingFunction(FProcessRPCDelegate::CreateLambda([&](const FPendingRPCParams&)
+    {
+        if (bQueueNewValue)
+        {
+            // The new value reuses the pool slot of the value being processed, and fails so it is queued.
+            bQueueNewValue = false;
+            RPCs.DropForEntity(Params.ObjectRef.Entity);
+            RPCs.ProcessOrQueueRPC(NewParams.ObjectRef, NewParams.Type, MoveTemp(NewParams.Payload));
+            return FRPCErrorInfo{ nullptr, nullptr, ERPCResult::Success };
+        }
+        return FRPCErrorInfo{ nullptr, nullptr, ERPCResult::UnresolvedParameters };
+    }));
+
+    RPCs.ProcessOrQueueRPC(Params.ObjectRef, Params.Type, MoveTemp(Params.Payload));
+
+    bQueueNewValue = true;
+    RPCs.ProcessRPCs();
+
+    TestTrue("Has queued RPCs", RPCs.ObjectHasRPCsQueuedOfType(Params.ObjectRef.Entity, AnySchemaComponentType));
+    TestEqual("Queued RPCs", RPCs.GetStats().NumQueuedRPCs, 1u);
+    TestEqual("Pending queues", RPCs.GetStats().NumPendingQueues, 1u);
+
+    return true;
+}
+
+RPCCONTAINER_TEST(GIVEN_a_container_with_values_waiting_on_unresolved_refs_WHEN_a_ref_is_resolved_THEN_only_values_waiting_on_it_are_processed)
+{
+	UObjectDummy* TargetObject = NewObject<UObjectDummy>();
+	UObjectDummy* OtherTargetObject = NewObject<UObjectDummy>();
+	FPendingRPCParams Params = CreateMockParameters(TargetObject, AnySchemaComponentType);
+	FPendingRPCParams OtherParams = CreateMockParameters(OtherTargetObject, AnySchemaComponentType);
+	const FUnrealObjectRef ParameterRef(1000, 0);
+	const FUnrealObjectRef OtherParameterRef(1001, 0);
+
+	TSet<FUnrealObjectRef> ResolvedRefs;
+	int32 NumProcessAttempts = 0;
+	FRPCContainer RPCs(ERPCQueueType::Receive);
+	RPCs.BindProcessingFunction(FProcessRPCDelegate::CreateLambda([&](const FPendingRPCParams& PendingParams)
+	{
+		NumProcessAttempts++;
+		const FUnrealObjectRef& WaitingOnRef = PendingParams.ObjectRef == Params.ObjectRef ? ParameterRef : OtherParameterRef;
+		if (ResolvedRefs.Contains(WaitingOnRef))
+		{
+			return FRPCErrorInfo{ nullptr, nullptr, ERPCResult::Success };
+		}
+		FRPCErrorInfo ErrorInfo{ nullptr, nullptr, ERPCResult::UnresolvedParameters };
+		ErrorInfo.UnresolvedRefs.Add(WaitingOnRef);
+		return ErrorInfo;
+	}));
+	RPCs.SetUnresolvedRefsRetryTime(TNumericLimits<float>::Max());
+
+	RPCs.ProcessOrQueueRPC(Params.ObjectRef, Params.Type, MoveTemp(Params.Payload));
+	RPCs.ProcessOrQueueRPC(OtherParams.ObjectRef, OtherParams.Type, MoveTemp(OtherParams.Payload));
+
+	RPCs.ProcessRPCs();
+	TestEqual("Waiting values are not retried by periodic processing", NumProcessAttempts, 2);
+
+	RPCs.ProcessRPCsWaitingOn(FUnrealObjectRef(2000, 0));
+	TestEqual("Resolving a ref nothing waits on processes nothing", NumProcessAttempts, 2);
+
+	ResolvedRefs.Add(ParameterRef);
+	RPCs.ProcessRPCsWaitingOn(ParameterRef);
+
+	TestEqual("Only the value waiting on the resolved ref is processed", NumProcessAttempts, 3);
+	TestFalse("Has queued RPCs", RPCs.ObjectHasRPCsQueuedOfType(Params.ObjectRef.Entity, AnySchemaComponentType));
+	TestTrue("Other object has queued RPCs", RPCs.ObjectHasRPCsQueuedOfType(OtherParams.ObjectRef.Entity, AnySchemaComponentType));
+
+	return true;
+}
+
+RPCCONTAINER_TEST(GIVEN_a_container_with_a_value_waiting_on_an_unresolved_target_WHEN_the_target_is_resolved_THEN_it_is_processed)
+{
+	UObjectDummy* TargetObject = NewObject<UObjectDummy>();
+	FPendingRPCParams Params = CreateMockParameters(TargetObject, AnySchemaComponentType);
+
+	bool bTargetResolved = false;
+	FRPCContainer RPCs(ERPCQueueType::Receive);
+	RPCs.BindProcessingFunction(FProcessRPCDelegate::CreateLambda([&bTargetResolved](const FPendingRPCParams&)
+	{
+		return bTargetResolved ? FRPCErrorInfo{ nullptr, nullptr, ERPCResult::Success } : FRPCErrorInfo{ nullptr, nullptr, ERPCResult::UnresolvedTargetObject };
+	}));
+	RPCs.SetUnresolvedRefsRetryTime(TNumericLimits<float>::Max());
+
+	RPCs.ProcessOrQueueRPC(Params.ObjectRef, Params.Type, MoveTemp(Params.Payload));
+
+	bTargetResolved = true;
+	RPCs.ProcessRPCs();
+	TestTrue("Has queued RPCs before the target is resolved", RPCs.ObjectHasRPCsQueuedOfType(Params.ObjectRef.Entity, AnySchemaComponentType));
+
+	RPCs.ProcessRPCsWaitingOn(Params.ObjectRef);
+	TestFalse("Has queued RPCs", RPCs.ObjectHasRPCsQueuedOfType(Params.ObjectRef.Entity, AnySchemaComponentType));
+
+	return true;
+}
@@ -0,0 +1,59 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "GameFramework/Actor.h"
+
+#include "Utils/GDKPropertyMacros.h"
+#include "Utils/SchemaFieldInfo.h"
+
+#define SCHEMAFIELDINFO_TEST(TestName) \
+	GDK_TEST(Core, FSchemaFieldInfo, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+FSchemaFieldInfo GetActorFieldInfo(const TCHAR* PropertyName)
+{
+	GDK_PROPERTY(Property)* Property = AActor::StaticClass()->FindPropertyByName(PropertyName);
+	check(Property != nullptr);
+	return GetSchemaFieldInfo(Property);
+}
+} // anonymous namespace
+
+SCHEMAFIELDINFO_TEST(GIVEN_scalar_properties_WHEN_field_info_is_computed_THEN_schema_types_match_the_properties)
+{
+	// GIVEN
+	// WHEN
+	const FSchemaFieldInfo HiddenInfo = GetActorFieldInfo(TEXT("bHidden"));
+	const FSchemaFieldInfo OwnerInfo = GetActorFieldInfo(TEXT("Owner"));
+	const FSchemaFieldInfo RemoteRoleInfo = GetActorFieldInfo(TEXT("RemoteRole"));
+	const FSchemaFieldInfo MovementInfo = GetActorFieldInfo(TEXT("ReplicatedMovement"));
+
+	// THEN
+	TestTrue(TEXT("Bool property is a bool field"), HiddenInfo.Type == ESchemaFieldType::Bool);
+	TestTrue(TEXT("Object property is an object field"), OwnerInfo.Type == ESchemaFieldType::Object);
+	TestTrue(TEXT("Enum as byte property is a byte field"), RemoteRoleInfo.Type == ESchemaFieldType::Byte);
+	TestTrue(TEXT("Struct property is a struct field"), MovementInfo.Type == ESchemaFieldType::Struct);
+	TestTrue(TEXT("Scalar fields have no inner property"), HiddenInfo.InnerProperty == nullptr && OwnerInfo.InnerProperty == nullptr);
+
+	return true;
+}
+
+SCHEMAFIELDINFO_TEST(GIVEN_array_property_WHEN_field_info_is_computed_THEN_inner_type_is_resolved)
+{
+	// GIVEN
+	GDK_PROPERTY(Property)* TagsProperty = AActor::StaticClass()->FindPropertyByName(TEXT("Tags"));
+
+	// WHEN
+	const FSchemaFieldInfo TagsInfo = GetSchemaFieldInfo(TagsProperty);
+
+	// THEN
+	TestTrue(TEXT("Array property is an array field"), TagsInfo.Type == ESchemaFieldType::Array);
+	TestTrue(TEXT("Field keeps the array property"), TagsInfo.Property == TagsProperty);
+	TestTrue(TEXT("Inner property is the array element"), TagsInfo.InnerProperty == GDK_CASTFIELD<GDK_PROPERTY(ArrayProperty)>(TagsProperty)->Inner);
+	TestTrue(TEXT("Inner type is resolved"), TagsInfo.InnerType == ESchemaFieldType::Name);
+
+	return true;
+}
@@ -0,0 +1,68 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "EngineClasses/SpatialNetBitWriter.h"
+#include "Utils/SchemaUtils.h"
+
+#define SCHEMAUTILS_TEST(TestName) \
+	GDK_TEST(Core, SchemaUtils, TestName)
+
+using namespace SpatialGDK;
+
+SCHEMAUTILS_TEST(GIVEN_strings_WHEN_added_to_schema_THEN_they_are_stored_as_utf8_and_read_back)
+{
+	// GIVEN
+	const TArray<FString> Strings = {
+		TEXT(""),
+		TEXT("/Game/Maps/Arena"),
+		TEXT("Caf\u00E9 \u6E2C\u8A66")
+	};
+
+	Schema_ComponentData* Data = Schema_CreateComponentData();
+	Schema_Object* ComponentObject = Schema_GetComponentDataFields(Data);
+
+	// WHEN
+	for (const FString& String : Strings)
+	{
+		AddStringToSchema(ComponentObject, 1, String);
+	}
+
+	// THEN
+	TestEqual("Every string was added", Schema_GetBytesCount(ComponentObject, 1), static_cast<uint32>(Strings.Num()));
+	for (int32 i = 0; i < Strings.Num(); ++i)
+	{
+		const FTCHARToUTF8 ExpectedUTF8(*Strings[i]);
+		const uint32 StoredLength = Schema_IndexBytesLength(ComponentObject, 1, i);
+		TestEqual(FString::Printf(TEXT("String %d is stored with its UTF-8 length"), i), StoredLength, static_cast<uint32>(ExpectedUTF8.Length()));
+		TestTrue(FString::Printf(TEXT("String %d is stored as UTF-8"), i),
+			FMemory::Memcmp(Schema_IndexBytes(ComponentObject, 1, i), ExpectedUTF8.Get(), StoredLength) == 0);
+
+		const FString ReadString = IndexStringFromSchema(ComponentObject, 1, i);
+		TestTrue(FString::Printf(TEXT("String %d is read back"), i), ReadString.Equals(Strings[i], ESearchCase::CaseSensitive));
+		TestEqual(FString::Printf(TEXT("String %d is read back with its length"), i), ReadString.Len(), Strings[i].Len());
+	}
+
+	Schema_DestroyComponentData(Data);
+	return true;
+}
+
+SCHEMAUTILS_TEST(GIVEN_net_bit_writer_with_partial_byte_WHEN_bytes_moved_out_THEN_they_match_the_written_data)
+{
+	// GIVEN
+	FSpatialNetBitWriter Writer(nullptr);
+	uint32 Value = 0xDEADBEEF;
+	Writer << Value;
+	uint8 Bit = 1;
+	Writer.SerializeBits(&Bit, 1);
+	const TArray<uint8> ExpectedBytes(Writer.GetData(), Writer.GetNumBytes());
+
+	// WHEN
+	const TArray<uint8> Bytes = Writer.MoveBytes();
+
+	// THEN
+	TestEqual("Moved bytes include the partial byte", Bytes.Num(), 5);
+	TestTrue("Moved bytes match the written data", Bytes == ExpectedBytes);
+
+	return true;
+}